@@ -20,8 +20,14 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/driver/DriverProcessReader.h"
 	"src/onh/driver/DriverBufferUpdater.cpp"
 	"src/onh/driver/ProcessUpdater.h"
+	"src/onh/driver/ProcessChangeNotifier.h"
+	"src/onh/driver/ProcessChangeNotifier.cpp"
 	"src/onh/driver/DriverProcessReader.cpp"
 	"src/onh/driver/DriverUtils.h"
+	"src/onh/driver/ConnectionTable.h"
+	"src/onh/driver/DriverRegistry.h"
+	"src/onh/driver/DriverWriteQueue.h"
+	"src/onh/driver/DriverWriteQueueData.h"
 	"src/onh/driver/SHM/ShmProcessUpdater.cpp"
 	"src/onh/driver/SHM/ShmProcessReader.h"
 	"src/onh/driver/SHM/ShmProcessReader.cpp"
@@ -39,7 +45,10 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/driver/DriverRegisterTypes.h"
 	"src/onh/driver/ProcessReader.h"
 	"src/onh/driver/ProcessReader.cpp"
+	"src/onh/driver/ProcessTagHandle.cpp"
+	"src/onh/driver/ProcessTagHandle.h"
 	"src/onh/driver/DriverUtils.cpp"
+	"src/onh/driver/DriverWriteQueue.cpp"
 	"src/onh/driver/ProcessUtils.cpp"
 	"src/onh/driver/DriverProcessWriter.cpp"
 	"src/onh/driver/Modbus/ModbusUpdater.cpp"
@@ -73,6 +82,15 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/utils/logger/ILogger.h"
 	"src/onh/utils/logger/TextLogger.h"
 	"src/onh/utils/logger/TextLogger.cpp"
+	"src/onh/utils/logger/LogQueue.h"
+	"src/onh/utils/logger/LogQueue.cpp"
+	"src/onh/utils/logger/LogWriter.h"
+	"src/onh/utils/logger/LogWriter.cpp"
+	"src/onh/utils/logger/BinaryLogFormat.h"
+	"src/onh/utils/logger/BinaryLogger.h"
+	"src/onh/utils/logger/BinaryLogger.cpp"
+	"src/onh/utils/logger/BinaryLogDecoder.h"
+	"src/onh/utils/logger/BinaryLogDecoder.cpp"
 	"src/onh/utils/MutexAccess.h"
 	"src/onh/utils/StringUtils.cpp"
 	"src/onh/utils/CycleTime.h"
@@ -82,16 +100,29 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/utils/Exception.h"
 	"src/onh/utils/MutexAccess.cpp"
 	"src/onh/utils/Delay.cpp"
+	"src/onh/utils/PeriodicScheduler.cpp"
+	"src/onh/utils/LatencyHistogram.cpp"
+	"src/onh/utils/ThreadCycleStats.cpp"
+	"src/onh/utils/Clock.cpp"
 	"src/onh/utils/DateUtils.h"
+	"src/onh/utils/Clock.h"
 	"src/onh/utils/GuardDataContainer.h"
 	"src/onh/utils/GuardDataController.h"
+	"src/onh/utils/SnapshotContainer.h"
+	"src/onh/utils/SharedDataStorage.h"
+	"src/onh/utils/SharedDataController.h"
+	"src/onh/utils/SharedDataContainer.h"
 	"src/onh/utils/MutexContainer.cpp"
 	"src/onh/utils/Delay.h"
+	"src/onh/utils/PeriodicScheduler.h"
+	"src/onh/utils/LatencyHistogram.h"
+	"src/onh/utils/ThreadCycleStats.h"
 	"src/onh/db/TagLoggerDB.cpp"
 	"src/onh/db/DBManager.cpp"
 	"src/onh/db/DBManager.h"
 	"src/onh/db/ScriptDB.cpp"
 	"src/onh/db/DBResult.cpp"
+	"src/onh/db/DBStatement.cpp"
 	"src/onh/db/ScriptDB.h"
 	"src/onh/db/DB.h"
 	"src/onh/db/ParserDB.cpp"
@@ -100,6 +131,12 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/db/TagLoggerDB.h"
 	"src/onh/db/ParserDB.h"
 	"src/onh/db/DBResult.h"
+	"src/onh/db/DBStatement.h"
+	"src/onh/db/DBRowDecoder.h"
+	"src/onh/db/DBExecutor.cpp"
+	"src/onh/db/DBExecutor.h"
+	"src/onh/db/DBExecutorContext.cpp"
+	"src/onh/db/DBExecutorContext.h"
 	"src/onh/db/DB.cpp"
 	"src/onh/db/AlarmingDB.cpp"
 	"src/onh/db/Config.cpp"
@@ -119,11 +156,17 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/db/objs/AlarmDefinitionItem.cpp"
 	"src/onh/db/objs/Tag.h"
 	"src/onh/db/objs/ScriptException.cpp"
+	"src/onh/db/objs/ConfigSnapshot.h"
+	"src/onh/db/objs/ConfigSnapshot.cpp"
 	"src/onh/db/AlarmingDB.h"
 	"src/onh/db/DBException.cpp"
 	"src/onh/db/DBException.h"
 	"src/onh/thread/DriverPolling/DriverPollingProg.h"
 	"src/onh/thread/DriverPolling/DriverPollingProg.cpp"
+	"src/onh/thread/DriverWriter/DriverWriterProg.h"
+	"src/onh/thread/DriverWriter/DriverWriterProg.cpp"
+	"src/onh/thread/DBExecutor/DBExecutorProg.h"
+	"src/onh/thread/DBExecutor/DBExecutorProg.cpp"
 	"src/onh/thread/ThreadSocket.cpp"
 	"src/onh/thread/ThreadExitData.h"
 	"src/onh/thread/ThreadCycleControllers.h"
@@ -132,8 +175,17 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/thread/ThreadProgram.cpp"
 	"src/onh/thread/Script/ScriptProg.h"
 	"src/onh/thread/Script/ScriptProg.cpp"
-	"src/onh/thread/Script/ScriptRunner.h"
-	"src/onh/thread/Script/ScriptRunner.cpp"
+	"src/onh/thread/Script/ScriptExecutor.h"
+	"src/onh/thread/Script/ScriptExecutor.cpp"
+	"src/onh/thread/Script/ScriptBytecode.h"
+	"src/onh/thread/Script/ScriptCompiler.h"
+	"src/onh/thread/Script/ScriptCompiler.cpp"
+	"src/onh/thread/Script/ScriptVM.h"
+	"src/onh/thread/Script/ScriptVM.cpp"
+	"src/onh/thread/Script/ScriptEngine.h"
+	"src/onh/thread/Script/ScriptEngine.cpp"
+	"src/onh/thread/Script/ScriptTable.h"
+	"src/onh/thread/Script/ScriptTable.cpp"
 	"src/onh/thread/Alarming/AlarmingProg.cpp"
 	"src/onh/thread/Alarming/AlarmingProg.h"
 	"src/onh/thread/ProcessUpdater/ProcessUpdaterProg.cpp"
@@ -147,6 +199,18 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/thread/Socket/SocketProg.h"
 	"src/onh/parser/IParser.h"
 	"src/onh/parser/IParserCommand.h"
+	"src/onh/parser/CommandTokenizer.h"
+	"src/onh/parser/CommandTokenizer.cpp"
+	"src/onh/parser/CommandDispatcher.h"
+	"src/onh/parser/CommandDispatcher.cpp"
+	"src/onh/parser/ReplyCache.h"
+	"src/onh/parser/ReplyCache.cpp"
+	"src/onh/parser/ParserCommands/GetReplyCacheStatsCommand.h"
+	"src/onh/parser/ParserCommands/GetReplyCacheStatsCommand.cpp"
+	"src/onh/parser/ParserCommands/GetThreadCycleStatsCommand.h"
+	"src/onh/parser/ParserCommands/GetThreadCycleStatsCommand.cpp"
+	"src/onh/parser/ParserCommands/GetLogWriterStatsCommand.h"
+	"src/onh/parser/ParserCommands/GetLogWriterStatsCommand.cpp"
 	"src/onh/parser/ParserCommands/ErrorCommand.h"
 	"src/onh/parser/ParserCommands/ErrorCommand.cpp"
 	"src/onh/parser/ParserCommands/TagErrorCommand.h"
@@ -191,11 +255,15 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/onh/parser/ParserCommands/ExitAppCommand.cpp"
 	"src/onh/parser/ParserCommands/MultiCommand.h"
 	"src/onh/parser/ParserCommands/MultiCommand.cpp"
+	"src/onh/parser/ParserCommands/SubscribeCommand.h"
+	"src/onh/parser/ParserCommands/SubscribeCommand.cpp"
 	"src/onh/parser/CommandList.h"
 	"src/onh/parser/CommandParserException.cpp"
 	"src/onh/parser/CommandParser.cpp"
 	"src/onh/parser/CommandParserException.h"
 	"src/onh/parser/CommandParser.h"
+	"src/onh/parser/TagSubscription.h"
+	"src/onh/parser/TagSubscription.cpp"
 	"src/onh/thread/Socket/Socket.h"
 	"src/onh/thread/Socket/SocketException.cpp"
 	"src/onh/thread/TagLogger/TagLoggerProg.cpp"
@@ -18,6 +18,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <chrono>
+#include <fstream>
 #include <sstream>
 
 #include "appConfig.h"
@@ -30,7 +32,9 @@ Application::Application():
 	drvManager(nullptr),
 	thManager(nullptr),
 	dbManager(nullptr),
-	cfg(nullptr) {
+	cfg(nullptr),
+	appliedConfig(nullptr),
+	restartRequired(false) {
 }
 
 Application::~Application() {
@@ -69,12 +73,79 @@ int Application::start() {
 
 void Application::runThreads() {
 	log->write(LOG_INFO("Starting threads..."));
-	thManager->run();
+	thManager->start();
+
+	// Check reload request till application exit
+	while (!thManager->waitForExit(APP_RELOAD_CHECK_INTERVAL)) {
+		checkReload();
+	}
+
+	thManager->join();
 
 	log->write(LOG_INFO("All threads are closed"));
 	log->write(LOG_INFO("Application closed by: " << thManager->getExitInfo()));
 }
 
+void Application::checkReload() {
+	try {
+		// Reload configuration (one query)
+		cfg->refresh();
+
+		// Restart already requested - flag is left for the restart
+		if (restartRequired || cfg->getIntValue("serverRestart") == 0)
+			return;
+	} catch (std::exception &e) {
+		log->write(LOG_ERROR("Configuration read failed: " << e.what()));
+		return;
+	}
+
+	// Configuration values are applied only during initialization
+	std::vector<std::string> notApplied;
+	for (const std::string& name : appliedConfig->getChangedNames(*cfg->getSnapshot())) {
+		if (name != "serverRestart")
+			notApplied.push_back(name);
+	}
+
+	try {
+		log->write(LOG_INFO("Configuration reload requested"));
+
+		auto start = std::chrono::steady_clock::now();
+
+		// Compare driver connections and create new drivers (running threads are not blocked)
+		driverReloadData rd = drvManager->reload(cfg->getDriverConnections());
+
+		// Stop/start threads of the changed driver connections only
+		thManager->reloadDrivers(rd);
+
+		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()-start);
+
+		log->write(LOG_INFO("Configuration reloaded in " << duration.count() << " ms (driver connections: added "
+							<< rd.added << ", removed " << rd.removed << ", changed " << rd.changed
+							<< ", unchanged " << rd.unchanged << ")"));
+	} catch (std::exception &e) {
+		log->write(LOG_ERROR("Configuration reload failed: " << e.what()));
+	}
+
+	if (notApplied.size()) {
+		std::stringstream s;
+		for (unsigned int i = 0; i < notApplied.size(); ++i)
+			s << ((i)?(", "):("")) << notApplied[i];
+
+		// Restart flag stays set (server restart applies the changes)
+		log->write(LOG_ERROR("Configuration changes not applied (restart required): " << s.str()));
+		restartRequired = true;
+		return;
+	}
+
+	try {
+		// Clear reload flag (failed reload is not repeated till next request)
+		cfg->setValue("serverRestart", 0);
+		appliedConfig = cfg->getSnapshot();
+	} catch (std::exception &e) {
+		log->write(LOG_ERROR(e.what()));
+	}
+}
+
 void Application::initDB() {
 	// Get DB connection data
 	std::ifstream confFile("dbConn.conf");
@@ -103,6 +174,9 @@ void Application::initDB() {
 
 	// Clear restart flag
 	cfg->setValue("serverRestart", 0);
+
+	// Configuration used by the threads (values are read only during initialization)
+	appliedConfig = cfg->getSnapshot();
 }
 
 void Application::initDriver() {
@@ -142,27 +216,37 @@ void Application::initThreadManager() {
 	// Init driver polling thread
 	thManager->initDriverPolling(drvManager->getDriverBufferUpdaters());
 
+	// Init driver writer threads
+	thManager->initDriverWriter(drvManager->getDriverWriteQueues(),
+									cfg->getUIntValue("processUpdateInterval"));
+
+	// Init DB executor threads
+	thManager->initDBExecutor(dbManager->getExecutor(),
+								cfg->getUIntValue("processUpdateInterval"));
+
 	// Init alarming thread
 	thManager->initAlarmingThread(drvManager->getProcessReader(),
 									drvManager->getProcessWriter(),
-									dbManager->getAlarmingDB(),
+									dbManager->getExecutor(),
 									cfg->getUIntValue("alarmingUpdateInterval"));
 
 	// Init tag logger thread
 	thManager->initTagLoggerThread(drvManager->getProcessReader(),
-									dbManager->getTagLoggerDB(),
+									dbManager->getExecutor(),
 									cfg->getUIntValue("tagLoggerUpdateInterval"));
 
 	// Init tag logger writer thread
-	thManager->initTagLoggerWriterThread(dbManager->getTagLoggerWriterDB(),
+	thManager->initTagLoggerWriterThread(dbManager->getExecutor(),
 											cfg->getUIntValue("tagLoggerUpdateInterval"));
 
 	// Init script thread
 	thManager->initScriptThread(drvManager->getProcessReader(),
 								drvManager->getProcessWriter(),
-								dbManager->getScriptDB(),
+								dbManager->getExecutor(),
 								cfg->getUIntValue("scriptSystemUpdateInterval"),
-								cfg->getStringValue("userScriptsPath"));
+								cfg->getStringValue("userScriptsPath"),
+								cfg->getUIntValue("scriptSystemPoolSize", 5),
+								cfg->getUIntValue("scriptSystemTimeout", 0)*1000);
 
 	// Init socket thread
 	thManager->initSocketThread(drvManager->getProcessReader(),
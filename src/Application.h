@@ -29,6 +29,9 @@
 #include "onh/db/Config.h"
 #include "onh/thread/TagLogger/TagLoggerBufferContainer.h"
 
+/// Configuration reload request check interval (milliseconds)
+#define APP_RELOAD_CHECK_INTERVAL 1000
+
 namespace onh {
 
 /**
@@ -81,6 +84,13 @@ class Application {
 		 */
 		void runThreads();
 
+		/**
+		 * Check reload request (serverRestart flag) and reload driver connections
+		 * without stopping the running threads (flag stays set if other configuration
+		 * values changed - they are applied only by the restart)
+		 */
+		void checkReload();
+
 		/// Main program logger
 		std::unique_ptr<ILogger> log;
 
@@ -95,6 +105,12 @@ class Application {
 
 		/// Config DB access
 		std::unique_ptr<Config> cfg;
+
+		/// Configuration used by the running threads
+		ConfigSnapshotPtr appliedConfig;
+
+		/// Configuration changes not applied - restart required
+		bool restartRequired;
 };
 
 }  // namespace onh
@@ -17,200 +17,109 @@
  */
 
 #include "AlarmingDB.h"
-#include <sstream>
 
 namespace onh {
 
 AlarmingDB::AlarmingDB(MYSQL *connDB):
-	DB(connDB) {
+	DB(connDB), tagDecoder(createTagDecoder()), feedbackDecoder(createTagDecoder("fb_")),
+	hwAckDecoder(createTagDecoder("hw_")), alarmDecoder(createAlarmDecoder()) {
 }
 
 AlarmingDB::AlarmingDB(const AlarmingDB &aDB):
-	DB(aDB) {
+	DB(aDB), tagDecoder(aDB.tagDecoder), feedbackDecoder(aDB.feedbackDecoder), hwAckDecoder(aDB.hwAckDecoder),
+	alarmDecoder(aDB.alarmDecoder) {
 }
 
 AlarmingDB::~AlarmingDB() {
 }
 
-std::vector<AlarmDefinitionItem> AlarmingDB::getAlarms(bool enabled) {
-	// Query
-	std::stringstream q;
-	std::string q1;
-	std::stringstream tagIDs;
+DBRowDecoder<AlarmDefinitionItem> AlarmingDB::createAlarmDecoder() {
+	DBRowDecoder<AlarmDefinitionItem> dec;
+
+	dec.field("adid", &AlarmDefinitionItem::setId)
+		.field("adPriority", &AlarmDefinitionItem::setPriority)
+		.field("adMessage", &AlarmDefinitionItem::setMsg)
+		.field("adTrigger", &AlarmDefinitionItem::setTrigger)
+		.field("adAutoAck", &AlarmDefinitionItem::setAutoAck)
+		.field("adActive", &AlarmDefinitionItem::setActive)
+		.field("adPending", &AlarmDefinitionItem::setPending)
+		.field("adEnable", &AlarmDefinitionItem::setEnable);
+
+	// Alarm trigger values (numeric value depends on Tag type - Tag is set before decoding)
+	dec.field("adTriggerB", [](AlarmDefinitionItem &ad, const DBStatement &stmt, unsigned int pos) {
+		AlarmDefinitionItem::triggerValues trVal = ad.getTriggerValues();
+		trVal.binVal = ((stmt.getInt(pos) == 1)?(true):(false));
+		ad.setTriggerValues(trVal);
+	});
+	dec.field("adTriggerN", [](AlarmDefinitionItem &ad, const DBStatement &stmt, unsigned int pos) {
+		AlarmDefinitionItem::triggerValues trVal = ad.getTriggerValues();
+		if (ad.getTag().getType() == TT_INT) {
+			trVal.intVal = stmt.getInt(pos);
+		} else {
+			trVal.dwVal = stmt.getUInt64(pos);
+		}
+		ad.setTriggerValues(trVal);
+	});
+	dec.field("adTriggerR", [](AlarmDefinitionItem &ad, const DBStatement &stmt, unsigned int pos) {
+		AlarmDefinitionItem::triggerValues trVal = ad.getTriggerValues();
+		trVal.realVal = stmt.getReal(pos);
+		ad.setTriggerValues(trVal);
+	});
+
+	return dec;
+}
 
+std::vector<AlarmDefinitionItem> AlarmingDB::getAlarms(bool enabled) {
 	// Return vector
 	std::vector<AlarmDefinitionItem> vAlarms;
 
 	// Return value
 	Tag tg;
-	Tag feedbackNotACK;
-	Tag HWAck;
-	TagType tt;
-	processDataArea ta;
 	AlarmDefinitionItem ad;
 	AlarmDefinitionItem ad_clear;
-	bool feedbackTag = false;
-	bool HWAckTag = false;
-
-	// Prepare query
-	q << "SELECT * FROM alarms_definition ad, tags t, driver_connections dc ";
-	q << "WHERE ad.adtid=t.tid AND t.tConnId=dc.dcId ";
-	q << "AND ad.adEnable=" << ((enabled)?("1"):("0")) << ";";
 
 	try {
-		// Query
-		auto result = executeQuery(q.str());
+		// Prepared query (feedback and HW acknowledgment tags in the same query)
+		DBStatement &stmt = getStatement("SELECT ad.*, t.*, fb.tid AS fb_tid, fb.tConnId AS fb_tConnId, "
+				"fb.tName AS fb_tName, fb.tType AS fb_tType, fb.tArea AS fb_tArea, "
+				"fb.tByteAddress AS fb_tByteAddress, fb.tBitAddress AS fb_tBitAddress, "
+				"hw.tid AS hw_tid, hw.tConnId AS hw_tConnId, hw.tName AS hw_tName, hw.tType AS hw_tType, "
+				"hw.tArea AS hw_tArea, hw.tByteAddress AS hw_tByteAddress, hw.tBitAddress AS hw_tBitAddress "
+				"FROM alarms_definition ad JOIN tags t ON ad.adtid=t.tid JOIN driver_connections dc ON t.tConnId=dc.dcId "
+				"LEFT JOIN (tags fb JOIN driver_connections fbdc ON fb.tConnId=fbdc.dcId) ON ad.adFeedbackNotACK=fb.tid "
+				"LEFT JOIN (tags hw JOIN driver_connections hwdc ON hw.tConnId=hwdc.dcId) ON ad.adHWAck=hw.tid "
+				"WHERE ad.adEnable=?;");
+
+		stmt.bindInt(0, ((enabled)?(1):(0)));
+		stmt.execute();
+
+		// Additional Tags field positions
+		unsigned int feedbackPos = stmt.getFieldPos("fb_tid");
+		unsigned int HWAckPos = stmt.getFieldPos("hw_tid");
 
 		// Read data
-		while (result->nextRow()) {
+		while (stmt.nextRow()) {
 			ad = ad_clear;
 
-			// Tag type
-			tt = (TagType)result->getUInt("tType");
-
-			// Tag area
-			ta = (processDataArea)result->getUInt("tArea");
-
-			// Update tag object values
-			tg.setId(result->getUInt("tid"));
-			tg.setConnId(result->getUInt("tConnId"));
-			tg.setName(result->getString("tName"));
-			tg.setType(tt);
-			tg.setArea(ta);
-			tg.setByteAddress(result->getUInt("tByteAddress"));
-			tg.setBitAddress(result->getUInt("tBitAddress"));
-
-			// Alarm trigger values
-			bool intV = (tg.getType() == TT_INT)?(true):(false);
-			AlarmDefinitionItem::triggerValues trVal;
-			trVal.binVal = ((result->getInt("adTriggerB") == 1)?(true):(false));
-			if (intV) {
-				trVal.intVal = result->getInt("adTriggerN");
-			} else {
-				trVal.dwVal = result->getUInt64("adTriggerN");
-			}
-			trVal.realVal = result->getReal("adTriggerR");
+			// Alarm Tag (needed before decoding trigger values)
+			tagDecoder.decode(stmt, tg);
+			ad.setTag(tg);
 
 			// Alarm item
-			ad.setId(result->getUInt("adid"));
-			ad.setTag(tg);
-			ad.setPriority(result->getUInt("adPriority"));
-			ad.setMsg(result->getString("adMessage"));
-			ad.setTrigger((AlarmDefinitionItem::triggers)result->getUInt("adTrigger"));
-			ad.setTriggerValues(trVal);
-			ad.setAutoAck(((result->getInt("adAutoAck") == 1)?(true):(false)));
-			ad.setActive(((result->getInt("adActive") == 1)?(true):(false)));
-			ad.setPending(((result->getInt("adPending") == 1)?(true):(false)));
+			alarmDecoder.decode(stmt, ad);
 
 			// Check if there is feedback Tag
-			tagIDs.str("");
-			if (!result->isNull("adFeedbackNotACK")) {
-				feedbackTag = true;
-				tagIDs << result->getUInt("adFeedbackNotACK");
+			if (!stmt.isNull(feedbackPos)) {
+				ad.setFeedbackNotAckTag(feedbackDecoder.decode(stmt));
 			}
 
 			// Check if there is HW ack Tag
-			if (!result->isNull("adHWAck")) {
-				HWAckTag = true;
-				if (!feedbackTag)
-					tagIDs << result->getUInt("adHWAck");
-				else
-					tagIDs << ", " << result->getUInt("adHWAck");
+			if (!stmt.isNull(HWAckPos)) {
+				ad.setHWAckTag(hwAckDecoder.decode(stmt));
 			}
 
-			if (tagIDs.str() != "") {
-				tagIDs << ");";
-				q1 = "SELECT * FROM tags t, driver_connections dc ";
-				q1 += "WHERE t.tConnId=dc.dcId AND t.tid IN ( "+tagIDs.str();
-
-				// Call additional query
-				auto result2 = executeQuery(q1);
-
-				if (result2->rowsCount() == 2) {
-					result2->nextRow();
-
-					// Tag type
-					tt = (TagType)result2->getUInt("tType");
-
-					// Tag area
-					ta = (processDataArea)result2->getUInt("tArea");
-
-					// Update tag object values
-					tg.setId(result2->getUInt("tid"));
-					tg.setConnId(result2->getUInt("tConnId"));
-					tg.setName(result2->getString("tName"));
-					tg.setType(tt);
-					tg.setArea(ta);
-					tg.setByteAddress(result2->getUInt("tByteAddress"));
-					tg.setBitAddress(result2->getUInt("tBitAddress"));
-
-					if (tg.getId() == result->getUInt("adFeedbackNotACK")) {
-						feedbackNotACK = tg;
-					} else {
-						HWAck = tg;
-					}
-
-					result2->nextRow();
-
-					// Tag type
-					tt = (TagType)result2->getUInt("tType");
-
-					// Tag area
-					ta = (processDataArea)result2->getUInt("tArea");
-
-					// Update tag object values
-					tg.setId(result2->getUInt("tid"));
-					tg.setConnId(result2->getUInt("tConnId"));
-					tg.setName(result2->getString("tName"));
-					tg.setType(tt);
-					tg.setArea(ta);
-					tg.setByteAddress(result2->getUInt("tByteAddress"));
-					tg.setBitAddress(result2->getUInt("tBitAddress"));
-
-					if (tg.getId() == result->getUInt("adHWAck")) {
-						HWAck = tg;
-					} else {
-						feedbackNotACK = tg;
-					}
-
-				} else if (result2->rowsCount() == 1) {
-					result2->nextRow();
-
-					// Tag type
-					tt = (TagType)result2->getUInt("tType");
-
-					// Tag area
-					ta = (processDataArea)result2->getUInt("tArea");
-
-					// Update tag object values
-					tg.setId(result2->getUInt("tid"));
-					tg.setConnId(result2->getUInt("tConnId"));
-					tg.setName(result2->getString("tName"));
-					tg.setType(tt);
-					tg.setArea(ta);
-					tg.setByteAddress(result2->getUInt("tByteAddress"));
-					tg.setBitAddress(result2->getUInt("tBitAddress"));
-
-					if (feedbackTag)
-						feedbackNotACK = tg;
-					else
-						HWAck = tg;
-				}
-			}
-
-			if (feedbackTag)
-				ad.setFeedbackNotAckTag(feedbackNotACK);
-
-			if (HWAckTag)
-				ad.setHWAckTag(HWAck);
-
-			ad.setEnable(((result->getInt("adEnable") == 1)?(true):(false)));
-
 			// Put into the vector
 			vAlarms.push_back(ad);
-
-			feedbackTag = false;
-			HWAckTag = false;
 		}
 	} catch (DBException &e) {
 		throw Exception(e.what(), "AlarmingDB::getAlarms");
@@ -220,18 +129,14 @@ std::vector<AlarmDefinitionItem> AlarmingDB::getAlarms(bool enabled) {
 }
 
 void AlarmingDB::setAlarm(const AlarmDefinitionItem& alarm) {
-	// Query
-	std::stringstream q;
-
-	// Prepare query
-	q << "INSERT INTO alarms_pending(apid, apadid, ap_active, ap_ack, ";
-	q << "ap_onTimestamp, ap_offTimestamp, ap_ackTimestamp) ";
-	q << "VALUES (NULL, " << alarm.getId() << ", 1, 0, ";
-	q << "CURRENT_TIMESTAMP, NULL, NULL);";
-
 	try {
-		// Query
-		executeSaveQuery(q.str());
+		// Prepared query
+		DBStatement &stmt = getStatement("INSERT INTO alarms_pending(apid, apadid, ap_active, ap_ack, "
+										"ap_onTimestamp, ap_offTimestamp, ap_ackTimestamp) "
+										"VALUES (NULL, ?, 1, 0, CURRENT_TIMESTAMP, NULL, NULL);");
+
+		stmt.bindUInt(0, alarm.getId());
+		stmt.execute();
 	} catch (DBException &e) {
 		throw Exception(e.what(), "AlarmingDB::setAlarm");
 	}
@@ -239,20 +144,14 @@ void AlarmingDB::setAlarm(const AlarmDefinitionItem& alarm) {
 
 void AlarmingDB::updateAlarmState(const AlarmDefinitionItem& alarm,
 		bool state) {
-	// Query
-	std::stringstream q;
-
-	// Prepare query
-	q << "UPDATE alarms_pending ";
-	if (state)
-		q << "SET ap_active=1 ";
-	else
-		q << "SET ap_active=0, ap_offTimestamp=CURRENT_TIMESTAMP ";
-	q << "WHERE apadid=" << alarm.getId() <<";";
-
 	try {
-		// Query
-		executeSaveQuery(q.str());
+		// Prepared query
+		DBStatement &stmt = getStatement((state)?
+				("UPDATE alarms_pending SET ap_active=1 WHERE apadid=?;"):
+				("UPDATE alarms_pending SET ap_active=0, ap_offTimestamp=CURRENT_TIMESTAMP WHERE apadid=?;"));
+
+		stmt.bindUInt(0, alarm.getId());
+		stmt.execute();
 
 		// Check if alarm is auto acknowledgment
 		if (state == 0 && alarm.isAutoAck()) {
@@ -264,32 +163,26 @@ void AlarmingDB::updateAlarmState(const AlarmDefinitionItem& alarm,
 }
 
 void AlarmingDB::ackAlarm(unsigned int apadid) {
-	// Query
-	std::stringstream q;
-
-	// Prepare query
-	q << "UPDATE alarms_pending ";
-	if (apadid == 0) {
-		q << "SET ap_ack=1, ap_ackTimestamp=CURRENT_TIMESTAMP WHERE ap_active=0;";
-	} else {
-		q << "SET ap_ack=1, ap_ackTimestamp=CURRENT_TIMESTAMP ";
-		q << "WHERE ap_active=0 AND apadid=" << apadid << ";";
-	}
-
 	try {
-		// Query 1
-		executeSaveQuery(q.str());
-
-		// Delete acknowledgment alarms
-		q.str("");
-		q << "DELETE FROM alarms_pending WHERE ";
-		if (apadid == 0)
-			q << "ap_ack=1;";
-		else
-			q << "ap_ack=1 AND apadid=" << apadid << ";";
-
-		// Query 2
-		executeSaveQuery(q.str());
+		if (apadid == 0) {
+			// Query 1
+			getStatement("UPDATE alarms_pending SET ap_ack=1, ap_ackTimestamp=CURRENT_TIMESTAMP "
+						"WHERE ap_active=0;").execute();
+
+			// Delete acknowledgment alarms
+			getStatement("DELETE FROM alarms_pending WHERE ap_ack=1;").execute();
+		} else {
+			// Query 1
+			DBStatement &stmtAck = getStatement("UPDATE alarms_pending SET ap_ack=1, ap_ackTimestamp=CURRENT_TIMESTAMP "
+												"WHERE ap_active=0 AND apadid=?;");
+			stmtAck.bindUInt(0, apadid);
+			stmtAck.execute();
+
+			// Delete acknowledgment alarms
+			DBStatement &stmtDel = getStatement("DELETE FROM alarms_pending WHERE ap_ack=1 AND apadid=?;");
+			stmtDel.bindUInt(0, apadid);
+			stmtDel.execute();
+		}
 	} catch (DBException &e) {
 		throw Exception(e.what(), "AlarmingDB::ackAlarm");
 	}
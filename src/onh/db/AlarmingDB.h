@@ -87,6 +87,26 @@ class AlarmingDB: public DB {
 		 * @param apadid Alarm definition identifier (alarm to acknowledge)
 		 */
 		void ackAlarm(unsigned int apadid = 0);
+
+	private:
+		/**
+		 * Create alarm definition row decoder
+		 *
+		 * @return Alarm definition row decoder
+		 */
+		static DBRowDecoder<AlarmDefinitionItem> createAlarmDecoder();
+
+		/// Tag row decoder
+		DBRowDecoder<Tag> tagDecoder;
+
+		/// Feedback not acknowledged Tag row decoder
+		DBRowDecoder<Tag> feedbackDecoder;
+
+		/// HW acknowledgment Tag row decoder
+		DBRowDecoder<Tag> hwAckDecoder;
+
+		/// Alarm definition row decoder
+		DBRowDecoder<AlarmDefinitionItem> alarmDecoder;
 };
 
 }  // namespace onh
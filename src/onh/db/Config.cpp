@@ -17,6 +17,7 @@
  */
 
 #include "Config.h"
+#include <memory>
 #include <sstream>
 #include "../driver/Modbus/modbusmasterCfg.h"
 
@@ -27,85 +28,76 @@ Config::Config(MYSQL *connDB):
 }
 
 Config::Config(const Config &cDB):
-	DB(cDB) {
+	DB(cDB), snapshot(cDB.snapshot) {
 }
 
 Config::~Config() {
 }
 
-std::string Config::getStringValue(const std::string& field) {
-	if (field == "")
-		throw Exception("Field is empty", "Config::getStringValue");
-
-	// Return value
-	std::string val;
+void Config::refresh() {
+	std::shared_ptr<ConfigSnapshot> snap = std::make_shared<ConfigSnapshot>();
 
 	try {
 		// Query
-		auto res = executeQuery("SELECT * FROM configuration WHERE cName='"+field+"'");
+		auto res = executeQuery("SELECT cName, cValue FROM configuration;");
 
 		// Load data
-		res->nextRow();
-
-		// Parse data
-		val = res->getString("cValue");
+		while (res->nextRow()) {
+			snap->add(res->getString("cName"), res->getString("cValue"));
+		}
 	} catch (DBException &e) {
-		std::stringstream s;
-		s << "Config::getStringValue (" << field << ")";
-		throw Exception(e.what(), s.str());
+		throw Exception(e.what(), "Config::refresh");
 	}
 
-	return val;
+	snapshot = snap;
 }
 
-int Config::getIntValue(const std::string& field) {
-	if (field == "")
-		throw Exception("Field is empty", "Config::getIntValue");
+ConfigSnapshotPtr Config::getSnapshot() {
+	if (!snapshot)
+		refresh();
 
-	// Return value
-	int iVal;
+	return snapshot;
+}
 
-	try {
-		// Query
-		auto res = executeQuery("SELECT * FROM configuration WHERE cName='"+field+"'");
+std::string Config::getStringValue(const std::string& field) {
+	if (field == "")
+		throw Exception("Field is empty", "Config::getStringValue");
 
-		// Load data
-		res->nextRow();
+	return getSnapshot()->getString(field);
+}
 
-		// Parse data
-		iVal = res->getInt("cValue");
-	} catch (DBException &e) {
-		std::stringstream s;
-		s << "Config::getIntValue (" << field << ")";
-		throw Exception(e.what(), s.str());
-	}
+int Config::getIntValue(const std::string& field) {
+	if (field == "")
+		throw Exception("Field is empty", "Config::getIntValue");
 
-	return iVal;
+	return getSnapshot()->getInt(field);
 }
 
 unsigned int Config::getUIntValue(const std::string& field) {
 	if (field == "")
 		throw Exception("Field is empty", "Config::getUIntValue");
 
-	// Return value
-	unsigned int iVal;
+	return getSnapshot()->getUInt(field);
+}
 
-	try {
-		// Query
-		auto res = executeQuery("SELECT * FROM configuration WHERE cName='"+field+"'");
+unsigned int Config::getUIntValue(const std::string& field, unsigned int defaultValue) {
+	if (field == "")
+		throw Exception("Field is empty", "Config::getUIntValue");
 
-		// Load data
-		res->nextRow();
+	ConfigSnapshotPtr snap = getSnapshot();
 
-		// Parse data
-		iVal = res->getUInt("cValue");
-	} catch (DBException &e) {
-		std::stringstream s;
-		s << "Config::getUIntValue (" << field << ")";
-		throw Exception(e.what(), s.str());
-	}
+	return (snap->contains(field))?(snap->getUInt(field)):(defaultValue);
+}
+
+void Config::updateSnapshot(const std::string& field, const std::string& val) {
+	// Snapshot not loaded yet - will be read from DB
+	if (!snapshot)
+		return;
+
+	std::shared_ptr<ConfigSnapshot> snap = std::make_shared<ConfigSnapshot>(*snapshot);
+	snap->add(field, val);
 
-	return iVal;
+	snapshot = snap;
 }
 
 void Config::setValue(const std::string& field, int val) {
@@ -124,6 +116,8 @@ void Config::setValue(const std::string& field, int val) {
 		s << "Config::setValue (int) (" << field << ")";
 		throw Exception(e.what(), s.str());
 	}
+
+	updateSnapshot(field, ss.str());
 }
 
 void Config::setValue(const std::string& field, const std::string& val) {
@@ -138,92 +132,43 @@ void Config::setValue(const std::string& field, const std::string& val) {
 		s << "Config::setValue (string) (" << field << ")";
 		throw Exception(e.what(), s.str());
 	}
-}
-
-std::string Config::getShmCfg(unsigned int id) {
-	// No data
-	bool noData = false;
-
-	// Query
-	std::stringstream q;
-
-	// Return value
-	std::string shm = "";
-
-	try {
-		// Prepare query
-		q << "SELECT * FROM driver_shm WHERE dsId = "<< id << ";";
-
-		// Query
-		auto result = executeQuery(q.str());
-
-		if (result->rowsCount() == 1) {
-			// Read data
-			result->nextRow();
 
-			// Get SHM region name
-			shm = result->getString("dsSegment");
-		} else {
-			noData = true;
-		}
-	} catch (DBException &e) {
-		throw Exception(e.what(), "Config::getShmCfg");
-	}
+	updateSnapshot(field, val);
+}
 
-	if (noData)
+std::string Config::getShmCfg(const DBResult& result) {
+	if (result.isNull("dsId"))
 		throw Exception("SHM configuration does not exist in DB", "Config::getShmCfg");
 
-	return shm;
+	// Get SHM region name
+	return result.getString("dsSegment");
 }
 
-modbusM::ModbusCfg Config::getModbusCfg(unsigned int id) {
-	// No data
-	bool noData = false;
-
-	// Query
-	std::stringstream q;
+modbusM::ModbusCfg Config::getModbusCfg(const DBResult& result) {
+	if (result.isNull("dmId"))
+		throw Exception("Modbus configuration does not exist in DB", "Config::getModbusCfg");
 
 	// Return value
 	modbusM::ModbusCfg mb;
 
-	try {
-		// Prepare query
-		q << "SELECT * FROM driver_modbus WHERE dmId = "<< id << ";";
-
-		// Query
-		auto result = executeQuery(q.str());
-
-		if (result->rowsCount() == 1) {
-			// Read data
-			result->nextRow();
-
-			// Get data
-			mb.mode = ((result->getUInt("dmMode") == modbusM::MM_RTU)?(modbusM::MM_RTU):(modbusM::MM_TCP));
-			mb.slaveID = result->getInt("dmSlaveID");
-			mb.registerCount = result->getInt("dmRegCount");
-			mb.polling = result->getUInt("dmPollingInterval");
-
-			if (mb.mode == modbusM::MM_RTU) {
-				mb.RTU_port = result->getString("dmRTU_port");
-				mb.RTU_baud = result->getInt("dmRTU_baud");
-				mb.RTU_parity = result->getString("dmRTU_parity")[0];
-				mb.RTU_dataBit = result->getInt("dmRTU_dataBit");
-				mb.RTU_stopBit = result->getInt("dmRTU_stopBit");
-			} else {
-				mb.TCP_addr = result->getString("dmTCP_addr");
-				mb.TCP_port = result->getInt("dmTCP_port");
-				mb.TCP_use_slaveID = result->getInt("dmTCP_use_slaveID");
-			}
-		} else {
-			noData = true;
-		}
-	} catch (DBException &e) {
-		throw Exception(e.what(), "Config::getModbusCfg");
+	// Get data
+	mb.mode = ((result.getUInt("dmMode") == modbusM::MM_RTU)?(modbusM::MM_RTU):(modbusM::MM_TCP));
+	mb.slaveID = result.getInt("dmSlaveID");
+	mb.registerCount = result.getInt("dmRegCount");
+	mb.polling = result.getUInt("dmPollingInterval");
+
+	if (mb.mode == modbusM::MM_RTU) {
+		mb.RTU_port = result.getString("dmRTU_port");
+		mb.RTU_baud = result.getInt("dmRTU_baud");
+		mb.RTU_parity = result.getString("dmRTU_parity")[0];
+		mb.RTU_dataBit = result.getInt("dmRTU_dataBit");
+		mb.RTU_stopBit = result.getInt("dmRTU_stopBit");
+	} else {
+		mb.TCP_addr = result.getString("dmTCP_addr");
+		mb.TCP_port = result.getInt("dmTCP_port");
+		mb.TCP_use_slaveID = result.getInt("dmTCP_use_slaveID");
 	}
 
-	if (noData)
-		throw Exception("Modbus configuration does not exist in DB", "Config::getModbusCfg");
-
 	return mb;
 }
 
@@ -241,8 +186,11 @@ std::vector<DriverConnection> Config::getDriverConnections(bool enabled) {
 	DriverConnection dc, dcp;
 
 	try {
-		// Prepare query
-		q << "SELECT * FROM driver_connections WHERE dcEnable=" << ((enabled)?("1"):("0")) << ";";
+		// Prepare query (driver configurations in one JOIN)
+		q << "SELECT dc.*, ds.dsId, ds.dsSegment, dm.* FROM driver_connections dc";
+		q << " LEFT JOIN driver_shm ds ON ds.dsId = dc.dcConfigSHM";
+		q << " LEFT JOIN driver_modbus dm ON dm.dmId = dc.dcConfigModbus";
+		q << " WHERE dc.dcEnable=" << ((enabled)?("1"):("0")) << ";";
 
 		// Query
 		auto result = executeQuery(q.str());
@@ -258,9 +206,9 @@ std::vector<DriverConnection> Config::getDriverConnections(bool enabled) {
 			dcp.setEnable(((result->getInt("dcEnable") == 1)?(true):(false)));
 
 			if (dcp.getType() == DriverType::DT_Modbus) {
-				dcp.setModbusCfg(getModbusCfg(result->getUInt("dcConfigModbus")));
+				dcp.setModbusCfg(getModbusCfg(*result));
 			} else {
-				dcp.setShmCfg(getShmCfg(result->getUInt("dcConfigSHM")));
+				dcp.setShmCfg(getShmCfg(*result));
 			}
 
 			// Put into the vector
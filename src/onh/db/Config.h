@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include "objs/DriverConnection.h"
+#include "objs/ConfigSnapshot.h"
 #include "DB.h"
 
 namespace onh {
@@ -31,6 +32,9 @@ class DBManager;
 
 /**
  * Class for read/write application configuration from DB
+ *
+ * Whole configuration table is loaded with one query into immutable
+ * snapshot (on first read or on refresh). Value getters use snapshot.
  */
 class Config: public DB {
 	public:
@@ -51,26 +55,46 @@ class Config: public DB {
 		Config& operator=(const Config&) = delete;
 
 		/**
-		 * Get string value from configuration DB
+		 * Reload configuration snapshot from DB
+		 */
+		void refresh();
+
+		/**
+		 * Get configuration snapshot (loaded from DB if not loaded yet)
+		 *
+		 * @return Configuration snapshot
+		 */
+		ConfigSnapshotPtr getSnapshot();
+
+		/**
+		 * Get string value from configuration snapshot
 		 *
 		 * @param field Configuration name
 		 */
 		std::string getStringValue(const std::string& field);
 
 		/**
-		 * Get int value from configuration DB
+		 * Get int value from configuration snapshot
 		 *
 		 * @param field Configuration name
 		 */
 		int getIntValue(const std::string& field);
 
 		/**
-		 * Get unsigned int value from configuration DB
+		 * Get unsigned int value from configuration snapshot
 		 *
 		 * @param field Configuration name
 		 */
 		unsigned int getUIntValue(const std::string& field);
 
+		/**
+		 * Get unsigned int value from configuration snapshot
+		 *
+		 * @param field Configuration name
+		 * @param defaultValue Value used if configuration does not exist (older DB)
+		 */
+		unsigned int getUIntValue(const std::string& field, unsigned int defaultValue);
+
 		/**
 		 * Set int value in configuration DB
 		 *
@@ -103,25 +127,38 @@ class Config: public DB {
 		explicit Config(MYSQL *connDB);
 
 		/**
-		 * Get SHM driver configuration
+		 * Update value in loaded configuration snapshot (copy on write)
+		 *
+		 * @param field Configuration name
+		 * @param val Configuration value
+		 */
+		void updateSnapshot(const std::string& field, const std::string& val);
+
+		/**
+		 * Get SHM driver configuration from driver connections query row
+		 *
+		 * @param result Query result
 		 *
-		 * @param id SHM driver identifier
 		 * @return SHM driver configuration
 		 */
-		std::string getShmCfg(unsigned int id);
+		std::string getShmCfg(const DBResult& result);
 
 		/**
-		 * Get Modbus driver configuration
+		 * Get Modbus driver configuration from driver connections query row
 		 *
-		 * @param id Modbus driver identifier
-		 * @return Modbus driver identifier
+		 * @param result Query result
+		 *
+		 * @return Modbus driver configuration
 		 */
-		modbusM::ModbusCfg getModbusCfg(unsigned int id);
+		modbusM::ModbusCfg getModbusCfg(const DBResult& result);
 
 		/**
 		 * Check driver connection limit
 		 */
 		void checkDriverConnectionLimit();
+
+		/// Configuration snapshot
+		ConfigSnapshotPtr snapshot;
 };
 
 }  // namespace onh
@@ -76,4 +76,35 @@ void DB::executeSaveQuery(const std::string &q) {
 	}
 }
 
+DBStatement& DB::getStatement(const std::string &q) {
+	auto it = statements.find(q);
+
+	if (it == statements.end()) {
+		if (!conn)
+			throw DBException("Connection not initialized", "DB::getStatement");
+
+		it = statements.emplace(q, DBStatementPtr(new DBStatement(conn, q))).first;
+	}
+
+	return *(it->second);
+}
+
+void DB::clearStatements() {
+	statements.clear();
+}
+
+DBRowDecoder<Tag> DB::createTagDecoder(const std::string &prefix) {
+	DBRowDecoder<Tag> dec;
+
+	dec.field(prefix+"tid", &Tag::setId)
+		.field(prefix+"tConnId", &Tag::setConnId)
+		.field(prefix+"tName", &Tag::setName)
+		.field(prefix+"tType", &Tag::setType)
+		.field(prefix+"tArea", &Tag::setArea)
+		.field(prefix+"tByteAddress", &Tag::setByteAddress)
+		.field(prefix+"tBitAddress", &Tag::setBitAddress);
+
+	return dec;
+}
+
 }  // namespace onh
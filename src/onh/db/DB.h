@@ -20,8 +20,12 @@
 #define ONH_DB_DB_H_
 
 #include <mysql.h>
+#include <map>
 #include <string>
+#include "objs/Tag.h"
 #include "DBResult.h"
+#include "DBStatement.h"
+#include "DBRowDecoder.h"
 
 namespace onh {
 
@@ -76,8 +80,35 @@ class DB {
 		 */
 		void executeSaveQuery(const std::string &q);
 
+		/**
+		 * Get prepared statement (prepared on first use and cached for next calls)
+		 *
+		 * @param q SQL query with '?' parameter markers
+		 *
+		 * @return Reference to the prepared statement
+		 */
+		DBStatement& getStatement(const std::string &q);
+
+		/**
+		 * Release prepared statements (should be called before connection is closed)
+		 */
+		void clearStatements();
+
+		/**
+		 * Create Tag row decoder
+		 *
+		 * @param prefix Tag field names prefix
+		 *
+		 * @return Tag row decoder
+		 */
+		static DBRowDecoder<Tag> createTagDecoder(const std::string &prefix = "");
+
 		/// DB connection instance
 		MYSQL *conn;
+
+	private:
+		/// Prepared statements (key: SQL query) - not shared between copies
+		std::map<std::string, DBStatementPtr> statements;
 };
 
 }  // namespace onh
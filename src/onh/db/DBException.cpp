@@ -35,4 +35,11 @@ DBException::DBException(const std::string& desc, const std::string& fName):
 DBException::~DBException() noexcept {
 }
 
+DBQueueFullException::DBQueueFullException(const std::string& desc, const std::string& fName):
+	DBException(desc, fName) {
+}
+
+DBQueueFullException::~DBQueueFullException() noexcept {
+}
+
 }  // namespace onh
@@ -48,6 +48,22 @@ class DBException: public Exception {
 		virtual ~DBException() noexcept;
 };
 
+/**
+ * Database exception of the work rejected because of the full queue
+ */
+class DBQueueFullException: public DBException {
+	public:
+		/**
+		 * Exception constructor with message and function name
+		 *
+		 * @param desc Exception error
+		 * @param fName Function from which exception was thrown
+		 */
+		DBQueueFullException(const std::string& desc, const std::string& fName);
+
+		virtual ~DBQueueFullException() noexcept;
+};
+
 }  // namespace onh
 
 #endif  // ONH_DB_DBEXCEPTION_H_
@@ -0,0 +1,204 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBExecutor.h"
+#include <chrono>
+
+namespace onh {
+
+DBExecutor::DBExecutor(const std::vector<MYSQL*>& connections, unsigned int capacity):
+	DBExecutor(connections.size(), [&connections](unsigned int worker) {
+		return std::make_unique<DBExecutorContext>(connections[worker]);
+	}, capacity) {
+	conns = connections;
+}
+
+DBExecutor::DBExecutor(unsigned int workers, DBExecutorContextFactory factory, unsigned int capacity):
+	maxSize(capacity), worksCount(0), rejectedCount(0) {
+	if (workers == 0)
+		throw DBException("Missing DB executor connections", "DBExecutor::DBExecutor");
+
+	for (unsigned int i = 0; i < workers; ++i) {
+		contexts.push_back(factory(i));
+	}
+
+	works.resize(workers);
+}
+
+DBExecutor::~DBExecutor() {
+	// Inform callers about not executed works
+	for (auto& q : works) {
+		for (dbWork& w : q) {
+			w.complete(std::make_exception_ptr(DBException("DB executor closed", "DBExecutor::~DBExecutor")));
+		}
+	}
+
+	// Release prepared statements before connections are closed
+	contexts.clear();
+
+	for (MYSQL *conn : conns) {
+		if (conn)
+			mysql_close(conn);
+	}
+}
+
+std::future<void> DBExecutor::write(dbExecutorChannel channel, std::function<void(DBExecutorContext&)> work) {
+	auto done = std::make_shared<std::promise<void>>();
+	std::future<void> ret = done->get_future();
+
+	push(channel, {true,
+		work,
+		[done](std::exception_ptr ex) {
+			if (ex)
+				done->set_exception(ex);
+			else
+				done->set_value();
+		}});
+
+	return ret;
+}
+
+void DBExecutor::push(dbExecutorChannel channel, dbWork&& work) {
+	bool rejected = false;
+
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+
+		if (worksCount >= maxSize) {
+			// Caller control loop is not interrupted - error is passed through the future
+			rejected = true;
+			++rejectedCount;
+		} else {
+			works[channel % works.size()].push_back(std::move(work));
+			++worksCount;
+		}
+	}
+
+	if (rejected) {
+		work.complete(std::make_exception_ptr(DBQueueFullException("DB executor queue is full", "DBExecutor::push")));
+		return;
+	}
+
+	cond.notify_all();
+}
+
+unsigned int DBExecutor::execute(unsigned int worker, unsigned int timeout) {
+	if (worker >= works.size())
+		throw DBException("Invalid worker number", "DBExecutor::execute");
+
+	std::deque<dbWork> batch;
+
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+
+		if (works[worker].empty())
+			cond.wait_for(lock, std::chrono::milliseconds(timeout), [this, worker] { return !works[worker].empty(); });
+
+		batch.swap(works[worker]);
+		worksCount -= batch.size();
+	}
+
+	DBExecutorContext &ctx = *contexts[worker];
+	std::vector<executedWrite> writes;
+
+	for (dbWork& w : batch) {
+		if (w.write) {
+			std::exception_ptr ex;
+
+			try {
+				// Writes one after another are executed in one transaction
+				if (writes.empty())
+					ctx.beginTransaction();
+
+				w.run(ctx);
+			} catch (...) {
+				ex = std::current_exception();
+			}
+
+			writes.push_back(executedWrite(&w, ex));
+		} else {
+			// Read sees all previous writes from the channel
+			commitWrites(ctx, writes);
+
+			w.run(ctx);
+		}
+	}
+
+	commitWrites(ctx, writes);
+
+	return batch.size();
+}
+
+void DBExecutor::commitWrites(DBExecutorContext& ctx, std::vector<executedWrite>& writes) {
+	if (writes.empty())
+		return;
+
+	std::exception_ptr commitEx;
+
+	try {
+		ctx.commitTransaction();
+	} catch (...) {
+		commitEx = std::current_exception();
+	}
+
+	for (executedWrite& w : writes) {
+		w.first->complete((w.second)?(w.second):(commitEx));
+	}
+
+	writes.clear();
+}
+
+unsigned int DBExecutor::getWorkersCount() const {
+	return works.size();
+}
+
+unsigned int DBExecutor::size() const {
+	std::unique_lock<std::mutex> lock(mtx);
+
+	return worksCount;
+}
+
+unsigned long int DBExecutor::getRejectedCount() const {
+	std::unique_lock<std::mutex> lock(mtx);
+
+	return rejectedCount;
+}
+
+unsigned int DBExecutor::checkFinished(std::vector<std::future<void>>& futures) {
+	unsigned int rejected = 0;
+
+	for (auto it = futures.begin(); it != futures.end(); ) {
+		if (it->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+			std::future<void> done = std::move(*it);
+			it = futures.erase(it);
+
+			try {
+				// Re-throw work exception
+				done.get();
+			} catch (DBQueueFullException &e) {
+				rejected++;
+			}
+		} else {
+			++it;
+		}
+	}
+
+	return rejected;
+}
+
+}  // namespace onh
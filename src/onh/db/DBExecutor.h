@@ -0,0 +1,238 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DB_DBEXECUTOR_H_
+#define ONH_DB_DBEXECUTOR_H_
+
+#include <mysql.h>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <functional>
+#include <condition_variable>
+#include "DBExecutorContext.h"
+
+/// Default number of DB executor connections (one worker thread for every connection)
+#define DB_EXECUTOR_CONNECTIONS 2
+
+/// Maximum number of pending works in DB executor
+#define DB_EXECUTOR_CAPACITY 4096
+
+namespace onh {
+
+/**
+ * DB executor channel (works from one channel are executed in order by one worker)
+ */
+typedef enum {
+	DBC_ALARMING = 0,
+	DBC_TAG_LOGGER = 1,
+	DBC_TAG_LOGGER_WRITER = 2,
+	DBC_SCRIPT = 3
+} dbExecutorChannel;
+
+/// DB executor worker context factory (argument: worker number)
+using DBExecutorContextFactory = std::function<std::unique_ptr<DBExecutorContext>(unsigned int)>;
+
+/**
+ * DB executor class
+ *
+ * Bounded queue of the DB works with pool of connections. Control threads
+ * only enqueue works and get results from futures - works are executed by
+ * executor worker threads. Writes queued one after another are executed
+ * in one transaction. Works pushed into the full queue are rejected (error
+ * is passed through the work future).
+ */
+class DBExecutor {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param connections DB connections (one worker for every connection - closed by executor)
+		 * @param capacity Maximum number of pending works
+		 */
+		explicit DBExecutor(const std::vector<MYSQL*>& connections, unsigned int capacity = DB_EXECUTOR_CAPACITY);
+
+		/**
+		 * Constructor with worker contexts from factory
+		 *
+		 * @param workers Number of workers
+		 * @param factory Worker context factory
+		 * @param capacity Maximum number of pending works
+		 */
+		DBExecutor(unsigned int workers, DBExecutorContextFactory factory, unsigned int capacity = DB_EXECUTOR_CAPACITY);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		DBExecutor(const DBExecutor&) = delete;
+
+		virtual ~DBExecutor();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		DBExecutor& operator=(const DBExecutor&) = delete;
+
+		/**
+		 * Enqueue read work (never blocks on the DB)
+		 *
+		 * @param channel Executor channel
+		 * @param work Read work
+		 *
+		 * @return Future with read result
+		 */
+		template <typename R>
+		std::future<R> read(dbExecutorChannel channel, std::function<R(DBExecutorContext&)> work);
+
+		/**
+		 * Enqueue write work (never blocks on the DB)
+		 *
+		 * @param channel Executor channel
+		 * @param work Write work
+		 *
+		 * @return Future ready after write commit
+		 */
+		std::future<void> write(dbExecutorChannel channel, std::function<void(DBExecutorContext&)> work);
+
+		/**
+		 * Execute all pending works of the worker
+		 *
+		 * @param worker Worker number
+		 * @param timeout Maximum time to wait on works (milliseconds)
+		 *
+		 * @return Number of executed works
+		 */
+		unsigned int execute(unsigned int worker, unsigned int timeout);
+
+		/**
+		 * Get number of workers
+		 *
+		 * @return Number of workers
+		 */
+		unsigned int getWorkersCount() const;
+
+		/**
+		 * Get number of pending works
+		 *
+		 * @return Number of pending works
+		 */
+		unsigned int size() const;
+
+		/**
+		 * Get number of the works rejected because of the full queue
+		 *
+		 * @return Number of the rejected works
+		 */
+		unsigned long int getRejectedCount() const;
+
+		/**
+		 * Remove finished works from vector
+		 *
+		 * Work exception is re-thrown, except the rejection of the full
+		 * queue (rejected works are only counted - caller loop is not interrupted).
+		 *
+		 * @param futures Vector with work futures
+		 *
+		 * @return Number of the rejected works
+		 */
+		static unsigned int checkFinished(std::vector<std::future<void>>& futures);
+
+	private:
+		/**
+		 * Pending work structure
+		 */
+		typedef struct {
+			/// Write work flag
+			bool write;
+			/// Execute work (write exception is passed to the caller)
+			std::function<void(DBExecutorContext&)> run;
+			/// Inform waiting caller about work result
+			std::function<void(std::exception_ptr)> complete;
+		} dbWork;
+
+		/// Executed write (waiting on commit) and its exception
+		using executedWrite = std::pair<dbWork*, std::exception_ptr>;
+
+		/**
+		 * Put work into the channel worker queue (work is rejected if queue is full)
+		 *
+		 * @param channel Executor channel
+		 * @param work Work to execute
+		 */
+		void push(dbExecutorChannel channel, dbWork&& work);
+
+		/**
+		 * Commit executed writes and inform waiting callers
+		 *
+		 * @param ctx Worker context
+		 * @param writes Executed writes
+		 */
+		static void commitWrites(DBExecutorContext& ctx, std::vector<executedWrite>& writes);
+
+		/// DB connections
+		std::vector<MYSQL*> conns;
+
+		/// Worker contexts (index: worker number)
+		std::vector<std::unique_ptr<DBExecutorContext>> contexts;
+
+		/// Pending works (index: worker number)
+		std::vector<std::deque<dbWork>> works;
+
+		/// Maximum number of pending works
+		unsigned int maxSize;
+
+		/// Number of pending works
+		unsigned int worksCount;
+
+		/// Number of the rejected works
+		unsigned long int rejectedCount;
+
+		/// Queue mutex
+		mutable std::mutex mtx;
+
+		/// New work condition
+		std::condition_variable cond;
+};
+
+template <typename R>
+std::future<R> DBExecutor::read(dbExecutorChannel channel, std::function<R(DBExecutorContext&)> work) {
+	auto done = std::make_shared<std::promise<R>>();
+	std::future<R> ret = done->get_future();
+
+	push(channel, {false,
+		[done, work](DBExecutorContext &ctx) {
+			try {
+				done->set_value(work(ctx));
+			} catch (...) {
+				done->set_exception(std::current_exception());
+			}
+		},
+		[done](std::exception_ptr ex) {
+			done->set_exception(ex);
+		}});
+
+	return ret;
+}
+
+using DBExecutorPtr = std::shared_ptr<DBExecutor>;
+
+}  // namespace onh
+
+#endif  // ONH_DB_DBEXECUTOR_H_
@@ -0,0 +1,66 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBExecutorContext.h"
+#include <sstream>
+
+namespace onh {
+
+DBExecutorContext::DBExecutorContext(MYSQL *connDB):
+	conn(connDB), alarmingDB(connDB), scriptDB(connDB), tagLoggerDB(connDB) {
+}
+
+DBExecutorContext::~DBExecutorContext() {
+}
+
+AlarmingDB& DBExecutorContext::getAlarmingDB() {
+	return alarmingDB;
+}
+
+ScriptDB& DBExecutorContext::getScriptDB() {
+	return scriptDB;
+}
+
+TagLoggerDB& DBExecutorContext::getTagLoggerDB() {
+	return tagLoggerDB;
+}
+
+void DBExecutorContext::beginTransaction() {
+	if (mysql_autocommit(conn, 0)) {
+		std::stringstream s;
+		s << "Can not start transaction: " << mysql_error(conn);
+		throw DBException(s.str(), "DBExecutorContext::beginTransaction");
+	}
+}
+
+void DBExecutorContext::commitTransaction() {
+	std::string err;
+
+	if (mysql_commit(conn)) {
+		err = mysql_error(conn);
+		mysql_rollback(conn);
+	}
+
+	// Back to auto commit mode
+	mysql_autocommit(conn, 1);
+
+	if (err.length())
+		throw DBException("Can not commit transaction: "+err, "DBExecutorContext::commitTransaction");
+}
+
+}  // namespace onh
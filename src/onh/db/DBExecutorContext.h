@@ -0,0 +1,102 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DB_DBEXECUTORCONTEXT_H_
+#define ONH_DB_DBEXECUTORCONTEXT_H_
+
+#include <mysql.h>
+#include "AlarmingDB.h"
+#include "ScriptDB.h"
+#include "TagLoggerDB.h"
+
+namespace onh {
+
+/**
+ * DB executor worker context (DB objects on one executor connection)
+ *
+ * Context is used only by the executor worker owning the connection.
+ */
+class DBExecutorContext {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param connDB Connection handle
+		 */
+		explicit DBExecutorContext(MYSQL *connDB);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		DBExecutorContext(const DBExecutorContext&) = delete;
+
+		virtual ~DBExecutorContext();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		DBExecutorContext& operator=(const DBExecutorContext&) = delete;
+
+		/**
+		 * Get AlarmingDB object
+		 *
+		 * @return Reference to the AlarmingDB object
+		 */
+		AlarmingDB& getAlarmingDB();
+
+		/**
+		 * Get ScriptDB object
+		 *
+		 * @return Reference to the ScriptDB object
+		 */
+		ScriptDB& getScriptDB();
+
+		/**
+		 * Get TagLoggerDB object
+		 *
+		 * @return Reference to the TagLoggerDB object
+		 */
+		TagLoggerDB& getTagLoggerDB();
+
+		/**
+		 * Start transaction (auto commit disabled)
+		 */
+		virtual void beginTransaction();
+
+		/**
+		 * Commit transaction (auto commit enabled again)
+		 */
+		virtual void commitTransaction();
+
+	private:
+		/// DB connection instance
+		MYSQL *conn;
+
+		/// Alarming DB
+		AlarmingDB alarmingDB;
+
+		/// Script DB
+		ScriptDB scriptDB;
+
+		/// Tag logger DB
+		TagLoggerDB tagLoggerDB;
+};
+
+}  // namespace onh
+
+#endif  // ONH_DB_DBEXECUTORCONTEXT_H_
@@ -22,145 +22,78 @@
 
 namespace onh {
 
-DBManager::DBManager(const std::string& db, const std::string& addr, const std::string& user, const std::string& pass):
-	connDB(0), connAlarming(0), connTagLogger(0), connTagLoggerWriter(0), connScript(0) {
+DBManager::DBManager(const std::string& db,
+						const std::string& addr,
+						const std::string& user,
+						const std::string& pass,
+						unsigned int executorConnections):
+	connDB(0), executor(nullptr) {
 	dbC.db = db;
 	dbC.addr = addr;
 	dbC.user = user;
 	dbC.pass = pass;
 
-	initConnections();
+	initConnections(executorConnections);
 }
 
 DBManager::~DBManager() {
 	if (connDB)
 		mysql_close(connDB);
-	if (connAlarming)
-		mysql_close(connAlarming);
-	if (connTagLogger)
-		mysql_close(connTagLogger);
-	if (connTagLoggerWriter)
-		mysql_close(connTagLoggerWriter);
-	if (connScript)
-		mysql_close(connScript);
 }
 
-void DBManager::initConnections() {
+void DBManager::initConnections(unsigned int executorConnections) {
+	// Create connection for DB manager
+	connDB = createConnection("DB manager");
+
+	// Create connections for DB executor
+	std::vector<MYSQL*> conns;
+
+	try {
+		for (unsigned int i=0; i < executorConnections; ++i) {
+			conns.push_back(createConnection("DB executor"));
+		}
+
+		executor = std::make_shared<DBExecutor>(conns);
+	} catch (Exception &e) {
+		for (MYSQL *conn : conns)
+			mysql_close(conn);
+
+		throw;
+	}
+}
+
+MYSQL* DBManager::createConnection(const std::string& name) {
 	// Initialize structures
-	connDB = mysql_init(NULL);
-	connAlarming = mysql_init(NULL);
-	connTagLogger = mysql_init(NULL);
-	connTagLoggerWriter = mysql_init(NULL);
-	connScript = mysql_init(NULL);
+	MYSQL *conn = mysql_init(NULL);
 
 	// Check initializations
-	if (!connDB)
-		throw Exception("Can not initialize DB structures", "DBManager::initConnections");
-	if (!connAlarming)
-		throw Exception("Can not initialize AlarmingDB structures", "DBManager::initConnections");
-	if (!connTagLogger)
-		throw Exception("Can not initialize TagLoggerDB structures", "DBManager::initConnections");
-	if (!connTagLoggerWriter)
-		throw Exception("Can not initialize TagLoggerWriterDB structures", "DBManager::initConnections");
-	if (!connScript)
-		throw Exception("Can not initialize ScriptDB structures", "DBManager::initConnections");
+	if (!conn)
+		throw Exception("Can not initialize DB structures for "+name, "DBManager::createConnection");
 
 	// Reconnect option
 	bool reconnect = true;
-	if (mysql_options(connDB, MYSQL_OPT_RECONNECT, &reconnect)) {
-		throw Exception("Invalid MySQL option for DB manager", "DBManager::initConnections");
-	}
-	if (mysql_options(connAlarming, MYSQL_OPT_RECONNECT, &reconnect)) {
-		throw Exception("Invalid MySQL option for AlarmingDB", "DBManager::initConnections");
-	}
-	if (mysql_options(connTagLogger, MYSQL_OPT_RECONNECT, &reconnect)) {
-		throw Exception("Invalid MySQL option for TagLoggerDB", "DBManager::initConnections");
-	}
-	if (mysql_options(connTagLoggerWriter, MYSQL_OPT_RECONNECT, &reconnect)) {
-		throw Exception("Invalid MySQL option for TagLoggerWriterDB", "DBManager::initConnections");
-	}
-	if (mysql_options(connScript, MYSQL_OPT_RECONNECT, &reconnect)) {
-		throw Exception("Invalid MySQL option for ScriptDB", "DBManager::initConnections");
+	if (mysql_options(conn, MYSQL_OPT_RECONNECT, &reconnect)) {
+		mysql_close(conn);
+		throw Exception("Invalid MySQL option for "+name, "DBManager::createConnection");
 	}
 
-	// Create connection for DB manager
-	if (!mysql_real_connect(connDB, dbC.addr.c_str(), dbC.user.c_str(), dbC.pass.c_str(), dbC.db.c_str(), 0, NULL, 0)) {
+	// Create connection
+	if (!mysql_real_connect(conn, dbC.addr.c_str(), dbC.user.c_str(), dbC.pass.c_str(), dbC.db.c_str(), 0, NULL, 0)) {
 		std::stringstream s;
-		s << "Can not create connection for DB manager: " << mysql_error(connDB);
-		throw Exception(s.str(), "DBManager::initConnections");
+		s << "Can not create connection for " << name << ": " << mysql_error(conn);
+		mysql_close(conn);
+		throw Exception(s.str(), "DBManager::createConnection");
 	}
-	// Create connection for Alarming DB
-	if (!mysql_real_connect(connAlarming,
-							dbC.addr.c_str(),
-							dbC.user.c_str(),
-							dbC.pass.c_str(),
-							dbC.db.c_str(),
-							0,
-							NULL,
-							0)) {
-		std::stringstream s;
-		s << "Can not create connection for AlarmingDB: " << mysql_error(connAlarming);
-		throw Exception(s.str(), "DBManager::initConnections");
-	}
-	// Create connection for Tag Logger DB
-	if (!mysql_real_connect(connTagLogger,
-							dbC.addr.c_str(),
-							dbC.user.c_str(),
-							dbC.pass.c_str(),
-							dbC.db.c_str(),
-							0,
-							NULL,
-							0)) {
-		std::stringstream s;
-		s << "Can not create connection for TagLoggerDB: " << mysql_error(connTagLogger);
-		throw Exception(s.str(), "DBManager::initConnections");
-	}
-	// Create connection for Tag Logger Writer DB
-	if (!mysql_real_connect(connTagLoggerWriter,
-							dbC.addr.c_str(),
-							dbC.user.c_str(),
-							dbC.pass.c_str(),
-							dbC.db.c_str(),
-							0,
-							NULL,
-							0)) {
-		std::stringstream s;
-		s << "Can not create connection for TagLoggerWriterDB: " << mysql_error(connTagLoggerWriter);
-		throw Exception(s.str(), "DBManager::initConnections");
-	}
-	// Create connection for Script DB
-	if (!mysql_real_connect(connScript,
-							dbC.addr.c_str(),
-							dbC.user.c_str(),
-							dbC.pass.c_str(),
-							dbC.db.c_str(),
-							0,
-							NULL,
-							0)) {
-		std::stringstream s;
-		s << "Can not create connection for ScriptDB: " << mysql_error(connScript);
-		throw Exception(s.str(), "DBManager::initConnections");
-	}
-}
 
-AlarmingDB DBManager::getAlarmingDB() {
-	return AlarmingDB(connAlarming);
+	return conn;
 }
 
 Config DBManager::getConfigDB() {
 	return Config(connDB);
 }
 
-ScriptDB DBManager::getScriptDB() {
-	return ScriptDB(connScript);
-}
-
-TagLoggerDB DBManager::getTagLoggerDB() {
-	return TagLoggerDB(connTagLogger);
-}
-
-TagLoggerDB DBManager::getTagLoggerWriterDB() {
-	return TagLoggerDB(connTagLoggerWriter);
+DBExecutorPtr DBManager::getExecutor() {
+	return executor;
 }
 
 DBCredentials DBManager::getCredentials() {
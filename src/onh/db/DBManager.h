@@ -21,11 +21,9 @@
 
 #include <mysql.h>
 #include <string>
-#include "AlarmingDB.h"
 #include "Config.h"
-#include "ScriptDB.h"
 #include "ParserDB.h"
-#include "TagLoggerDB.h"
+#include "DBExecutor.h"
 #include "DBCredentials.h"
 
 namespace onh {
@@ -41,8 +39,13 @@ class DBManager {
 		 * @param addr DB address
 		 * @param user DB user
 		 * @param pass DB password
+		 * @param executorConnections Number of DB executor connections
 		 */
-		DBManager(const std::string& db, const std::string& addr, const std::string& user, const std::string& pass);
+		DBManager(const std::string& db,
+					const std::string& addr,
+					const std::string& user,
+					const std::string& pass,
+					unsigned int executorConnections = DB_EXECUTOR_CONNECTIONS);
 
 		/**
 		 * Copy constructor - inactive
@@ -56,13 +59,6 @@ class DBManager {
 		 */
 		DBManager& operator=(const DBManager&) = delete;
 
-		/**
-		 * Get AlarmingDB object
-		 *
-		 * @return AlarmingDB object
-		 */
-		AlarmingDB getAlarmingDB();
-
 		/**
 		 * Get ConfigDB object
 		 *
@@ -71,25 +67,11 @@ class DBManager {
 		Config getConfigDB();
 
 		/**
-		 * Get ScriptDB object
-		 *
-		 * @return ScriptDB object
-		 */
-		ScriptDB getScriptDB();
-
-		/**
-		 * Get TagLoggerDB object
+		 * Get DB executor (shared by alarming, tag logger and script systems)
 		 *
-		 * @return TagLoggerDB object
+		 * @return DB executor
 		 */
-		TagLoggerDB getTagLoggerDB();
-
-		/**
-		 * Get TagLoggerWriterDB object
-		 *
-		 * @return TagLoggerDB object
-		 */
-		TagLoggerDB getTagLoggerWriterDB();
+		DBExecutorPtr getExecutor();
 
 		/**
 		 * Get database credentials
@@ -104,19 +86,25 @@ class DBManager {
 
 		/// DB connection instance for DB manager
 		MYSQL *connDB;
-		/// DB connection instance for Alarming system
-		MYSQL *connAlarming;
-		/// DB connection instance for Tag logger system
-		MYSQL *connTagLogger;
-		/// DB connection instance for Tag logger writer system
-		MYSQL *connTagLoggerWriter;
-		/// DB connection instance for Script system
-		MYSQL *connScript;
+
+		/// DB executor (owns its connections)
+		DBExecutorPtr executor;
 
 		/**
 		 * Initialize DB connections
+		 *
+		 * @param executorConnections Number of DB executor connections
+		 */
+		void initConnections(unsigned int executorConnections);
+
+		/**
+		 * Create DB connection
+		 *
+		 * @param name Connection name (for exception)
+		 *
+		 * @return Connection handle
 		 */
-		void initConnections();
+		MYSQL* createConnection(const std::string& name);
 };
 
 }  // namespace onh
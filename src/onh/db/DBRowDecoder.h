@@ -0,0 +1,170 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DB_DBROWDECODER_H_
+#define ONH_DB_DBROWDECODER_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <type_traits>
+#include "DBStatement.h"
+
+namespace onh {
+
+/**
+ * Row decoder class (maps prepared statement result columns into object)
+ *
+ * Field positions are resolved once per statement.
+ */
+template <typename T>
+class DBRowDecoder {
+	public:
+		/// Field setter (object, statement, field position)
+		using fieldSetter = std::function<void(T&, const DBStatement&, unsigned int)>;
+
+		DBRowDecoder() = default;
+
+		/**
+		 * Add field with custom setter
+		 *
+		 * @param fName Result field name
+		 * @param setter Field setter
+		 *
+		 * @return Reference to the decoder
+		 */
+		DBRowDecoder& field(const std::string &fName, fieldSetter setter) {
+			fields.push_back({fName, setter});
+			positions.clear();
+
+			return *this;
+		}
+
+		/**
+		 * Add field mapped to the object setter
+		 *
+		 * @param fName Result field name
+		 * @param setter Object setter
+		 *
+		 * @return Reference to the decoder
+		 */
+		template <typename V>
+		DBRowDecoder& field(const std::string &fName, void (T::*setter)(V)) {
+			return field(fName, [setter](T &obj, const DBStatement &stmt, unsigned int pos) {
+				(obj.*setter)(getValue<typename std::decay<V>::type>(stmt, pos));
+			});
+		}
+
+		/**
+		 * Decode current statement row into object
+		 *
+		 * @param stmt Prepared statement
+		 * @param obj Object to fill
+		 */
+		void decode(const DBStatement &stmt, T &obj) {
+			const std::vector<unsigned int> &pos = getPositions(stmt);
+
+			for (unsigned int i=0; i < fields.size(); ++i) {
+				fields[i].setter(obj, stmt, pos[i]);
+			}
+		}
+
+		/**
+		 * Decode current statement row
+		 *
+		 * @param stmt Prepared statement
+		 *
+		 * @return Decoded object
+		 */
+		T decode(const DBStatement &stmt) {
+			T obj;
+			decode(stmt, obj);
+
+			return obj;
+		}
+
+		/**
+		 * Get value from statement row converted to given type
+		 *
+		 * @param stmt Prepared statement
+		 * @param pos Field position
+		 *
+		 * @return Field value
+		 */
+		template <typename V>
+		static V getValue(const DBStatement &stmt, unsigned int pos) {
+			if constexpr (std::is_same<V, bool>::value) {
+				return (stmt.getInt(pos) == 1)?(true):(false);
+			} else if constexpr (std::is_same<V, std::string>::value) {
+				return stmt.getString(pos);
+			} else if constexpr (std::is_enum<V>::value) {
+				return static_cast<V>(stmt.getUInt(pos));
+			} else if constexpr (std::is_floating_point<V>::value) {
+				return static_cast<V>(stmt.getReal(pos));
+			} else if constexpr (std::is_unsigned<V>::value) {
+				return static_cast<V>(stmt.getUInt64(pos));
+			} else {
+				static_assert(std::is_integral<V>::value, "Not supported field type");
+				return static_cast<V>(stmt.getInt(pos));
+			}
+		}
+
+	private:
+		/**
+		 * Get field positions for statement (resolved on first use)
+		 *
+		 * @param stmt Prepared statement
+		 *
+		 * @return Field positions
+		 */
+		const std::vector<unsigned int>& getPositions(const DBStatement &stmt) {
+			auto it = positions.find(stmt.getId());
+
+			if (it == positions.end()) {
+				std::vector<unsigned int> pos;
+				for (const fieldData &f : fields) {
+					pos.push_back(stmt.getFieldPos(f.name));
+				}
+
+				it = positions.emplace(stmt.getId(), pos).first;
+			}
+
+			return it->second;
+		}
+
+		/**
+		 * Field data
+		 */
+		typedef struct {
+			/// Result field name
+			std::string name;
+			/// Field setter
+			fieldSetter setter;
+		} fieldData;
+
+		/// Decoder fields
+		std::vector<fieldData> fields;
+
+		/// Field positions (key: statement identifier)
+		std::map<unsigned long int, std::vector<unsigned int>> positions;
+};
+
+}  // namespace onh
+
+#endif  // ONH_DB_DBROWDECODER_H_
@@ -0,0 +1,420 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBStatement.h"
+#include <atomic>
+#include <cstring>
+#include <sstream>
+
+/// Initial size of the string result buffer (longer values are fetched again)
+#define DB_STMT_STRING_BUFFER_SIZE 64
+
+namespace onh {
+
+DBStatement::DBStatement(MYSQL *DBConn, const std::string &q):
+	conn(DBConn), stmt(0), query(q), id(0), resultStored(false), prepareRequired(false), rowReady(false) {
+	prepare();
+}
+
+DBStatement::~DBStatement() {
+	close();
+}
+
+void DBStatement::close() {
+	if (stmt) {
+		mysql_stmt_close(stmt);
+		stmt = 0;
+	}
+
+	resultStored = false;
+	rowReady = false;
+}
+
+void DBStatement::throwError(const std::string &msg, const std::string &fName) const {
+	std::stringstream s;
+	s << msg << ": " << ((stmt)?(mysql_stmt_error(stmt)):(mysql_error(conn)));
+	throw DBException(s.str(), fName);
+}
+
+void DBStatement::prepare() {
+	// Statement identifiers (field positions resolved for old identifier are not valid)
+	static std::atomic<unsigned long int> lastId(0);
+
+	if (!conn)
+		throw DBException("Connection not initialized", "DBStatement::prepare");
+
+	close();
+
+	stmt = mysql_stmt_init(conn);
+	if (!stmt)
+		throwError("Statement init error", "DBStatement::prepare");
+
+	if (mysql_stmt_prepare(stmt, query.c_str(), query.length()))
+		throwError("Statement prepare error", "DBStatement::prepare");
+
+	// Parameters (bound values are kept when statement is prepared again)
+	unsigned long int pCount = mysql_stmt_param_count(stmt);
+	if (params.size() != pCount) {
+		MYSQL_BIND b;
+		std::memset(&b, 0, sizeof(b));
+
+		params.assign(pCount, b);
+		paramValues.assign(pCount, bindValue());
+		paramBound.assign(pCount, false);
+	}
+
+	// Result columns
+	results.clear();
+	resultValues.clear();
+	fieldPos.clear();
+
+	MYSQL_RES *meta = mysql_stmt_result_metadata(stmt);
+	if (meta) {
+		unsigned int fCount = mysql_num_fields(meta);
+		MYSQL_FIELD *fields = mysql_fetch_fields(meta);
+
+		MYSQL_BIND b;
+		std::memset(&b, 0, sizeof(b));
+
+		results.assign(fCount, b);
+		resultValues.assign(fCount, bindValue());
+
+		for (unsigned int i=0; i < fCount; ++i) {
+			// First field with given name is used (same as in DBResult)
+			fieldPos.emplace(fields[i].name, i);
+
+			MYSQL_BIND &rb = results[i];
+			bindValue &v = resultValues[i];
+
+			rb.is_null = &v.nullFlag;
+			rb.error = &v.errorFlag;
+			rb.length = &v.length;
+
+			switch (fields[i].type) {
+				case MYSQL_TYPE_TINY:
+				case MYSQL_TYPE_SHORT:
+				case MYSQL_TYPE_INT24:
+				case MYSQL_TYPE_LONG:
+				case MYSQL_TYPE_LONGLONG:
+				case MYSQL_TYPE_YEAR: {
+					rb.buffer_type = MYSQL_TYPE_LONGLONG;
+					rb.buffer = &v.intVal;
+					rb.is_unsigned = (fields[i].flags & UNSIGNED_FLAG)?(1):(0);
+				}; break;
+				case MYSQL_TYPE_FLOAT:
+				case MYSQL_TYPE_DOUBLE: {
+					rb.buffer_type = MYSQL_TYPE_DOUBLE;
+					rb.buffer = &v.realVal;
+				}; break;
+				default: {
+					v.strVal.resize(DB_STMT_STRING_BUFFER_SIZE);
+					rb.buffer_type = MYSQL_TYPE_STRING;
+					rb.buffer = v.strVal.data();
+					rb.buffer_length = v.strVal.size();
+				}; break;
+			}
+		}
+
+		mysql_free_result(meta);
+
+		if (mysql_stmt_bind_result(stmt, results.data()))
+			throwError("Bind result error", "DBStatement::prepare");
+	}
+
+	id = ++lastId;
+	prepareRequired = false;
+}
+
+MYSQL_BIND& DBStatement::getParam(unsigned int pos, const std::string &fName) {
+	if (pos >= params.size()) {
+		std::stringstream s;
+		s << "Parameter position " << pos << " out of range";
+		throw DBException(s.str(), fName);
+	}
+
+	paramBound[pos] = true;
+
+	return params[pos];
+}
+
+void DBStatement::bindInt(unsigned int pos, int val) {
+	MYSQL_BIND &b = getParam(pos, "DBStatement::bindInt");
+	bindValue &v = paramValues[pos];
+
+	v.intVal = val;
+	v.nullFlag = 0;
+
+	b.buffer_type = MYSQL_TYPE_LONGLONG;
+	b.buffer = &v.intVal;
+	b.is_unsigned = 0;
+	b.is_null = &v.nullFlag;
+	b.length = 0;
+}
+
+void DBStatement::bindUInt(unsigned int pos, unsigned int val) {
+	bindUInt64(pos, val);
+}
+
+void DBStatement::bindUInt64(unsigned int pos, unsigned long int val) {
+	MYSQL_BIND &b = getParam(pos, "DBStatement::bindUInt64");
+	bindValue &v = paramValues[pos];
+
+	v.intVal = static_cast<long long int>(val);
+	v.nullFlag = 0;
+
+	b.buffer_type = MYSQL_TYPE_LONGLONG;
+	b.buffer = &v.intVal;
+	b.is_unsigned = 1;
+	b.is_null = &v.nullFlag;
+	b.length = 0;
+}
+
+void DBStatement::bindReal(unsigned int pos, double val) {
+	MYSQL_BIND &b = getParam(pos, "DBStatement::bindReal");
+	bindValue &v = paramValues[pos];
+
+	v.realVal = val;
+	v.nullFlag = 0;
+
+	b.buffer_type = MYSQL_TYPE_DOUBLE;
+	b.buffer = &v.realVal;
+	b.is_null = &v.nullFlag;
+	b.length = 0;
+}
+
+void DBStatement::bindString(unsigned int pos, const std::string &val) {
+	MYSQL_BIND &b = getParam(pos, "DBStatement::bindString");
+	bindValue &v = paramValues[pos];
+
+	v.strVal.assign(val.begin(), val.end());
+	v.length = val.length();
+	v.nullFlag = 0;
+
+	b.buffer_type = MYSQL_TYPE_STRING;
+	b.buffer = v.strVal.data();
+	b.buffer_length = v.length;
+	b.is_null = &v.nullFlag;
+	b.length = &v.length;
+}
+
+void DBStatement::bindNull(unsigned int pos) {
+	MYSQL_BIND &b = getParam(pos, "DBStatement::bindNull");
+	bindValue &v = paramValues[pos];
+
+	v.nullFlag = 1;
+
+	b.buffer_type = MYSQL_TYPE_NULL;
+	b.buffer = 0;
+	b.is_null = &v.nullFlag;
+	b.length = 0;
+}
+
+void DBStatement::execute() {
+	// Release previous result
+	if (resultStored) {
+		mysql_stmt_free_result(stmt);
+		resultStored = false;
+	}
+	rowReady = false;
+
+	// Statement lost after previous error (connection restored)
+	if (prepareRequired)
+		prepare();
+
+	// Check parameters
+	for (unsigned int i=0; i < paramBound.size(); ++i) {
+		if (!paramBound[i]) {
+			std::stringstream s;
+			s << "Parameter " << i << " is not bound";
+			throw DBException(s.str(), "DBStatement::execute");
+		}
+	}
+
+	if (params.size() && mysql_stmt_bind_param(stmt, params.data()))
+		throwError("Bind parameters error", "DBStatement::execute");
+
+	if (mysql_stmt_execute(stmt)) {
+		// Prepare statement again before next execution (handle can be lost after reconnect)
+		prepareRequired = true;
+
+		throwError("Error during statement execute", "DBStatement::execute");
+	}
+
+	// Store result on client side (other statements can be executed during reading rows)
+	if (results.size()) {
+		if (mysql_stmt_store_result(stmt))
+			throwError("Store result error", "DBStatement::execute");
+
+		resultStored = true;
+	}
+}
+
+bool DBStatement::nextRow() {
+	if (!resultStored)
+		throw DBException("No result data", "DBStatement::nextRow");
+
+	rowReady = false;
+
+	int ret = mysql_stmt_fetch(stmt);
+
+	if (ret == MYSQL_NO_DATA)
+		return false;
+
+	if (ret == 1)
+		throwError("Error getting next row", "DBStatement::nextRow");
+
+	// Fetch truncated strings with bigger buffer
+	if (ret == MYSQL_DATA_TRUNCATED) {
+		for (unsigned int i=0; i < results.size(); ++i) {
+			MYSQL_BIND &rb = results[i];
+			bindValue &v = resultValues[i];
+
+			if (!v.errorFlag || rb.buffer_type != MYSQL_TYPE_STRING)
+				continue;
+
+			v.strVal.resize(v.length + 1);
+			rb.buffer = v.strVal.data();
+			rb.buffer_length = v.strVal.size();
+
+			if (mysql_stmt_fetch_column(stmt, &rb, i, 0))
+				throwError("Error getting field data", "DBStatement::nextRow");
+		}
+
+		// New buffers for next rows
+		if (mysql_stmt_bind_result(stmt, results.data()))
+			throwError("Bind result error", "DBStatement::nextRow");
+	}
+
+	rowReady = true;
+
+	return true;
+}
+
+unsigned long int DBStatement::rowsCount() const {
+	return (resultStored)?(mysql_stmt_num_rows(stmt)):(0);
+}
+
+unsigned long int DBStatement::affectedRows() const {
+	return mysql_stmt_affected_rows(stmt);
+}
+
+unsigned int DBStatement::getFieldPos(const std::string &fName) const {
+	auto it = fieldPos.find(fName);
+
+	if (it == fieldPos.end()) {
+		std::stringstream s;
+		s << "Field: " << fName << " does not exist in result array";
+		throw DBException(s.str(), "DBStatement::getFieldPos");
+	}
+
+	return it->second;
+}
+
+unsigned long int DBStatement::getId() const {
+	return id;
+}
+
+void DBStatement::checkField(unsigned int pos, const std::string &fName) const {
+	if (!rowReady)
+		throw DBException("No data in row structure", fName);
+
+	if (pos >= results.size())
+		throw DBException("Field position out of range", fName);
+}
+
+template <typename T>
+T DBStatement::getNumber(unsigned int pos, const std::string &fName) const {
+	checkField(pos, fName);
+
+	const MYSQL_BIND &rb = results[pos];
+	const bindValue &v = resultValues[pos];
+
+	T val = 0;
+
+	if (v.nullFlag)
+		return val;
+
+	switch (rb.buffer_type) {
+		case MYSQL_TYPE_LONGLONG: {
+			if (rb.is_unsigned)
+				val = static_cast<T>(static_cast<unsigned long long int>(v.intVal));
+			else
+				val = static_cast<T>(v.intVal);
+		}; break;
+		case MYSQL_TYPE_DOUBLE: val = static_cast<T>(v.realVal); break;
+		default: {
+			std::istringstream iss(std::string(v.strVal.data(), v.length));
+			iss >> val;
+		}; break;
+	}
+
+	return val;
+}
+
+std::string DBStatement::getString(unsigned int pos) const {
+	checkField(pos, "DBStatement::getString");
+
+	const MYSQL_BIND &rb = results[pos];
+	const bindValue &v = resultValues[pos];
+
+	if (v.nullFlag)
+		return "";
+
+	std::string ret;
+
+	switch (rb.buffer_type) {
+		case MYSQL_TYPE_LONGLONG: {
+			if (rb.is_unsigned)
+				ret = std::to_string(static_cast<unsigned long long int>(v.intVal));
+			else
+				ret = std::to_string(v.intVal);
+		}; break;
+		case MYSQL_TYPE_DOUBLE: {
+			std::ostringstream oss;
+			oss << v.realVal;
+			ret = oss.str();
+		}; break;
+		default: ret.assign(v.strVal.data(), v.length); break;
+	}
+
+	return ret;
+}
+
+int DBStatement::getInt(unsigned int pos) const {
+	return getNumber<int>(pos, "DBStatement::getInt");
+}
+
+unsigned int DBStatement::getUInt(unsigned int pos) const {
+	return getNumber<unsigned int>(pos, "DBStatement::getUInt");
+}
+
+unsigned long int DBStatement::getUInt64(unsigned int pos) const {
+	return getNumber<unsigned long int>(pos, "DBStatement::getUInt64");
+}
+
+float DBStatement::getReal(unsigned int pos) const {
+	return getNumber<float>(pos, "DBStatement::getReal");
+}
+
+bool DBStatement::isNull(unsigned int pos) const {
+	checkField(pos, "DBStatement::isNull");
+
+	return (resultValues[pos].nullFlag)?(true):(false);
+}
+
+}  // namespace onh
@@ -0,0 +1,320 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DB_DBSTATEMENT_H_
+#define ONH_DB_DBSTATEMENT_H_
+
+#include <mysql.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include "DBException.h"
+
+namespace onh {
+
+/// Forward declaration
+class DB;
+
+/**
+ * Prepared statement class (MariaDB binary protocol)
+ *
+ * Statement is prepared once and executed many times with bound typed parameters.
+ * Result columns are bound to typed buffers and field positions are resolved
+ * once after prepare. Statements are created and cached by the DB class.
+ */
+class DBStatement {
+	public:
+		friend class DB;
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		DBStatement(const DBStatement&) = delete;
+
+		virtual ~DBStatement();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		DBStatement& operator=(const DBStatement&) = delete;
+
+		/**
+		 * Bind integer parameter
+		 *
+		 * @param pos Parameter position (from 0)
+		 * @param val Parameter value
+		 */
+		void bindInt(unsigned int pos, int val);
+
+		/**
+		 * Bind unsigned integer parameter
+		 *
+		 * @param pos Parameter position (from 0)
+		 * @param val Parameter value
+		 */
+		void bindUInt(unsigned int pos, unsigned int val);
+
+		/**
+		 * Bind unsigned long integer parameter
+		 *
+		 * @param pos Parameter position (from 0)
+		 * @param val Parameter value
+		 */
+		void bindUInt64(unsigned int pos, unsigned long int val);
+
+		/**
+		 * Bind real parameter
+		 *
+		 * @param pos Parameter position (from 0)
+		 * @param val Parameter value
+		 */
+		void bindReal(unsigned int pos, double val);
+
+		/**
+		 * Bind string parameter
+		 *
+		 * @param pos Parameter position (from 0)
+		 * @param val Parameter value
+		 */
+		void bindString(unsigned int pos, const std::string &val);
+
+		/**
+		 * Bind NULL parameter
+		 *
+		 * @param pos Parameter position (from 0)
+		 */
+		void bindNull(unsigned int pos);
+
+		/**
+		 * Execute statement with bound parameters
+		 *
+		 * Result of the previous execution is released.
+		 */
+		void execute();
+
+		/**
+		 * Get next row data
+		 *
+		 * @return True if data exist
+		 */
+		bool nextRow();
+
+		/**
+		 * Get rows count from result
+		 *
+		 * @return Rows count
+		 */
+		unsigned long int rowsCount() const;
+
+		/**
+		 * Get rows count changed by the last execution
+		 *
+		 * @return Affected rows count
+		 */
+		unsigned long int affectedRows() const;
+
+		/**
+		 * Get field position in result (resolved once after prepare)
+		 *
+		 * @param fName Field name
+		 *
+		 * @return Field position
+		 */
+		unsigned int getFieldPos(const std::string &fName) const;
+
+		/**
+		 * Get statement identifier (changes after statement is prepared again)
+		 *
+		 * @return Statement identifier
+		 */
+		unsigned long int getId() const;
+
+		/**
+		 * Get string value from current row
+		 *
+		 * @param pos Field position
+		 *
+		 * @return DB data as string
+		 */
+		std::string getString(unsigned int pos) const;
+
+		/**
+		 * Get integer value from current row
+		 *
+		 * @param pos Field position
+		 *
+		 * @return DB data as integer
+		 */
+		int getInt(unsigned int pos) const;
+
+		/**
+		 * Get unsigned integer value from current row
+		 *
+		 * @param pos Field position
+		 *
+		 * @return DB data as unsigned integer
+		 */
+		unsigned int getUInt(unsigned int pos) const;
+
+		/**
+		 * Get unsigned long integer value from current row
+		 *
+		 * @param pos Field position
+		 *
+		 * @return DB data as unsigned long integer
+		 */
+		unsigned long int getUInt64(unsigned int pos) const;
+
+		/**
+		 * Get real value from current row
+		 *
+		 * @param pos Field position
+		 *
+		 * @return DB data as real
+		 */
+		float getReal(unsigned int pos) const;
+
+		/**
+		 * Check if field value in current row is null
+		 *
+		 * @param pos Field position
+		 *
+		 * @return True if data is NULL
+		 */
+		bool isNull(unsigned int pos) const;
+
+	private:
+		/**
+		 * Constructor (allowed only from DB)
+		 *
+		 * @param DBConn Connection handle
+		 * @param q SQL query with '?' parameter markers
+		 */
+		DBStatement(MYSQL *DBConn, const std::string &q);
+
+		/**
+		 * Prepare statement and bind result buffers
+		 */
+		void prepare();
+
+		/**
+		 * Release statement handle
+		 */
+		void close();
+
+		/**
+		 * Get parameter binding (parameter is marked as bound)
+		 *
+		 * @param pos Parameter position
+		 * @param fName Function name (for exception)
+		 *
+		 * @return Reference to the parameter binding
+		 */
+		MYSQL_BIND& getParam(unsigned int pos, const std::string &fName);
+
+		/**
+		 * Check if current row field can be read
+		 *
+		 * @param pos Field position
+		 * @param fName Function name (for exception)
+		 */
+		void checkField(unsigned int pos, const std::string &fName) const;
+
+		/**
+		 * Get numeric value from current row
+		 *
+		 * @param pos Field position
+		 * @param fName Function name (for exception)
+		 *
+		 * @return DB data converted to numeric type
+		 */
+		template <typename T>
+		T getNumber(unsigned int pos, const std::string &fName) const;
+
+		/**
+		 * Throw exception with statement error
+		 *
+		 * @param msg Error message
+		 * @param fName Function name
+		 */
+		void throwError(const std::string &msg, const std::string &fName) const;
+
+		/**
+		 * Bound value buffer (parameter or result column)
+		 */
+		typedef struct {
+			/// Integer value
+			long long int intVal;
+			/// Real value
+			double realVal;
+			/// String value
+			std::vector<char> strVal;
+			/// Data length
+			unsigned long int length;
+			/// NULL flag
+			my_bool nullFlag;
+			/// Truncation flag
+			my_bool errorFlag;
+		} bindValue;
+
+		/// MySQL connection handle
+		MYSQL *conn;
+
+		/// MySQL statement handle
+		MYSQL_STMT *stmt;
+
+		/// SQL query
+		std::string query;
+
+		/// Statement identifier
+		unsigned long int id;
+
+		/// Parameter bindings
+		std::vector<MYSQL_BIND> params;
+
+		/// Parameter values
+		std::vector<bindValue> paramValues;
+
+		/// Parameter bound flags
+		std::vector<bool> paramBound;
+
+		/// Result column bindings
+		std::vector<MYSQL_BIND> results;
+
+		/// Result column values
+		std::vector<bindValue> resultValues;
+
+		/// Field positions
+		std::unordered_map<std::string, unsigned int> fieldPos;
+
+		/// Result is stored
+		bool resultStored;
+
+		/// Statement needs to be prepared again (after execute error)
+		bool prepareRequired;
+
+		/// Row data is available
+		bool rowReady;
+};
+
+using DBStatementPtr = std::unique_ptr<DBStatement>;
+
+}  // namespace onh
+
+#endif  // ONH_DB_DBSTATEMENT_H_
@@ -17,13 +17,14 @@
  */
 
 #include <mysql.h>
+#include <algorithm>
 #include <sstream>
 #include "ParserDB.h"
 
 namespace onh {
 
 ParserDB::ParserDB(const DBCredentials & dbData):
-	DB(mysql_init(NULL)) {
+	DB(mysql_init(NULL)), tagDecoder(createTagDecoder()) {
 	// Check initializations
 	if (!conn)
 		throw Exception("Can not initialize DB structures", "ParserDB::ParserDB");
@@ -47,11 +48,15 @@ ParserDB::ParserDB(const DBCredentials & dbData):
 }
 
 ParserDB::ParserDB(const ParserDB &tDB):
-	DB(tDB) {
+	DB(tDB), tagDecoder(tDB.tagDecoder) {
 	pAlarmDB = std::make_unique<AlarmingDB>(*(tDB.pAlarmDB));
 }
 
 ParserDB::~ParserDB() {
+	// Release prepared statements before connection is closed
+	clearStatements();
+	pAlarmDB.reset();
+
 	if (conn)
 		mysql_close(conn);
 }
@@ -71,29 +76,30 @@ const Tag ParserDB::getTag(const std::string& tagName) {
 	if (!DB::checkStringValue(tagName))
 		throw TagException(TagException::WRONG_NAME, "Tag name contains invalid characters", "ParserDB::getTag");
 
+	// Check tag cache
+	auto it = tagCache.find(tagName);
+	if (it != tagCache.end())
+		return it->second;
+
 	// No data
 	bool noData = false;
 
-	// Query
-	std::stringstream q;
-
 	// Return value
 	Tag tg;
 
 	try {
-		// Prepare query
-		q << "SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND t.tName=";
-		q << "'" << tagName << "';";
+		// Prepared query
+		DBStatement &stmt = getStatement("SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND t.tName=?;");
 
-		// Query
-		auto result = executeQuery(q.str());
+		stmt.bindString(0, tagName);
+		stmt.execute();
 
-		if (result->rowsCount() == 1) {
+		if (stmt.rowsCount() == 1) {
 			// Read data
-			result->nextRow();
+			stmt.nextRow();
 
 			// Get Tag
-			tg = getTagFromResultset(*result);
+			tagDecoder.decode(stmt, tg);
 		} else {
 			noData = true;
 		}
@@ -107,8 +113,8 @@ const Tag ParserDB::getTag(const std::string& tagName) {
 	return tg;
 }
 
-std::stringstream ParserDB::prepareIN(const std::vector<std::string> &tagNames) {
-	std::stringstream sTags;
+std::string ParserDB::prepareIN(const std::vector<std::string> &tagNames) {
+	std::string sTags;
 
 	// Prepare SQL IN statement values
 	for (unsigned int i=0; i < tagNames.size(); ++i) {
@@ -119,12 +125,12 @@ std::stringstream ParserDB::prepareIN(const std::vector<std::string> &tagNames)
 		if (!DB::checkStringValue(tagNames[i]))
 			throw TagException(TagException::WRONG_NAME, "Tag name contains invalid characters", "ParserDB::getTags");
 
-		// Add to string values
-		sTags << "'" << tagNames[i] << "'";
+		// Add parameter marker
+		sTags += "?";
 
 		// Put separator?
 		if (i < tagNames.size()-1) {
-			sTags << ", ";
+			sTags += ", ";
 		}
 	}
 
@@ -155,39 +161,55 @@ void ParserDB::checkTagNamesExist(const std::vector<std::string> &tagNames, cons
 std::vector<Tag> ParserDB::getTags(std::vector<std::string> tagNames) {
 	// Return vector
 	std::vector<Tag> vTag;
-	std::stringstream sTags;
+	std::string sTags;
 
 	// Check input values
 	if (tagNames.size() <= 1) {
 		throw TagException(TagException::WRONG_NAME, "Tag array should have more than 1 item", "ParserDB::getTags");
 	}
 
+	// Check tag cache
+	if (tagCache.size() > 0) {
+		for (const std::string& name : tagNames) {
+			auto it = tagCache.find(name);
+			if (it == tagCache.end())
+				break;
+
+			vTag.push_back(it->second);
+		}
+
+		if (vTag.size() == tagNames.size())
+			return vTag;
+
+		vTag.clear();
+	}
+
 	// Prepare SQL IN statement values
 	sTags = prepareIN(tagNames);
 
 	// No data
 	bool noData = true;
 
-	// Query
-	std::stringstream q;
-
 	// Return value
 	Tag tg;
 
 	try {
-		// Prepare query
-		q << "SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND tName IN (";
-		q << sTags.str() << ") ORDER BY FIELD(t.tName, " << sTags.str() << ");";
+		// Prepared query (one prepared statement per tag names count)
+		DBStatement &stmt = getStatement("SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND tName IN ("+
+										sTags+") ORDER BY FIELD(t.tName, "+sTags+");");
 
-		// Query
-		auto result = executeQuery(q.str());
+		for (unsigned int i=0; i < tagNames.size(); ++i) {
+			stmt.bindString(i, tagNames[i]);
+			stmt.bindString(tagNames.size()+i, tagNames[i]);
+		}
+		stmt.execute();
 
 		// Read data
-		while (result->nextRow()) {
+		while (stmt.nextRow()) {
 			noData = false;
 
 			// Get Tag
-			tg = getTagFromResultset(*result);
+			tagDecoder.decode(stmt, tg);
 
 			// Put into the vector
 			vTag.push_back(tg);
@@ -197,8 +219,16 @@ std::vector<Tag> ParserDB::getTags(std::vector<std::string> tagNames) {
 	}
 
 	// Check empty data
-	if (noData || vTag.size() == 0)
-		throw TagException(TagException::NOT_EXIST, "Tags "+sTags.str()+" does not exist in DB", "ParserDB::getTags");
+	if (noData || vTag.size() == 0) {
+		std::stringstream s;
+		s << "Tags ";
+		for (unsigned int i=0; i < tagNames.size(); ++i) {
+			s << ((i)?(", "):("")) << "'" << tagNames[i] << "'";
+		}
+		s << " does not exist in DB";
+
+		throw TagException(TagException::NOT_EXIST, s.str(), "ParserDB::getTags");
+	}
 
 	// Check if all tags read from DB
 	checkTagNamesExist(tagNames, vTag);
@@ -206,28 +236,49 @@ std::vector<Tag> ParserDB::getTags(std::vector<std::string> tagNames) {
 	return vTag;
 }
 
-Tag ParserDB::getTagFromResultset(const DBResult &res) {
-	// Return value
-	Tag tg;
-	TagType tt;
-	processDataArea ta;
+void ParserDB::cacheTags(const std::vector<std::string>& tagNames) {
+	std::vector<std::string> names;
 
-	// Tag type
-	tt = (TagType)res.getUInt("tType");
+	// Skip cached and not valid names (getTag reports them)
+	for (const std::string& name : tagNames) {
+		if (name.size() == 0 || !DB::checkStringValue(name))
+			continue;
 
-	// Tag area
-	ta = (processDataArea)res.getUInt("tArea");
+		if (tagCache.find(name) != tagCache.end())
+			continue;
 
-	// Update tag object values
-	tg.setId(res.getUInt("tid"));
-	tg.setConnId(res.getUInt("tConnId"));
-	tg.setName(res.getString("tName"));
-	tg.setType(tt);
-	tg.setArea(ta);
-	tg.setByteAddress(res.getUInt("tByteAddress"));
-	tg.setBitAddress(res.getUInt("tBitAddress"));
+		if (std::find(names.begin(), names.end(), name) != names.end())
+			continue;
 
-	return tg;
+		names.push_back(name);
+	}
+
+	if (names.size() == 0)
+		return;
+
+	try {
+		// Prepared query
+		DBStatement &stmt = getStatement("SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND tName IN ("+
+										prepareIN(names)+");");
+
+		for (unsigned int i=0; i < names.size(); ++i) {
+			stmt.bindString(i, names[i]);
+		}
+		stmt.execute();
+
+		// Read data
+		while (stmt.nextRow()) {
+			Tag tg = tagDecoder.decode(stmt);
+
+			tagCache.insert(std::pair<std::string, Tag>(tg.getName(), tg));
+		}
+	} catch (DBException &e) {
+		throw Exception(e.what(), "ParserDB::cacheTags");
+	}
+}
+
+void ParserDB::clearTagCache() {
+	tagCache.clear();
 }
 
 }  // namespace onh
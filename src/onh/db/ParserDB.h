@@ -19,6 +19,8 @@
 #ifndef ONH_DB_PARSERDB_H_
 #define ONH_DB_PARSERDB_H_
 
+#include <map>
+#include <string>
 #include <vector>
 #include "objs/Tag.h"
 #include "DB.h"
@@ -71,30 +73,35 @@ class ParserDB: public DB {
 		std::vector<Tag> getTags(std::vector<std::string> tagNames);
 
 		/**
-		 * Get access to the alarming DB
+		 * Read Tags data from DB into the tag cache (one query for all names)
 		 *
-		 * @return Reference to the AlarmingDB object
+		 * Not existing tag names are skipped - they are reported by getTag/getTags.
+		 *
+		 * @param tagNames Vector with tag names
 		 */
-		AlarmingDB& getAlarmDB();
+		void cacheTags(const std::vector<std::string>& tagNames);
 
-	private:
 		/**
-		 * Get Tag object from SQL resultset
-		 *
-		 * @param res Reference to the resultset
+		 * Clear tag cache
+		 */
+		void clearTagCache();
+
+		/**
+		 * Get access to the alarming DB
 		 *
-		 * @return  Tag objects
+		 * @return Reference to the AlarmingDB object
 		 */
-		Tag getTagFromResultset(const DBResult &res);
+		AlarmingDB& getAlarmDB();
 
+	private:
 		/**
-		 * Prepare SQL IN array statement
+		 * Prepare SQL IN array statement with parameter markers (tag names are checked)
 		 *
 		 * @param tagNames Vector with tag names
 		 *
 		 * @return SQL IN array statement
 		 */
-		std::stringstream prepareIN(const std::vector<std::string> &tagNames);
+		std::string prepareIN(const std::vector<std::string> &tagNames);
 
 		/**
 		 * Check if Tag names exists in Tag vector
@@ -106,6 +113,12 @@ class ParserDB: public DB {
 
 		/// AlarmingDB object
 		std::unique_ptr<AlarmingDB> pAlarmDB;
+
+		/// Tag cache (filled by cacheTags)
+		std::map<std::string, Tag> tagCache;
+
+		/// Tag row decoder
+		DBRowDecoder<Tag> tagDecoder;
 };
 
 }  // namespace onh
@@ -23,100 +23,65 @@
 namespace onh {
 
 ScriptDB::ScriptDB(const ScriptDB &sDB):
-	DB(sDB) {
+	DB(sDB), exitCodeColumn(sDB.exitCodeColumn), tagDecoder(sDB.tagDecoder), feedbackDecoder(sDB.feedbackDecoder), scriptDecoder(sDB.scriptDecoder) {
 }
 
 ScriptDB::ScriptDB(MYSQL *connDB):
-	DB(connDB) {
+	DB(connDB), exitCodeColumn(-1), tagDecoder(createTagDecoder()), feedbackDecoder(createTagDecoder("fb_")),
+	scriptDecoder(createScriptDecoder()) {
 }
 
 ScriptDB::~ScriptDB() {
 }
 
-std::vector<ScriptItem> ScriptDB::getScripts(bool enabled) {
-	std::stringstream tagID;
+DBRowDecoder<ScriptItem> ScriptDB::createScriptDecoder() {
+	DBRowDecoder<ScriptItem> dec;
 
-	// Query
-	std::stringstream q;
-	std::string q1;
+	dec.field("scid", &ScriptItem::setId)
+		.field("scName", &ScriptItem::setName)
+		.field("scRun", &ScriptItem::setRun)
+		.field("scLock", &ScriptItem::setLock)
+		.field("scEnable", &ScriptItem::setEnable);
 
+	return dec;
+}
+
+std::vector<ScriptItem> ScriptDB::getScripts(bool enabled) {
 	// Return vector
 	std::vector<ScriptItem> vScripts;
 
 	// Return value
-	Tag tg;
-	TagType tt;
-	processDataArea ta;
 	ScriptItem sc;
 	ScriptItem sc_clear;
 
-	// Prepare query
-	q << "SELECT * FROM scripts sc, tags t, driver_connections dc WHERE sc.scTagId=t.tid AND t.tConnId=dc.dcId ";
-	q << "AND sc.scEnable=" << ((enabled)?("1"):("0")) << ";";
-
 	try {
-		// Query
-		auto result = executeQuery(q.str());
+		// Prepared query (feedback tag in the same query)
+		DBStatement &stmt = getStatement("SELECT sc.*, t.*, fb.tid AS fb_tid, fb.tConnId AS fb_tConnId, "
+				"fb.tName AS fb_tName, fb.tType AS fb_tType, fb.tArea AS fb_tArea, "
+				"fb.tByteAddress AS fb_tByteAddress, fb.tBitAddress AS fb_tBitAddress "
+				"FROM scripts sc JOIN tags t ON sc.scTagId=t.tid JOIN driver_connections dc ON t.tConnId=dc.dcId "
+				"LEFT JOIN (tags fb JOIN driver_connections fbdc ON fb.tConnId=fbdc.dcId) ON sc.scFeedbackRun=fb.tid "
+				"WHERE sc.scEnable=?;");
 
-		// Read data
-		while (result->nextRow()) {
-			sc = sc_clear;
-
-			// Tag type
-			tt = (TagType)result->getUInt("tType");
+		stmt.bindInt(0, ((enabled)?(1):(0)));
+		stmt.execute();
 
-			// Tag area
-			ta = (processDataArea)result->getUInt("tArea");
+		// Feedback Tag field position
+		unsigned int feedbackPos = stmt.getFieldPos("fb_tid");
 
-			// Update tag object values
-			tg.setId(result->getUInt("tid"));
-			tg.setConnId(result->getUInt("tConnId"));
-			tg.setName(result->getString("tName"));
-			tg.setType(tt);
-			tg.setArea(ta);
-			tg.setByteAddress(result->getUInt("tByteAddress"));
-			tg.setBitAddress(result->getUInt("tBitAddress"));
+		// Read data
+		while (stmt.nextRow()) {
+			sc = sc_clear;
 
 			// Script item
-			sc.setId(result->getUInt("scid"));
-			sc.setTag(tg);
-			sc.setName(result->getString("scName"));
-			sc.setRun(((result->getInt("scRun") == 1)?(true):(false)));
-			sc.setLock(((result->getInt("scLock") == 1)?(true):(false)));
+			scriptDecoder.decode(stmt, sc);
+			sc.setTag(tagDecoder.decode(stmt));
 
 			// Check if there is feedback Tag
-			if (!result->isNull("scFeedbackRun")) {
-				tagID << result->getUInt("scFeedbackRun");
-				q1 = "SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND tid="+tagID.str();
-
-				// Call additional query
-				auto result2 = executeQuery(q1);
-
-				if (result2->rowsCount() == 1) {
-					result2->nextRow();
-
-					// Tag type
-					tt = (TagType)result2->getUInt("tType");
-
-					// Tag area
-					ta = (processDataArea)result2->getUInt("tArea");
-
-					// Update tag object values
-					tg.setId(result2->getUInt("tid"));
-					tg.setConnId(result2->getUInt("tConnId"));
-					tg.setName(result2->getString("tName"));
-					tg.setType(tt);
-					tg.setArea(ta);
-					tg.setByteAddress(result2->getUInt("tByteAddress"));
-					tg.setBitAddress(result2->getUInt("tBitAddress"));
-
-					// Set feedback tag
-					sc.setFeedbackRunTag(tg);
-				}
+			if (!stmt.isNull(feedbackPos)) {
+				sc.setFeedbackRunTag(feedbackDecoder.decode(stmt));
 			}
 
-			sc.setEnable(((result->getInt("scEnable") == 1)?(true):(false)));
-
 			// Put into the vector
 			vScripts.push_back(sc);
 		}
@@ -127,49 +92,113 @@ std::vector<ScriptItem> ScriptDB::getScripts(bool enabled) {
 	return vScripts;
 }
 
-void ScriptDB::setScriptRun(const ScriptItem& script) {
-	// Query
-	std::stringstream q;
+Tag ScriptDB::getTag(const std::string& tagName) {
+	// Check tag name
+	if (tagName.size() == 0)
+		throw TagException(TagException::WRONG_NAME, "Tag name is empty", "ScriptDB::getTag");
 
-	// Prepare query
-	q << "UPDATE scripts SET scRun=1, scLock=1 WHERE scid=" << script.getId() <<";";
+	if (!DB::checkStringValue(tagName))
+		throw TagException(TagException::WRONG_NAME, "Tag name contains invalid characters", "ScriptDB::getTag");
+
+	// No data
+	bool noData = false;
+
+	// Return value
+	Tag tg;
 
 	try {
-		// Query
-		executeSaveQuery(q.str());
+		// Prepared query
+		DBStatement &stmt = getStatement("SELECT * FROM tags t, driver_connections dc WHERE t.tConnId=dc.dcId AND t.tName=?;");
+
+		stmt.bindString(0, tagName);
+		stmt.execute();
+
+		if (stmt.rowsCount() == 1) {
+			// Read data
+			stmt.nextRow();
+
+			// Update tag object values
+			tagDecoder.decode(stmt, tg);
+		} else {
+			noData = true;
+		}
 	} catch (DBException &e) {
-		throw Exception(e.what(), "ScriptDB::setScriptRun");
+		throw Exception(e.what(), "ScriptDB::getTag");
 	}
-}
 
-void ScriptDB::clearScriptRun(unsigned int scriptId) {
-	// Query
-	std::stringstream q;
+	if (noData)
+		throw TagException(TagException::NOT_EXIST, "Tag "+tagName+" does not exist in DB", "ScriptDB::getTag");
 
-	// Prepare query
-	q << "UPDATE scripts SET scRun=0 WHERE scid=" << scriptId <<";";
+	return tg;
+}
+
+std::string ScriptDB::getScriptsChecksum() {
+	std::string ret;
 
 	try {
-		// Query
-		executeSaveQuery(q.str());
-	} catch (Exception &e) {
-		throw Exception(e.what(), "ScriptDB::clearScriptRun");
+		// Prepared query (run/lock flags and exit code are not part of the definition, trigger and feedback tags are)
+		DBStatement &stmt = getStatement("SELECT COUNT(*) AS scCount, COALESCE(SUM(CRC32(CONCAT_WS(',', sc.scid, sc.scTagId, "
+				"sc.scName, COALESCE(sc.scFeedbackRun, 0), sc.scEnable, "
+				"t.tConnId, t.tName, t.tType, t.tArea, t.tByteAddress, t.tBitAddress, "
+				"fb.tConnId, fb.tName, fb.tType, fb.tArea, fb.tByteAddress, fb.tBitAddress))), 0) AS scChecksum "
+				"FROM scripts sc LEFT JOIN tags t ON sc.scTagId=t.tid LEFT JOIN tags fb ON sc.scFeedbackRun=fb.tid;");
+
+		stmt.execute();
+
+		if (stmt.nextRow()) {
+			ret = stmt.getString(0) + ":" + stmt.getString(1);
+		}
+	} catch (DBException &e) {
+		throw Exception(e.what(), "ScriptDB::getScriptsChecksum");
 	}
+
+	return ret;
 }
 
-void ScriptDB::clearScriptLock(const ScriptItem& script) {
+void ScriptDB::saveScriptStates(const std::vector<scriptState>& states) {
+	if (states.empty())
+		return;
+
 	// Query
 	std::stringstream q;
+	std::stringstream qRun, qLock, qExit, qIds;
+
+	for (unsigned int i = 0; i < states.size(); ++i) {
+		const scriptState& st = states[i];
+
+		qRun << " WHEN " << st.id << " THEN " << ((st.run)?("1"):("0"));
+		qLock << " WHEN " << st.id << " THEN " << ((st.lock)?("1"):("0"));
+		if (st.exitCodeValid)
+			qExit << " WHEN " << st.id << " THEN " << st.exitCode;
+		qIds << ((i)?(","):("")) << st.id;
+	}
 
 	// Prepare query
-	q << "UPDATE scripts SET scLock=0 WHERE scid=" << script.getId() <<";";
+	q << "UPDATE scripts SET scRun=CASE scid" << qRun.str() << " END, scLock=CASE scid" << qLock.str() << " END";
+	if (qExit.str().length() && hasExitCodeColumn())
+		q << ", scExitCode=CASE scid" << qExit.str() << " ELSE scExitCode END";
+	q << " WHERE scid IN (" << qIds.str() << ");";
 
 	try {
 		// Query
 		executeSaveQuery(q.str());
-	} catch (Exception &e) {
-		throw Exception(e.what(), "ScriptDB::clearScriptLock");
+	} catch (DBException &e) {
+		throw Exception(e.what(), "ScriptDB::saveScriptStates");
 	}
 }
 
+bool ScriptDB::hasExitCodeColumn() {
+	if (exitCodeColumn == -1) {
+		try {
+			auto res = executeQuery("SHOW COLUMNS FROM scripts LIKE 'scExitCode';");
+
+			exitCodeColumn = (res->nextRow())?(1):(0);
+		} catch (DBException &e) {
+			throw Exception(e.what(), "ScriptDB::hasExitCodeColumn");
+		}
+	}
+
+	return exitCodeColumn == 1;
+}
+
 }  // namespace onh
@@ -28,12 +28,32 @@ namespace onh {
 /// Forward declaration
 class DBManager;
 
+/// Forward declaration
+class DBExecutorContext;
+
+/**
+ * Script state structure (persisted run and lock flags)
+ */
+typedef struct {
+	/// Script item identifier
+	unsigned int id;
+	/// Script run flag
+	bool run;
+	/// Script lock flag
+	bool lock;
+	/// Exit code of the last execution is valid
+	bool exitCodeValid;
+	/// Exit code of the last execution
+	int exitCode;
+} scriptState;
+
 /**
  * Class for read/write Script system DB
  */
 class ScriptDB: public DB {
 	public:
 		friend class DBManager;
+		friend class DBExecutorContext;
 
 		/**
 		 * Copy constructor
@@ -59,25 +79,27 @@ class ScriptDB: public DB {
 		std::vector<ScriptItem> getScripts(bool enabled = true);
 
 		/**
-		 * Set Script run and lock flag
+		 * Get tag used by the embedded script
 		 *
-		 * @param script Script item object
+		 * @param tagName Tag name
+		 *
+		 * @return Tag object
 		 */
-		void setScriptRun(const ScriptItem& script);
+		Tag getTag(const std::string& tagName);
 
 		/**
-		 * Clear Script run lag
+		 * Get script definitions checksum (changes after script definition is added, removed or modified)
 		 *
-		 * @param scriptId Script item object identifier
+		 * @return Script definitions checksum
 		 */
-		void clearScriptRun(unsigned int scriptId);
+		std::string getScriptsChecksum();
 
 		/**
-		 * Clear script lock flag
+		 * Save script states (one query for all scripts)
 		 *
-		 * @param script Script item object
+		 * @param states Script states
 		 */
-		void clearScriptLock(const ScriptItem& script);
+		void saveScriptStates(const std::vector<scriptState>& states);
 
 	private:
 		/**
@@ -86,6 +108,31 @@ class ScriptDB: public DB {
 		 * @param connection Connection handle
 		 */
 		explicit ScriptDB(MYSQL *connDB);
+
+		/**
+		 * Create script row decoder
+		 *
+		 * @return Script row decoder
+		 */
+		static DBRowDecoder<ScriptItem> createScriptDecoder();
+
+		/**
+		 * Check if scripts table has exit code column (added in newer DB versions)
+		 * @return True if exit code can be saved
+		 */
+		bool hasExitCodeColumn();
+
+		/// Exit code column state (-1 - not checked, 0 - missing, 1 - exist)
+		int exitCodeColumn;
+
+		/// Tag row decoder
+		DBRowDecoder<Tag> tagDecoder;
+
+		/// Feedback Tag row decoder
+		DBRowDecoder<Tag> feedbackDecoder;
+
+		/// Script row decoder
+		DBRowDecoder<ScriptItem> scriptDecoder;
 };
 
 }  // namespace onh
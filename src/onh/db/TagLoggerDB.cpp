@@ -22,68 +22,56 @@
 namespace onh {
 
 TagLoggerDB::TagLoggerDB(const TagLoggerDB &tlDB):
-	DB(tlDB) {
+	DB(tlDB), tagDecoder(tlDB.tagDecoder), loggerDecoder(tlDB.loggerDecoder) {
 }
 
 TagLoggerDB::TagLoggerDB(MYSQL *connDB):
-	DB(connDB) {
+	DB(connDB), tagDecoder(createTagDecoder()), loggerDecoder(createLoggerDecoder()) {
 }
 
 TagLoggerDB::~TagLoggerDB() {
 }
 
-std::vector<TagLoggerItem> TagLoggerDB::getLoggers(bool enabled) {
-	// Query
-	std::stringstream q;
+DBRowDecoder<TagLoggerItem> TagLoggerDB::createLoggerDecoder() {
+	DBRowDecoder<TagLoggerItem> dec;
+
+	dec.field("ltid", &TagLoggerItem::setId)
+		.field("ltInterval", &TagLoggerItem::setInterval)
+		.field("ltIntervalS", &TagLoggerItem::setIntervalSec)
+		.field("ltLastValue", &TagLoggerItem::setLastValue)
+		.field("ltEnable", &TagLoggerItem::setEnable);
 
+	dec.field("ltLastUPD", [](TagLoggerItem &tl, const DBStatement &stmt, unsigned int pos) {
+		if (stmt.isNull(pos)) {
+			tl.setLastUpdate("2000-01-01 07:00:00.000");
+		} else {
+			tl.setLastUpdate(stmt.getString(pos));
+		}
+	});
+
+	return dec;
+}
+
+std::vector<TagLoggerItem> TagLoggerDB::getLoggers(bool enabled) {
 	// Return vector
 	std::vector<TagLoggerItem> vTagLoggers;
 
 	// Return value
-	Tag tg;
-	TagType tt;
-	processDataArea ta;
 	TagLoggerItem tl;
 
 	try {
-		// Prepare query
-		q << "SELECT * FROM log_tags lt, tags t, driver_connections dc WHERE lt.lttid=t.tid AND t.tConnId=dc.dcId ";
-		q << "AND lt.ltEnable=" << ((enabled)?("1"):("0")) << ";";
+		// Prepared query
+		DBStatement &stmt = getStatement("SELECT * FROM log_tags lt, tags t, driver_connections dc "
+				"WHERE lt.lttid=t.tid AND t.tConnId=dc.dcId AND lt.ltEnable=?;");
 
-		// Query
-		auto result = executeQuery(q.str());
+		stmt.bindInt(0, ((enabled)?(1):(0)));
+		stmt.execute();
 
 		// Read data
-		while (result->nextRow()) {
-			// Tag type
-			tt = (TagType)result->getUInt("tType");
-
-			// Tag area
-			ta = (processDataArea)result->getUInt("tArea");
-
-			// Update tag object values
-			tg.setId(result->getUInt("tid"));
-			tg.setConnId(result->getUInt("tConnId"));
-			tg.setName(result->getString("tName"));
-			tg.setType(tt);
-			tg.setArea(ta);
-			tg.setByteAddress(result->getUInt("tByteAddress"));
-			tg.setBitAddress(result->getUInt("tBitAddress"));
-
+		while (stmt.nextRow()) {
 			// Tag logger
-			tl.setId(result->getUInt("ltid"));
-			tl.setTag(tg);
-			tl.setInterval((TagLoggerItem::intervals)result->getUInt("ltInterval"));
-			tl.setIntervalSec(result->getUInt("ltIntervalS"));
-
-			if (result->isNull("ltLastUPD")) {
-				tl.setLastUpdate("2000-01-01 07:00:00.000");
-			} else {
-				tl.setLastUpdate(result->getString("ltLastUPD"));
-			}
-
-			tl.setLastValue(result->getString("ltLastValue"));
-			tl.setEnable(((result->getInt("ltEnable") == 1)?(true):(false)));
+			loggerDecoder.decode(stmt, tl);
+			tl.setTag(tagDecoder.decode(stmt));
 
 			// Put into the vector
 			vTagLoggers.push_back(tl);
@@ -139,13 +127,16 @@ void TagLoggerDB::logTag(const TagLoggerItem& loggerItem) {
 	}
 
 	try {
-		// Prepare query
+		// Prepare query (one prepared statement per logger table)
 		q << "INSERT INTO " << tableName << loggerItem.getId();
-		q << " (" << tableColumns << ") VALUES (" << loggerItem.getTag().getId() << ", ";
-		q << loggerItem.getCurrentTimeValue().value << ", '" << loggerItem.getCurrentUpdate() << "');";
+		q << " (" << tableColumns << ") VALUES (?, ?, ?);";
+
+		DBStatement &stmt = getStatement(q.str());
 
-		// Query
-		executeSaveQuery(q.str());
+		stmt.bindUInt(0, loggerItem.getTag().getId());
+		stmt.bindString(1, loggerItem.getCurrentTimeValue().value);
+		stmt.bindString(2, loggerItem.getCurrentUpdate());
+		stmt.execute();
 	} catch (DBException &e) {
 		throw Exception(e.what(), "TagLoggerDB::logTag");
 	}
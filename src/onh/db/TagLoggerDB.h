@@ -29,12 +29,16 @@ namespace onh {
 /// Forward declaration
 class DBManager;
 
+/// Forward declaration
+class DBExecutorContext;
+
 /**
  * Class for read/write Tag logger
  */
 class TagLoggerDB: public DB {
 	public:
 		friend class DBManager;
+		friend class DBExecutorContext;
 
 		/**
 		 * Copy constructor
@@ -73,6 +77,19 @@ class TagLoggerDB: public DB {
 		 * @param connection Connection handle
 		 */
 		explicit TagLoggerDB(MYSQL *connDB);
+
+		/**
+		 * Create tag logger row decoder
+		 *
+		 * @return Tag logger row decoder
+		 */
+		static DBRowDecoder<TagLoggerItem> createLoggerDecoder();
+
+		/// Tag row decoder
+		DBRowDecoder<Tag> tagDecoder;
+
+		/// Tag logger row decoder
+		DBRowDecoder<TagLoggerItem> loggerDecoder;
 };
 
 }  // namespace onh
@@ -0,0 +1,126 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConfigSnapshot.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include "../../utils/Exception.h"
+
+namespace onh {
+
+ConfigSnapshot::ConfigSnapshot() {
+}
+
+ConfigSnapshot::ConfigSnapshot(const ConfigSnapshot& cs):
+	values(cs.values) {
+}
+
+ConfigSnapshot::~ConfigSnapshot() {
+}
+
+void ConfigSnapshot::add(const std::string& name, const std::string& val) {
+	if (name.empty())
+		throw Exception("Configuration name is empty", "ConfigSnapshot::add");
+
+	configValue cv;
+	cv.str = val;
+	cv.num = 0;
+	cv.numeric = false;
+
+	// Parse integer form
+	if (!val.empty()) {
+		char *end = nullptr;
+		errno = 0;
+		long long int n = strtoll(val.c_str(), &end, 10);
+		if (errno == 0 && end && *end == '\0') {
+			cv.num = n;
+			cv.numeric = true;
+		}
+	}
+
+	values[name] = cv;
+}
+
+bool ConfigSnapshot::contains(const std::string& name) const {
+	return values.find(name) != values.end();
+}
+
+const configValue& ConfigSnapshot::getValue(const std::string& name, const std::string& func) const {
+	auto it = values.find(name);
+	if (it == values.end())
+		throw Exception("Configuration value "+name+" does not exist", func);
+
+	return it->second;
+}
+
+long long int ConfigSnapshot::getNumeric(const std::string& name,
+											long long int min,
+											long long int max,
+											const std::string& func) const {
+	const configValue& cv = getValue(name, func);
+
+	if (!cv.numeric)
+		throw Exception("Configuration value "+name+" is not an integer", func);
+
+	if (cv.num < min || cv.num > max)
+		throw Exception("Configuration value "+name+" out of range", func);
+
+	return cv.num;
+}
+
+const std::string& ConfigSnapshot::getString(const std::string& name) const {
+	return getValue(name, "ConfigSnapshot::getString").str;
+}
+
+int ConfigSnapshot::getInt(const std::string& name) const {
+	return getNumeric(name, INT_MIN, INT_MAX, "ConfigSnapshot::getInt");
+}
+
+unsigned int ConfigSnapshot::getUInt(const std::string& name) const {
+	return getNumeric(name, 0, UINT_MAX, "ConfigSnapshot::getUInt");
+}
+
+size_t ConfigSnapshot::size() const {
+	return values.size();
+}
+
+std::vector<std::string> ConfigSnapshot::getChangedNames(const ConfigSnapshot& cs) const {
+	std::vector<std::string> ret;
+
+	// Changed and removed values
+	for (const auto& v : values) {
+		auto it = cs.values.find(v.first);
+
+		if (it == cs.values.end() || it->second.str != v.second.str)
+			ret.push_back(v.first);
+	}
+
+	// Added values
+	for (const auto& v : cs.values) {
+		if (values.find(v.first) == values.end())
+			ret.push_back(v.first);
+	}
+
+	std::sort(ret.begin(), ret.end());
+
+	return ret;
+}
+
+}  // namespace onh
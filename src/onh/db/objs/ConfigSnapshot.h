@@ -0,0 +1,161 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DB_OBJS_CONFIGSNAPSHOT_H_
+#define ONH_DB_OBJS_CONFIGSNAPSHOT_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace onh {
+
+/**
+ * Configuration value (string with parsed integer form)
+ */
+typedef struct {
+	/// String value
+	std::string str;
+	/// Integer value (valid only if numeric flag is set)
+	long long int num;
+	/// Value is an integer
+	bool numeric;
+} configValue;
+
+/**
+ * Configuration snapshot class
+ *
+ * Holds all configuration values loaded from DB. Values are parsed once
+ * on insert and served from hash map. Snapshot is filled by Config and
+ * shared read-only (ConfigSnapshotPtr) - refresh creates new snapshot.
+ */
+class ConfigSnapshot {
+	public:
+		ConfigSnapshot();
+
+		/**
+		 * Copy constructor
+		 *
+		 * @param cs Configuration snapshot to copy
+		 */
+		ConfigSnapshot(const ConfigSnapshot& cs);
+
+		virtual ~ConfigSnapshot();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+		/**
+		 * Add configuration value (replaces existing one)
+		 *
+		 * @param name Configuration name
+		 * @param val Configuration value
+		 */
+		void add(const std::string& name, const std::string& val);
+
+		/**
+		 * Check if configuration value exist
+		 *
+		 * @param name Configuration name
+		 *
+		 * @return True if value exist
+		 */
+		bool contains(const std::string& name) const;
+
+		/**
+		 * Get string value
+		 *
+		 * @param name Configuration name
+		 *
+		 * @return String value
+		 */
+		const std::string& getString(const std::string& name) const;
+
+		/**
+		 * Get int value
+		 *
+		 * @param name Configuration name
+		 *
+		 * @return Int value
+		 */
+		int getInt(const std::string& name) const;
+
+		/**
+		 * Get unsigned int value
+		 *
+		 * @param name Configuration name
+		 *
+		 * @return Unsigned int value
+		 */
+		unsigned int getUInt(const std::string& name) const;
+
+		/**
+		 * Get number of configuration values
+		 *
+		 * @return Number of configuration values
+		 */
+		size_t size() const;
+
+		/**
+		 * Get names of the configuration values which differ from other snapshot
+		 *
+		 * @param cs Configuration snapshot to compare
+		 *
+		 * @return Sorted names of the added, removed and changed values
+		 */
+		std::vector<std::string> getChangedNames(const ConfigSnapshot& cs) const;
+
+	private:
+		/**
+		 * Get configuration value
+		 *
+		 * @param name Configuration name
+		 * @param func Calling function name (for exception)
+		 *
+		 * @return Configuration value
+		 */
+		const configValue& getValue(const std::string& name, const std::string& func) const;
+
+		/**
+		 * Get numeric configuration value
+		 *
+		 * @param name Configuration name
+		 * @param min Minimum allowed value
+		 * @param max Maximum allowed value
+		 * @param func Calling function name (for exception)
+		 *
+		 * @return Numeric value
+		 */
+		long long int getNumeric(const std::string& name,
+									long long int min,
+									long long int max,
+									const std::string& func) const;
+
+		/// Configuration values
+		std::unordered_map<std::string, configValue> values;
+};
+
+/// Shared read-only configuration snapshot
+typedef std::shared_ptr<const ConfigSnapshot> ConfigSnapshotPtr;
+
+}  // namespace onh
+
+#endif  // ONH_DB_OBJS_CONFIGSNAPSHOT_H_
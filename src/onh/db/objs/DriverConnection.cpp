@@ -168,4 +168,24 @@ void DriverConnection::setEnable(bool enable) {
 	dcEnable = enable;
 }
 
+bool DriverConnection::isSameConfig(const DriverConnection& dc) const {
+	if (dcId != dc.dcId || dcType != dc.dcType)
+		return false;
+
+	if (dcType == DriverType::DT_SHM)
+		return shm == dc.shm;
+
+	if (!modbus || !dc.modbus)
+		return !modbus && !dc.modbus;
+
+	const modbusM::ModbusCfg& a = *modbus;
+	const modbusM::ModbusCfg& b = *dc.modbus;
+
+	return a.mode == b.mode && a.slaveID == b.slaveID && a.registerCount == b.registerCount &&
+			a.polling == b.polling && a.TCP_addr == b.TCP_addr && a.TCP_port == b.TCP_port &&
+			a.TCP_use_slaveID == b.TCP_use_slaveID && a.RTU_port == b.RTU_port &&
+			a.RTU_baud == b.RTU_baud && a.RTU_parity == b.RTU_parity &&
+			a.RTU_dataBit == b.RTU_dataBit && a.RTU_stopBit == b.RTU_stopBit;
+}
+
 }  // namespace onh
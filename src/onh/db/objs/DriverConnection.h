@@ -148,6 +148,15 @@ class DriverConnection {
 		 */
 		void setEnable(bool enable);
 
+		/**
+		 * Check if driver configuration is the same (name and enable flag are not compared)
+		 *
+		 * @param dc Driver connection to compare
+		 *
+		 * @return True if driver does not need to be restarted
+		 */
+		bool isSameConfig(const DriverConnection& dc) const;
+
 	private:
 		/// Driver connection identifier
 		unsigned int dcId;
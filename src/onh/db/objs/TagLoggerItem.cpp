@@ -19,13 +19,7 @@
 #include "TagLoggerItem.h"
 #include <time.h>
 #include <sys/time.h>
-#include <string.h>
-#include <cstdlib>
-#include <vector>
 #include <sstream>
-#include <cmath>
-#include "../../utils/StringUtils.h"
-#include "../../utils/DateUtils.h"
 
 namespace onh {
 
@@ -181,6 +175,7 @@ void TagLoggerItem::setLastUpdate(const std::string& lastUpdate) {
 	checkLastUpdate(lastUpdate);
 
 	ltLast.timestamp = lastUpdate;
+	ltLast.time = ClockTime();
 }
 
 void TagLoggerItem::checkLastValue(const std::string& value) const {
@@ -218,46 +213,32 @@ void TagLoggerItem::setEnable(bool enable) {
 bool TagLoggerItem::isNeededUpdate(const std::string& tagValue) {
 	bool ret = false;
 
-	// Current milliseconds
-	int currentMS = 0;
+	// Current time
+	ClockTime now = Clock::now();
 
-	// Current timestamp string
-	std::string currentTSS;
-
-	// Current timestamp
-	std::time_t currentTS = DateUtils::getTimestamp(currentMS, currentTSS, true);
-
-	// Tag last update timestamp
-	std::time_t tagTS = getTagUpdateTimestamp();
-
-	// Timestamp difference
-	double tsDiff = difftime(currentTS, tagTS);
-
-	// Tag last update milliseconds
-	int tagMS = getTagUpdateMilliseconds();
+	// Time from the last update (milliseconds)
+	long long int diff = now.monotonic - getLastMonotonic(now);
 
 	// Check update type
 	switch (ltInterval) {
 		case TagLoggerItem::I_100MS: {
-			// Millisecond update?
-			ret = msUpdate(tsDiff, tagMS, currentMS, 100);
+			// Millisecond update? (last update in the future also triggers)
+			ret = (diff >= 100 || diff < 0);
 		}; break;
 
 		case TagLoggerItem::I_200MS: {
 			// Millisecond update?
-			ret = msUpdate(tsDiff, tagMS, currentMS, 200);
+			ret = (diff >= 200 || diff < 0);
 		}; break;
 
 		case TagLoggerItem::I_500MS: {
 			// Millisecond update?
-			ret = msUpdate(tsDiff, tagMS, currentMS, 500);
+			ret = (diff >= 500 || diff < 0);
 		}; break;
 
 		case TagLoggerItem::I_1S: {
 			// 1 second update
-			if (tsDiff >= 1.0) {
-				ret = true;
-			}
+			ret = (diff >= 1000);
 		}; break;
 
 		case TagLoggerItem::I_XS: {
@@ -265,9 +246,7 @@ bool TagLoggerItem::isNeededUpdate(const std::string& tagValue) {
 				throw Exception("Interval seconds can not be 0", "TagLoggerItem::isNeededUpdate");
 
 			// X second update
-			if (tsDiff >= ltIntervalS) {
-				ret = true;
-			}
+			ret = (diff >= static_cast<long long int>(ltIntervalS) * 1000);
 		}; break;
 
 		case TagLoggerItem::I_ON_CHANGE: {
@@ -279,87 +258,23 @@ bool TagLoggerItem::isNeededUpdate(const std::string& tagValue) {
 
 	// Update logger current timestamp and value
 	if (ret) {
-		ltCurrent.timestamp = currentTSS;
+		ltCurrent.timestamp = Clock::getTimestampString(now.realtime);
 		ltCurrent.value = tagValue;
+		ltCurrent.time = now;
 	}
 
 	return ret;
 }
 
-std::time_t TagLoggerItem::getTagUpdateTimestamp() const {
-	checkLastUpdate(ltLast.timestamp);
-
-	std::vector<std::string> v;
-	// Explode string (YYYY-MM-DD HH:MM:SS.MSS) to get time without milliseconds
-	v = StringUtils::explode(ltLast.timestamp, '.');
-
-	// Check exploded data count
-	if (v.size() != 2)
-		throw Exception("Wrong exploded data count", "TagLoggerItem::getTagUpdateTimestamp");
-
-	struct tm tmTUPD;
-
-	// Init structure
-	memset(&tmTUPD, 0, sizeof(struct tm));
-
-	// Parse string
-	strptime(v[0].c_str(), "%Y-%m-%d %H:%M:%S", &tmTUPD);
-
-	time_t timeUPD = mktime(&tmTUPD);
-
-	if (timeUPD == -1)
-		throw Exception("Error during creation timestamp", "TagLoggerItem::getTagUpdateTimestamp");
-
-	return timeUPD;
-}
+long long int TagLoggerItem::getLastMonotonic(const ClockTime& now) const {
+	// Already resolved
+	if (ltLast.time.realtime != 0)
+		return ltLast.time.monotonic;
 
-int TagLoggerItem::getTagUpdateMilliseconds() const {
 	checkLastUpdate(ltLast.timestamp);
 
-	std::vector<std::string> v;
-
-	// Explode string (YYYY-MM-DD HH:MM:SS.MSS) to get milliseconds
-	v = StringUtils::explode(ltLast.timestamp, '.');
-
-	// Check exploded data count
-	if (v.size() != 2)
-		throw Exception("Wrong exploded data count", "TagLoggerItem::getTagUpdateMilliseconds");
-
-	// Convert to milliseconds
-	int ms = 0;
-	std::istringstream iss(v[1]);
-	iss >> ms;
-
-	// Check value
-	if (ms >=1000 || ms < 0)
-		throw Exception("Wrong milliseconds value", "TagLoggerItem::getTagUpdateMilliseconds");
-
-	return ms;
-}
-
-bool TagLoggerItem::msUpdate(double dTS,
-								unsigned int tagMillisec,
-								unsigned int currentMillisec,
-								unsigned int msFactor) const {
-	bool ret = false;
-
-	if ((dTS > 1.0) || (dTS < 0.0)) {
-		ret = true;
-	} else if (dTS == 1.0) {
-		unsigned int A = 1000 - tagMillisec;
-		unsigned int B = currentMillisec + A;
-
-		if (B >= msFactor)
-			ret = true;
-
-	} else if (dTS == 0.0) {
-		unsigned msD = abs(currentMillisec-tagMillisec);
-
-		if (msD >= msFactor)
-			ret = true;
-	}
-
-	return ret;
+	// Map wall-clock timestamp to the monotonic clock
+	return now.monotonic - (now.realtime - Clock::parseTimestamp(ltLast.timestamp));
 }
 
 void TagLoggerItem::setLastTimeValue(const timeVal& tv) {
@@ -373,7 +288,16 @@ TagLoggerItem::timeVal TagLoggerItem::getLastTimeValue() const {
 	checkLastUpdate(ltLast.timestamp);
 	checkLastValue(ltLast.value);
 
-	return ltLast;
+	timeVal ret = ltLast;
+
+	// Resolve time from the timestamp string (parsed only once)
+	if (ret.time.realtime == 0) {
+		ClockTime now = Clock::now();
+		ret.time.realtime = Clock::parseTimestamp(ret.timestamp);
+		ret.time.monotonic = now.monotonic - (now.realtime - ret.time.realtime);
+	}
+
+	return ret;
 }
 
 TagLoggerItem::timeVal TagLoggerItem::getCurrentTimeValue() const {
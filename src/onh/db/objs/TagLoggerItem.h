@@ -23,6 +23,7 @@
 #include <sys/time.h>
 #include <ctime>
 #include "Tag.h"
+#include "../../utils/Clock.h"
 
 namespace onh {
 
@@ -52,6 +53,9 @@ class TagLoggerItem {
 
 			/// Tag value
 			std::string value;
+
+			/// Value time (zero if not resolved from the timestamp string yet)
+			ClockTime time;
 		} timeVal;
 
 		TagLoggerItem();
@@ -245,30 +249,13 @@ class TagLoggerItem {
 		bool ltEnable;
 
 		/**
-		 * Get tag last update timestamp (seconds from epoch)
-		 *
-		 * @return Tag last update timestamp
-		 */
-		std::time_t getTagUpdateTimestamp() const;
-
-		/**
-		 *  Get tag last update milliseconds
-		 *
-		 * @return Tag last update milliseconds
-		 */
-		int getTagUpdateMilliseconds() const;
-
-		/**
-		 * Check if tag need to be updated (millisecond difference)
+		 * Get tag last update monotonic time
 		 *
-		 * @param dTS Timestamp difference (seconds)
-		 * @param tagMillisec Tag last update milliseconds
-		 * @param currentMillisec Current time milliseconds
-		 * @param msFactor Difference between current MS and tag MS which trigger update
+		 * @param now Current time
 		 *
-		 * @return  True if tag need to be updated
+		 * @return Tag last update monotonic time (milliseconds)
 		 */
-		bool msUpdate(double dTS, unsigned int tagMillisec, unsigned int currentMillisec, unsigned int msFactor) const;
+		long long int getLastMonotonic(const ClockTime& now) const;
 
 		/**
 		 * Check identifier
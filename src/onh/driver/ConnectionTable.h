@@ -0,0 +1,265 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DRIVER_CONNECTIONTABLE_H_
+#define ONH_DRIVER_CONNECTIONTABLE_H_
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+/// Slot of the not existing connection
+#define CONNECTION_TABLE_NO_SLOT 0xFFFFFFFF
+
+namespace onh {
+
+/**
+ * Driver connection table class
+ *
+ * Flat replacement of the std::map keyed by driver connection identifier.
+ * Items are stored in one dense vector (in insert order, removed item
+ * slot is filled with the last item). Every connection gets dense slot
+ * when it is inserted (driver load/reload), the connection identifier
+ * (database id) is only a key used to find that slot. Slot stays valid
+ * until the next item remove.
+ */
+template <class T>
+class ConnectionTable {
+	public:
+		/// Item type (connection identifier, value)
+		using value_type = std::pair<unsigned int, T>;
+		using iterator = typename std::vector<value_type>::iterator;
+		using const_iterator = typename std::vector<value_type>::const_iterator;
+
+		ConnectionTable() {
+		}
+
+		virtual ~ConnectionTable() {
+		}
+
+		/**
+		 * Insert item
+		 *
+		 * @param item Item to insert (connection identifier, value)
+		 *
+		 * @return True if item inserted (false if connection already exist)
+		 */
+		bool insert(value_type&& item) {
+			if (count(item.first))
+				return false;
+
+			keys.insert(findKey(item.first), std::pair<unsigned int, unsigned int>(item.first, items.size()));
+			items.push_back(std::move(item));
+
+			return true;
+		}
+
+		/**
+		 * Remove item
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return True if item removed (false if connection does not exist)
+		 */
+		bool erase(unsigned int connId) {
+			unsigned int pos = getSlot(connId);
+			if (pos == CONNECTION_TABLE_NO_SLOT)
+				return false;
+
+			// Move last item to the removed item slot
+			if (pos != items.size()-1) {
+				std::swap(items[pos], items.back());
+				findKey(items[pos].first)->second = pos;
+			}
+
+			items.pop_back();
+			keys.erase(findKey(connId));
+
+			return true;
+		}
+
+		/**
+		 * Get connection slot
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Dense slot (CONNECTION_TABLE_NO_SLOT if connection does not exist)
+		 */
+		unsigned int getSlot(unsigned int connId) const {
+			auto it = findKey(connId);
+
+			return (it != keys.end() && it->first == connId)?(it->second):(CONNECTION_TABLE_NO_SLOT);
+		}
+
+		/**
+		 * Get value from the slot
+		 *
+		 * @param slot Dense slot (returned by getSlot)
+		 *
+		 * @return Value
+		 */
+		T& atSlot(unsigned int slot) {
+			return items[slot].second;
+		}
+
+		/**
+		 * Get value from the slot
+		 *
+		 * @param slot Dense slot (returned by getSlot)
+		 *
+		 * @return Value
+		 */
+		const T& atSlot(unsigned int slot) const {
+			return items[slot].second;
+		}
+
+		/**
+		 * Get value
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Pointer to the value (nullptr if connection does not exist)
+		 */
+		T* get(unsigned int connId) {
+			unsigned int pos = getSlot(connId);
+
+			return (pos != CONNECTION_TABLE_NO_SLOT)?(&items[pos].second):(nullptr);
+		}
+
+		/**
+		 * Get value
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Pointer to the value (nullptr if connection does not exist)
+		 */
+		const T* get(unsigned int connId) const {
+			unsigned int pos = getSlot(connId);
+
+			return (pos != CONNECTION_TABLE_NO_SLOT)?(&items[pos].second):(nullptr);
+		}
+
+		/**
+		 * Find item
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Item iterator (end if connection does not exist)
+		 */
+		iterator find(unsigned int connId) {
+			unsigned int pos = getSlot(connId);
+
+			return (pos != CONNECTION_TABLE_NO_SLOT)?(items.begin() + pos):(items.end());
+		}
+
+		/**
+		 * Find item
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Item iterator (end if connection does not exist)
+		 */
+		const_iterator find(unsigned int connId) const {
+			unsigned int pos = getSlot(connId);
+
+			return (pos != CONNECTION_TABLE_NO_SLOT)?(items.begin() + pos):(items.end());
+		}
+
+		/**
+		 * Check if connection exist
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return 1 if connection exist, otherwise 0
+		 */
+		unsigned int count(unsigned int connId) const {
+			return (getSlot(connId) != CONNECTION_TABLE_NO_SLOT)?(1):(0);
+		}
+
+		/**
+		 * Get number of connections
+		 *
+		 * @return Number of connections
+		 */
+		unsigned int size() const {
+			return items.size();
+		}
+
+		/**
+		 * Remove all items
+		 */
+		void clear() {
+			items.clear();
+			keys.clear();
+		}
+
+		iterator begin() {
+			return items.begin();
+		}
+
+		iterator end() {
+			return items.end();
+		}
+
+		const_iterator begin() const {
+			return items.begin();
+		}
+
+		const_iterator end() const {
+			return items.end();
+		}
+
+	private:
+		/// Connection key iterator
+		using key_iterator = std::vector<std::pair<unsigned int, unsigned int>>::iterator;
+		using const_key_iterator = std::vector<std::pair<unsigned int, unsigned int>>::const_iterator;
+
+		/**
+		 * Find first key not less than connection identifier
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Key iterator
+		 */
+		key_iterator findKey(unsigned int connId) {
+			return std::lower_bound(keys.begin(), keys.end(), connId,
+					[](const std::pair<unsigned int, unsigned int>& k, unsigned int id) { return k.first < id; });
+		}
+
+		/**
+		 * Find first key not less than connection identifier
+		 *
+		 * @param connId Connection identifier
+		 *
+		 * @return Key iterator
+		 */
+		const_key_iterator findKey(unsigned int connId) const {
+			return std::lower_bound(keys.begin(), keys.end(), connId,
+					[](const std::pair<unsigned int, unsigned int>& k, unsigned int id) { return k.first < id; });
+		}
+
+		/// Items (dense, in insert order)
+		std::vector<value_type> items;
+
+		/// Connection identifier to item slot (sorted by connection identifier)
+		std::vector<std::pair<unsigned int, unsigned int>> keys;
+};
+
+}  // namespace onh
+
+#endif  // ONH_DRIVER_CONNECTIONTABLE_H_
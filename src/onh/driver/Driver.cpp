@@ -26,14 +26,14 @@ Driver::Driver(const std::string& logPrefix):
 		throw DriverException("Driver::Driver: Logger prefix is empty");
 
 	// Create logger object
-	log = std::make_unique<TextLogger>("driver", logPrefix);
-	log->write(LOG_INFO("Initialize driver logger with prefix: " << logPrefix));
+	log = std::make_unique<BinaryLogger>("driver", logPrefix);
+	BLOG_INFO(*log, "Initialize driver logger with prefix: {}", logPrefix);
 }
 
 Driver::~Driver() {
 }
 
-ILogger& Driver::getLog() {
+BinaryLogger& Driver::getLog() {
 	return *log;
 }
 
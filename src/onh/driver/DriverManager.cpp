@@ -17,42 +17,17 @@
  */
 
 #include "DriverManager.h"
+#include <algorithm>
 #include "SHM/ShmDriver.h"
 #include "Modbus/ModbusDriver.h"
 
 namespace onh {
 
-DriverManager::DriverManager(const std::vector<DriverConnection>& dcv) {
-	// Check drivers count
-	if (dcv.size() == 0) {
-		throw Exception("Missing driver configuration",
-						"DriverManager::DriverManager");
-	}
-
-	driver.clear();
-	driverBuffer.clear();
-
+DriverManager::DriverManager(const std::vector<DriverConnection>& dcv):
+	registry(std::make_shared<DriverRegistry>(driverRegistryData())),
+	changeNotifier(std::make_shared<ProcessChangeNotifier>()) {
 	// Create drivers
-	for (const DriverConnection& driverConn : dcv) {
-		// SHM driver
-		if (driverConn.getType() == DriverType::DT_SHM) {
-			// Create SHM driver
-			driver.insert(std::pair<unsigned int, DriverPtr>(driverConn.getId(),
-							DriverPtr(new ShmDriver(driverConn.getShmCfg(), driverConn.getId()))));
-
-		} else if (driverConn.getType() == DriverType::DT_Modbus) {
-			// Create Modbus driver
-			DriverPtr drv(new ModbusDriver(driverConn.getModbusCfg(), driverConn.getId()));
-			driver.insert(std::pair<unsigned int, DriverPtr>(driverConn.getId(), drv));
-
-			// Create Modbus driver buffer
-			DriverBufferData dbd;
-			dbd.connId = driverConn.getId();
-			dbd.updateInterval = driverConn.getModbusCfg().polling;
-			dbd.buff = drv->getBuffer();
-			driverBuffer.push_back(dbd);
-		}
-	}
+	reload(dcv);
 }
 
 DriverManager::~DriverManager() {
@@ -62,9 +37,9 @@ std::vector<ProcessUpdaterData> DriverManager::getProcessUpdaters() {
 	std::vector<ProcessUpdaterData> ret;
 
 	// Prepare all driver updaters
-	for (const auto& drv : driver) {
+	for (const auto& drv : registry->acquire()->driver) {
 		ret.push_back(ProcessUpdaterData{drv.first,
-						ProcessUpdater(drv.second->getUpdater())});
+						ProcessUpdater(drv.second->getUpdater(), changeNotifier)});
 	}
 
 	return ret;
@@ -73,10 +48,11 @@ std::vector<ProcessUpdaterData> DriverManager::getProcessUpdaters() {
 ProcessReader DriverManager::getProcessReader() {
 	ProcessReader pr;
 
-	// Add all driver readers
-	for (const auto& drv : driver) {
-		pr.addReader(drv.first, drv.second->getReader());
-	}
+	// Driver readers are created from the driver registry
+	pr.setDriverRegistry(registry);
+
+	// Process data change information
+	pr.setChangeNotifier(changeNotifier);
 
 	return pr;
 }
@@ -84,10 +60,8 @@ ProcessReader DriverManager::getProcessReader() {
 ProcessWriter DriverManager::getProcessWriter() {
 	ProcessWriter pw;
 
-	// Add all driver readers
-	for (const auto& drv : driver) {
-		pw.addWriter(drv.first, drv.second->getWriter());
-	}
+	// Driver writers and write queues are created from the driver registry
+	pw.setDriverRegistry(registry);
 
 	return pw;
 }
@@ -105,4 +79,121 @@ std::vector<DriverBufferUpdaterData> DriverManager::getDriverBufferUpdaters() {
 	return ret;
 }
 
+std::vector<DriverWriteQueueData> DriverManager::getDriverWriteQueues() {
+	std::vector<DriverWriteQueueData> ret;
+
+	for (const auto& wq : registry->acquire()->writeQueue) {
+		ret.push_back(DriverWriteQueueData{wq.first, wq.second});
+	}
+
+	return ret;
+}
+
+driverReloadData DriverManager::reload(const std::vector<DriverConnection>& dcv) {
+	// Check drivers count
+	if (dcv.size() == 0) {
+		throw Exception("Missing driver configuration",
+						"DriverManager::reload");
+	}
+
+	driverReloadData rd;
+	rd.added = 0;
+	rd.removed = 0;
+	rd.changed = 0;
+	rd.unchanged = 0;
+
+	// New configuration
+	std::map<unsigned int, DriverConnection> newConn;
+	for (const DriverConnection& driverConn : dcv) {
+		newConn[driverConn.getId()] = driverConn;
+	}
+
+	// New registry and buffers (running ones are not modified until publish)
+	driverRegistryData drivers = *registry->acquire();
+	std::vector<DriverBufferData> buffers = driverBuffer;
+
+	// Removed and changed connections
+	for (const auto& conn : connections) {
+		auto it = newConn.find(conn.first);
+
+		if (it != newConn.end() && it->second.isSameConfig(conn.second))
+			continue;
+
+		if (it == newConn.end())
+			rd.removed++;
+
+		drivers.driver.erase(conn.first);
+		drivers.writeQueue.erase(conn.first);
+		buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+						[&conn](const DriverBufferData& dbd) { return dbd.connId == conn.first; }),
+						buffers.end());
+
+		rd.stopConn.push_back(conn.first);
+	}
+
+	// Added and changed connections
+	for (const auto& conn : newConn) {
+		auto it = connections.find(conn.first);
+
+		if (it == connections.end()) {
+			rd.added++;
+		} else if (it->second.isSameConfig(conn.second)) {
+			rd.unchanged++;
+			continue;
+		} else {
+			rd.changed++;
+		}
+
+		createDriver(conn.second, drivers, buffers, rd);
+	}
+
+	// Switch to the new drivers
+	if (!rd.stopConn.empty() || rd.added > 0) {
+		registry->publish(std::make_shared<const driverRegistryData>(drivers));
+	}
+
+	connections.swap(newConn);
+	driverBuffer.swap(buffers);
+
+	return rd;
+}
+
+void DriverManager::createDriver(const DriverConnection& dc,
+									driverRegistryData& drivers,
+									std::vector<DriverBufferData>& buffers,
+									driverReloadData& rd) {
+	DriverPtr drv;
+
+	if (dc.getType() == DriverType::DT_SHM) {
+		// Create SHM driver
+		drv = DriverPtr(new ShmDriver(dc.getShmCfg(), dc.getId()));
+
+	} else if (dc.getType() == DriverType::DT_Modbus) {
+		// Create Modbus driver
+		drv = DriverPtr(new ModbusDriver(dc.getModbusCfg(), dc.getId()));
+
+		// Create Modbus driver buffer
+		DriverBufferData dbd;
+		dbd.connId = dc.getId();
+		dbd.updateInterval = dc.getModbusCfg().polling;
+		dbd.buff = drv->getBuffer();
+		buffers.push_back(dbd);
+
+		rd.bufferUpdaters.push_back(DriverBufferUpdaterData{dbd.connId,
+										dbd.updateInterval,
+										DriverBufferUpdater(dbd.buff)});
+	} else {
+		throw Exception("Unknown driver type", "DriverManager::createDriver");
+	}
+
+	// Create write queue
+	DriverWriteQueuePtr wq = std::make_shared<DriverWriteQueue>(drv->getWriter());
+
+	drivers.driver[dc.getId()] = drv;
+	drivers.writeQueue[dc.getId()] = wq;
+
+	rd.updaters.push_back(ProcessUpdaterData{dc.getId(), ProcessUpdater(drv->getUpdater(), changeNotifier)});
+	rd.writeQueues.push_back(DriverWriteQueueData{dc.getId(), wq});
+}
+
 }  // namespace onh
@@ -27,12 +27,36 @@
 #include "ProcessUpdaterData.h"
 #include "DriverBufferUpdater.h"
 #include "DriverBufferUpdaterData.h"
+#include "DriverWriteQueueData.h"
+#include "DriverRegistry.h"
 #include "../utils/Exception.h"
 #include "../utils/MutexContainer.h"
 #include "../db/objs/DriverConnection.h"
 
 namespace onh {
 
+/**
+ * Driver connections reload data
+ */
+typedef struct {
+	/// Number of added connections
+	unsigned int added;
+	/// Number of removed connections
+	unsigned int removed;
+	/// Number of changed connections (restarted)
+	unsigned int changed;
+	/// Number of unchanged connections
+	unsigned int unchanged;
+	/// Connections to stop (removed and changed)
+	std::vector<unsigned int> stopConn;
+	/// Process updaters of the connections to start (added and changed)
+	std::vector<ProcessUpdaterData> updaters;
+	/// Driver buffer updaters of the connections to start
+	std::vector<DriverBufferUpdaterData> bufferUpdaters;
+	/// Driver write queues of the connections to start
+	std::vector<DriverWriteQueueData> writeQueues;
+} driverReloadData;
+
 /**
  * Driver manager class
  */
@@ -85,6 +109,25 @@ class DriverManager {
 		 */
 		std::vector<DriverBufferUpdaterData> getDriverBufferUpdaters();
 
+		/**
+		 * Get driver write queues (executed by driver writer threads)
+		 *
+		 * @return Driver write queues data
+		 */
+		std::vector<DriverWriteQueueData> getDriverWriteQueues();
+
+		/**
+		 * Reload driver connections
+		 * New configuration is compared with the running one. Drivers of the added
+		 * and changed connections are created, then new driver registry is published
+		 * (process readers/writers switch to it on next use).
+		 *
+		 * @param dcv Driver connection configuration
+		 *
+		 * @return Reload data (connections to stop and to start)
+		 */
+		driverReloadData reload(const std::vector<DriverConnection>& dcv);
+
 	private:
 		/**
 		 * Driver buffer data structure
@@ -98,11 +141,30 @@ class DriverManager {
 			DriverBufferPtr buff;
 		} DriverBufferData;
 
-		/// Driver handle
-		std::map<unsigned int, DriverPtr> driver;
+		/**
+		 * Create driver of the connection
+		 *
+		 * @param dc Driver connection configuration
+		 * @param drivers Driver registry data (driver and write queue are added)
+		 * @param buffers Driver buffers (Modbus buffer is added)
+		 * @param rd Reload data (connection threads data are added)
+		 */
+		void createDriver(const DriverConnection& dc,
+							driverRegistryData& drivers,
+							std::vector<DriverBufferData>& buffers,
+							driverReloadData& rd);
+
+		/// Running driver connections configuration (key: driver connection identifier)
+		std::map<unsigned int, DriverConnection> connections;
 
 		/// Driver buffer handle
 		std::vector<DriverBufferData> driverBuffer;
+
+		/// Drivers and write queues of the running connections
+		DriverRegistryPtr registry;
+
+		/// Process data change notifier (shared by all updaters and readers)
+		ProcessChangeNotifierPtr changeNotifier;
 };
 
 }  // namespace onh
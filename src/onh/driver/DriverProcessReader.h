@@ -50,7 +50,7 @@ class DriverProcessReader {
 		 *
 		 * @return Bits values
 		 */
-		virtual std::vector<bool> getBitsValue(std::vector<processDataAddress> addr) = 0;
+		virtual std::vector<bool> getBitsValue(const std::vector<processDataAddress>& addr) = 0;
 
 		/**
 		 * Get byte value from process data
@@ -98,7 +98,20 @@ class DriverProcessReader {
 		virtual float getReal(processDataAddress addr) = 0;
 
 		/**
-		 * Update reader process data (copy from driver)
+		 * Get reader data slot of the process data area (used by tag handles)
+		 *
+		 * Slot holds pointer to the first byte of the area in the current snapshot
+		 * and is updated by updateProcessData. Slot is valid for the reader lifetime.
+		 *
+		 * @param addr Process data address (checked against byte count)
+		 * @param byteCount Number of bytes which will be read from the address
+		 *
+		 * @return Pointer to the area data slot
+		 */
+		virtual const BYTE* const* getDataSlot(processDataAddress addr, unsigned int byteCount) = 0;
+
+		/**
+		 * Update reader process data (acquire current driver snapshot)
 		 */
 		virtual void updateProcessData() = 0;
 
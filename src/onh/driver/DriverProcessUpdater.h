@@ -34,8 +34,10 @@ class DriverProcessUpdater {
 
 		/**
 		 * Update process data (copy from device)
+		 *
+		 * @return True if process data changed
 		 */
-		virtual void updateProcessData() = 0;
+		virtual bool updateProcessData() = 0;
 
 		/**
 		 * Create new driver process updater
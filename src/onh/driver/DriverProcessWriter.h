@@ -103,6 +103,18 @@ class DriverProcessWriter {
 		 */
 		virtual void writeReal(processDataAddress addr, float val) = 0;
 
+		/**
+		 * Write batch of operations in device process data
+		 *
+		 * All operations are checked before the first write and executed
+		 * with one driver lock (in the given order).
+		 *
+		 * @param ops Write operations
+		 * @param applied Number of the first operations written in device
+		 *                (set also when exception is thrown)
+		 */
+		virtual void writeBatch(const std::vector<processWriteOp>& ops, unsigned int& applied) = 0;
+
 		/**
 		 * Create new driver process writer
 		 *
@@ -0,0 +1,49 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DRIVER_DRIVERREGISTRY_H_
+#define ONH_DRIVER_DRIVERREGISTRY_H_
+
+#include <map>
+#include <memory>
+#include "Driver.h"
+#include "DriverWriteQueue.h"
+#include "../utils/SnapshotContainer.h"
+
+namespace onh {
+
+/**
+ * Driver registry data (drivers of the running connections)
+ */
+typedef struct {
+	/// Drivers (key: driver connection identifier)
+	std::map<unsigned int, DriverPtr> driver;
+	/// Driver write queues (key: driver connection identifier)
+	std::map<unsigned int, DriverWriteQueuePtr> writeQueue;
+} driverRegistryData;
+
+/// Driver registry (published by DriverManager, process readers/writers switch to the new drivers)
+using DriverRegistry = SnapshotContainer<driverRegistryData>;
+using DriverRegistryPtr = std::shared_ptr<DriverRegistry>;
+
+/// Driver registry snapshot
+using DriverRegistrySnapshot = std::shared_ptr<const driverRegistryData>;
+
+}  // namespace onh
+
+#endif  // ONH_DRIVER_DRIVERREGISTRY_H_
@@ -16,6 +16,7 @@
  * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "DriverUtils.h"
 #include "DriverException.h"
 
@@ -27,4 +28,39 @@ void DriverUtils::checkBitAddress(processDataAddress addr) {
 	}
 }
 
+unsigned int DriverUtils::getWriteSize(processWriteType type) {
+	unsigned int size = 0;
+
+	switch (type) {
+		case PWO_SET_BIT:
+		case PWO_RESET_BIT:
+		case PWO_INVERT_BIT:
+		case PWO_BYTE: size = 1; break;
+		case PWO_WORD: size = 2; break;
+		case PWO_DWORD:
+		case PWO_INT:
+		case PWO_REAL: size = 4; break;
+		default: throw DriverException("Wrong write operation type", "DriverUtils::getWriteSize"); break;
+	}
+
+	return size;
+}
+
+void DriverUtils::applyWrite(BYTE *data, const processWriteOp& op) {
+	switch (op.type) {
+		case PWO_SET_BIT: *data |= (1 << op.addr.bitAddr); break;
+		case PWO_RESET_BIT: *data &= ~(1 << op.addr.bitAddr); break;
+		case PWO_INVERT_BIT: *data ^= (1 << op.addr.bitAddr); break;
+		case PWO_BYTE: *data = static_cast<BYTE>(op.value); break;
+		case PWO_WORD: {
+			WORD w = static_cast<WORD>(op.value);
+			memcpy(data, &w, sizeof w);
+		} break;
+		case PWO_DWORD:
+		case PWO_INT:
+		case PWO_REAL: memcpy(data, &op.value, sizeof op.value); break;
+		default: throw DriverException("Wrong write operation type", "DriverUtils::applyWrite"); break;
+	}
+}
+
 }  // namespace onh
@@ -34,6 +34,23 @@ class DriverUtils {
 		 * @param addr Process data address
 		 */
 		static void checkBitAddress(processDataAddress addr);
+
+		/**
+		 * Get number of bytes modified by the write operation
+		 *
+		 * @param type Write operation type
+		 *
+		 * @return Number of bytes
+		 */
+		static unsigned int getWriteSize(processWriteType type);
+
+		/**
+		 * Apply write operation on the process data bytes
+		 *
+		 * @param data Pointer to the first byte modified by the operation
+		 * @param op Write operation
+		 */
+		static void applyWrite(BYTE *data, const processWriteOp& op);
 };
 
 }  // namespace onh
@@ -0,0 +1,207 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DriverWriteQueue.h"
+#include "DriverException.h"
+#include "DriverUtils.h"
+#include <chrono>
+
+namespace onh {
+
+DriverWriteQueue::DriverWriteQueue(DriverProcessWriterPtr dpw, unsigned int capacity):
+	writer(std::move(dpw)), maxSize(capacity), writesCount(0) {
+	if (!writer)
+		throw DriverException("Driver process writer is empty", "DriverWriteQueue::DriverWriteQueue");
+}
+
+DriverWriteQueue::~DriverWriteQueue() {
+	// Queue of the removed driver connection - inform writers about not executed writes
+	std::exception_ptr ex = std::make_exception_ptr(DriverException("Driver connection closed",
+																		"DriverWriteQueue::~DriverWriteQueue"));
+
+	for (std::deque<pendingWrite>& q : writes) {
+		for (pendingWrite& w : q) {
+			complete(w, ex);
+		}
+	}
+}
+
+std::future<void> DriverWriteQueue::push(const processWriteOp& op, processWritePriority prio) {
+	std::promise<void> done;
+	std::future<void> ret = done.get_future();
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+
+		std::deque<pendingWrite>& q = writes[prio];
+
+		// Older normal writes to the same address can not be executed after this write
+		std::vector<std::promise<void>> superseded;
+		if (prio == PWP_HIGH) {
+			std::deque<pendingWrite>& nq = writes[PWP_NORMAL];
+			for (auto it = nq.begin(); it != nq.end();) {
+				if (!isOverlapping(it->op, op)) {
+					++it;
+					continue;
+				}
+
+				if (canCoalesce(it->op, op)) {
+					// Replaced by the new value
+					for (std::promise<void>& p : it->done) {
+						superseded.push_back(std::move(p));
+					}
+					writesCount--;
+				} else {
+					// Keep order - execute together with high priority writes
+					q.push_back(std::move(*it));
+				}
+				it = nq.erase(it);
+			}
+		}
+
+		// Replace last write to the same address
+		if (!q.empty() && canCoalesce(q.back().op, op)) {
+			q.back().op = op;
+			for (std::promise<void>& p : superseded) {
+				q.back().done.push_back(std::move(p));
+			}
+			q.back().done.push_back(std::move(done));
+
+			return ret;
+		}
+
+		if (writesCount >= maxSize)
+			throw DriverException("Write queue is full", "DriverWriteQueue::push");
+
+		q.push_back(pendingWrite());
+		q.back().op = op;
+		for (std::promise<void>& p : superseded) {
+			q.back().done.push_back(std::move(p));
+		}
+		q.back().done.push_back(std::move(done));
+		writesCount++;
+	}
+
+	cond.notify_one();
+
+	return ret;
+}
+
+unsigned int DriverWriteQueue::execute(unsigned int timeout) {
+	std::vector<pendingWrite> pw;
+
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+
+		if (writesCount == 0) {
+			cond.wait_for(lock, std::chrono::milliseconds(timeout), [this]{ return writesCount > 0; });
+		}
+
+		// Take all pending writes (high priority first)
+		pw.reserve(writesCount);
+		for (std::deque<pendingWrite>& q : writes) {
+			for (pendingWrite& w : q) {
+				pw.push_back(std::move(w));
+			}
+			q.clear();
+		}
+		writesCount = 0;
+	}
+
+	if (pw.empty())
+		return 0;
+
+	std::vector<processWriteOp> ops;
+	ops.reserve(pw.size());
+	for (const pendingWrite& w : pw) {
+		ops.push_back(w.op);
+	}
+
+	// Number of writes done in device
+	unsigned int applied = 0;
+	// Batch exception
+	std::exception_ptr ex;
+
+	try {
+		// All writes with one driver lock
+		writer->writeBatch(ops, applied);
+		applied = pw.size();
+	} catch (...) {
+		// Writes after the failed one are not repeated (invert is not idempotent, driver may be down)
+		ex = std::current_exception();
+	}
+
+	for (unsigned int i = 0; i < pw.size(); ++i) {
+		complete(pw[i], (i < applied) ? nullptr : ex);
+	}
+
+	return pw.size();
+}
+
+unsigned int DriverWriteQueue::size() const {
+	std::lock_guard<std::mutex> lock(mtx);
+
+	return writesCount;
+}
+
+bool DriverWriteQueue::canCoalesce(const processWriteOp& pending, const processWriteOp& op) {
+	// Invert depends on the previous state
+	if (pending.type == PWO_INVERT_BIT || op.type == PWO_INVERT_BIT)
+		return false;
+
+	if (pending.addr.area != op.addr.area || pending.addr.byteAddr != op.addr.byteAddr)
+		return false;
+
+	bool pendingBit = (pending.type == PWO_SET_BIT || pending.type == PWO_RESET_BIT);
+	bool opBit = (op.type == PWO_SET_BIT || op.type == PWO_RESET_BIT);
+
+	// Set/reset of the same bit
+	if (pendingBit && opBit)
+		return pending.addr.bitAddr == op.addr.bitAddr;
+
+	return pending.type == op.type;
+}
+
+bool DriverWriteQueue::isOverlapping(const processWriteOp& w1, const processWriteOp& w2) {
+	if (w1.addr.area != w2.addr.area)
+		return false;
+
+	bool w1Bit = (w1.type == PWO_SET_BIT || w1.type == PWO_RESET_BIT || w1.type == PWO_INVERT_BIT);
+	bool w2Bit = (w2.type == PWO_SET_BIT || w2.type == PWO_RESET_BIT || w2.type == PWO_INVERT_BIT);
+
+	// Different bits of the same byte
+	if (w1Bit && w2Bit)
+		return (w1.addr.byteAddr == w2.addr.byteAddr && w1.addr.bitAddr == w2.addr.bitAddr);
+
+	unsigned int w1End = w1.addr.byteAddr + DriverUtils::getWriteSize(w1.type);
+	unsigned int w2End = w2.addr.byteAddr + DriverUtils::getWriteSize(w2.type);
+
+	return (w1.addr.byteAddr < w2End && w2.addr.byteAddr < w1End);
+}
+
+void DriverWriteQueue::complete(pendingWrite& pw, std::exception_ptr ex) {
+	for (std::promise<void>& p : pw.done) {
+		if (ex) {
+			p.set_exception(ex);
+		} else {
+			p.set_value();
+		}
+	}
+}
+
+}  // namespace onh
@@ -0,0 +1,169 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DRIVER_DRIVERWRITEQUEUE_H_
+#define ONH_DRIVER_DRIVERWRITEQUEUE_H_
+
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <condition_variable>
+#include "DriverProcessWriter.h"
+#include "ProcessDataTypes.h"
+
+/// Maximum number of pending writes in one driver write queue
+#define DRIVER_WRITE_QUEUE_CAPACITY 1024
+
+namespace onh {
+
+/**
+ * Write priority
+ */
+typedef enum {
+	PWP_HIGH = 0,
+	PWP_NORMAL = 1
+} processWritePriority;
+
+/**
+ * Driver write queue class
+ *
+ * Bounded queue of the writes to one driver connection. Writers only
+ * enqueue operations - writes are executed by one consumer (driver writer thread).
+ */
+class DriverWriteQueue {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param dpw Driver process writer
+		 * @param capacity Maximum number of pending writes
+		 */
+		DriverWriteQueue(DriverProcessWriterPtr dpw, unsigned int capacity = DRIVER_WRITE_QUEUE_CAPACITY);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		DriverWriteQueue(const DriverWriteQueue&) = delete;
+
+		virtual ~DriverWriteQueue();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		DriverWriteQueue& operator=(const DriverWriteQueue&) = delete;
+
+		/**
+		 * Enqueue write operation (never blocks on the driver)
+		 *
+		 * Write to the same address as the last pending write with the
+		 * same priority replaces that write. High priority write replaces
+		 * older normal writes to the same address (or moves them before
+		 * itself if they can not be replaced), so the order of the writes
+		 * to one address is always kept.
+		 *
+		 * @param op Write operation
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> push(const processWriteOp& op, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Execute all pending writes (high priority first)
+		 *
+		 * When the batch fails, writes after the last applied one are
+		 * completed with the batch exception (they are never repeated).
+		 *
+		 * @param timeout Maximum time to wait on writes (milliseconds)
+		 *
+		 * @return Number of executed writes
+		 */
+		unsigned int execute(unsigned int timeout);
+
+		/**
+		 * Get number of pending writes
+		 *
+		 * @return Number of pending writes
+		 */
+		unsigned int size() const;
+
+	private:
+		/**
+		 * Pending write structure
+		 */
+		typedef struct {
+			/// Write operation
+			processWriteOp op;
+			/// Write completion (one for every coalesced write)
+			std::vector<std::promise<void>> done;
+		} pendingWrite;
+
+		/**
+		 * Check if write operation can replace pending write
+		 *
+		 * @param pending Pending write operation
+		 * @param op New write operation
+		 *
+		 * @return True if new write replaces pending write
+		 */
+		static bool canCoalesce(const processWriteOp& pending, const processWriteOp& op);
+
+		/**
+		 * Check if write operations change the same process data
+		 *
+		 * @param w1 First write operation
+		 * @param w2 Second write operation
+		 *
+		 * @return True if write operations overlap
+		 */
+		static bool isOverlapping(const processWriteOp& w1, const processWriteOp& w2);
+
+		/**
+		 * Inform waiting writers about write result
+		 *
+		 * @param pw Pending write
+		 * @param ex Write exception (null on success)
+		 */
+		static void complete(pendingWrite& pw, std::exception_ptr ex);
+
+		/// Driver process writer
+		DriverProcessWriterPtr writer;
+
+		/// Maximum number of pending writes
+		unsigned int maxSize;
+
+		/// Pending writes (index: priority)
+		std::deque<pendingWrite> writes[2];
+
+		/// Number of pending writes
+		unsigned int writesCount;
+
+		/// Queue mutex
+		mutable std::mutex mtx;
+
+		/// New write condition
+		std::condition_variable cond;
+};
+
+using DriverWriteQueuePtr = std::shared_ptr<DriverWriteQueue>;
+
+}  // namespace onh
+
+#endif  // ONH_DRIVER_DRIVERWRITEQUEUE_H_
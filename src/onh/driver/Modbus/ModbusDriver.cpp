@@ -40,15 +40,15 @@ ModbusDriver::ModbusDriver(const modbusM::ModbusCfg& cfg, unsigned int connId):
 
 	// Create Modbus protocol
 	modbus = std::make_shared<modbusM::ModbusMaster>(cfg);
-	getLog() << LOG_INFO("ModbusDriver initialized");
+	BLOG_INFO(getLog(), "ModbusDriver initialized");
 
 	// Initialize registers
 	ModbusProcessData clearProcess(regCount);
 	maxByteCount = clearProcess.getMaxByte();
-	process = std::make_unique<GuardDataContainer<ModbusProcessData>>(clearProcess);
+	process = std::make_shared<SnapshotContainer<ModbusProcessData>>(clearProcess);
 	buff = std::make_unique<GuardDataContainer<ModbusProcessData>>(clearProcess);
 
-	getLog() << LOG_INFO("Process registers prepared");
+	BLOG_INFO(getLog(), "Process registers prepared");
 
 	// Connect to the controller
 	connect();
@@ -59,21 +59,20 @@ ModbusDriver::~ModbusDriver() {
 		modbus->disconnect();
 	}
 
-	getLog() << LOG_INFO("ModbusDriver driver closed");
+	BLOG_INFO(getLog(), "ModbusDriver driver closed");
 }
 
-void ModbusDriver::triggerError(const std::string& msg,
-		const std::string& fName) {
-	getLog() << LOG_ERROR(fName << ": " << msg);
+void ModbusDriver::triggerError(const char *msg, const char *fName) {
+	BLOG_ERROR(getLog(), "{}: {}", fName, msg);
 	throw DriverException(msg, fName);
 }
 
 void ModbusDriver::connect() {
 	try {
 		// Connect to the controller
-		getLog() << LOG_INFO("Connecting to the controller...");
+		BLOG_INFO(getLog(), "Connecting to the controller...");
 		modbus->connect();
-		getLog() << LOG_INFO("Connected");
+		BLOG_INFO(getLog(), "Connected");
 	} catch (modbusM::ModbusException &e) {
 		triggerError(e.what(), "ModbusDriver::connect:");
 	}
@@ -84,7 +83,7 @@ DriverBufferPtr ModbusDriver::getBuffer() {
 }
 
 DriverProcessReaderPtr ModbusDriver::getReader() {
-	return DriverProcessReaderPtr(new ModbusProcessReader(process->getController()));
+	return DriverProcessReaderPtr(new ModbusProcessReader(process));
 }
 
 DriverProcessWriterPtr ModbusDriver::getWriter() {
@@ -92,7 +91,7 @@ DriverProcessWriterPtr ModbusDriver::getWriter() {
 }
 
 DriverProcessUpdaterPtr ModbusDriver::getUpdater() {
-	return DriverProcessUpdaterPtr(new ModbusProcessUpdater(buff->getController(), process->getController(false)));
+	return DriverProcessUpdaterPtr(new ModbusProcessUpdater(buff->getController(), process));
 }
 
 }  // namespace onh
@@ -23,6 +23,7 @@
 #include "modbusmaster.h"
 #include "ModbusProcessData.h"
 #include "../../utils/GuardDataContainer.h"
+#include "../../utils/SnapshotContainer.h"
 
 namespace onh {
 
@@ -86,8 +87,8 @@ class ModbusDriver: public Driver {
 		/// Maximum Byte address
 		unsigned int maxByteCount;
 
-		/// Modbus process data
-		std::unique_ptr<GuardDataContainer<ModbusProcessData>> process;
+		/// Modbus process data snapshot
+		SnapshotContainerPtr<ModbusProcessData> process;
 
 		/// Modbus process data buffer
 		std::unique_ptr<GuardDataContainer<ModbusProcessData>> buff;
@@ -109,7 +110,7 @@ class ModbusDriver: public Driver {
 		 * @param msg Exception message
 		 * @param fName Function from which exception was throwed
 		 */
-		void triggerError(const std::string& msg, const std::string& fName);
+		void triggerError(const char *msg, const char *fName);
 };
 
 }  // namespace onh
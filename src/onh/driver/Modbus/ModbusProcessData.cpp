@@ -53,8 +53,11 @@ ModbusProcessData::ModbusProcessData(const ModbusProcessData &mpd):
 	mreg.holdingReg = new WORD[mreg.regCount];
 	mreg.inputReg = new WORD[mreg.regCount];
 
-	// Clear all registers
-	clear();
+	// Copy registers
+	for (int i=0; i < mreg.regCount; ++i) {
+		mreg.holdingReg[i] = mpd.mreg.holdingReg[i];
+		mreg.inputReg[i] = mpd.mreg.inputReg[i];
+	}
 }
 
 ModbusProcessData::~ModbusProcessData() {
@@ -71,18 +74,21 @@ ModbusProcessData& ModbusProcessData::operator=(const ModbusProcessData &mpd) {
 		return *this;
 	}
 
-	// Release memory
-	if (mreg.holdingReg)
-		delete [] mreg.holdingReg;
-	if (mreg.inputReg)
-		delete [] mreg.inputReg;
+	// Reallocate only if registers count changed
+	if (!mreg.holdingReg || !mreg.inputReg || mreg.regCount != mpd.mreg.regCount) {
+		// Release memory
+		if (mreg.holdingReg)
+			delete [] mreg.holdingReg;
+		if (mreg.inputReg)
+			delete [] mreg.inputReg;
 
-	// Registers count
-	mreg.regCount = mpd.mreg.regCount;
-	mreg.maxByteCount = mpd.mreg.maxByteCount;
+		// Registers count
+		mreg.regCount = mpd.mreg.regCount;
 
-	mreg.holdingReg = new WORD[mreg.regCount];
-	mreg.inputReg = new WORD[mreg.regCount];
+		mreg.holdingReg = new WORD[mreg.regCount];
+		mreg.inputReg = new WORD[mreg.regCount];
+	}
+	mreg.maxByteCount = mpd.mreg.maxByteCount;
 
 	// Copy registers
 	for (int i=0; i < mreg.regCount; ++i) {
@@ -124,6 +130,7 @@ bool ModbusProcessData::getBit(processDataAddress addr) const {
 std::vector<bool> ModbusProcessData::getBits(const std::vector<processDataAddress>& addr) const {
 	// Return vector
 	std::vector<bool> retV;
+	retV.reserve(addr.size());
 
 	for (unsigned int i=0; i < addr.size(); ++i) {
 		// Get one bit
@@ -362,6 +369,21 @@ float ModbusProcessData::getReal(processDataAddress addr) const {
 	return ret;
 }
 
+const BYTE* ModbusProcessData::getRawData(processDataAddress addr, unsigned int byteCount) const {
+	// Check byte count
+	if (byteCount == 0 || byteCount > mreg.maxByteCount) {
+		throw DriverException("Byte address is out of range", "ModbusProcessData::getRawData");
+	}
+
+	// Check process address
+	ModbusUtils::checkProcessAddress(addr, mreg.maxByteCount, byteCount-1);
+
+	// Registers are stored in host byte order (little endian - same assumption as in getWord/getDWord)
+	const WORD *regs = (addr.area == PDA_INPUT)?(mreg.inputReg):(mreg.holdingReg);
+
+	return reinterpret_cast<const BYTE*>(regs) + addr.byteAddr;
+}
+
 unsigned int ModbusProcessData::getMaxByte() const {
 	return mreg.maxByteCount;
 }
@@ -377,4 +399,16 @@ WORD ModbusProcessData::getRegCount() const {
 	return mreg.regCount;
 }
 
+bool ModbusProcessData::isEqual(const ModbusProcessData &mpd) const {
+	// Check registers count
+	if (mreg.regCount != mpd.mreg.regCount)
+		return false;
+
+	// Compare registers
+	size_t regSize = mreg.regCount*sizeof(WORD);
+
+	return ((memcmp(mreg.holdingReg, mpd.mreg.holdingReg, regSize) == 0) &&
+			(memcmp(mreg.inputReg, mpd.mreg.inputReg, regSize) == 0));
+}
+
 }  // namespace onh
@@ -125,6 +125,18 @@ class ModbusProcessData {
 		 */
 		float getReal(processDataAddress addr) const;
 
+		/**
+		 * Get pointer to the raw process data
+		 *
+		 * Pointer stays valid until registers count is changed.
+		 *
+		 * @param addr Process data address
+		 * @param byteCount Number of bytes which will be read from the pointer
+		 *
+		 * @return Pointer to the first byte of the process data
+		 */
+		const BYTE* getRawData(processDataAddress addr, unsigned int byteCount) const;
+
 		/**
 		 * Get max Byte address
 		 *
@@ -144,6 +156,15 @@ class ModbusProcessData {
 		 */
 		void clear();
 
+		/**
+		 * Check if registers are equal to the registers of the other process data
+		 *
+		 * @param mpd Modbus process data to compare
+		 *
+		 * @return True if registers are equal
+		 */
+		bool isEqual(const ModbusProcessData &mpd) const;
+
 	private:
 		/// Process registers count
 		ModbusRegisters mreg;
@@ -23,45 +23,62 @@
 
 namespace onh {
 
-ModbusProcessReader::ModbusProcessReader(const GuardDataController<ModbusProcessData> &gdc):
-	driverProcess(gdc) {
-	// Init process data
-	driverProcess.getData(process);
+ModbusProcessReader::ModbusProcessReader(SnapshotContainerPtr<ModbusProcessData> snap):
+	process(nullptr), driverProcess(snap), areaData{nullptr} {
+	if (!driverProcess)
+		throw Exception("Missing process data snapshot container", "ModbusProcessReader::ModbusProcessReader");
+
+	updateProcessData();
 }
 
 ModbusProcessReader::~ModbusProcessReader() {
 }
 
 bool ModbusProcessReader::getBitValue(processDataAddress addr) {
-	return process.getBit(addr);
+	return process->getBit(addr);
 }
 
-std::vector<bool> ModbusProcessReader::getBitsValue(std::vector<processDataAddress> addr) {
-	return process.getBits(addr);
+std::vector<bool> ModbusProcessReader::getBitsValue(const std::vector<processDataAddress>& addr) {
+	return process->getBits(addr);
 }
 
 BYTE ModbusProcessReader::getByte(processDataAddress addr) {
-	return process.getByte(addr);
+	return process->getByte(addr);
 }
 
 WORD ModbusProcessReader::getWord(processDataAddress addr) {
-	return process.getWord(addr);
+	return process->getWord(addr);
 }
 
 DWORD ModbusProcessReader::getDWord(processDataAddress addr) {
-	return process.getDWord(addr);
+	return process->getDWord(addr);
 }
 
 int ModbusProcessReader::getInt(processDataAddress addr) {
-	return process.getInt(addr);
+	return process->getInt(addr);
 }
 
 float ModbusProcessReader::getReal(processDataAddress addr) {
-	return process.getReal(addr);
+	return process->getReal(addr);
+}
+
+const BYTE* const* ModbusProcessReader::getDataSlot(processDataAddress addr, unsigned int byteCount) {
+	// Check address (throws if out of range)
+	process->getRawData(addr, byteCount);
+
+	return &areaData[(addr.area == PDA_INPUT)?(0):(1)];
 }
 
 void ModbusProcessReader::updateProcessData() {
-	driverProcess.getData(process);
+	// Acquire current driver snapshot
+	process = driverProcess->acquire();
+
+	updateDataSlots();
+}
+
+void ModbusProcessReader::updateDataSlots() {
+	areaData[0] = process->getRawData({PDA_INPUT, 0, 0}, 1);
+	areaData[1] = process->getRawData({PDA_OUTPUT, 0, 0}, 1);
 }
 
 DriverProcessReaderPtr ModbusProcessReader::createNew() {
@@ -21,7 +21,7 @@
 
 #include "../DriverProcessReader.h"
 #include "ModbusProcessData.h"
-#include "../../utils/GuardDataController.h"
+#include "../../utils/SnapshotContainer.h"
 
 namespace onh {
 
@@ -63,7 +63,7 @@ class ModbusProcessReader: public DriverProcessReader {
 		 *
 		 * @return Bits values
 		 */
-		std::vector<bool> getBitsValue(std::vector<processDataAddress> addr) override;
+		std::vector<bool> getBitsValue(const std::vector<processDataAddress>& addr) override;
 
 		/**
 		 * Get byte value from process data
@@ -111,7 +111,20 @@ class ModbusProcessReader: public DriverProcessReader {
 		float getReal(processDataAddress addr) override;
 
 		/**
-		 * Update reader process data (copy from driver)
+		 * Get reader data slot of the process data area (used by tag handles)
+		 *
+		 * Slot holds pointer to the first byte of the area in the current snapshot
+		 * and is updated by updateProcessData. Slot is valid for the reader lifetime.
+		 *
+		 * @param addr Process data address (checked against byte count)
+		 * @param byteCount Number of bytes which will be read from the address
+		 *
+		 * @return Pointer to the area data slot
+		 */
+		const BYTE* const* getDataSlot(processDataAddress addr, unsigned int byteCount) override;
+
+		/**
+		 * Update reader process data (acquire current driver snapshot)
 		 */
 		void updateProcessData() override;
 
@@ -126,15 +139,23 @@ class ModbusProcessReader: public DriverProcessReader {
 		/**
 		 * Constructor (allowed only from ModbusDriver)
 		 *
-		 * @param gdc Modbus process data controller
+		 * @param snap Modbus process data snapshot container
 		 */
-		explicit ModbusProcessReader(const GuardDataController<ModbusProcessData> &gdc);
+		explicit ModbusProcessReader(SnapshotContainerPtr<ModbusProcessData> snap);
+
+		/**
+		 * Update area data slots from the current snapshot
+		 */
+		void updateDataSlots();
+
+		/// Current driver process data snapshot
+		std::shared_ptr<const ModbusProcessData> process;
 
-		/// Copy of the driver process data
-		ModbusProcessData process;
+		/// Driver process data snapshot container
+		SnapshotContainerPtr<ModbusProcessData> driverProcess;
 
-		/// Driver process data controller
-		GuardDataController<ModbusProcessData> driverProcess;
+		/// Pointers to the process data areas of the current snapshot
+		const BYTE* areaData[2];
 };
 
 }  // namespace onh
@@ -21,16 +21,41 @@
 namespace onh {
 
 ModbusProcessUpdater::ModbusProcessUpdater(const GuardDataController<ModbusProcessData> &mbuff,
-											const GuardDataController<ModbusProcessData> &gdc):
-	buff(mbuff), process(gdc) {
+											SnapshotContainerPtr<ModbusProcessData> snap):
+	buff(mbuff), process(snap), published(nullptr), spare(nullptr) {
 }
 
 ModbusProcessUpdater::~ModbusProcessUpdater() {
 }
 
-void ModbusProcessUpdater::updateProcessData() {
-	// Copy data from buffer registers to the process data registers
-	process.setData(buff);
+bool ModbusProcessUpdater::updateProcessData() {
+	bool changed = false;
+
+	std::shared_ptr<ModbusProcessData> snap;
+
+	// Reuse snapshot released by all readers
+	if (spare && spare.use_count() == 1) {
+		std::atomic_thread_fence(std::memory_order_acquire);
+		snap = spare;
+	} else {
+		snap = std::make_shared<ModbusProcessData>();
+	}
+
+	// Get buffer registers
+	buff.getData(*snap);
+
+	// Publish new process data snapshot (only when changed)
+	if (!process->acquire()->isEqual(*snap)) {
+		process->publish(snap);
+
+		spare = published;
+		published = snap;
+		changed = true;
+	} else {
+		spare = snap;
+	}
+
+	return changed;
 }
 
 DriverProcessUpdaterPtr ModbusProcessUpdater::createNew() {
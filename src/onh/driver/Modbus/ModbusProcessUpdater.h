@@ -22,6 +22,7 @@
 #include "../DriverProcessUpdater.h"
 #include "ModbusProcessData.h"
 #include "../../utils/GuardDataController.h"
+#include "../../utils/SnapshotContainer.h"
 
 namespace onh {
 
@@ -49,8 +50,10 @@ class ModbusProcessUpdater: public DriverProcessUpdater {
 
 		/**
 		 * Update process data (copy from load buffer)
+		 *
+		 * @return True if process data changed
 		 */
-		void updateProcessData() override;
+		bool updateProcessData() override;
 
 		/**
 		 * Create new driver process updater
@@ -64,16 +67,22 @@ class ModbusProcessUpdater: public DriverProcessUpdater {
 		 * Constructor with parameters (allowed only from ShmDriver)
 		 *
 		 * @param mbuff Buffer data controller
-		 * @param gdc Process data controller (write mode)
+		 * @param snap Process data snapshot container
 		 */
 		ModbusProcessUpdater(const GuardDataController<ModbusProcessData> &mbuff,
-							const GuardDataController<ModbusProcessData> &gdc);
+							SnapshotContainerPtr<ModbusProcessData> snap);
 
 		/// Driver buffer data controller
 		GuardDataController<ModbusProcessData> buff;
 
-		/// Driver process data controller (write mode)
-		GuardDataController<ModbusProcessData> process;
+		/// Driver process data snapshot container
+		SnapshotContainerPtr<ModbusProcessData> process;
+
+		/// Last published snapshot
+		std::shared_ptr<ModbusProcessData> published;
+
+		/// Snapshot reused by the next update (when released by all readers)
+		std::shared_ptr<ModbusProcessData> spare;
 };
 
 }  // namespace onh
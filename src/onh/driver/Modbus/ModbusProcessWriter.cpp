@@ -17,6 +17,7 @@
  */
 
 #include <iostream>
+#include <algorithm>
 #include "ModbusProcessWriter.h"
 #include "../DriverUtils.h"
 #include "ModbusUtils.h"
@@ -158,10 +159,16 @@ void ModbusProcessWriter::invertBit(processDataAddress addr) {
 }
 
 void ModbusProcessWriter::setBits(std::vector<processDataAddress> addr) {
+	std::vector<processWriteOp> ops;
+	ops.reserve(addr.size());
+
 	for (unsigned int i=0; i < addr.size(); ++i) {
-		// Set one bit
-		setBit(addr[i]);
+		ops.push_back({PWO_SET_BIT, addr[i], 0});
 	}
+
+	// Set all bits with coalesced register ranges
+	unsigned int applied = 0;
+	writeBatch(ops, applied);
 }
 
 void ModbusProcessWriter::writeByte(processDataAddress addr, BYTE val) {
@@ -485,6 +492,111 @@ void ModbusProcessWriter::writeReal(processDataAddress addr, float val) {
 	}
 }
 
+void ModbusProcessWriter::writeBatch(const std::vector<processWriteOp>& ops, unsigned int& applied) {
+	applied = 0;
+
+	// Registers ranges modified by operations
+	std::vector<registersRange> ranges;
+	ranges.reserve(ops.size());
+
+	// Check all operations before first write
+	for (const processWriteOp& op : ops) {
+		unsigned int size = DriverUtils::getWriteSize(op.type);
+
+		ModbusUtils::checkProcessAddress(op.addr, maxByteCount, size-1, true);
+
+		bool fullRegisters = (op.type == PWO_WORD || size == 4) && (op.addr.byteAddr % 2 == 0);
+
+		ranges.push_back({ModbusUtils::getRegisterAddress(op.addr),
+							static_cast<WORD>((op.addr.byteAddr+size-1)/2),
+							!fullRegisters});
+	}
+
+	// Coalesce overlapping and adjacent ranges
+	std::sort(ranges.begin(), ranges.end(), [](const registersRange& a, const registersRange& b) {
+		return a.first < b.first;
+	});
+
+	std::vector<registersRange> merged;
+	for (const registersRange& r : ranges) {
+		if (merged.size() > 0 && r.first <= merged.back().last+1) {
+			merged.back().last = std::max(merged.back().last, r.last);
+			merged.back().readRequired = merged.back().readRequired || r.readRequired;
+		} else {
+			merged.push_back(r);
+		}
+	}
+
+	driverLock.lock();
+
+	try {
+		// Check Modbus
+		if (!modbus) {
+			throw DriverException("Modbus protocol is not initialized", "ModbusProcessWriter::writeBatch");
+		}
+
+		// Operations with written registers
+		std::vector<bool> written(ops.size(), false);
+
+		for (const registersRange& r : merged) {
+			writeRange(r, ops);
+
+			for (unsigned int i = 0; i < ops.size(); ++i) {
+				WORD regAddr = ModbusUtils::getRegisterAddress(ops[i].addr);
+				if (regAddr >= r.first && regAddr <= r.last)
+					written[i] = true;
+			}
+
+			// Ranges are written in address order - count only first operations of the batch
+			while (applied < ops.size() && written[applied])
+				applied++;
+		}
+
+		driverLock.unlock();
+	} catch (modbusM::ModbusException &e) {
+		driverLock.unlock();
+
+		throw DriverException(e.what(), "ModbusProcessWriter::writeBatch");
+	} catch (...) {
+		driverLock.unlock();
+
+		throw;
+	}
+}
+
+void ModbusProcessWriter::writeRange(const registersRange& range, const std::vector<processWriteOp>& ops) {
+	WORD count = range.last - range.first + 1;
+
+	// Registers image (host byte order - same as single writes)
+	std::vector<WORD> reg(count, 0);
+
+	// Read current registers state
+	if (range.readRequired) {
+		for (WORD i=0; i < count; i += MODBUS_MAX_READ_REGISTERS) {
+			WORD n = std::min<WORD>(count-i, MODBUS_MAX_READ_REGISTERS);
+			modbus->READ_HOLDING_REGISTERS(range.first+i, n, &reg[i]);
+		}
+	}
+
+	// Apply operations (in batch order)
+	BYTE *data = reinterpret_cast<BYTE*>(reg.data());
+	unsigned int firstByte = range.first*2;
+
+	for (const processWriteOp& op : ops) {
+		WORD regAddr = ModbusUtils::getRegisterAddress(op.addr);
+
+		if (regAddr >= range.first && regAddr <= range.last) {
+			DriverUtils::applyWrite(&data[op.addr.byteAddr-firstByte], op);
+		}
+	}
+
+	// Write registers
+	for (WORD i=0; i < count; i += MODBUS_MAX_WRITE_REGISTERS) {
+		WORD n = std::min<WORD>(count-i, MODBUS_MAX_WRITE_REGISTERS);
+		modbus->WRITE_MULTIPLE_REGISTERS(range.first+i, n, &reg[i]);
+	}
+}
+
 DriverProcessWriterPtr ModbusProcessWriter::createNew() {
 	return DriverProcessWriterPtr(new ModbusProcessWriter(modbus, driverLock, maxByteCount));
 }
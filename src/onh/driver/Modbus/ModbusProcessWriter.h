@@ -117,6 +117,18 @@ class ModbusProcessWriter: public DriverProcessWriter {
 		 */
 		void writeReal(processDataAddress addr, float val) override;
 
+		/**
+		 * Write batch of operations in device process data
+		 *
+		 * All operations are checked before the first write and executed
+		 * with one driver lock (in the given order).
+		 *
+		 * @param ops Write operations
+		 * @param applied Number of the first operations written in device
+		 *                (set also when exception is thrown)
+		 */
+		void writeBatch(const std::vector<processWriteOp>& ops, unsigned int& applied) override;
+
 		/**
 		 * Create new driver process writer
 		 *
@@ -142,6 +154,26 @@ class ModbusProcessWriter: public DriverProcessWriter {
 
 		/// Maximum Byte address
 		unsigned int maxByteCount;
+
+		/**
+		 * Registers range modified by the write batch
+		 */
+		typedef struct {
+			/// First register address
+			WORD first;
+			/// Last register address
+			WORD last;
+			/// Registers need to be read before write (bit/byte or not aligned operations)
+			bool readRequired;
+		} registersRange;
+
+		/**
+		 * Write registers range (read, apply batch operations, write back)
+		 *
+		 * @param range Registers range
+		 * @param ops Write operations
+		 */
+		void writeRange(const registersRange& range, const std::vector<processWriteOp>& ops);
 };
 
 }  // namespace onh
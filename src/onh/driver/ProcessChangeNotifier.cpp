@@ -0,0 +1,53 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProcessChangeNotifier.h"
+#include <chrono>
+
+namespace onh {
+
+ProcessChangeNotifier::ProcessChangeNotifier():
+	generation(0) {
+}
+
+ProcessChangeNotifier::~ProcessChangeNotifier() {
+}
+
+void ProcessChangeNotifier::notifyChange() {
+	{
+		// Change under lock - waiting thread can not miss notification
+		std::lock_guard<std::mutex> lock(changeLock);
+		generation.fetch_add(1, std::memory_order_release);
+	}
+
+	changeCond.notify_all();
+}
+
+unsigned long int ProcessChangeNotifier::getGeneration() const {
+	return generation.load(std::memory_order_acquire);
+}
+
+bool ProcessChangeNotifier::waitForChange(unsigned long int gen, unsigned int timeout) const {
+	std::unique_lock<std::mutex> lock(changeLock);
+
+	return changeCond.wait_for(lock, std::chrono::milliseconds(timeout), [this, gen] {
+		return generation.load(std::memory_order_acquire) != gen;
+	});
+}
+
+}  // namespace onh
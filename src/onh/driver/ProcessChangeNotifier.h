@@ -0,0 +1,89 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DRIVER_PROCESSCHANGENOTIFIER_H_
+#define ONH_DRIVER_PROCESSCHANGENOTIFIER_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
+namespace onh {
+
+/**
+ * Process data change notifier class
+ *
+ * Shared by all process updaters - every update which changes
+ * driver process data increments the process generation and wakes
+ * threads waiting on new process data.
+ */
+class ProcessChangeNotifier {
+	public:
+		ProcessChangeNotifier();
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		ProcessChangeNotifier(const ProcessChangeNotifier&) = delete;
+
+		virtual ~ProcessChangeNotifier();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		ProcessChangeNotifier& operator=(const ProcessChangeNotifier&) = delete;
+
+		/**
+		 * Inform that process data changed
+		 */
+		void notifyChange();
+
+		/**
+		 * Get process data generation
+		 *
+		 * @return Process data generation (incremented on every change)
+		 */
+		unsigned long int getGeneration() const;
+
+		/**
+		 * Wait until process data generation changes
+		 *
+		 * @param gen Last known process data generation
+		 * @param timeout Maximum wait time (milliseconds)
+		 *
+		 * @return True if generation changed, false on timeout
+		 */
+		bool waitForChange(unsigned long int gen, unsigned int timeout) const;
+
+	private:
+		/// Process data generation
+		std::atomic<unsigned long int> generation;
+
+		/// Generation change mutex
+		mutable std::mutex changeLock;
+
+		/// Generation change condition
+		mutable std::condition_variable changeCond;
+};
+
+using ProcessChangeNotifierPtr = std::shared_ptr<ProcessChangeNotifier>;
+
+}  // namespace onh
+
+#endif  // ONH_DRIVER_PROCESSCHANGENOTIFIER_H_
@@ -19,6 +19,8 @@
 #ifndef ONH_DRIVER_PROCESSDATATYPES_H_
 #define ONH_DRIVER_PROCESSDATATYPES_H_
 
+#include "DriverRegisterTypes.h"
+
 namespace onh {
 
 /**
@@ -42,6 +44,32 @@ typedef struct {
 	unsigned int bitAddr;
 } processDataAddress;
 
+/**
+ * Process data write operation types
+ */
+typedef enum {
+	PWO_SET_BIT = 1,
+	PWO_RESET_BIT = 2,
+	PWO_INVERT_BIT = 3,
+	PWO_BYTE = 4,
+	PWO_WORD = 5,
+	PWO_DWORD = 6,
+	PWO_INT = 7,
+	PWO_REAL = 8
+} processWriteType;
+
+/**
+ * Structure of the process data write operation (used by write batches)
+ */
+typedef struct {
+	/// Operation type
+	processWriteType type;
+	/// Process data address
+	processDataAddress addr;
+	/// Value to write (raw bytes in host byte order)
+	DWORD value;
+} processWriteOp;
+
 }  // namespace onh
 
 #endif  // ONH_DRIVER_PROCESSDATATYPES_H_
@@ -18,40 +18,143 @@
 
 #include "ProcessReader.h"
 #include "DriverException.h"
+#include <string.h>
 #include <sstream>
 
 namespace onh {
 
-ProcessReader::ProcessReader(const ProcessReader &pr) {
-	driverReader.clear();
+namespace {
+
+/**
+ * Load value from the area data (host byte order - same as driver readers)
+ *
+ * @param data Area data
+ * @param offset Byte offset in the area
+ *
+ * @return Value
+ */
+template <typename T>
+T loadValue(const BYTE *data, unsigned int offset) {
+	T v;
+	memcpy(&v, data + offset, sizeof v);
+	return v;
+}
+
+}  // namespace
+
+template <typename T, typename R>
+void ProcessReader::readHandles(const std::vector<ProcessTagHandle>& handles,
+								std::vector<T>& values,
+								R readValue,
+								const char *fName) {
+	values.resize(handles.size());
+
+	// Area data of the current handles run
+	const BYTE* const* slot = nullptr;
+	const BYTE *data = nullptr;
+
+	for (size_t i=0; i < handles.size(); ++i) {
+		const ProcessTagHandle& h = handles[i];
+
+		if (!h.area)
+			throw Exception("Tag handle is not bound", fName);
+
+		// Next driver area
+		if (h.area != slot) {
+			slot = h.area;
+			data = *slot;
+		}
 
-	for (auto& it : pr.driverReader) {
-		driverReader.insert(std::pair<unsigned int, DriverProcessReaderPtr>(it.first, it.second->createNew()));
+		values[i] = readValue(data, h);
 	}
 }
 
-ProcessReader::ProcessReader() {
+ProcessReader::ProcessReader(const ProcessReader &pr):
+	driverRegistry(pr.driverRegistry), drivers(nullptr), driverGeneration(0), changeNotifier(pr.changeNotifier) {
+	driverReader.clear();
+
+	// Create own driver readers
+	updateDrivers();
+}
+
+ProcessReader::ProcessReader():
+	driverRegistry(nullptr), drivers(nullptr), driverGeneration(0), changeNotifier(nullptr) {
 	driverReader.clear();
 }
 
 ProcessReader::~ProcessReader() {
 }
 
-void ProcessReader::addReader(unsigned int id, DriverProcessReaderPtr dpr) {
-	// Check identifier
-	if (id == 0) {
-		throw Exception("Wrong driver process reader identifier",
-						"ProcessReader::addReader");
+void ProcessReader::setDriverRegistry(DriverRegistryPtr reg) {
+	if (!reg) {
+		throw Exception("Missing driver registry instance",
+						"ProcessReader::setDriverRegistry");
 	}
 
-	// Check reader
-	if (dpr == nullptr) {
-		throw Exception("Missing driver process reader instance",
-						"ProcessReader::addReader");
+	driverRegistry = reg;
+	drivers = nullptr;
+
+	updateDrivers();
+}
+
+void ProcessReader::updateDrivers() {
+	if (!driverRegistry)
+		return;
+
+	unsigned long int gen = driverRegistry->getGeneration();
+
+	if (drivers && gen == driverGeneration)
+		return;
+
+	DriverRegistrySnapshot snap = driverRegistry->acquire();
+
+	// Removed readers invalidate tag handles
+	bool removed = false;
+
+	// Remove readers of the removed or replaced drivers
+	std::vector<unsigned int> oldIds;
+	for (const auto& reader : driverReader) {
+		oldIds.push_back(reader.first);
 	}
 
-	// Add reader
-	driverReader.insert(std::pair<unsigned int, DriverProcessReaderPtr>(id, std::move(dpr)));
+	for (unsigned int id : oldIds) {
+		auto it = snap->driver.find(id);
+
+		if (it == snap->driver.end() || !drivers || drivers->driver.count(id) == 0 ||
+				drivers->driver.at(id) != it->second) {
+			driverReader.erase(id);
+			removed = true;
+		}
+	}
+
+	// Add readers of the new drivers
+	for (const auto& drv : snap->driver) {
+		if (driverReader.count(drv.first) == 0) {
+			driverReader.insert(std::pair<unsigned int, DriverProcessReaderPtr>(drv.first, drv.second->getReader()));
+		}
+	}
+
+	if (removed)
+		tagHandles.clear();
+
+	drivers = snap;
+	driverGeneration = gen;
+}
+
+DriverProcessReader& ProcessReader::getDriverReader(const Tag& tg, const char *fName) {
+	DriverProcessReaderPtr *reader = driverReader.get(tg.getConnId());
+
+	if (!reader) {
+		std::stringstream s;
+		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
+		ProcessUtils::triggerError(s.str(), tg.getName(), fName);
+	}
+
+	return **reader;
+}
+
+void ProcessReader::setChangeNotifier(ProcessChangeNotifierPtr pcn) {
+	changeNotifier = pcn;
 }
 
 bool ProcessReader::getBitValue(const Tag& tg) {
@@ -71,17 +174,11 @@ bool ProcessReader::getBitValue(const Tag& tg) {
 
 	try {
 		// Read bit
-		v = driverReader.at(tg.getConnId())->getBitValue(addr);
+		v = getDriverReader(tg, "ProcessReader::getBitValue").getBitValue(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessReader::getBitValue");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(),
-									tg.getName(),
-									"ProcessReader::getBitValue");
 	}
 
 	return v;
@@ -98,6 +195,7 @@ std::vector<bool> ProcessReader::getBitsValue(const std::vector<Tag>& tags) {
 		throw Exception("Tags array is empty", "ProcessReader::getBitsValue");
 
 	std::vector<bool> ret;
+	ret.reserve(tags.size());
 
 	// Get values
 	for (const Tag& tag : tags) {
@@ -128,15 +226,11 @@ BYTE ProcessReader::getByte(const Tag& tg) {
 
 	try {
 		// Read byte
-		b = driverReader.at(tg.getConnId())->getByte(addr);
+		b = getDriverReader(tg, "ProcessReader::getByte").getByte(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessReader::getByte");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessReader::getByte");
 	}
 
 	return b;
@@ -159,13 +253,9 @@ WORD ProcessReader::getWord(const Tag& tg) {
 
 	try {
 		// Read word
-		w = driverReader.at(tg.getConnId())->getWord(addr);
+		w = getDriverReader(tg, "ProcessReader::getWord").getWord(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessReader::getWord");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessReader::getWord");
 	}
 
 	return w;
@@ -188,13 +278,9 @@ DWORD ProcessReader::getDWord(const Tag& tg) {
 
 	try {
 		// Read double word
-		dw = driverReader.at(tg.getConnId())->getDWord(addr);
+		dw = getDriverReader(tg, "ProcessReader::getDWord").getDWord(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessReader::getDWord");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessReader::getDWord");
 	}
 
 	return dw;
@@ -217,13 +303,9 @@ int ProcessReader::getInt(const Tag& tg) {
 
 	try {
 		// Read int
-		v = driverReader.at(tg.getConnId())->getInt(addr);
+		v = getDriverReader(tg, "ProcessReader::getInt").getInt(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessReader::getInt");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessReader::getInt");
 	}
 
 	return v;
@@ -246,22 +328,137 @@ float ProcessReader::getReal(const Tag& tg) {
 
 	try {
 		// Read real
-		f = driverReader.at(tg.getConnId())->getReal(addr);
+		f = getDriverReader(tg, "ProcessReader::getReal").getReal(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessReader::getReal");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process reader with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessReader::getReal");
 	}
 
 	return f;
 }
 
+ProcessTagHandle ProcessReader::bindTag(const Tag& tg) {
+	// Check driver reader
+	if (driverReader.size() == 0) {
+		throw Exception("Driver reader is empty", "ProcessReader::bindTag");
+	}
+
+	// Bytes read by the handle
+	unsigned int byteCount = 0;
+
+	switch (tg.getType()) {
+		case TT_BIT:
+		case TT_BYTE: byteCount = 1; break;
+		case TT_WORD: byteCount = 2; break;
+		case TT_DWORD:
+		case TT_INT:
+		case TT_REAL: byteCount = 4; break;
+		default: ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessReader::bindTag"); break;
+	}
+
+	const BYTE* const* slot = nullptr;
+
+	try {
+		// Get process data area slot
+		slot = getDriverReader(tg, "ProcessReader::bindTag").getDataSlot(tg.getAddress(), byteCount);
+	} catch(DriverException &e) {
+		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessReader::bindTag");
+	}
+
+	return ProcessTagHandle(slot, tg);
+}
+
+std::vector<ProcessTagHandle> ProcessReader::bindTags(const std::vector<Tag>& tags) {
+	std::vector<ProcessTagHandle> handles;
+	handles.reserve(tags.size());
+
+	for (const Tag& tag : tags) {
+		handles.push_back(bindTag(tag));
+	}
+
+	return handles;
+}
+
+void ProcessReader::readBits(const std::vector<ProcessTagHandle>& handles, std::vector<BYTE>& values) const {
+	readHandles(handles, values, [](const BYTE *data, const ProcessTagHandle& h) {
+		return static_cast<BYTE>((data[h.offset] & h.mask) != 0);
+	}, "ProcessReader::readBits");
+}
+
+void ProcessReader::readBytes(const std::vector<ProcessTagHandle>& handles, std::vector<BYTE>& values) const {
+	readHandles(handles, values, [](const BYTE *data, const ProcessTagHandle& h) {
+		return data[h.offset];
+	}, "ProcessReader::readBytes");
+}
+
+void ProcessReader::readWords(const std::vector<ProcessTagHandle>& handles, std::vector<WORD>& values) const {
+	readHandles(handles, values, [](const BYTE *data, const ProcessTagHandle& h) {
+		return loadValue<WORD>(data, h.offset);
+	}, "ProcessReader::readWords");
+}
+
+void ProcessReader::readDWords(const std::vector<ProcessTagHandle>& handles, std::vector<DWORD>& values) const {
+	readHandles(handles, values, [](const BYTE *data, const ProcessTagHandle& h) {
+		return loadValue<DWORD>(data, h.offset);
+	}, "ProcessReader::readDWords");
+}
+
+void ProcessReader::readInts(const std::vector<ProcessTagHandle>& handles, std::vector<int>& values) const {
+	readHandles(handles, values, [](const BYTE *data, const ProcessTagHandle& h) {
+		return loadValue<int>(data, h.offset);
+	}, "ProcessReader::readInts");
+}
+
+void ProcessReader::readReals(const std::vector<ProcessTagHandle>& handles, std::vector<float>& values) const {
+	readHandles(handles, values, [](const BYTE *data, const ProcessTagHandle& h) {
+		return loadValue<float>(data, h.offset);
+	}, "ProcessReader::readReals");
+}
+
+const ProcessTagHandle& ProcessReader::getHandle(const Tag& tg, TagType tt) {
+	// Check Tag type
+	if (tg.getType() != tt) {
+		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessReader::getHandle");
+	}
+
+	auto it = tagHandles.find(tg.getId());
+
+	if (it == tagHandles.end()) {
+		it = tagHandles.emplace(tg.getId(), bindTag(tg)).first;
+	} else if (!it->second.isBoundTo(tg)) {
+		// Tag address changed
+		it->second = bindTag(tg);
+	}
+
+	return it->second;
+}
+
 void ProcessReader::updateProcessData() {
+	// Switch readers after driver connections reload
+	updateDrivers();
+
 	for (auto& reader : driverReader) {
 		reader.second->updateProcessData();
 	}
 }
 
+unsigned long int ProcessReader::getDriverGeneration() const {
+	return driverGeneration;
+}
+
+unsigned long int ProcessReader::getProcessGeneration() const {
+	if (!changeNotifier) {
+		throw Exception("Missing process change notifier", "ProcessReader::getProcessGeneration");
+	}
+
+	return changeNotifier->getGeneration();
+}
+
+bool ProcessReader::waitForProcessChange(unsigned long int generation, unsigned int timeout) const {
+	if (!changeNotifier) {
+		throw Exception("Missing process change notifier", "ProcessReader::waitForProcessChange");
+	}
+
+	return changeNotifier->waitForChange(generation, timeout);
+}
+
 }  // namespace onh
@@ -20,10 +20,14 @@
 #define ONH_DRIVER_PROCESSREADER_H_
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include "ProcessUtils.h"
+#include "ConnectionTable.h"
 #include "../db/objs/Tag.h"
 #include "DriverProcessReader.h"
+#include "ProcessChangeNotifier.h"
+#include "ProcessTagHandle.h"
+#include "DriverRegistry.h"
 
 namespace onh {
 
@@ -115,10 +119,112 @@ class ProcessReader {
 		float getReal(const Tag& tg);
 
 		/**
-		 * Update reader process data (copy from driver)
+		 * Bind tag to the process data
+		 *
+		 * @param tg Tag object
+		 *
+		 * @return Tag handle (valid as long as this process reader)
+		 */
+		ProcessTagHandle bindTag(const Tag& tg);
+
+		/**
+		 * Bind tags to the process data
+		 *
+		 * @param tags Tags vector
+		 *
+		 * @return Tag handles (same order as tags)
+		 */
+		std::vector<ProcessTagHandle> bindTags(const std::vector<Tag>& tags);
+
+		/**
+		 * Read bits through the tag handles
+		 *
+		 * @param handles Bit tag handles
+		 * @param values Output values - one byte per bit, 0 or 1 (resized to the handles count)
+		 */
+		void readBits(const std::vector<ProcessTagHandle>& handles, std::vector<BYTE>& values) const;
+
+		/**
+		 * Read bytes through the tag handles
+		 *
+		 * @param handles Byte tag handles
+		 * @param values Output values (resized to the handles count)
+		 */
+		void readBytes(const std::vector<ProcessTagHandle>& handles, std::vector<BYTE>& values) const;
+
+		/**
+		 * Read words through the tag handles
+		 *
+		 * @param handles Word tag handles
+		 * @param values Output values (resized to the handles count)
+		 */
+		void readWords(const std::vector<ProcessTagHandle>& handles, std::vector<WORD>& values) const;
+
+		/**
+		 * Read double words through the tag handles
+		 *
+		 * @param handles Double word tag handles
+		 * @param values Output values (resized to the handles count)
+		 */
+		void readDWords(const std::vector<ProcessTagHandle>& handles, std::vector<DWORD>& values) const;
+
+		/**
+		 * Read ints through the tag handles
+		 *
+		 * @param handles Int tag handles
+		 * @param values Output values (resized to the handles count)
+		 */
+		void readInts(const std::vector<ProcessTagHandle>& handles, std::vector<int>& values) const;
+
+		/**
+		 * Read reals through the tag handles
+		 *
+		 * @param handles Real tag handles
+		 * @param values Output values (resized to the handles count)
+		 */
+		void readReals(const std::vector<ProcessTagHandle>& handles, std::vector<float>& values) const;
+
+		/**
+		 * Get cached tag handle (tag is bound on first use or when its address changed)
+		 *
+		 * @param tg Tag object
+		 * @param tt Expected tag type
+		 *
+		 * @return Tag handle
+		 */
+		const ProcessTagHandle& getHandle(const Tag& tg, TagType tt);
+
+		/**
+		 * Update reader process data (acquire current driver snapshot)
+		 * Readers of the added/removed driver connections are switched first.
 		 */
 		void updateProcessData();
 
+		/**
+		 * Get driver registry generation used by this reader
+		 * (changed after driver connections reload - tag handles need to be bound again)
+		 *
+		 * @return Driver registry generation
+		 */
+		unsigned long int getDriverGeneration() const;
+
+		/**
+		 * Get process data generation (changed by process updaters)
+		 *
+		 * @return Process data generation
+		 */
+		unsigned long int getProcessGeneration() const;
+
+		/**
+		 * Wait on new process data
+		 *
+		 * @param generation Process data generation read before last process data update
+		 * @param timeout Maximum wait time (milliseconds)
+		 *
+		 * @return True if process data changed, false on timeout
+		 */
+		bool waitForProcessChange(unsigned long int generation, unsigned int timeout) const;
+
 	private:
 		/**
 		 * Constructor (allowed only from DriverManager)
@@ -126,15 +232,66 @@ class ProcessReader {
 		ProcessReader();
 
 		/**
-		 * Add Driver process reader to process reader (allowed only from DriverManager)
+		 * Read values through the tag handles
+		 * Area data is loaded once for the consecutive handles of the same driver area.
+		 *
+		 * @param handles Tag handles
+		 * @param values Output values (resized to the handles count)
+		 * @param readValue Function reading value from the area data
+		 * @param fName Function from which exception is thrown
+		 */
+		template <typename T, typename R>
+		static void readHandles(const std::vector<ProcessTagHandle>& handles,
+								std::vector<T>& values,
+								R readValue,
+								const char *fName);
+
+		/**
+		 * Set driver registry (allowed only from DriverManager)
+		 *
+		 * @param reg Driver registry
+		 */
+		void setDriverRegistry(DriverRegistryPtr reg);
+
+		/**
+		 * Switch driver readers to the current driver registry snapshot
+		 */
+		void updateDrivers();
+
+		/**
+		 * Get tag driver reader
+		 *
+		 * @param tg Tag object
+		 * @param fName Function from which exception is thrown
 		 *
-		 * @param id Driver process reader identifier
-		 * @param dpr Driver process reader
+		 * @return Driver reader
 		 */
-		void addReader(unsigned int id, DriverProcessReaderPtr dpr);
+		DriverProcessReader& getDriverReader(const Tag& tg, const char *fName);
+
+		/**
+		 * Set process data change notifier (allowed only from DriverManager)
+		 *
+		 * @param pcn Process data change notifier
+		 */
+		void setChangeNotifier(ProcessChangeNotifierPtr pcn);
 
 		/// Driver process data reader
-		std::map<unsigned int, DriverProcessReaderPtr> driverReader;
+		ConnectionTable<DriverProcessReaderPtr> driverReader;
+
+		/// Driver registry
+		DriverRegistryPtr driverRegistry;
+
+		/// Driver registry snapshot used by driver readers
+		DriverRegistrySnapshot drivers;
+
+		/// Driver registry generation used by driver readers
+		unsigned long int driverGeneration;
+
+		/// Process data change notifier
+		ProcessChangeNotifierPtr changeNotifier;
+
+		/// Cached tag handles (key: tag identifier)
+		std::unordered_map<unsigned int, ProcessTagHandle> tagHandles;
 };
 
 }  // namespace onh
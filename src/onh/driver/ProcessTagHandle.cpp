@@ -0,0 +1,47 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProcessTagHandle.h"
+
+namespace onh {
+
+ProcessTagHandle::ProcessTagHandle():
+	area(nullptr), offset(0), mask(0), connId(0), address{PDA_INPUT, 0, 0}, type(TT_BIT) {
+}
+
+ProcessTagHandle::ProcessTagHandle(const BYTE* const* slot, const Tag& tg):
+	area(slot), offset(0), mask(0), connId(tg.getConnId()), address(tg.getAddress()), type(tg.getType()) {
+	offset = address.byteAddr;
+	mask = static_cast<BYTE>(1 << address.bitAddr);
+}
+
+ProcessTagHandle::~ProcessTagHandle() {
+}
+
+bool ProcessTagHandle::isBoundTo(const Tag& tg) const {
+	const processDataAddress& addr = tg.getAddress();
+
+	return (area != nullptr &&
+			connId == tg.getConnId() &&
+			type == tg.getType() &&
+			address.area == addr.area &&
+			address.byteAddr == addr.byteAddr &&
+			address.bitAddr == addr.bitAddr);
+}
+
+}  // namespace onh
@@ -0,0 +1,164 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_DRIVER_PROCESSTAGHANDLE_H_
+#define ONH_DRIVER_PROCESSTAGHANDLE_H_
+
+#include <string.h>
+#include "../db/objs/Tag.h"
+#include "DriverRegisterTypes.h"
+
+namespace onh {
+
+/// Forward declaration
+class ProcessReader;
+
+/**
+ * Process tag handle class
+ *
+ * Tag resolved once by the ProcessReader into the reader area data slot
+ * and byte offset. Address and type are checked during binding, so reads are
+ * plain loads from the current reader snapshot. Handle is valid as long as
+ * the ProcessReader which created it.
+ */
+class ProcessTagHandle {
+	public:
+		friend class ProcessReader;
+
+		/**
+		 * Default constructor (handle not bound to any tag)
+		 */
+		ProcessTagHandle();
+
+		~ProcessTagHandle();
+
+		/**
+		 * Check if handle is bound to the process data
+		 *
+		 * @return True if handle is bound
+		 */
+		bool isBound() const {
+			return area != nullptr;
+		}
+
+		/**
+		 * Check if handle is bound to the tag (same driver, address and type)
+		 *
+		 * @param tg Tag object
+		 *
+		 * @return True if handle points to the tag process data
+		 */
+		bool isBoundTo(const Tag& tg) const;
+
+		/**
+		 * Read bit value
+		 *
+		 * @return Bit value
+		 */
+		bool getBit() const {
+			return ((*area)[offset] & mask) != 0;
+		}
+
+		/**
+		 * Read byte value
+		 *
+		 * @return Byte value
+		 */
+		BYTE getByte() const {
+			return (*area)[offset];
+		}
+
+		/**
+		 * Read word value
+		 *
+		 * @return Word value
+		 */
+		WORD getWord() const {
+			return read<WORD>();
+		}
+
+		/**
+		 * Read double word value
+		 *
+		 * @return Double word value
+		 */
+		DWORD getDWord() const {
+			return read<DWORD>();
+		}
+
+		/**
+		 * Read int value
+		 *
+		 * @return Int value
+		 */
+		int getInt() const {
+			return read<int>();
+		}
+
+		/**
+		 * Read real value
+		 *
+		 * @return Real value
+		 */
+		float getReal() const {
+			return read<float>();
+		}
+
+	private:
+		/**
+		 * Constructor (allowed only from ProcessReader)
+		 *
+		 * @param slot Reader area data slot
+		 * @param tg Tag object
+		 */
+		ProcessTagHandle(const BYTE* const* slot, const Tag& tg);
+
+		/**
+		 * Read value from the process data (host byte order - same as driver readers)
+		 *
+		 * @return Value
+		 */
+		template <typename T>
+		T read() const {
+			T v;
+			memcpy(&v, *area + offset, sizeof v);
+			return v;
+		}
+
+		/// Reader area data slot (pointer to the area in the current snapshot)
+		const BYTE* const* area;
+
+		/// Byte offset in the area
+		unsigned int offset;
+
+		/// Bit mask (bit tags)
+		BYTE mask;
+
+		/// Driver connection identifier
+		unsigned int connId;
+
+		/// Tag address
+		processDataAddress address;
+
+		/// Tag type
+		TagType type;
+};
+
+}  // namespace onh
+
+#endif  // ONH_DRIVER_PROCESSTAGHANDLE_H_
@@ -20,13 +20,14 @@
 
 namespace onh {
 
-ProcessUpdater::ProcessUpdater(const ProcessUpdater &pu) {
+ProcessUpdater::ProcessUpdater(const ProcessUpdater &pu):
+	changeNotifier(pu.changeNotifier) {
 	// Create new instance of the driver updater
 	driverUpdater = pu.driverUpdater->createNew();
 }
 
-ProcessUpdater::ProcessUpdater(DriverProcessUpdaterPtr dpu):
-	driverUpdater(std::move(dpu)) {
+ProcessUpdater::ProcessUpdater(DriverProcessUpdaterPtr dpu, ProcessChangeNotifierPtr pcn):
+	driverUpdater(std::move(dpu)), changeNotifier(pcn) {
 }
 
 ProcessUpdater::~ProcessUpdater() {
@@ -34,7 +35,10 @@ ProcessUpdater::~ProcessUpdater() {
 
 void ProcessUpdater::update() {
 	// Update process data in driver
-	driverUpdater->updateProcessData();
+	if (driverUpdater->updateProcessData() && changeNotifier) {
+		// Inform readers about new process data
+		changeNotifier->notifyChange();
+	}
 }
 
 }  // namespace onh
@@ -20,6 +20,7 @@
 #define ONH_DRIVER_PROCESSUPDATER_H_
 
 #include "DriverProcessUpdater.h"
+#include "ProcessChangeNotifier.h"
 
 namespace onh {
 
@@ -57,11 +58,15 @@ class ProcessUpdater {
 		 * Constructor with parameters (allowed only from ProcessManager)
 		 *
 		 * @param dpu Pointer to the driver process data updater
+		 * @param pcn Process data change notifier
 		 */
-		explicit ProcessUpdater(DriverProcessUpdaterPtr dpu);
+		ProcessUpdater(DriverProcessUpdaterPtr dpu, ProcessChangeNotifierPtr pcn);
 
 		/// Driver process data updater
 		DriverProcessUpdaterPtr driverUpdater;
+
+		/// Process data change notifier
+		ProcessChangeNotifierPtr changeNotifier;
 };
 
 }  // namespace onh
@@ -19,43 +19,87 @@
 #include "ProcessWriter.h"
 #include "DriverException.h"
 #include "ProcessDataTypes.h"
+#include <string.h>
+#include <chrono>
 #include <sstream>
 
 namespace onh {
 
-ProcessWriter::ProcessWriter(const ProcessWriter &pw) {
+ProcessWriter::ProcessWriter(const ProcessWriter &pw):
+	driverRegistry(pw.driverRegistry), drivers(nullptr), driverGeneration(0), batchActive(false) {
 	driverWriter.clear();
 
-	for (auto& it : pw.driverWriter) {
-		driverWriter.insert(std::pair<unsigned int, DriverProcessWriterPtr>(it.first, it.second->createNew()));
-	}
+	// Create own driver writers (write queues are shared by all process writers)
+	updateDrivers();
 }
 
-ProcessWriter::ProcessWriter() {
+ProcessWriter::ProcessWriter():
+	driverRegistry(nullptr), drivers(nullptr), driverGeneration(0), batchActive(false) {
 	driverWriter.clear();
 }
 
 ProcessWriter::~ProcessWriter() {
 }
 
-void ProcessWriter::addWriter(unsigned int id, DriverProcessWriterPtr dpw) {
-	// Check identifier
-	if (id == 0) {
-		throw Exception("Wrong driver process writer identifier",
-						"ProcessWriter::addWriter");
+void ProcessWriter::setDriverRegistry(DriverRegistryPtr reg) {
+	if (!reg) {
+		throw Exception("Missing driver registry instance",
+						"ProcessWriter::setDriverRegistry");
+	}
+
+	driverRegistry = reg;
+	drivers = nullptr;
+
+	updateDrivers();
+}
+
+void ProcessWriter::updateDrivers() {
+	if (!driverRegistry || batchActive)
+		return;
+
+	unsigned long int gen = driverRegistry->getGeneration();
+
+	if (drivers && gen == driverGeneration)
+		return;
+
+	DriverRegistrySnapshot snap = driverRegistry->acquire();
+
+	// Remove writers of the removed or replaced drivers
+	std::vector<unsigned int> oldIds;
+	for (const auto& writer : driverWriter) {
+		oldIds.push_back(writer.first);
+	}
+
+	for (unsigned int id : oldIds) {
+		auto it = snap->driver.find(id);
+
+		if (it == snap->driver.end() || !drivers || drivers->driver.count(id) == 0 ||
+				drivers->driver.at(id) != it->second) {
+			driverWriter.erase(id);
+		}
+	}
+
+	// Add writers of the new drivers
+	for (const auto& drv : snap->driver) {
+		if (driverWriter.count(drv.first) == 0) {
+			driverWriter.insert(std::pair<unsigned int, DriverProcessWriterPtr>(drv.first, drv.second->getWriter()));
+		}
 	}
 
-	// Check reader
-	if (dpw == nullptr) {
-		throw Exception("Missing driver process reader instance",
-						"ProcessWriter::addWriter");
+	// Write queues
+	writeQueue.clear();
+	for (const auto& wq : snap->writeQueue) {
+		writeQueue.insert(std::pair<unsigned int, DriverWriteQueuePtr>(wq.first, wq.second));
 	}
 
-	// Add reader
-	driverWriter.insert(std::pair<unsigned int, DriverProcessWriterPtr>(id, std::move(dpw)));
+	drivers = snap;
+	driverGeneration = gen;
 }
 
 void ProcessWriter::setBit(const Tag& tg) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::setBit");
@@ -66,21 +110,26 @@ void ProcessWriter::setBit(const Tag& tg) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::setBit");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		queueWrite(tg, PWO_SET_BIT, 0, "ProcessWriter::setBit");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Modify bit
-		driverWriter.at(tg.getConnId())->setBit(addr);
+		getDriverWriter(tg, "ProcessWriter::setBit").setBit(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessWriter::setBit");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::setBit");
 	}
 }
 
 void ProcessWriter::resetBit(const Tag& tg) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::resetBit");
@@ -91,21 +140,26 @@ void ProcessWriter::resetBit(const Tag& tg) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::resetBit");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		queueWrite(tg, PWO_RESET_BIT, 0, "ProcessWriter::resetBit");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Modify bit
-		driverWriter.at(tg.getConnId())->resetBit(addr);
+		getDriverWriter(tg, "ProcessWriter::resetBit").resetBit(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessWriter::resetBit");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::resetBit");
 	}
 }
 
 void ProcessWriter::invertBit(const Tag& tg) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::invertBit");
@@ -116,23 +170,28 @@ void ProcessWriter::invertBit(const Tag& tg) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::invertBit");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		queueWrite(tg, PWO_INVERT_BIT, 0, "ProcessWriter::invertBit");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Modify bit
-		driverWriter.at(tg.getConnId())->invertBit(addr);
+		getDriverWriter(tg, "ProcessWriter::invertBit").invertBit(addr);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessWriter::invertBit");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::invertBit");
 	}
 }
 
 void ProcessWriter::setBits(const std::vector<Tag>& tags) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::setBits");
@@ -142,8 +201,8 @@ void ProcessWriter::setBits(const std::vector<Tag>& tags) {
 	if (tags.size() == 0)
 		throw Exception("Tags array is empty", "ProcessWriter::setBits");
 
-	std::vector<processDataAddress> vAddr;
-	std::multimap<unsigned int, processDataAddress> addrs;
+	// Addresses grouped by driver writer slot
+	std::map<unsigned int, std::vector<processDataAddress>> addrs;
 
 	// Prepare Tag addresses
 	for (const Tag& tag : tags) {
@@ -152,36 +211,21 @@ void ProcessWriter::setBits(const std::vector<Tag>& tags) {
 			ProcessUtils::triggerTagTypeError(tag.getName(), "ProcessWriter::setBits");
 		}
 
-		addrs.insert(std::pair<unsigned int, processDataAddress>(tag.getConnId(),
-																tag.getAddress()));
+		addrs[getWriterSlot(tag, "ProcessWriter::setBits")].push_back(tag.getAddress());
 	}
 
-	try {
-		vAddr.clear();
-		unsigned int oldId = 0;
-		for (auto& it : addrs) {
-			// First iteration
-			if (oldId == 0) {
-				vAddr.push_back(it.second);
-			} else {
-				// Change driver id
-				if (it.first != oldId) {
-					// Set bits
-					driverWriter.at(oldId)->setBits(vAddr);
-					vAddr.clear();
-					// Add new address to the vector
-					vAddr.push_back(it.second);
-				} else {  // Driver id is the same as old
-					// Put address to the vector
-					vAddr.push_back(it.second);
-				}
-			}
-
-			oldId = it.first;
+	// Queue writes in the active batch
+	if (batchActive) {
+		for (const Tag& tag : tags) {
+			queueWrite(tag, PWO_SET_BIT, 0, "ProcessWriter::setBits");
 		}
 
-		if (vAddr.size() != 0) {
-			driverWriter.at(oldId)->setBits(vAddr);
+		return;
+	}
+
+	try {
+		for (auto& it : addrs) {
+			driverWriter.atSlot(it.first)->setBits(it.second);
 		}
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), "", "ProcessWriter::setBits");
@@ -189,6 +233,9 @@ void ProcessWriter::setBits(const std::vector<Tag>& tags) {
 }
 
 void ProcessWriter::writeByte(const Tag& tg, BYTE val) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::writeByte");
@@ -199,23 +246,28 @@ void ProcessWriter::writeByte(const Tag& tg, BYTE val) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::writeByte");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		queueWrite(tg, PWO_BYTE, val, "ProcessWriter::writeByte");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Write byte
-		driverWriter.at(tg.getConnId())->writeByte(addr, val);
+		getDriverWriter(tg, "ProcessWriter::writeByte").writeByte(addr, val);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessWriter::writeByte");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::writeByte");
 	}
 }
 
 void ProcessWriter::writeWord(const Tag& tg, WORD val) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::writeWord");
@@ -226,23 +278,28 @@ void ProcessWriter::writeWord(const Tag& tg, WORD val) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::writeWord");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		queueWrite(tg, PWO_WORD, val, "ProcessWriter::writeWord");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Write word
-		driverWriter.at(tg.getConnId())->writeWord(addr, val);
+		getDriverWriter(tg, "ProcessWriter::writeWord").writeWord(addr, val);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessWriter::writeWord");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::writeWord");
 	}
 }
 
 void ProcessWriter::writeDWord(const Tag& tg, DWORD val) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::writeDWord");
@@ -253,25 +310,28 @@ void ProcessWriter::writeDWord(const Tag& tg, DWORD val) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::writeDWord");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		queueWrite(tg, PWO_DWORD, val, "ProcessWriter::writeDWord");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Write word
-		driverWriter.at(tg.getConnId())->writeDWord(addr, val);
+		getDriverWriter(tg, "ProcessWriter::writeDWord").writeDWord(addr, val);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessWriter::writeDWord");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(),
-									tg.getName(),
-									"ProcessWriter::writeDWord");
 	}
 }
 
 void ProcessWriter::writeInt(const Tag& tg, int val) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::writeInt");
@@ -282,21 +342,28 @@ void ProcessWriter::writeInt(const Tag& tg, int val) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::writeInt");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		DWORD raw = 0;
+		memcpy(&raw, &val, sizeof val);
+		queueWrite(tg, PWO_INT, raw, "ProcessWriter::writeInt");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Write word
-		driverWriter.at(tg.getConnId())->writeInt(addr, val);
+		getDriverWriter(tg, "ProcessWriter::writeInt").writeInt(addr, val);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(), tg.getName(), "ProcessWriter::writeInt");
-	} catch(const std::out_of_range &e) {
-		std::stringstream s;
-		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::writeInt");
 	}
 }
 
 void ProcessWriter::writeReal(const Tag& tg, float val) {
+	// Switch writers after driver connections reload
+	updateDrivers();
+
 	// Check driver writer
 	if (driverWriter.size() == 0) {
 		throw Exception("Driver writer is empty", "ProcessWriter::writeReal");
@@ -307,20 +374,170 @@ void ProcessWriter::writeReal(const Tag& tg, float val) {
 		ProcessUtils::triggerTagTypeError(tg.getName(), "ProcessWriter::writeReal");
 	}
 
+	// Queue write in the active batch
+	if (batchActive) {
+		DWORD raw = 0;
+		memcpy(&raw, &val, sizeof val);
+		queueWrite(tg, PWO_REAL, raw, "ProcessWriter::writeReal");
+		return;
+	}
+
 	processDataAddress addr = tg.getAddress();
 
 	try {
 		// Write word
-		driverWriter.at(tg.getConnId())->writeReal(addr, val);
+		getDriverWriter(tg, "ProcessWriter::writeReal").writeReal(addr, val);
 	} catch(DriverException &e) {
 		ProcessUtils::triggerError(e.what(),
 									tg.getName(),
 									"ProcessWriter::writeReal");
-	} catch(const std::out_of_range &e) {
+	}
+}
+
+std::future<void> ProcessWriter::setBitAsync(const Tag& tg, processWritePriority prio) {
+	return postWrite(tg, TT_BIT, PWO_SET_BIT, 0, prio, "ProcessWriter::setBitAsync");
+}
+
+std::future<void> ProcessWriter::resetBitAsync(const Tag& tg, processWritePriority prio) {
+	return postWrite(tg, TT_BIT, PWO_RESET_BIT, 0, prio, "ProcessWriter::resetBitAsync");
+}
+
+std::future<void> ProcessWriter::invertBitAsync(const Tag& tg, processWritePriority prio) {
+	return postWrite(tg, TT_BIT, PWO_INVERT_BIT, 0, prio, "ProcessWriter::invertBitAsync");
+}
+
+std::future<void> ProcessWriter::writeByteAsync(const Tag& tg, BYTE val, processWritePriority prio) {
+	return postWrite(tg, TT_BYTE, PWO_BYTE, val, prio, "ProcessWriter::writeByteAsync");
+}
+
+std::future<void> ProcessWriter::writeWordAsync(const Tag& tg, WORD val, processWritePriority prio) {
+	return postWrite(tg, TT_WORD, PWO_WORD, val, prio, "ProcessWriter::writeWordAsync");
+}
+
+std::future<void> ProcessWriter::writeDWordAsync(const Tag& tg, DWORD val, processWritePriority prio) {
+	return postWrite(tg, TT_DWORD, PWO_DWORD, val, prio, "ProcessWriter::writeDWordAsync");
+}
+
+std::future<void> ProcessWriter::writeIntAsync(const Tag& tg, int val, processWritePriority prio) {
+	DWORD raw = 0;
+	memcpy(&raw, &val, sizeof val);
+
+	return postWrite(tg, TT_INT, PWO_INT, raw, prio, "ProcessWriter::writeIntAsync");
+}
+
+std::future<void> ProcessWriter::writeRealAsync(const Tag& tg, float val, processWritePriority prio) {
+	DWORD raw = 0;
+	memcpy(&raw, &val, sizeof val);
+
+	return postWrite(tg, TT_REAL, PWO_REAL, raw, prio, "ProcessWriter::writeRealAsync");
+}
+
+void ProcessWriter::beginBatch() {
+	if (batchActive) {
+		throw Exception("Write batch is already active", "ProcessWriter::beginBatch");
+	}
+
+	// Switch writers after driver connections reload
+	updateDrivers();
+
+	batch.assign(driverWriter.size(), std::vector<processWriteOp>());
+	batchActive = true;
+}
+
+writeBatchStats ProcessWriter::commitBatch() {
+	if (!batchActive) {
+		throw Exception("Write batch is not active", "ProcessWriter::commitBatch");
+	}
+
+	// Batch is finished even if commit fails
+	std::vector<std::vector<processWriteOp>> ops;
+	ops.swap(batch);
+	batchActive = false;
+
+	writeBatchStats stats = {0, 0, 0};
+
+	auto start = std::chrono::steady_clock::now();
+
+	try {
+		for (unsigned int slot = 0; slot < ops.size(); ++slot) {
+			if (ops[slot].empty())
+				continue;
+
+			unsigned int applied = 0;
+			driverWriter.atSlot(slot)->writeBatch(ops[slot], applied);
+
+			stats.operations += ops[slot].size();
+			stats.connections++;
+		}
+	} catch(DriverException &e) {
+		ProcessUtils::triggerError(e.what(), "", "ProcessWriter::commitBatch");
+	}
+
+	stats.latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()-start).count();
+
+	return stats;
+}
+
+void ProcessWriter::cancelBatch() {
+	batch.clear();
+	batchActive = false;
+}
+
+bool ProcessWriter::isBatchActive() const {
+	return batchActive;
+}
+
+void ProcessWriter::queueWrite(const Tag& tg, processWriteType type, DWORD value, const std::string& fName) {
+	// Writers are not switched during the batch - slot is valid until commit
+	batch[getWriterSlot(tg, fName.c_str())].push_back({type, tg.getAddress(), value});
+}
+
+unsigned int ProcessWriter::getWriterSlot(const Tag& tg, const char *fName) const {
+	unsigned int slot = driverWriter.getSlot(tg.getConnId());
+
+	if (slot == CONNECTION_TABLE_NO_SLOT) {
 		std::stringstream s;
 		s << "Driver process writer with id: " << tg.getConnId() << " does not exist";
-		ProcessUtils::triggerError(s.str(), tg.getName(), "ProcessWriter::writeReal");
+		ProcessUtils::triggerError(s.str(), tg.getName(), fName);
+	}
+
+	return slot;
+}
+
+DriverProcessWriter& ProcessWriter::getDriverWriter(const Tag& tg, const char *fName) {
+	return *driverWriter.atSlot(getWriterSlot(tg, fName));
+}
+
+std::future<void> ProcessWriter::postWrite(const Tag& tg,
+											TagType tt,
+											processWriteType type,
+											DWORD value,
+											processWritePriority prio,
+											const std::string& fName) {
+	// Switch write queues after driver connections reload
+	updateDrivers();
+
+	// Check Tag type
+	if (tg.getType() != tt) {
+		ProcessUtils::triggerTagTypeError(tg.getName(), fName);
+	}
+
+	DriverWriteQueuePtr *wq = writeQueue.get(tg.getConnId());
+	if (!wq) {
+		std::stringstream s;
+		s << "Driver write queue with id: " << tg.getConnId() << " does not exist";
+		ProcessUtils::triggerError(s.str(), tg.getName(), fName);
+	}
+
+	std::future<void> ret;
+
+	try {
+		ret = (*wq)->push({type, tg.getAddress(), value}, prio);
+	} catch(DriverException &e) {
+		ProcessUtils::triggerError(e.what(), tg.getName(), fName);
 	}
+
+	return ret;
 }
 
 }  // namespace onh
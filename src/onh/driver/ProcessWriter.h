@@ -22,15 +22,30 @@
 #include <vector>
 #include <map>
 #include "ProcessUtils.h"
+#include "ConnectionTable.h"
 #include "../utils/MutexAccess.h"
 #include "../db/objs/Tag.h"
 #include "DriverProcessWriter.h"
+#include "DriverWriteQueue.h"
+#include "DriverRegistry.h"
 
 namespace onh {
 
 /// Forward declaration
 class DriverManager;
 
+/**
+ * Write batch statistics
+ */
+typedef struct {
+	/// Number of write operations
+	unsigned int operations;
+	/// Number of driver connections
+	unsigned int connections;
+	/// Batch commit time (microseconds)
+	unsigned long int latency;
+} writeBatchStats;
+
 /**
  * Process writer class
  */
@@ -120,6 +135,115 @@ class ProcessWriter {
 		 */
 		void writeReal(const Tag& tg, float val);
 
+		/**
+		 * Set bit in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> setBitAsync(const Tag& tg, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Reset bit in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> resetBitAsync(const Tag& tg, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Invert bit in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> invertBitAsync(const Tag& tg, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Write byte in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param val Byte value
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> writeByteAsync(const Tag& tg, BYTE val, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Write word in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param val Word value
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> writeWordAsync(const Tag& tg, WORD val, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Write double word in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param val Double word value
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> writeDWordAsync(const Tag& tg, DWORD val, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Write INT in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param val INT value
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> writeIntAsync(const Tag& tg, int val, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Write Real in process data (asynchronous)
+		 *
+		 * @param tg Tag object
+		 * @param val Real value
+		 * @param prio Write priority
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> writeRealAsync(const Tag& tg, float val, processWritePriority prio = PWP_NORMAL);
+
+		/**
+		 * Begin write batch (next writes are queued until commit)
+		 */
+		void beginBatch();
+
+		/**
+		 * Commit write batch (one driver batch per connection)
+		 *
+		 * @return Batch statistics
+		 */
+		writeBatchStats commitBatch();
+
+		/**
+		 * Cancel write batch (queued writes are dropped)
+		 */
+		void cancelBatch();
+
+		/**
+		 * Check if write batch is active
+		 *
+		 * @return True if writes are queued
+		 */
+		bool isBatchActive() const;
+
 	private:
 		/**
 		 * Constructor (allowed only from DriverManager)
@@ -127,15 +251,87 @@ class ProcessWriter {
 		ProcessWriter();
 
 		/**
-		 * Add Driver process writer to process writer (allowed only from DriverManager)
+		 * Set driver registry (allowed only from DriverManager)
 		 *
-		 * @param id Driver process writer identifier
-		 * @param dpw Driver process writer
+		 * @param reg Driver registry
 		 */
-		void addWriter(unsigned int id, DriverProcessWriterPtr dpw);
+		void setDriverRegistry(DriverRegistryPtr reg);
+
+		/**
+		 * Switch driver writers and write queues to the current driver registry snapshot
+		 * (not switched during active write batch)
+		 */
+		void updateDrivers();
 
 		/// Driver process data writer
-		std::map<unsigned int, DriverProcessWriterPtr> driverWriter;
+		ConnectionTable<DriverProcessWriterPtr> driverWriter;
+
+		/// Driver write queues (asynchronous writes)
+		ConnectionTable<DriverWriteQueuePtr> writeQueue;
+
+		/// Driver registry
+		DriverRegistryPtr driverRegistry;
+
+		/// Driver registry snapshot used by driver writers
+		DriverRegistrySnapshot drivers;
+
+		/// Driver registry generation used by driver writers
+		unsigned long int driverGeneration;
+
+		/**
+		 * Put write operation in the driver write queue
+		 *
+		 * @param tg Tag object
+		 * @param tt Expected Tag type
+		 * @param type Write operation type
+		 * @param value Raw value to write
+		 * @param prio Write priority
+		 * @param fName Function from which exception is thrown
+		 *
+		 * @return Future ready after write execution
+		 */
+		std::future<void> postWrite(const Tag& tg,
+									TagType tt,
+									processWriteType type,
+									DWORD value,
+									processWritePriority prio,
+									const std::string& fName);
+
+		/**
+		 * Queue write operation in the active batch
+		 *
+		 * @param tg Tag object
+		 * @param type Write operation type
+		 * @param value Raw value to write
+		 * @param fName Function from which exception is thrown
+		 */
+		void queueWrite(const Tag& tg, processWriteType type, DWORD value, const std::string& fName);
+
+		/**
+		 * Get slot of the tag driver writer
+		 *
+		 * @param tg Tag object
+		 * @param fName Function from which exception is thrown
+		 *
+		 * @return Driver writer slot
+		 */
+		unsigned int getWriterSlot(const Tag& tg, const char *fName) const;
+
+		/**
+		 * Get tag driver writer
+		 *
+		 * @param tg Tag object
+		 * @param fName Function from which exception is thrown
+		 *
+		 * @return Driver writer
+		 */
+		DriverProcessWriter& getDriverWriter(const Tag& tg, const char *fName);
+
+		/// Write batch active flag
+		bool batchActive;
+
+		/// Queued write operations (index: driver writer slot)
+		std::vector<std::vector<processWriteOp>> batch;
 };
 
 }  // namespace onh
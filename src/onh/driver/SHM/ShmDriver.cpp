@@ -33,7 +33,8 @@
 namespace onh {
 
 ShmDriver::ShmDriver(const std::string& segmentName, unsigned int connId):
-	Driver("shm_"+std::to_string(connId)+"_"), sfd(0), shm(0), shmName(segmentName) {
+	Driver("shm_"+std::to_string(connId)+"_"), sfd(0), shm(0), shmName(segmentName),
+	process(std::make_shared<SnapshotContainer<ShmProcessData>>(ShmProcessData())) {
 	if (shmName == "") {
 		triggerError("SHM segment name is empty", "ShmDriver::ShmDriver");
 	}
@@ -45,10 +46,11 @@ ShmDriver::ShmDriver(const std::string& segmentName, unsigned int connId):
 	shm = (sMemory*) mmap(NULL, smSize, PROT_READ | PROT_WRITE, MAP_SHARED, sfd, 0);
 
 	if (shm == MAP_FAILED) {
-		triggerError("SHM ("+shmName+") is not initialized", "ShmDriver::ShmDriver");
+		std::string msg = "SHM ("+shmName+") is not initialized";
+		triggerError(msg.c_str(), "ShmDriver::ShmDriver");
 	}
 
-	getLog() << LOG_INFO("SHM ("+shmName+") driver initialized");
+	BLOG_INFO(getLog(), "SHM ({}) driver initialized", shmName);
 }
 
 ShmDriver::~ShmDriver() {
@@ -58,11 +60,11 @@ ShmDriver::~ShmDriver() {
 	// Close shared memory object
 	close(sfd);
 
-	getLog() << LOG_INFO("Shm driver closed");
+	BLOG_INFO(getLog(), "Shm driver closed");
 }
 
-void ShmDriver::triggerError(const std::string& msg, const std::string& fName) {
-	getLog() << LOG_ERROR(fName << ": " << msg);
+void ShmDriver::triggerError(const char *msg, const char *fName) {
+	BLOG_ERROR(getLog(), "{}: {}", fName, msg);
 	throw DriverException(msg, fName);
 }
 
@@ -71,7 +73,7 @@ DriverBufferPtr ShmDriver::getBuffer() {
 }
 
 DriverProcessReaderPtr ShmDriver::getReader() {
-	return DriverProcessReaderPtr(new ShmProcessReader(process.getController()));
+	return DriverProcessReaderPtr(new ShmProcessReader(process));
 }
 
 DriverProcessWriterPtr ShmDriver::getWriter() {
@@ -79,7 +81,7 @@ DriverProcessWriterPtr ShmDriver::getWriter() {
 }
 
 DriverProcessUpdaterPtr ShmDriver::getUpdater() {
-	return DriverProcessUpdaterPtr(new ShmProcessUpdater(shmName, shm, process.getController(false), driverLock.getAccess()));
+	return DriverProcessUpdaterPtr(new ShmProcessUpdater(shmName, shm, process, driverLock.getAccess()));
 }
 
 }  // namespace onh
@@ -20,7 +20,8 @@
 #define ONH_DRIVER_SHM_SHMDRIVER_H_
 
 #include "../Driver.h"
-#include "../../utils/GuardDataContainer.h"
+#include "../../utils/MutexContainer.h"
+#include "../../utils/SnapshotContainer.h"
 #include "sMemory.h"
 #include "ShmProcessData.h"
 
@@ -95,8 +96,8 @@ class ShmDriver: public Driver {
 		/// Driver access protection
 		MutexContainer driverLock;
 
-		/// Copy of the controller process data
-		GuardDataContainer<ShmProcessData> process;
+		/// Snapshot of the controller process data
+		SnapshotContainerPtr<ShmProcessData> process;
 
 		/**
 		 * Trigger error (write log and throw exception)
@@ -104,7 +105,7 @@ class ShmDriver: public Driver {
 		 * @param msg Exception message
 		 * @param fName Function from which exception was thrown
 		 */
-		void triggerError(const std::string& msg, const std::string& fName);
+		void triggerError(const char *msg, const char *fName);
 };
 
 }  // namespace onh
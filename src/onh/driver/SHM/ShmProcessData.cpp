@@ -61,12 +61,9 @@ ShmProcessData& ShmProcessData::operator=(const ShmProcessData &spd) {
 		return *this;
 	}
 
-	// Release memory
-	if (process)
-		delete process;
-
-	// Create process data
-	process = new processData();
+	// Create process data (keep existing buffer)
+	if (!process)
+		process = new processData();
 
 	// Copy data
 	*process = *spd.process;
@@ -101,6 +98,7 @@ bool ShmProcessData::getBit(processDataAddress addr) const {
 
 std::vector<bool> ShmProcessData::getBits(const std::vector<processDataAddress>& addr) const {
 	std::vector<bool> retV;
+	retV.reserve(addr.size());
 
 	for (unsigned int i=0; i < addr.size(); ++i) {
 		// Read bit value
@@ -283,6 +281,27 @@ float ShmProcessData::getReal(processDataAddress addr) const {
 	return f;
 }
 
+const BYTE* ShmProcessData::getRawData(processDataAddress addr, unsigned int byteCount) const {
+	// Check bit address
+	DriverUtils::checkBitAddress(addr);
+
+	// Check byte address
+	if (byteCount == 0 || byteCount > PROCESS_DT_SIZE || addr.byteAddr > PROCESS_DT_SIZE-byteCount) {
+		throw DriverException("Byte address is out of range", "ShmProcessData::getRawData");
+	}
+
+	const BYTE *data = nullptr;
+
+	switch (addr.area) {
+		case PDA_INPUT: data = &process->in[addr.byteAddr]; break;
+		case PDA_OUTPUT: data = &process->out[addr.byteAddr]; break;
+		case PDA_MEMORY: data = &process->mem[addr.byteAddr]; break;
+		default: throw DriverException("Wrong address area", "ShmProcessData::getRawData"); break;
+	}
+
+	return data;
+}
+
 void ShmProcessData::clear() {
 	for (unsigned int i=0; i < PROCESS_DT_SIZE; ++i) {
 		process->in[i] = 0;
@@ -291,4 +310,13 @@ void ShmProcessData::clear() {
 	}
 }
 
+bool ShmProcessData::isEqual(const processData &pd) const {
+	return (memcmp(process, &pd, sizeof(processData)) == 0);
+}
+
+void ShmProcessData::update(const processData &pd) {
+	// Copy data
+	*process = pd;
+}
+
 }  // namespace onh
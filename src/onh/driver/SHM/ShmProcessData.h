@@ -118,11 +118,39 @@ class ShmProcessData {
 		 */
 		float getReal(processDataAddress addr) const;
 
+		/**
+		 * Get pointer to the raw process data
+		 *
+		 * Pointer stays valid for the object lifetime (assignment copies data in place).
+		 *
+		 * @param addr Process data address
+		 * @param byteCount Number of bytes which will be read from the pointer
+		 *
+		 * @return Pointer to the first byte of the process data
+		 */
+		const BYTE* getRawData(processDataAddress addr, unsigned int byteCount) const;
+
 		/**
 		 * Clear process data
 		 */
 		void clear();
 
+		/**
+		 * Check if process data are equal to the SHM process data structure
+		 *
+		 * @param pd SHM process data structure
+		 *
+		 * @return True if process data are equal
+		 */
+		bool isEqual(const processData &pd) const;
+
+		/**
+		 * Update process data from the SHM process data structure
+		 *
+		 * @param pd SHM process data structure
+		 */
+		void update(const processData &pd);
+
 	private:
 		/// SHM process data
 		processData *process;
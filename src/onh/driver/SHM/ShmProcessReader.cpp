@@ -22,8 +22,11 @@
 
 namespace onh {
 
-ShmProcessReader::ShmProcessReader(const GuardDataController<ShmProcessData>& gdc):
-	driverProcess(gdc) {
+ShmProcessReader::ShmProcessReader(SnapshotContainerPtr<ShmProcessData> snap):
+	process(nullptr), driverProcess(snap), areaData{nullptr} {
+	if (!driverProcess)
+		throw Exception("Missing process data snapshot container", "ShmProcessReader::ShmProcessReader");
+
 	updateProcessData();
 }
 
@@ -31,36 +34,51 @@ ShmProcessReader::~ShmProcessReader() {
 }
 
 bool ShmProcessReader::getBitValue(processDataAddress addr) {
-	return process.getBit(addr);
+	return process->getBit(addr);
 }
 
-std::vector<bool> ShmProcessReader::getBitsValue(std::vector<processDataAddress> addr) {
-	return process.getBits(addr);
+std::vector<bool> ShmProcessReader::getBitsValue(const std::vector<processDataAddress>& addr) {
+	return process->getBits(addr);
 }
 
 BYTE ShmProcessReader::getByte(processDataAddress addr) {
-	return process.getByte(addr);
+	return process->getByte(addr);
 }
 
 WORD ShmProcessReader::getWord(processDataAddress addr) {
-	return process.getWord(addr);
+	return process->getWord(addr);
 }
 
 DWORD ShmProcessReader::getDWord(processDataAddress addr) {
-	return process.getDWord(addr);
+	return process->getDWord(addr);
 }
 
 int ShmProcessReader::getInt(processDataAddress addr) {
-	return process.getInt(addr);
+	return process->getInt(addr);
 }
 
 float ShmProcessReader::getReal(processDataAddress addr) {
-	return process.getReal(addr);
+	return process->getReal(addr);
+}
+
+const BYTE* const* ShmProcessReader::getDataSlot(processDataAddress addr, unsigned int byteCount) {
+	// Check address (throws if out of range)
+	process->getRawData(addr, byteCount);
+
+	return &areaData[addr.area-1];
 }
 
 void ShmProcessReader::updateProcessData() {
-	// Copy data from driver
-	driverProcess.getData(process);
+	// Acquire current driver snapshot
+	process = driverProcess->acquire();
+
+	updateDataSlots();
+}
+
+void ShmProcessReader::updateDataSlots() {
+	areaData[0] = process->getRawData({PDA_INPUT, 0, 0}, 1);
+	areaData[1] = process->getRawData({PDA_OUTPUT, 0, 0}, 1);
+	areaData[2] = process->getRawData({PDA_MEMORY, 0, 0}, 1);
 }
 
 DriverProcessReaderPtr ShmProcessReader::createNew() {
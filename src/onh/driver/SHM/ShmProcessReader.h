@@ -21,7 +21,7 @@
 
 #include "../DriverProcessReader.h"
 #include "ShmProcessData.h"
-#include "../../utils/GuardDataController.h"
+#include "../../utils/SnapshotContainer.h"
 
 namespace onh {
 
@@ -63,7 +63,7 @@ class ShmProcessReader: public DriverProcessReader {
 		 *
 		 * @return Bits values
 		 */
-		std::vector<bool> getBitsValue(std::vector<processDataAddress> addr) override;
+		std::vector<bool> getBitsValue(const std::vector<processDataAddress>& addr) override;
 
 		/**
 		 * Get byte value from process data
@@ -111,7 +111,20 @@ class ShmProcessReader: public DriverProcessReader {
 		float getReal(processDataAddress addr) override;
 
 		/**
-		 * Update reader process data (copy from driver)
+		 * Get reader data slot of the process data area (used by tag handles)
+		 *
+		 * Slot holds pointer to the first byte of the area in the current snapshot
+		 * and is updated by updateProcessData. Slot is valid for the reader lifetime.
+		 *
+		 * @param addr Process data address (checked against byte count)
+		 * @param byteCount Number of bytes which will be read from the address
+		 *
+		 * @return Pointer to the area data slot
+		 */
+		const BYTE* const* getDataSlot(processDataAddress addr, unsigned int byteCount) override;
+
+		/**
+		 * Update reader process data (acquire current driver snapshot)
 		 */
 		void updateProcessData() override;
 
@@ -126,15 +139,23 @@ class ShmProcessReader: public DriverProcessReader {
 		/**
 		 * Constructor (allowed only from ShmDriver)
 		 *
-		 * @param gdc Shm process data controller
+		 * @param snap Shm process data snapshot container
 		 */
-		explicit ShmProcessReader(const GuardDataController<ShmProcessData>& gdc);
+		explicit ShmProcessReader(SnapshotContainerPtr<ShmProcessData> snap);
+
+		/**
+		 * Update area data slots from the current snapshot
+		 */
+		void updateDataSlots();
+
+		/// Current driver process data snapshot
+		std::shared_ptr<const ShmProcessData> process;
 
-		/// Copy of the driver process data
-		ShmProcessData process;
+		/// Driver process data snapshot container
+		SnapshotContainerPtr<ShmProcessData> driverProcess;
 
-		/// Driver process data controller
-		GuardDataController<ShmProcessData> driverProcess;
+		/// Pointers to the process data areas of the current snapshot
+		const BYTE* areaData[3];
 };
 
 }  // namespace onh
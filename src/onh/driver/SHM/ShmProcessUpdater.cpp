@@ -26,15 +26,17 @@ namespace onh {
 
 ShmProcessUpdater::ShmProcessUpdater(const std::string& segmentName,
 										sMemory *smem,
-										const GuardDataController<ShmProcessData> &gdc,
+										SnapshotContainerPtr<ShmProcessData> snap,
 										const MutexAccess& lock):
-	shmName(segmentName), shm(smem), process(gdc), driverLock(lock) {
+	shmName(segmentName), shm(smem), process(snap), published(nullptr), spare(nullptr), driverLock(lock) {
 }
 
 ShmProcessUpdater::~ShmProcessUpdater() {
 }
 
-void ShmProcessUpdater::updateProcessData() {
+bool ShmProcessUpdater::updateProcessData() {
+	bool changed = false;
+
 	driverLock.lock();
 
 	try {
@@ -48,8 +50,30 @@ void ShmProcessUpdater::updateProcessData() {
 			throw DriverException("Can not lock process mutex in SHM", "ShmProcessUpdater::updateProcessData");
 		}
 
-		// Copy process data
-		process.setData(ShmProcessData(shm->process.procDT));
+		// Publish new process data snapshot (only when changed)
+		try {
+			if (!process->acquire()->isEqual(shm->process.procDT)) {
+				std::shared_ptr<ShmProcessData> snap;
+
+				// Reuse snapshot released by all readers
+				if (spare && spare.use_count() == 1) {
+					std::atomic_thread_fence(std::memory_order_acquire);
+					snap = spare;
+				} else {
+					snap = std::make_shared<ShmProcessData>();
+				}
+
+				snap->update(shm->process.procDT);
+				process->publish(snap);
+
+				spare = published;
+				published = snap;
+				changed = true;
+			}
+		} catch (...) {
+			pthread_mutex_unlock(&shm->process.processMutex);
+			throw;
+		}
 
 		// Unlock process mutex
 		if (pthread_mutex_unlock(&shm->process.processMutex) != 0) {
@@ -64,6 +88,8 @@ void ShmProcessUpdater::updateProcessData() {
 		// Re-throw exception
 		throw;
 	}
+
+	return changed;
 }
 
 DriverProcessUpdaterPtr ShmProcessUpdater::createNew() {
@@ -21,7 +21,8 @@
 
 #include "../DriverProcessUpdater.h"
 #include "ShmProcessData.h"
-#include "../../utils/GuardDataController.h"
+#include "../../utils/MutexAccess.h"
+#include "../../utils/SnapshotContainer.h"
 #include "sMemory.h"
 
 namespace onh {
@@ -50,8 +51,10 @@ class ShmProcessUpdater: public DriverProcessUpdater {
 
 		/**
 		 * Update process data (copy from device)
+		 *
+		 * @return True if process data changed
 		 */
-		void updateProcessData() override;
+		bool updateProcessData() override;
 
 		/**
 		 * Create new driver process updater
@@ -66,12 +69,12 @@ class ShmProcessUpdater: public DriverProcessUpdater {
 		 *
 		 * @param segmentName Shared memory segment name
 		 * @param smem SHM structure handle
-		 * @param gdc SHM process data controller (write mode)
+		 * @param snap SHM process data snapshot container
 		 * @param lock Mutex for protecting driver
 		 */
 		ShmProcessUpdater(const std::string& segmentName,
 							sMemory *smem,
-							const GuardDataController<ShmProcessData> &gdc,
+							SnapshotContainerPtr<ShmProcessData> snap,
 							const MutexAccess& lock);
 
 		/// Shared memory segment name
@@ -80,8 +83,14 @@ class ShmProcessUpdater: public DriverProcessUpdater {
 		/// Shared memory structure handle
 		sMemory *shm;
 
-		/// Driver process data controller (write mode)
-		GuardDataController<ShmProcessData> process;
+		/// Driver process data snapshot container
+		SnapshotContainerPtr<ShmProcessData> process;
+
+		/// Last published snapshot
+		std::shared_ptr<ShmProcessData> published;
+
+		/// Previously published snapshot (reused when released by all readers)
+		std::shared_ptr<ShmProcessData> spare;
 
 		/// Mutex for protecting driver
 		MutexAccess driverLock;
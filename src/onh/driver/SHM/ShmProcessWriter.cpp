@@ -498,6 +498,112 @@ void ShmProcessWriter::writeReal(processDataAddress addr, float val) {
 	}
 }
 
+extCMD ShmProcessWriter::prepareCommand(const processWriteOp& op) const {
+	// Check bit address
+	DriverUtils::checkBitAddress(op.addr);
+
+	// Check byte address
+	unsigned int size = DriverUtils::getWriteSize(op.type);
+	if (op.addr.byteAddr > PROCESS_DT_SIZE-size) {
+		throw DriverException("Byte address is out of range", "ShmProcessWriter::prepareCommand");
+	}
+
+	extCMD cmd;
+	cmd.len = 3;
+
+	switch (op.type) {
+		case PWO_SET_BIT: cmd.command = DRV_SET_BIT; break;
+		case PWO_RESET_BIT: cmd.command = DRV_RESET_BIT; break;
+		case PWO_INVERT_BIT: cmd.command = DRV_INVERT_BIT; break;
+		case PWO_BYTE: cmd.command = DRV_WRITE_BYTE; break;
+		case PWO_WORD: cmd.command = DRV_WRITE_WORD; break;
+		case PWO_DWORD: cmd.command = DRV_WRITE_DWORD; break;
+		case PWO_INT: cmd.command = DRV_WRITE_INT; break;
+		case PWO_REAL: cmd.command = DRV_WRITE_REAL; break;
+	}
+
+	// Process area
+	switch (op.addr.area) {
+		case PDA_INPUT: cmd.value[0] = DRV_PROC_IN; break;
+		case PDA_OUTPUT: cmd.value[0] = DRV_PROC_OUT; break;
+		case PDA_MEMORY: cmd.value[0] = DRV_PROC_MEM; break;
+		default: throw DriverException("Wrong address area", "ShmProcessWriter::prepareCommand"); break;
+	}
+
+	// Byte address
+	cmd.value[1] = op.addr.byteAddr;
+
+	// Bit address or value (raw bytes - same as single writes)
+	if (size == 1 && op.type != PWO_BYTE) {
+		cmd.value[2] = op.addr.bitAddr;
+	} else if (op.type == PWO_BYTE || op.type == PWO_WORD) {
+		cmd.value[2] = op.value;
+	} else {
+		memcpy(&cmd.value[2], &op.value, sizeof op.value);
+	}
+
+	return cmd;
+}
+
+void ShmProcessWriter::writeBatch(const std::vector<processWriteOp>& ops, unsigned int& applied) {
+	applied = 0;
+
+	// Prepare all commands (addresses are checked before first write)
+	std::vector<extCMD> cmds;
+	cmds.reserve(ops.size());
+	// Number of operations in every command
+	std::vector<unsigned int> cmdOps;
+	cmdOps.reserve(ops.size());
+
+	for (const processWriteOp& op : ops) {
+		extCMD cmd = prepareCommand(op);
+
+		if (cmd.command == DRV_SET_BIT) {
+			// Merge consecutive set bit operations into one set bits command
+			if (cmds.size() == 0 || cmds.back().command != DRV_SET_BITS || cmds.back().len+3 > CMD_DATA_SIZE) {
+				extCMD bits;
+				bits.command = DRV_SET_BITS;
+				bits.len = 0;
+				cmds.push_back(bits);
+				cmdOps.push_back(0);
+			}
+
+			extCMD &bits = cmds.back();
+			bits.value[bits.len] = cmd.value[0];
+			bits.value[bits.len+1] = cmd.value[1];
+			bits.value[bits.len+2] = cmd.value[2];
+			bits.len += 3;
+			cmdOps.back()++;
+		} else {
+			cmds.push_back(cmd);
+			cmdOps.push_back(1);
+		}
+	}
+
+	driverLock.lock();
+
+	try {
+		for (unsigned int i = 0; i < cmds.size(); ++i) {
+			// Send command
+			extCMD cmd_reply = putRequest(cmds[i]);
+
+			if (cmd_reply.command != DRV_CMD_OK) {
+				throw DriverException("Controller respond is ERROR", "ShmProcessWriter::writeBatch");
+			}
+
+			applied += cmdOps[i];
+		}
+
+		driverLock.unlock();
+	} catch(...) {
+		// Unlock access to the driver
+		driverLock.unlock();
+
+		// Re-throw exception
+		throw;
+	}
+}
+
 DriverProcessWriterPtr ShmProcessWriter::createNew() {
 	return DriverProcessWriterPtr(new ShmProcessWriter(shmName, shm, driverLock));
 }
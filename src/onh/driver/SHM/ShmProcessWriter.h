@@ -117,6 +117,18 @@ class ShmProcessWriter: public DriverProcessWriter {
 		 */
 		void writeReal(processDataAddress addr, float val) override;
 
+		/**
+		 * Write batch of operations in device process data
+		 *
+		 * All operations are checked before the first write and executed
+		 * with one driver lock (in the given order).
+		 *
+		 * @param ops Write operations
+		 * @param applied Number of the first operations written in device
+		 *                (set also when exception is thrown)
+		 */
+		void writeBatch(const std::vector<processWriteOp>& ops, unsigned int& applied) override;
+
 		/**
 		 * Create new driver process writer
 		 *
@@ -164,6 +176,15 @@ class ShmProcessWriter: public DriverProcessWriter {
 		 * @param drvFunc Bit function
 		 */
 		void modifyBit(processDataAddress addr, int drvFunc);
+
+		/**
+		 * Prepare server command of the write operation
+		 *
+		 * @param op Write operation
+		 *
+		 * @return Server command
+		 */
+		extCMD prepareCommand(const processWriteOp& op) const;
 };
 
 }  // namespace onh
@@ -0,0 +1,331 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CommandDispatcher.h"
+#include "CommandList.h"
+#include "CommandTokenizer.h"
+#include "ParserCommands/GetBitCommand.h"
+#include "ParserCommands/SetBitCommand.h"
+#include "ParserCommands/ResetBitCommand.h"
+#include "ParserCommands/InvertBitCommand.h"
+#include "ParserCommands/GetBitsCommand.h"
+#include "ParserCommands/SetBitsCommand.h"
+#include "ParserCommands/GetByteCommand.h"
+#include "ParserCommands/WriteByteCommand.h"
+#include "ParserCommands/GetWordCommand.h"
+#include "ParserCommands/WriteWordCommand.h"
+#include "ParserCommands/GetDWordCommand.h"
+#include "ParserCommands/WriteDWordCommand.h"
+#include "ParserCommands/GetIntCommand.h"
+#include "ParserCommands/WriteIntCommand.h"
+#include "ParserCommands/GetRealCommand.h"
+#include "ParserCommands/WriteRealCommand.h"
+#include "ParserCommands/AckAlarmCommand.h"
+#include "ParserCommands/GetThreadCycleTimeCommand.h"
+#include "ParserCommands/GetReplyCacheStatsCommand.h"
+#include "ParserCommands/GetThreadCycleStatsCommand.h"
+#include "ParserCommands/GetLogWriterStatsCommand.h"
+#include "ParserCommands/ExitAppCommand.h"
+#include "ParserCommands/MultiCommand.h"
+#include "ParserCommands/SubscribeCommand.h"
+
+namespace onh {
+
+constexpr CommandDispatcher::commandEntry CommandDispatcher::commands[] = {
+	{GET_BIT, "GET_BIT", &CommandDispatcher::readCommand<GetBitCommand>, true, TAGS_NAME, true},
+	{SET_BIT, "SET_BIT", &CommandDispatcher::writeCommand<SetBitCommand>, true, TAGS_NAME, false},
+	{RESET_BIT, "RESET_BIT", &CommandDispatcher::writeCommand<ResetBitCommand>, true, TAGS_NAME, false},
+	{INVERT_BIT, "INVERT_BIT", &CommandDispatcher::writeCommand<InvertBitCommand>, true, TAGS_NAME, false},
+	{GET_BITS, "GET_BITS", &CommandDispatcher::readCommand<GetBitsCommand>, true, TAGS_NAMES, true},
+	{SET_BITS, "SET_BITS", &CommandDispatcher::writeCommand<SetBitsCommand>, true, TAGS_NAMES, false},
+	{GET_BYTE, "GET_BYTE", &CommandDispatcher::readCommand<GetByteCommand>, true, TAGS_NAME, true},
+	{WRITE_BYTE, "WRITE_BYTE", &CommandDispatcher::writeCommand<WriteByteCommand>, true, TAGS_NAME_VALUE, false},
+	{GET_WORD, "GET_WORD", &CommandDispatcher::readCommand<GetWordCommand>, true, TAGS_NAME, true},
+	{WRITE_WORD, "WRITE_WORD", &CommandDispatcher::writeCommand<WriteWordCommand>, true, TAGS_NAME_VALUE, false},
+	{GET_DWORD, "GET_DWORD", &CommandDispatcher::readCommand<GetDWordCommand>, true, TAGS_NAME, true},
+	{WRITE_DWORD, "WRITE_DWORD", &CommandDispatcher::writeCommand<WriteDWordCommand>, true, TAGS_NAME_VALUE, false},
+	{GET_INT, "GET_INT", &CommandDispatcher::readCommand<GetIntCommand>, true, TAGS_NAME, true},
+	{WRITE_INT, "WRITE_INT", &CommandDispatcher::writeCommand<WriteIntCommand>, true, TAGS_NAME_VALUE, false},
+	{GET_REAL, "GET_REAL", &CommandDispatcher::readCommand<GetRealCommand>, true, TAGS_NAME, true},
+	{WRITE_REAL, "WRITE_REAL", &CommandDispatcher::writeCommand<WriteRealCommand>, true, TAGS_NAME_VALUE, false},
+	{MULTI_CMD, "MULTI_CMD", &CommandDispatcher::multiCommand, false, TAGS_NONE, false},
+	{SUBSCRIBE, "SUBSCRIBE", &CommandDispatcher::subscribeCommand, false, TAGS_NONE, false},
+	{ACK_ALARM, "ACK_ALARM", &CommandDispatcher::ackAlarmCommand, true, TAGS_NONE, false},
+	{GET_THREAD_CYCLE_TIME, "GET_THREAD_CYCLE_TIME", &CommandDispatcher::cycleTimeCommand, false, TAGS_NONE, false},
+	{GET_REPLY_CACHE_STATS, "GET_REPLY_CACHE_STATS", &CommandDispatcher::cacheStatsCommand, false, TAGS_NONE, false},
+	{GET_THREAD_CYCLE_STATS, "GET_THREAD_CYCLE_STATS", &CommandDispatcher::cycleStatsCommand, false, TAGS_NONE, false},
+	{GET_LOG_WRITER_STATS, "GET_LOG_WRITER_STATS", &CommandDispatcher::logStatsCommand, false, TAGS_NONE, false},
+	{EXIT_APP, "EXIT_APP", &CommandDispatcher::exitAppCommand, true, TAGS_NONE, false}
+};
+
+CommandDispatcher::CommandDispatcher(std::shared_ptr<ParserDB> parserDB,
+										std::shared_ptr<ProcessReader> pr,
+										std::shared_ptr<ProcessWriter> pw,
+										ThreadCycleRegistryPtr cc,
+										const SharedDataController<ThreadExitData> &gdcTED,
+										std::shared_ptr<TagSubscription> ts,
+										ReplyCachePtr rc):
+	db(parserDB), prReader(pr), prWriter(pw), cycleController(cc), thExitController(gdcTED), subscription(ts),
+	replyCache(rc) {
+}
+
+std::string CommandDispatcher::execute(std::string_view query, char separator, bool insideMulti) const {
+	return execute(CommandTokenizer::split(query, separator), insideMulti);
+}
+
+std::string CommandDispatcher::execute(const commandTokens& ct, bool insideMulti) const {
+	const commandEntry *entry = findCommand(ct.command);
+
+	if (!entry)
+		throw CommandParserException(CommandParserException::UNKNOWN_COMMAND,
+										"Unknown command: "+std::to_string(ct.command),
+										"CommandDispatcher::execute");
+
+	if (insideMulti && !entry->multiAllowed)
+		throw CommandParserException(CommandParserException::UNKNOWN_COMMAND,
+										"Can not call "+std::string(entry->name)+" inside multi command",
+										"CommandDispatcher::execute");
+
+	return (this->*(entry->handler))(ct.data);
+}
+
+bool CommandDispatcher::isReadOnly(std::string_view query, char separator) const {
+	commandTokens ct = CommandTokenizer::split(query, separator);
+
+	// Check all commands from multi command
+	if (ct.command == MULTI_CMD) {
+		std::string_view commands = ct.data;
+
+		while (!commands.empty()) {
+			std::string_view cmd = CommandTokenizer::nextToken(commands, CMD_MULTI_SEPARATOR);
+			commandTokens sub = CommandTokenizer::split(cmd, CMD_MULTI_VALUE_SEPARATOR);
+
+			const commandEntry *entry = findCommand(sub.command);
+			if (!entry || !entry->readOnly)
+				return false;
+		}
+
+		return true;
+	}
+
+	const commandEntry *entry = findCommand(ct.command);
+
+	return (entry && entry->readOnly);
+}
+
+void CommandDispatcher::cacheTags(const std::vector<commandTokens>& cmds) const {
+	std::vector<std::string> names;
+	names.reserve(cmds.size());
+
+	// Get tag names from commands data
+	for (const commandTokens& ct : cmds) {
+		const commandEntry *entry = findCommand(ct.command);
+
+		if (!entry)
+			continue;
+
+		switch (entry->tags) {
+			case TAGS_NAME: names.emplace_back(ct.data); break;
+			case TAGS_NAME_VALUE: {
+				std::string_view data = ct.data;
+				names.emplace_back(CommandTokenizer::nextToken(data, CMD_TAG_VALUE_SEPARATOR));
+			} break;
+			case TAGS_NAMES: {
+				std::string_view data = ct.data;
+				while (!data.empty())
+					names.emplace_back(CommandTokenizer::nextToken(data, CMD_TAGS_SEPARATOR));
+			} break;
+			default: break;
+		}
+	}
+
+	if (names.size() > 0)
+		db->cacheTags(names);
+}
+
+void CommandDispatcher::clearTagCache() const {
+	db->clearTagCache();
+}
+
+void CommandDispatcher::executeReads(const std::vector<commandTokens>& cmds, std::vector<std::string>& replies) const {
+	/**
+	 * Read command data structure
+	 */
+	typedef struct {
+		/// Command index
+		unsigned int cmd;
+		/// Value type
+		TagType type;
+		/// Index of the first command value in the value type handles
+		unsigned int first;
+		/// Command values count
+		unsigned int count;
+	} readItem;
+
+	std::vector<readItem> items;
+
+	// Tag handles grouped by value type (index: value type)
+	std::vector<ProcessTagHandle> handles[TT_REAL+1];
+
+	replies.assign(cmds.size(), std::string());
+
+	for (unsigned int i = 0; i < cmds.size(); ++i) {
+		TagType tt;
+
+		if (!getReadType(cmds[i].command, tt))
+			continue;
+
+		if (cmds[i].data.empty())
+			throw CommandParserException(CommandParserException::WRONG_DATA, "No data", "CommandDispatcher::executeReads");
+
+		readItem item = {i, tt, static_cast<unsigned int>(handles[tt].size()), 0};
+
+		if (cmds[i].command == GET_BITS) {
+			std::string_view data = cmds[i].data;
+
+			while (!data.empty()) {
+				std::string name(CommandTokenizer::nextToken(data, CMD_TAGS_SEPARATOR));
+				handles[tt].push_back(prReader->getHandle(db->getTag(name), tt));
+			}
+		} else {
+			handles[tt].push_back(prReader->getHandle(db->getTag(std::string(cmds[i].data)), tt));
+		}
+
+		item.count = handles[tt].size() - item.first;
+		items.push_back(item);
+	}
+
+	if (items.empty())
+		return;
+
+	// One bulk read per value type
+	std::vector<BYTE> bits;
+	std::vector<BYTE> bytes;
+	std::vector<WORD> words;
+	std::vector<DWORD> dwords;
+	std::vector<int> ints;
+	std::vector<float> reals;
+
+	prReader->readBits(handles[TT_BIT], bits);
+	prReader->readBytes(handles[TT_BYTE], bytes);
+	prReader->readWords(handles[TT_WORD], words);
+	prReader->readDWords(handles[TT_DWORD], dwords);
+	prReader->readInts(handles[TT_INT], ints);
+	prReader->readReals(handles[TT_REAL], reals);
+
+	// Prepare replies
+	for (const readItem& item : items) {
+		std::string& reply = replies[item.cmd];
+
+		switch (item.type) {
+			case TT_BIT: {
+				if (cmds[item.cmd].command == GET_BITS) {
+					reply = GetBitsCommand::createReply(std::vector<bool>(bits.begin()+item.first,
+																			bits.begin()+item.first+item.count));
+				} else {
+					reply = GetBitCommand::createReply(bits[item.first]);
+				}
+			} break;
+			case TT_BYTE: reply = GetByteCommand::createReply(bytes[item.first]); break;
+			case TT_WORD: reply = GetWordCommand::createReply(words[item.first]); break;
+			case TT_DWORD: reply = GetDWordCommand::createReply(dwords[item.first]); break;
+			case TT_INT: reply = GetIntCommand::createReply(ints[item.first]); break;
+			case TT_REAL: reply = GetRealCommand::createReply(reals[item.first]); break;
+		}
+	}
+}
+
+void CommandDispatcher::beginWriteBatch() const {
+	prWriter->beginBatch();
+}
+
+void CommandDispatcher::commitWriteBatch() const {
+	prWriter->commitBatch();
+}
+
+void CommandDispatcher::cancelWriteBatch() const {
+	prWriter->cancelBatch();
+}
+
+const CommandDispatcher::commandEntry* CommandDispatcher::findCommand(int command) {
+	for (const commandEntry& entry : commands) {
+		if (entry.command == command)
+			return &entry;
+	}
+
+	return nullptr;
+}
+
+bool CommandDispatcher::getReadType(int command, TagType& tt) {
+	switch (command) {
+		case GET_BIT:
+		case GET_BITS: tt = TT_BIT; break;
+		case GET_BYTE: tt = TT_BYTE; break;
+		case GET_WORD: tt = TT_WORD; break;
+		case GET_DWORD: tt = TT_DWORD; break;
+		case GET_INT: tt = TT_INT; break;
+		case GET_REAL: tt = TT_REAL; break;
+		default: return false;
+	}
+
+	return true;
+}
+
+template <class CMD>
+std::string CommandDispatcher::readCommand(std::string_view data) const {
+	return CMD(db, prReader, std::string(data)).execute();
+}
+
+template <class CMD>
+std::string CommandDispatcher::writeCommand(std::string_view data) const {
+	return CMD(db, prWriter, std::string(data)).execute();
+}
+
+std::string CommandDispatcher::multiCommand(std::string_view data) const {
+	return MultiCommand(*this, data).execute();
+}
+
+std::string CommandDispatcher::subscribeCommand(std::string_view data) const {
+	return SubscribeCommand(db, subscription, std::string(data)).execute();
+}
+
+std::string CommandDispatcher::ackAlarmCommand(std::string_view data) const {
+	return AckAlarmCommand(db, std::string(data)).execute();
+}
+
+std::string CommandDispatcher::cycleTimeCommand(std::string_view data) const {
+	return GetThreadCycleTimeCommand(cycleController->acquire(), std::string(data)).execute();
+}
+
+std::string CommandDispatcher::cacheStatsCommand(std::string_view data) const {
+	return GetReplyCacheStatsCommand(replyCache, std::string(data)).execute();
+}
+
+std::string CommandDispatcher::cycleStatsCommand(std::string_view data) const {
+	return GetThreadCycleStatsCommand(cycleController->acquire(), std::string(data)).execute();
+}
+
+std::string CommandDispatcher::logStatsCommand(std::string_view data) const {
+	return GetLogWriterStatsCommand(std::string(data)).execute();
+}
+
+std::string CommandDispatcher::exitAppCommand(std::string_view data) const {
+	return ExitAppCommand(thExitController, std::string(data)).execute();
+}
+
+}  // namespace onh
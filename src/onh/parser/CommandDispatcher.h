@@ -0,0 +1,304 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_PARSER_COMMANDDISPATCHER_H_
+#define ONH_PARSER_COMMANDDISPATCHER_H_
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <vector>
+#include "CommandParserException.h"
+#include "CommandTokenizer.h"
+#include "TagSubscription.h"
+#include "ReplyCache.h"
+#include "../db/ParserDB.h"
+#include "../driver/ProcessReader.h"
+#include "../driver/ProcessWriter.h"
+#include "../thread/ThreadCycleControllers.h"
+#include "../thread/ThreadExitData.h"
+#include "../utils/SharedDataController.h"
+
+namespace onh {
+
+/**
+ * Command dispatcher class (executes parser commands from the static command table)
+ */
+class CommandDispatcher {
+	public:
+		/**
+		 * Dispatcher constructor
+		 *
+		 * @param parserDB Parser database
+		 * @param pr Process reader
+		 * @param pw Process writer
+		 * @param cc Thread cycle controllers registry
+		 * @param gdcTED Thread exit controller
+		 * @param ts Tag subscription
+		 * @param rc Reply cache
+		 */
+		CommandDispatcher(std::shared_ptr<ParserDB> parserDB,
+							std::shared_ptr<ProcessReader> pr,
+							std::shared_ptr<ProcessWriter> pw,
+							ThreadCycleRegistryPtr cc,
+							const SharedDataController<ThreadExitData> &gdcTED,
+							std::shared_ptr<TagSubscription> ts,
+							ReplyCachePtr rc);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		CommandDispatcher(const CommandDispatcher&) = delete;
+
+		virtual ~CommandDispatcher() = default;
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		CommandDispatcher& operator=(const CommandDispatcher&) = delete;
+
+		/**
+		 * Execute command from query string
+		 *
+		 * @param query Query string (command number and data)
+		 * @param separator Command number and data separator
+		 * @param insideMulti Flag informs that command is a part of the multi command
+		 *
+		 * @return String with reply
+		 */
+		std::string execute(std::string_view query, char separator, bool insideMulti = false) const;
+
+		/**
+		 * Execute tokenized command
+		 *
+		 * @param ct Command tokens
+		 * @param insideMulti Flag informs that command is a part of the multi command
+		 *
+		 * @return String with reply
+		 */
+		std::string execute(const commandTokens& ct, bool insideMulti = false) const;
+
+		/**
+		 * Check if command only reads data (reply can be cached)
+		 *
+		 * @param query Query string (command number and data)
+		 * @param separator Command number and data separator
+		 *
+		 * @return True if command (all commands in the multi command) only reads data
+		 */
+		bool isReadOnly(std::string_view query, char separator) const;
+
+		/**
+		 * Read all tags used by the commands from DB (one query)
+		 *
+		 * @param cmds Tokenized commands
+		 */
+		void cacheTags(const std::vector<commandTokens>& cmds) const;
+
+		/**
+		 * Clear tag cache filled by cacheTags
+		 */
+		void clearTagCache() const;
+
+		/**
+		 * Execute read commands with one bulk read per value type
+		 * (tags of the commands should be cached by cacheTags)
+		 *
+		 * @param cmds Tokenized commands
+		 * @param replies Replies of the read commands (empty for other commands)
+		 */
+		void executeReads(const std::vector<commandTokens>& cmds, std::vector<std::string>& replies) const;
+
+		/**
+		 * Begin process write batch (writes of the next commands are queued until commit)
+		 */
+		void beginWriteBatch() const;
+
+		/**
+		 * Commit process write batch (one driver write batch per connection)
+		 */
+		void commitWriteBatch() const;
+
+		/**
+		 * Cancel process write batch (queued writes are dropped)
+		 */
+		void cancelWriteBatch() const;
+
+	private:
+		/// Command handler
+		typedef std::string (CommandDispatcher::*commandHandler)(std::string_view data) const;
+
+		/// Tag names in the command data
+		enum commandTags {
+			TAGS_NONE = 0,
+			TAGS_NAME,
+			TAGS_NAMES,
+			TAGS_NAME_VALUE
+		};
+
+		/**
+		 * Command table entry structure
+		 */
+		typedef struct {
+			/// Command number
+			int command;
+			/// Command name
+			const char *name;
+			/// Command handler
+			commandHandler handler;
+			/// Command can be called inside multi command
+			bool multiAllowed;
+			/// Tag names in the command data
+			commandTags tags;
+			/// Command only reads data
+			bool readOnly;
+		} commandEntry;
+
+		/// Command table
+		static const commandEntry commands[];
+
+		/// Parser database access
+		std::shared_ptr<ParserDB> db;
+		/// Process data reader
+		std::shared_ptr<ProcessReader> prReader;
+		/// Process data writer
+		std::shared_ptr<ProcessWriter> prWriter;
+		/// Thread cycle controllers registry
+		ThreadCycleRegistryPtr cycleController;
+		/// Thread exit data controller
+		SharedDataController<ThreadExitData> thExitController;
+		/// Tag subscription of the connection
+		std::shared_ptr<TagSubscription> subscription;
+		/// Reply cache
+		ReplyCachePtr replyCache;
+
+		/**
+		 * Find command in the command table
+		 *
+		 * @param command Command number
+		 *
+		 * @return Command table entry (nullptr if not exist)
+		 */
+		static const commandEntry* findCommand(int command);
+
+		/**
+		 * Get value type read by the command
+		 *
+		 * @param command Command number
+		 * @param tt Value type (output)
+		 *
+		 * @return True if command reads process data values
+		 */
+		static bool getReadType(int command, TagType& tt);
+
+		/**
+		 * Execute command which reads process data
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		template <class CMD>
+		std::string readCommand(std::string_view data) const;
+
+		/**
+		 * Execute command which writes process data
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		template <class CMD>
+		std::string writeCommand(std::string_view data) const;
+
+		/**
+		 * Execute MULTI_CMD command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string multiCommand(std::string_view data) const;
+
+		/**
+		 * Execute SUBSCRIBE command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string subscribeCommand(std::string_view data) const;
+
+		/**
+		 * Execute ACK_ALARM command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string ackAlarmCommand(std::string_view data) const;
+
+		/**
+		 * Execute GET_THREAD_CYCLE_TIME command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string cycleTimeCommand(std::string_view data) const;
+
+		/**
+		 * Execute GET_REPLY_CACHE_STATS command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string cacheStatsCommand(std::string_view data) const;
+
+		/**
+		 * Execute GET_THREAD_CYCLE_STATS command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string cycleStatsCommand(std::string_view data) const;
+
+		/**
+		 * Execute GET_LOG_WRITER_STATS command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string logStatsCommand(std::string_view data) const;
+
+		/**
+		 * Execute EXIT_APP command
+		 *
+		 * @param data Command data
+		 *
+		 * @return String with reply
+		 */
+		std::string exitAppCommand(std::string_view data) const;
+};
+
+}  // namespace onh
+
+#endif  // ONH_PARSER_COMMANDDISPATCHER_H_
@@ -22,6 +22,9 @@
 #define CMD_SEPARATOR '|'
 #define CMD_TAGS_SEPARATOR ','
 #define CMD_TAG_VALUE_SEPARATOR ','
+#define CMD_SUBSCRIPTION_VALUE_SEPARATOR ':'
+#define CMD_MULTI_SEPARATOR '!'
+#define CMD_MULTI_VALUE_SEPARATOR '?'
 
 namespace onh {
 
@@ -54,9 +57,15 @@ enum parserCMD {
 
 	MULTI_CMD = 50,
 
+	SUBSCRIBE = 60,
+	SUBSCRIPTION_UPDATE = 61,
+
 	ACK_ALARM = 90,
 
 	GET_THREAD_CYCLE_TIME = 500,
+	GET_REPLY_CACHE_STATS = 501,
+	GET_THREAD_CYCLE_STATS = 502,
+	GET_LOG_WRITER_STATS = 503,
 
 	EXIT_APP = 600
 };
@@ -75,6 +84,7 @@ enum parserReply {
 	WRONG_ADDR = 9,
 
 	INTERNAL_ERR = 20,
+	SUBSCRIPTION_LIMIT = 21,
 
 	SQL_ERROR = 50,
 
@@ -20,43 +20,26 @@
 #include <sstream>
 #include "../db/objs/DriverConnection.h"
 #include "../db/objs/Tag.h"
-#include "../utils/StringUtils.h"
 #include "ParserCommands/ErrorCommand.h"
 #include "ParserCommands/TagErrorCommand.h"
-#include "ParserCommands/GetBitCommand.h"
-#include "ParserCommands/SetBitCommand.h"
-#include "ParserCommands/ResetBitCommand.h"
-#include "ParserCommands/InvertBitCommand.h"
-#include "ParserCommands/GetBitsCommand.h"
-#include "ParserCommands/SetBitsCommand.h"
-#include "ParserCommands/GetByteCommand.h"
-#include "ParserCommands/WriteByteCommand.h"
-#include "ParserCommands/GetWordCommand.h"
-#include "ParserCommands/WriteWordCommand.h"
-#include "ParserCommands/GetDWordCommand.h"
-#include "ParserCommands/WriteDWordCommand.h"
-#include "ParserCommands/GetIntCommand.h"
-#include "ParserCommands/WriteIntCommand.h"
-#include "ParserCommands/GetRealCommand.h"
-#include "ParserCommands/WriteRealCommand.h"
-#include "ParserCommands/AckAlarmCommand.h"
-#include "ParserCommands/GetThreadCycleTimeCommand.h"
-#include "ParserCommands/ExitAppCommand.h"
-#include "ParserCommands/MultiCommand.h"
 
 namespace onh {
 
 CommandParser::CommandParser(const ProcessReader& pr,
 								const ProcessWriter& pw,
 								const DBCredentials& dbc,
-								const ThreadCycleControllers& cc,
-								const GuardDataController<ThreadExitData> &gdcTED,
+								ThreadCycleRegistryPtr cc,
+								const SharedDataController<ThreadExitData> &gdcTED,
+								ReplyCachePtr rc,
 								int connDescriptor):
 	prReader(std::make_shared<ProcessReader>(pr)),
 	prWriter(std::make_shared<ProcessWriter>(pw)),
 	thExitController(gdcTED),
 	cycleController(cc),
-	db(std::make_shared<ParserDB>(dbc)) {
+	db(std::make_shared<ParserDB>(dbc)),
+	subscription(std::make_shared<TagSubscription>()),
+	replyCache(rc),
+	dispatcher(db, prReader, prWriter, cycleController, thExitController, subscription, replyCache) {
 	// Create logger
 	std::stringstream s;
 	s << "parser_th_" << connDescriptor << "_";
@@ -76,14 +59,27 @@ std::string CommandParser::getReply(const std::string& query) {
 		if (!prWriter)
 			throw Exception("No process writer object", "CommandParser::getReply");
 
+		// Read only command - check reply cache
+		bool cacheable = (replyCache && dispatcher.isReadOnly(query, CMD_SEPARATOR));
+		unsigned long int generation = 0;
+
+		if (cacheable) {
+			// Generation read before process update (cached reply is never older than generation)
+			generation = prReader->getProcessGeneration();
+
+			if (replyCache->getReply(query, generation, s))
+				return s;
+		}
+
 		// Update process reader
 		prReader->updateProcessData();
 
-		// Parse command
-		auto cmd = getCommand(query);
+		// Parse and execute command
+		s = dispatcher.execute(query, CMD_SEPARATOR);
 
-		// Parse whole command
-		s = cmd->execute();
+		// Store reply
+		if (cacheable)
+			replyCache->putReply(query, generation, s);
 	} catch(CommandParserException &e) {
 		log->write(LOG_ERROR(e.what()));
 
@@ -104,51 +100,46 @@ std::string CommandParser::getReply(const std::string& query) {
 	return s;
 }
 
-ParserCommandPtr CommandParser::getCommand(const std::string& query) {
-	std::vector<std::string> v;
-
-	// Check if there is query string
-	if (query.length() == 0)
-		throw CommandParserException(CommandParserException::WRONG_DATA, "Query string is empty", "CommandParser::getReply");
-
-	// Explode command and data
-	v = StringUtils::explode(query, CMD_SEPARATOR);
-
-	// Check exploded data count
-	if (v.size() != 2)
-		throw CommandParserException(CommandParserException::WRONG_DATA_COUNT,
-										"Wrong exploded data count",
-										"CommandParser::getReply");
-
-	int val = 0;
-	std::istringstream iss(v[0]);
-	iss >> val;
-
-	switch (val) {
-		case GET_BIT: return ParserCommandPtr(new GetBitCommand(db, prReader, v[1])); break;
-		case SET_BIT: return ParserCommandPtr(new SetBitCommand(db, prWriter, v[1])); break;
-		case RESET_BIT: return ParserCommandPtr(new ResetBitCommand(db, prWriter, v[1])); break;
-		case INVERT_BIT: return ParserCommandPtr(new InvertBitCommand(db, prWriter, v[1])); break;
-		case GET_BITS: return ParserCommandPtr(new GetBitsCommand(db, prReader, v[1])); break;
-		case SET_BITS: return ParserCommandPtr(new SetBitsCommand(db, prWriter, v[1])); break;
-		case GET_BYTE: return ParserCommandPtr(new GetByteCommand(db, prReader, v[1])); break;
-		case WRITE_BYTE: return ParserCommandPtr(new WriteByteCommand(db, prWriter, v[1])); break;
-		case GET_WORD: return ParserCommandPtr(new GetWordCommand(db, prReader, v[1])); break;
-		case WRITE_WORD: return ParserCommandPtr(new WriteWordCommand(db, prWriter, v[1])); break;
-		case GET_DWORD: return ParserCommandPtr(new GetDWordCommand(db, prReader, v[1])); break;
-		case WRITE_DWORD: return ParserCommandPtr(new WriteDWordCommand(db, prWriter, v[1])); break;
-		case GET_INT: return ParserCommandPtr(new GetIntCommand(db, prReader, v[1])); break;
-		case WRITE_INT: return ParserCommandPtr(new WriteIntCommand(db, prWriter, v[1])); break;
-		case GET_REAL: return ParserCommandPtr(new GetRealCommand(db, prReader, v[1])); break;
-		case WRITE_REAL: return ParserCommandPtr(new WriteRealCommand(db, prWriter, v[1])); break;
-		case MULTI_CMD: return ParserCommandPtr(new MultiCommand(db, prReader, prWriter, thExitController, v[1])); break;
-		case ACK_ALARM: return ParserCommandPtr(new AckAlarmCommand(db, v[1])); break;
-		case GET_THREAD_CYCLE_TIME: return ParserCommandPtr(new GetThreadCycleTimeCommand(cycleController, v[1])); break;
-		case EXIT_APP: return ParserCommandPtr(new ExitAppCommand(thExitController, v[1])); break;
-		default: throw CommandParserException(CommandParserException::UNKNOWN_COMMAND,
-												"Unknown command: "+v[0],
-												"CommandParser::parseCMD");
+bool CommandParser::isSubscribed() const {
+	return (subscription && subscription->isActive());
+}
+
+std::string CommandParser::getSubscriptionUpdate() {
+	std::string s;
+
+	try {
+		if (!isSubscribed())
+			return s;
+
+		// Check process data change
+		unsigned long int generation = prReader->getProcessGeneration();
+
+		if (subscription->isUpdateNeeded(generation)) {
+			// Update process reader
+			prReader->updateProcessData();
+
+			// Get changed values
+			s = subscription->getUpdate(*prReader, generation);
+		}
+	} catch (TagException &e) {
+		log->write(LOG_ERROR(e.what()));
+
+		// Stop sending updates
+		subscription->cancel();
+
+		TagErrorCommand errCmd(e.getType());
+		s = errCmd.execute();
+	} catch (Exception &e) {
+		log->write(LOG_ERROR(e.what()));
+
+		// Stop sending updates
+		subscription->cancel();
+
+		ErrorCommand errCmd(CommandParserException::NONE);
+		s = errCmd.execute();
 	}
+
+	return s;
 }
 
 }  // namespace onh
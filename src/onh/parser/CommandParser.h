@@ -20,9 +20,7 @@
 #define ONH_PARSER_COMMANDPARSER_H_
 
 #include <string>
-#include <vector>
 #include "IParser.h"
-#include "IParserCommand.h"
 #include "../driver/ProcessReader.h"
 #include "../driver/ProcessWriter.h"
 #include "../thread/ThreadCycleControllers.h"
@@ -32,7 +30,10 @@
 #include "../db/ParserDB.h"
 #include "../db/DBCredentials.h"
 #include "../thread/ThreadExitData.h"
-#include "../utils/GuardDataController.h"
+#include "../utils/SharedDataController.h"
+#include "TagSubscription.h"
+#include "CommandDispatcher.h"
+#include "ReplyCache.h"
 
 namespace onh {
 
@@ -47,15 +48,17 @@ class CommandParser: public IParser {
 		 * @param pr Process reader
 		 * @param pw Process writer
 		 * @param dbc DB data
-		 * @param cc Thread cycle controllers
+		 * @param cc Thread cycle controllers registry
 		 * @param gdcTED Thread exit controller
+		 * @param rc Reply cache (shared by connections)
 		 * @param connDescriptor Socket connection descriptor
 		 */
 		CommandParser(const ProcessReader& pr,
 						const ProcessWriter& pw,
 						const DBCredentials& dbc,
-						const ThreadCycleControllers& cc,
-						const GuardDataController<ThreadExitData> &gdcTED,
+						ThreadCycleRegistryPtr cc,
+						const SharedDataController<ThreadExitData> &gdcTED,
+						ReplyCachePtr rc,
 						int connDescriptor);
 
 		/**
@@ -78,6 +81,20 @@ class CommandParser: public IParser {
 		 */
 		std::string getReply(const std::string& query) override;
 
+		/**
+		 * Check if client subscribed tags
+		 *
+		 * @return True if subscription is active
+		 */
+		bool isSubscribed() const override;
+
+		/**
+		 * Get subscription update (changed tag values)
+		 *
+		 * @return String with update (empty if nothing to send)
+		 */
+		std::string getSubscriptionUpdate() override;
+
 	private:
 		/// Process data reader
 		std::shared_ptr<ProcessReader> prReader;
@@ -86,24 +103,25 @@ class CommandParser: public IParser {
 		std::shared_ptr<ProcessWriter> prWriter;
 
 		/// Thread exit data controller
-		GuardDataController<ThreadExitData> thExitController;
+		SharedDataController<ThreadExitData> thExitController;
 
-		/// Thread cycle controllers
-		ThreadCycleControllers cycleController;
+		/// Thread cycle controllers registry
+		ThreadCycleRegistryPtr cycleController;
 
 		/// DB access
 		std::shared_ptr<ParserDB> db;
 
+		/// Tag subscription of the connection
+		std::shared_ptr<TagSubscription> subscription;
+
+		/// Reply cache of read only commands
+		ReplyCachePtr replyCache;
+
+		/// Command dispatcher
+		CommandDispatcher dispatcher;
+
 		/// Logger object
 		std::unique_ptr<ILogger> log;
-
-		/**
-		 * Get parser command
-		 *
-		 * @param query String with qury
-		 * @return Parser command pointer
-		 */
-		ParserCommandPtr getCommand(const std::string& query);
 };
 
 }  // namespace onh
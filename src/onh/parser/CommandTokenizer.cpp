@@ -0,0 +1,78 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CommandTokenizer.h"
+#include <charconv>
+#include <string>
+
+namespace onh {
+
+commandTokens CommandTokenizer::split(std::string_view query, char separator) {
+	// Check if there is query string
+	if (query.length() == 0)
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"Query string is empty",
+										"CommandTokenizer::split");
+
+	std::string_view::size_type pos = query.find(separator);
+
+	// Only one separator with not empty data is allowed
+	if (pos == std::string_view::npos || pos == query.length()-1 ||
+		query.find(separator, pos+1) != std::string_view::npos)
+		throw CommandParserException(CommandParserException::WRONG_DATA_COUNT,
+										"Wrong exploded data count",
+										"CommandTokenizer::split");
+
+	std::string_view id = query.substr(0, pos);
+
+	commandTokens ct;
+	ct.data = query.substr(pos+1);
+
+	if (!toNumber(id, ct.command))
+		throw CommandParserException(CommandParserException::UNKNOWN_COMMAND,
+										"Unknown command: "+std::string(id),
+										"CommandTokenizer::split");
+
+	return ct;
+}
+
+std::string_view CommandTokenizer::nextToken(std::string_view& data, char separator) {
+	std::string_view token;
+
+	std::string_view::size_type pos = data.find(separator);
+
+	if (pos == std::string_view::npos) {
+		token = data;
+		data = std::string_view();
+	} else {
+		token = data.substr(0, pos);
+		data.remove_prefix(pos+1);
+	}
+
+	return token;
+}
+
+bool CommandTokenizer::toNumber(std::string_view id, int& command) {
+	const char *end = id.data() + id.length();
+
+	std::from_chars_result res = std::from_chars(id.data(), end, command);
+
+	return (res.ec == std::errc() && res.ptr == end);
+}
+
+}  // namespace onh
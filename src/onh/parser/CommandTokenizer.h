@@ -0,0 +1,75 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_PARSER_COMMANDTOKENIZER_H_
+#define ONH_PARSER_COMMANDTOKENIZER_H_
+
+#include <string_view>
+#include "CommandParserException.h"
+
+namespace onh {
+
+/**
+ * Command tokens structure
+ */
+typedef struct {
+	/// Command number
+	int command;
+	/// Command data
+	std::string_view data;
+} commandTokens;
+
+/**
+ * Command tokenizer class (non allocating view on the query string)
+ */
+class CommandTokenizer {
+	public:
+		/**
+		 * Split query on command number and command data
+		 *
+		 * @param query Query string
+		 * @param separator Command and data separator
+		 *
+		 * @return Command tokens (views on the query string)
+		 */
+		static commandTokens split(std::string_view query, char separator);
+
+		/**
+		 * Get next token from the data and remove it from the data
+		 *
+		 * @param data Data to tokenize (remaining data after call)
+		 * @param separator Tokens separator
+		 *
+		 * @return Token view
+		 */
+		static std::string_view nextToken(std::string_view& data, char separator);
+
+		/**
+		 * Convert command identifier to number
+		 *
+		 * @param id Command identifier
+		 * @param command Command number
+		 *
+		 * @return True if identifier is a valid number
+		 */
+		static bool toNumber(std::string_view id, int& command);
+};
+
+}  // namespace onh
+
+#endif  // ONH_PARSER_COMMANDTOKENIZER_H_
@@ -38,6 +38,20 @@ class IParser {
 		 * @return String with reply
 		 */
 		virtual std::string getReply(const std::string& query) = 0;
+
+		/**
+		 * Check if client subscribed tags
+		 *
+		 * @return True if subscription is active
+		 */
+		virtual bool isSubscribed() const = 0;
+
+		/**
+		 * Get subscription update (changed tag values)
+		 *
+		 * @return String with update (empty if nothing to send)
+		 */
+		virtual std::string getSubscriptionUpdate() = 0;
 };
 
 }  // namespace onh
@@ -22,7 +22,7 @@
 
 namespace onh {
 
-ExitAppCommand::ExitAppCommand(const GuardDataController<ThreadExitData> &gdcTED,
+ExitAppCommand::ExitAppCommand(const SharedDataController<ThreadExitData> &gdcTED,
 								const std::string& commandData):
 	thExitController(gdcTED), data(commandData) {
 }
@@ -22,7 +22,7 @@
 #include "../IParserCommand.h"
 #include "../CommandParserException.h"
 #include "../../thread/ThreadExitData.h"
-#include "../../utils/GuardDataController.h"
+#include "../../utils/SharedDataController.h"
 
 namespace onh {
 
@@ -37,7 +37,7 @@ class ExitAppCommand: public IParserCommand {
 		 * @param gdcTED Thread exit controller
 		 * @param commandData String with command data
 		 */
-		ExitAppCommand(const GuardDataController<ThreadExitData> &gdcTED,
+		ExitAppCommand(const SharedDataController<ThreadExitData> &gdcTED,
 						const std::string& commandData);
 
 		/**
@@ -54,7 +54,7 @@ class ExitAppCommand: public IParserCommand {
 
 	private:
 		/// Thread exit data controller
-		GuardDataController<ThreadExitData> thExitController;
+		SharedDataController<ThreadExitData> thExitController;
 		/// command data
 		const std::string data;
 };
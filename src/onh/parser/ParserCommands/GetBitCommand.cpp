@@ -34,8 +34,6 @@ GetBitCommand::GetBitCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetBitCommand::execute() {
-	std::stringstream s;
-
 	// Check data string
 	if (data.length() == 0)
 		throw CommandParserException(CommandParserException::WRONG_DATA, "No data", "GetBitCommand::execute");
@@ -47,6 +45,12 @@ std::string GetBitCommand::execute() {
 	bool v = prReader->getBitValue(t);
 
 	// Prepare answer
+	return createReply(v);
+}
+
+std::string GetBitCommand::createReply(bool v) {
+	std::stringstream s;
+
 	s << GET_BIT << CMD_SEPARATOR << ((v)?("1"):("0"));
 
 	return s.str();
@@ -54,6 +54,15 @@ class GetBitCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_BIT reply
+		 *
+		 * @param v Bit value
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(bool v);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
@@ -35,7 +35,6 @@ GetBitsCommand::GetBitsCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetBitsCommand::execute() {
-	std::stringstream s;
 	std::vector<std::string> v;
 	std::vector<Tag> vTag;
 	std::vector<bool> TagValues;
@@ -66,11 +65,17 @@ std::string GetBitsCommand::execute() {
 										"GetBitsCommand::execute");
 
 	// Prepare answer
+	return createReply(TagValues);
+}
+
+std::string GetBitsCommand::createReply(const std::vector<bool>& values) {
+	std::stringstream s;
+
 	s << GET_BITS << CMD_SEPARATOR;
-	for (unsigned int i=0; i < TagValues.size(); ++i) {
-		s << ((TagValues[i])?("1"):("0"));
+	for (unsigned int i=0; i < values.size(); ++i) {
+		s << ((values[i])?("1"):("0"));
 
-		if (i < TagValues.size()-1) {
+		if (i < values.size()-1) {
 			s << CMD_TAGS_SEPARATOR;
 		}
 	}
@@ -19,6 +19,7 @@
 #ifndef ONH_PARSER_PARSERCOMMANDS_GETBITSCOMMAND_H_
 #define ONH_PARSER_PARSERCOMMANDS_GETBITSCOMMAND_H_
 
+#include <vector>
 #include "../IParserCommand.h"
 #include "../CommandParserException.h"
 #include "../../db/ParserDB.h"
@@ -54,6 +55,15 @@ class GetBitsCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_BITS reply
+		 *
+		 * @param values Bit values
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(const std::vector<bool>& values);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
@@ -34,7 +34,6 @@ GetByteCommand::GetByteCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetByteCommand::execute() {
-	std::stringstream s;
 	BYTE v;
 
 	// Check data string
@@ -48,6 +47,12 @@ std::string GetByteCommand::execute() {
 	v = prReader->getByte(t);
 
 	// Prepare answer
+	return createReply(v);
+}
+
+std::string GetByteCommand::createReply(BYTE v) {
+	std::stringstream s;
+
 	s << GET_BYTE << CMD_SEPARATOR << (int)v;
 
 	return s.str();
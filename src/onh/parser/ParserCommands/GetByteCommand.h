@@ -54,6 +54,15 @@ class GetByteCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_BYTE reply
+		 *
+		 * @param v Byte value
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(BYTE v);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
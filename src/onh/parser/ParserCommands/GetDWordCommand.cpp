@@ -34,7 +34,6 @@ GetDWordCommand::GetDWordCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetDWordCommand::execute() {
-	std::stringstream s;
 	DWORD dw;
 
 	// Check data string
@@ -48,7 +47,13 @@ std::string GetDWordCommand::execute() {
 	dw = prReader->getDWord(t);
 
 	// Prepare answer
-	s << GET_DWORD << CMD_SEPARATOR << (DWORD)dw;
+	return createReply(dw);
+}
+
+std::string GetDWordCommand::createReply(DWORD v) {
+	std::stringstream s;
+
+	s << GET_DWORD << CMD_SEPARATOR << (DWORD)v;
 
 	return s.str();
 }
@@ -54,6 +54,15 @@ class GetDWordCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_DWORD reply
+		 *
+		 * @param v Double word value
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(DWORD v);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
@@ -34,7 +34,6 @@ GetIntCommand::GetIntCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetIntCommand::execute() {
-	std::stringstream s;
 	int v;
 
 	// Check data string
@@ -48,6 +47,12 @@ std::string GetIntCommand::execute() {
 	v = prReader->getInt(t);
 
 	// Prepare answer
+	return createReply(v);
+}
+
+std::string GetIntCommand::createReply(int v) {
+	std::stringstream s;
+
 	s << GET_INT << CMD_SEPARATOR << (int)v;
 
 	return s.str();
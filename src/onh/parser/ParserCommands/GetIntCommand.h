@@ -54,6 +54,15 @@ class GetIntCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_INT reply
+		 *
+		 * @param v Int value
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(int v);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
@@ -0,0 +1,51 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include "GetLogWriterStatsCommand.h"
+#include "../CommandList.h"
+#include "../../utils/logger/LogWriter.h"
+
+namespace onh {
+
+GetLogWriterStatsCommand::GetLogWriterStatsCommand(const std::string& commandData):
+	data(commandData) {
+}
+
+std::string GetLogWriterStatsCommand::execute() {
+	std::stringstream s;
+
+	// Check data string
+	if (data.length() == 0)
+		throw CommandParserException(CommandParserException::WRONG_DATA, "No data", "GetLogWriterStatsCommand::execute");
+
+	if (data != "1")
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"Wrong data",
+										"GetLogWriterStatsCommand::execute");
+
+	logWriterStats st = LogWriter::getWriter().getStats();
+
+	// Prepare answer
+	s << GET_LOG_WRITER_STATS << CMD_SEPARATOR;
+	s << st.written << CMD_TAGS_SEPARATOR << st.dropped << CMD_TAGS_SEPARATOR << st.errors;
+
+	return s.str();
+}
+
+}  // namespace onh
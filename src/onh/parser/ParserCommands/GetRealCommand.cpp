@@ -34,7 +34,6 @@ GetRealCommand::GetRealCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetRealCommand::execute() {
-	std::stringstream s;
 	float f;
 
 	// Check data string
@@ -48,7 +47,13 @@ std::string GetRealCommand::execute() {
 	f = prReader->getReal(t);
 
 	// Prepare answer
-	s << GET_REAL << CMD_SEPARATOR << (float)f;
+	return createReply(f);
+}
+
+std::string GetRealCommand::createReply(float v) {
+	std::stringstream s;
+
+	s << GET_REAL << CMD_SEPARATOR << (float)v;
 
 	return s.str();
 }
@@ -54,6 +54,15 @@ class GetRealCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_REAL reply
+		 *
+		 * @param v Real value
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(float v);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
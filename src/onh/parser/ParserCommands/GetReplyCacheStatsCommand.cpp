@@ -0,0 +1,54 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include "GetReplyCacheStatsCommand.h"
+#include "../CommandList.h"
+
+namespace onh {
+
+GetReplyCacheStatsCommand::GetReplyCacheStatsCommand(ReplyCachePtr rc,
+														const std::string& commandData):
+	replyCache(rc), data(commandData) {
+	// Check cache
+	if (!replyCache)
+		throw Exception("No reply cache object", "GetReplyCacheStatsCommand::GetReplyCacheStatsCommand");
+}
+
+std::string GetReplyCacheStatsCommand::execute() {
+	std::stringstream s;
+
+	// Check data string
+	if (data.length() == 0)
+		throw CommandParserException(CommandParserException::WRONG_DATA, "No data", "GetReplyCacheStatsCommand::execute");
+
+	if (data != "1")
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"Wrong data",
+										"GetReplyCacheStatsCommand::execute");
+
+	replyCacheStats st = replyCache->getStats();
+
+	// Prepare answer
+	s << GET_REPLY_CACHE_STATS << CMD_SEPARATOR;
+	s << st.hits << CMD_TAGS_SEPARATOR << st.misses << CMD_TAGS_SEPARATOR << st.entries;
+
+	return s.str();
+}
+
+}  // namespace onh
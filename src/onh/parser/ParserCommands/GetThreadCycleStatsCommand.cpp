@@ -0,0 +1,78 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include "GetThreadCycleStatsCommand.h"
+#include "../CommandList.h"
+
+namespace onh {
+
+/// Thread name separator
+const char STN = ':';
+/// Statistics values separator
+const char STS = '?';
+/// Thread statistics separator
+const char STC = '!';
+
+GetThreadCycleStatsCommand::GetThreadCycleStatsCommand(ThreadCycleSnapshot tcc,
+								const std::string& commandData):
+	cycleController(tcc), data(commandData) {
+}
+
+std::string GetThreadCycleStatsCommand::execute() {
+	std::stringstream s;
+
+	// Check data string
+	if (data.length() == 0)
+		throw CommandParserException(CommandParserException::WRONG_DATA, "No data", "GetThreadCycleStatsCommand::execute");
+
+	if (data != "0" && data != "1")
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"Wrong data",
+										"GetThreadCycleStatsCommand::execute");
+
+	bool lastWindow = (data == "1");
+
+	// Prepare answer
+	s << GET_THREAD_CYCLE_STATS << CMD_SEPARATOR << cycleController->size();
+
+	for (const auto& cntr : *cycleController) {
+		if (!cntr.second.stats)
+			throw Exception("No cycle statistics of the thread "+cntr.first, "GetThreadCycleStatsCommand::execute");
+
+		ThreadCycleWindow w = (lastWindow)?(cntr.second.stats->getLastWindow()):(cntr.second.stats->getCurrentWindow());
+
+		s << STC << cntr.first << STN << w.duration << STS << w.cycles << STS << w.rate;
+		for (const auto& ph : w.phase) {
+			s << STS << ph.p50 << STS << ph.p90 << STS << ph.p99 << STS << ph.p999;
+		}
+
+		// Periodic scheduler statistics
+		CycleTimeData ctd;
+		cntr.second.cycleTime.getData(ctd);
+
+		s << STS << ctd.sched.cycles << STS << ctd.sched.overruns << STS << ctd.sched.skipped << STS << ctd.sched.jitterMax;
+		for (unsigned long int bucket : ctd.sched.jitterHist) {
+			s << STS << bucket;
+		}
+	}
+
+	return s.str();
+}
+
+}  // namespace onh
@@ -0,0 +1,72 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_PARSER_PARSERCOMMANDS_GETTHREADCYCLESTATSCOMMAND_H_
+#define ONH_PARSER_PARSERCOMMANDS_GETTHREADCYCLESTATSCOMMAND_H_
+
+#include "../IParserCommand.h"
+#include "../CommandParserException.h"
+#include "../../thread/ThreadCycleControllers.h"
+
+namespace onh {
+
+/**
+ * Parser GET_THREAD_CYCLE_STATS command
+ *
+ * Command data: 0 - current statistics window, 1 - last completed window.
+ * Reply contains for every thread: window length (ms), number of cycles,
+ * cycle rate (1/s) and p50, p90, p99, p99.9 (us) of the cycle time
+ * and of the process copy, evaluation, DB I/O and wait phases, followed
+ * by the periodic scheduler statistics: scheduled cycles, overruns, skipped
+ * periods, max wake-up jitter (us) and the wake-up jitter histogram.
+ * Threads woken by the process data change (Alarming, TagLogger, Script)
+ * are not scheduled - their scheduler statistics are always 0.
+ */
+class GetThreadCycleStatsCommand: public IParserCommand {
+	public:
+		/**
+		 * GET_THREAD_CYCLE_STATS command constructor
+		 *
+		 * @param tcc Thread cycle controllers snapshot
+		 * @param commandData String with command data
+		 */
+		GetThreadCycleStatsCommand(ThreadCycleSnapshot tcc,
+						const std::string& commandData);
+
+		/**
+		 * Command Destructor
+		 */
+		virtual ~GetThreadCycleStatsCommand() = default;
+
+		/**
+		 * Execute parser command and get reply
+		 *
+		 * @return String with reply
+		 */
+		std::string execute() override;
+
+	private:
+		/// Thread cycle controllers snapshot
+		ThreadCycleSnapshot cycleController;
+		/// command data
+		const std::string data;
+};
+
+}  // namespace onh
+
+#endif  // ONH_PARSER_PARSERCOMMANDS_GETTHREADCYCLESTATSCOMMAND_H_
@@ -29,7 +29,7 @@ const char TS = '?';
 /// Cycle time values separator
 const char CS = '!';
 
-GetThreadCycleTimeCommand::GetThreadCycleTimeCommand(const ThreadCycleControllers& tcc,
+GetThreadCycleTimeCommand::GetThreadCycleTimeCommand(ThreadCycleSnapshot tcc,
 								const std::string& commandData):
 	cycleController(tcc), data(commandData) {
 }
@@ -49,27 +49,27 @@ std::string GetThreadCycleTimeCommand::execute() {
 	std::map<std::string, CycleTimeData> UpdaterCT, PollingCT;
 
 	// Get cycle time of the updaters and buffers
-	for (auto& cntr : cycleController) {
+	for (auto& cntr : *cycleController) {
 		// Updater?
 		if (cntr.first.find("Updater_") != std::string::npos) {
 			// Get cycle time
-			cntr.second.getData(tmp);
+			cntr.second.cycleTime.getData(tmp);
 			UpdaterCT.insert(std::pair<std::string, CycleTimeData>(cntr.first, tmp));
 		}
 
 		// Driver buffer?
 		if (cntr.first.find("DriverBuffer_") != std::string::npos) {
 			// Get cycle time
-			cntr.second.getData(tmp);
+			cntr.second.cycleTime.getData(tmp);
 			PollingCT.insert(std::pair<std::string, CycleTimeData>(cntr.first, tmp));
 		}
 	}
 
 	// Get cycle times of the threads
-	cycleController.at("TagLogger").getData(LoggerCT);
-	cycleController.at("TagLoggerWriter").getData(LoggerWriterCT);
-	cycleController.at("Alarming").getData(AlarmingCT);
-	cycleController.at("Script").getData(ScriptCT);
+	cycleController->at("TagLogger").cycleTime.getData(LoggerCT);
+	cycleController->at("TagLoggerWriter").cycleTime.getData(LoggerWriterCT);
+	cycleController->at("Alarming").cycleTime.getData(AlarmingCT);
+	cycleController->at("Script").cycleTime.getData(ScriptCT);
 
 	return prepareReply(LoggerCT, LoggerWriterCT, AlarmingCT, ScriptCT, UpdaterCT, PollingCT);
 }
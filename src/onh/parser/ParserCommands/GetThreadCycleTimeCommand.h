@@ -33,10 +33,10 @@ class GetThreadCycleTimeCommand: public IParserCommand {
 		/**
 		 * GET_THREAD_CYCLE_TIME command constructor
 		 *
-		 * @param tcc Thread cycle controllers
+		 * @param tcc Thread cycle controllers snapshot
 		 * @param commandData String with command data
 		 */
-		GetThreadCycleTimeCommand(const ThreadCycleControllers& tcc,
+		GetThreadCycleTimeCommand(ThreadCycleSnapshot tcc,
 						const std::string& commandData);
 
 		/**
@@ -52,8 +52,8 @@ class GetThreadCycleTimeCommand: public IParserCommand {
 		std::string execute() override;
 
 	private:
-		/// Thread cycle controllers
-		ThreadCycleControllers cycleController;
+		/// Thread cycle controllers snapshot
+		ThreadCycleSnapshot cycleController;
 		/// command data
 		const std::string data;
 
@@ -34,7 +34,6 @@ GetWordCommand::GetWordCommand(std::shared_ptr<ParserDB> parserDB,
 }
 
 std::string GetWordCommand::execute() {
-	std::stringstream s;
 	WORD w;
 
 	// Check data string
@@ -48,7 +47,13 @@ std::string GetWordCommand::execute() {
 	w = prReader->getWord(t);
 
 	// Prepare answer
-	s << GET_WORD << CMD_SEPARATOR << (WORD)w;
+	return createReply(w);
+}
+
+std::string GetWordCommand::createReply(WORD v) {
+	std::stringstream s;
+
+	s << GET_WORD << CMD_SEPARATOR << (WORD)v;
 
 	return s.str();
 }
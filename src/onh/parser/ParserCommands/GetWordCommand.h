@@ -54,6 +54,15 @@ class GetWordCommand: public IParserCommand {
 		 */
 		std::string execute() override;
 
+		/**
+		 * Prepare GET_WORD reply
+		 *
+		 * @param v Word value
+		 *
+		 * @return String with reply
+		 */
+		static std::string createReply(WORD v);
+
 	private:
 		/// Parser database access
 		std::shared_ptr<ParserDB> db;
@@ -19,13 +19,10 @@
 #ifndef ONH_PARSER_PARSERCOMMANDS_MULTICOMMAND_H_
 #define ONH_PARSER_PARSERCOMMANDS_MULTICOMMAND_H_
 
+#include <string_view>
 #include "../IParserCommand.h"
 #include "../CommandParserException.h"
-#include "../../db/ParserDB.h"
-#include "../../driver/ProcessWriter.h"
-#include "../../driver/ProcessReader.h"
-#include "../../thread/ThreadExitData.h"
-#include "../../utils/GuardDataController.h"
+#include "../CommandDispatcher.h"
 
 namespace onh {
 
@@ -37,17 +34,10 @@ class MultiCommand: public IParserCommand {
 		/**
 		 * MULTI_CMD command constructor
 		 *
-		 * @param parserDB Parser database
-		 * @param pr Process reader
-		 * @param pw Process writer
-		 * @param gdcTED Thread exit controller
-		 * @param commandData String with command data
+		 * @param cd Command dispatcher
+		 * @param commandData Command data
 		 */
-		MultiCommand(std::shared_ptr<ParserDB> parserDB,
-						std::shared_ptr<ProcessReader> pr,
-						std::shared_ptr<ProcessWriter> pw,
-						const GuardDataController<ThreadExitData> &gdcTED,
-						const std::string& commandData);
+		MultiCommand(const CommandDispatcher& cd, std::string_view commandData);
 
 		/**
 		 * Command Destructor
@@ -62,32 +52,18 @@ class MultiCommand: public IParserCommand {
 		std::string execute() override;
 
 	private:
-		/// Parser database access
-		std::shared_ptr<ParserDB> db;
-		/// Process data reader
-		std::shared_ptr<ProcessReader> prReader;
-		/// Process data writer
-		std::shared_ptr<ProcessWriter> prWriter;
-		/// Thread exit data controller
-		GuardDataController<ThreadExitData> thExitController;
+		/// Command dispatcher
+		const CommandDispatcher& dispatcher;
 		/// command data
-		const std::string data;
+		std::string_view data;
 
 		/**
-		 * Get reply from one command request
+		 * Append one command reply to the multi command reply
 		 *
-		 * @param cmd String with command
-		 * @return String data with reply
+		 * @param reply Multi command reply
+		 * @param cmdReply One command reply
 		 */
-		std::string parseOneCommand(const std::string& cmd);
-
-		/**
-		 * Prepare reply
-		 *
-		 * @param reply Command reply data
-		 * @return String with reply
-		 */
-		std::string prepareReply(const std::vector<std::string>& reply);
+		void appendReply(std::string& reply, const std::string& cmdReply);
 };
 
 }  // namespace onh
@@ -0,0 +1,59 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include "SubscribeCommand.h"
+#include "../CommandList.h"
+
+namespace onh {
+
+SubscribeCommand::SubscribeCommand(std::shared_ptr<ParserDB> parserDB,
+									std::shared_ptr<TagSubscription> ts,
+									const std::string& commandData):
+	db(parserDB), subscription(ts), data(commandData) {
+	// Check readers
+	if (!db)
+		throw Exception("No database object", "SubscribeCommand::SubscribeCommand");
+	if (!subscription)
+		throw Exception("No subscription object", "SubscribeCommand::SubscribeCommand");
+}
+
+std::string SubscribeCommand::execute() {
+	std::stringstream s;
+	std::vector<Tag> vTag;
+
+	// Interval, deadband and tag names
+	subscriptionRequest req = TagSubscription::parseRequest(data);
+
+	// Read tag data from DB
+	if (req.tagNames.size() == 1) {
+		vTag.push_back(db->getTag(req.tagNames[0]));
+	} else {
+		vTag = db->getTags(req.tagNames);
+	}
+
+	// Start subscription
+	subscription->subscribe(vTag, req.interval, req.deadband);
+
+	// Prepare answer
+	s << SUBSCRIBE << CMD_SEPARATOR << OK;
+
+	return s.str();
+}
+
+}  // namespace onh
@@ -0,0 +1,114 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ReplyCache.h"
+
+namespace onh {
+
+ReplyCache::ReplyCache(unsigned int maxEntries, unsigned int maxAge):
+	cacheGeneration(0),
+	cacheTime(std::chrono::steady_clock::now()),
+	cacheMaxEntries(maxEntries),
+	cacheMaxAge(maxAge),
+	hits(0),
+	misses(0) {
+}
+
+ReplyCache::~ReplyCache() {
+}
+
+bool ReplyCache::getReply(const std::string& query, unsigned long int generation, std::string& reply) {
+	bool found = false;
+
+	cacheLock.lock();
+
+	try {
+		checkValidity(generation);
+
+		auto it = replies.find(query);
+		if (it != replies.end()) {
+			reply = it->second;
+			found = true;
+		}
+
+		cacheLock.unlock();
+	} catch (...) {
+		cacheLock.unlock();
+
+		// Re-throw exception
+		throw;
+	}
+
+	if (found)
+		hits.fetch_add(1, std::memory_order_relaxed);
+	else
+		misses.fetch_add(1, std::memory_order_relaxed);
+
+	return found;
+}
+
+void ReplyCache::putReply(const std::string& query, unsigned long int generation, const std::string& reply) {
+	cacheLock.lock();
+
+	try {
+		checkValidity(generation);
+
+		// Store only replies of the current generation
+		if (generation == cacheGeneration && replies.size() < cacheMaxEntries) {
+			if (replies.size() == 0)
+				cacheTime = std::chrono::steady_clock::now();
+
+			replies[query] = reply;
+		}
+
+		cacheLock.unlock();
+	} catch (...) {
+		cacheLock.unlock();
+
+		// Re-throw exception
+		throw;
+	}
+}
+
+replyCacheStats ReplyCache::getStats() {
+	replyCacheStats st;
+
+	cacheLock.lock();
+	st.entries = replies.size();
+	cacheLock.unlock();
+
+	st.hits = hits.load(std::memory_order_relaxed);
+	st.misses = misses.load(std::memory_order_relaxed);
+
+	return st;
+}
+
+void ReplyCache::checkValidity(unsigned long int generation) {
+	// Process data changed (older generations are not stored)
+	if (generation > cacheGeneration) {
+		replies.clear();
+		cacheGeneration = generation;
+	}
+
+	// Replies too old (tag configuration could be changed)
+	if (replies.size() > 0 && std::chrono::steady_clock::now() - cacheTime > cacheMaxAge) {
+		replies.clear();
+	}
+}
+
+}  // namespace onh
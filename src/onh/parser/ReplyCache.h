@@ -0,0 +1,132 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_PARSER_REPLYCACHE_H_
+#define ONH_PARSER_REPLYCACHE_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "../utils/MutexContainer.h"
+
+namespace onh {
+
+/**
+ * Reply cache statistics structure
+ */
+typedef struct {
+	/// Replies served from cache
+	unsigned long int hits;
+	/// Replies not found in cache
+	unsigned long int misses;
+	/// Replies stored in cache
+	unsigned long int entries;
+} replyCacheStats;
+
+/**
+ * Reply cache class (replies of read only requests within one process data generation)
+ */
+class ReplyCache {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param maxEntries Maximum number of cached replies
+		 * @param maxAge Maximum age of cached replies (milliseconds)
+		 */
+		explicit ReplyCache(unsigned int maxEntries = 256, unsigned int maxAge = 1000);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		ReplyCache(const ReplyCache&) = delete;
+
+		virtual ~ReplyCache();
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		ReplyCache& operator=(const ReplyCache&) = delete;
+
+		/**
+		 * Get reply from cache
+		 *
+		 * @param query Query string
+		 * @param generation Process data generation
+		 * @param reply Cached reply
+		 *
+		 * @return True if reply was found
+		 */
+		bool getReply(const std::string& query, unsigned long int generation, std::string& reply);
+
+		/**
+		 * Put reply into the cache
+		 *
+		 * @param query Query string
+		 * @param generation Process data generation (read before process data update)
+		 * @param reply Reply to store
+		 */
+		void putReply(const std::string& query, unsigned long int generation, const std::string& reply);
+
+		/**
+		 * Get cache statistics
+		 *
+		 * @return Cache statistics
+		 */
+		replyCacheStats getStats();
+
+	private:
+		/**
+		 * Drop cached replies if generation changed or replies are too old (call with locked mutex)
+		 *
+		 * @param generation Process data generation
+		 */
+		void checkValidity(unsigned long int generation);
+
+		/// Cached replies
+		std::unordered_map<std::string, std::string> replies;
+
+		/// Process data generation of cached replies
+		unsigned long int cacheGeneration;
+
+		/// Time of the first cached reply
+		std::chrono::steady_clock::time_point cacheTime;
+
+		/// Maximum number of cached replies
+		unsigned int cacheMaxEntries;
+
+		/// Maximum age of cached replies
+		std::chrono::milliseconds cacheMaxAge;
+
+		/// Cache hits
+		std::atomic<unsigned long int> hits;
+
+		/// Cache misses
+		std::atomic<unsigned long int> misses;
+
+		/// Cache lock
+		MutexContainer cacheLock;
+};
+
+using ReplyCachePtr = std::shared_ptr<ReplyCache>;
+
+}  // namespace onh
+
+#endif  // ONH_PARSER_REPLYCACHE_H_
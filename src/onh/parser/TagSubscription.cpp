@@ -0,0 +1,211 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TagSubscription.h"
+#include <cmath>
+#include <sstream>
+#include "CommandList.h"
+#include "CommandParserException.h"
+#include "../utils/StringUtils.h"
+
+namespace onh {
+
+TagSubscription::TagSubscription():
+	interval(0), valueDeadband(0), active(false), firstUpdate(false), lastGeneration(0) {
+}
+
+TagSubscription::~TagSubscription() {
+}
+
+subscriptionRequest TagSubscription::parseRequest(const std::string& data) {
+	subscriptionRequest req = {0, 0, {}};
+
+	// Check data string
+	if (data.length() == 0)
+		throw CommandParserException(CommandParserException::WRONG_DATA, "No data", "TagSubscription::parseRequest");
+
+	// Explode interval, deadband and tag names
+	std::vector<std::string> v = StringUtils::explode(data, CMD_TAGS_SEPARATOR);
+	if (v.size() < 3)
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"No valid data",
+										"TagSubscription::parseRequest");
+
+	// Minimum update interval
+	std::istringstream issInterval(v[0]);
+	if (!(issInterval >> req.interval))
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"Wrong subscription interval",
+										"TagSubscription::parseRequest");
+
+	// Value deadband
+	std::istringstream issDeadband(v[1]);
+	if (!(issDeadband >> req.deadband) || req.deadband < 0)
+		throw CommandParserException(CommandParserException::WRONG_DATA,
+										"Wrong subscription deadband",
+										"TagSubscription::parseRequest");
+
+	// Tag names
+	req.tagNames.assign(v.begin()+2, v.end());
+
+	return req;
+}
+
+void TagSubscription::subscribe(const std::vector<Tag>& tagsToObserve, unsigned int minInterval, double deadband) {
+	// Check tags
+	if (tagsToObserve.size() == 0)
+		throw Exception("Tags array is empty", "TagSubscription::subscribe");
+
+	// Check deadband
+	if (deadband < 0)
+		throw Exception("Deadband can not be negative", "TagSubscription::subscribe");
+
+	tags.clear();
+	for (const Tag& tg : tagsToObserve) {
+		tags.push_back(subscribedTag{tg, 0, false});
+	}
+
+	interval = minInterval;
+	valueDeadband = deadband;
+	active = true;
+	firstUpdate = true;
+	lastGeneration = 0;
+	lastUpdate = std::chrono::steady_clock::now();
+}
+
+void TagSubscription::cancel() {
+	tags.clear();
+	active = false;
+	firstUpdate = false;
+}
+
+bool TagSubscription::isActive() const {
+	return active;
+}
+
+bool TagSubscription::isUpdateNeeded(unsigned long int generation) const {
+	if (!active)
+		return false;
+
+	// Initial values
+	if (firstUpdate)
+		return true;
+
+	// Process data did not change
+	if (generation == lastGeneration)
+		return false;
+
+	// Check minimum interval
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - lastUpdate;
+
+	return (elapsed.count() >= interval);
+}
+
+std::string TagSubscription::getUpdate(ProcessReader& pr, unsigned long int generation) {
+	if (!active)
+		throw Exception("Subscription is not active", "TagSubscription::getUpdate");
+
+	// Current values
+	std::vector<double> values;
+	values.reserve(tags.size());
+
+	for (const subscribedTag& st : tags) {
+		values.push_back(readValue(pr, st.tag));
+	}
+
+	return getUpdate(values, generation);
+}
+
+std::string TagSubscription::getUpdate(const std::vector<double>& values, unsigned long int generation) {
+	std::stringstream s;
+	bool changed = false;
+
+	if (!active)
+		throw Exception("Subscription is not active", "TagSubscription::getUpdate");
+
+	if (values.size() != tags.size())
+		throw Exception("Wrong values count", "TagSubscription::getUpdate");
+
+	for (unsigned int i = 0; i < tags.size(); ++i) {
+		subscribedTag& st = tags[i];
+		double val = values[i];
+
+		if (!isChanged(st, val))
+			continue;
+
+		if (changed)
+			s << CMD_TAGS_SEPARATOR;
+
+		// Tag name and value
+		s << st.tag.getName() << CMD_SUBSCRIPTION_VALUE_SEPARATOR;
+		switch (st.tag.getType()) {
+			case TT_BIT: s << ((val)?("1"):("0")); break;
+			case TT_INT: s << static_cast<int>(val); break;
+			case TT_REAL: s << static_cast<float>(val); break;
+			default: s << static_cast<DWORD>(val); break;
+		}
+
+		st.lastValue = val;
+		st.sent = true;
+		changed = true;
+	}
+
+	firstUpdate = false;
+	lastGeneration = generation;
+	lastUpdate = std::chrono::steady_clock::now();
+
+	if (!changed)
+		return "";
+
+	std::stringstream reply;
+	reply << SUBSCRIPTION_UPDATE << CMD_SEPARATOR << s.str();
+
+	return reply.str();
+}
+
+double TagSubscription::readValue(ProcessReader& pr, const Tag& tg) const {
+	double val = 0;
+
+	switch (tg.getType()) {
+		case TT_BIT: val = (pr.getHandle(tg, TT_BIT).getBit())?(1):(0); break;
+		case TT_BYTE: val = pr.getHandle(tg, TT_BYTE).getByte(); break;
+		case TT_WORD: val = pr.getHandle(tg, TT_WORD).getWord(); break;
+		case TT_DWORD: val = pr.getHandle(tg, TT_DWORD).getDWord(); break;
+		case TT_INT: val = pr.getHandle(tg, TT_INT).getInt(); break;
+		case TT_REAL: val = pr.getHandle(tg, TT_REAL).getReal(); break;
+	}
+
+	return val;
+}
+
+bool TagSubscription::isChanged(const subscribedTag& st, double val) const {
+	// Value not sent yet
+	if (!st.sent)
+		return true;
+
+	// Bits - every change
+	if (st.tag.getType() == TT_BIT)
+		return (val != st.lastValue);
+
+	// Numeric values - check deadband
+	double diff = std::fabs(val - st.lastValue);
+
+	return ((valueDeadband > 0)?(diff >= valueDeadband):(diff > 0));
+}
+
+}  // namespace onh
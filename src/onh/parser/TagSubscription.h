@@ -0,0 +1,177 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_PARSER_TAGSUBSCRIPTION_H_
+#define ONH_PARSER_TAGSUBSCRIPTION_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include "../db/objs/Tag.h"
+#include "../driver/ProcessReader.h"
+
+namespace onh {
+
+/**
+ * Subscription request structure (parsed SUBSCRIBE command data)
+ */
+typedef struct {
+	/// Minimum interval between updates (milliseconds)
+	unsigned int interval;
+	/// Minimal value change of the numeric tags which triggers update
+	double deadband;
+	/// Names of the tags to observe
+	std::vector<std::string> tagNames;
+} subscriptionRequest;
+
+/**
+ * Tag subscription class (values pushed to the socket client on change)
+ */
+class TagSubscription {
+	public:
+		TagSubscription();
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		TagSubscription(const TagSubscription&) = delete;
+
+		virtual ~TagSubscription();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		TagSubscription& operator=(const TagSubscription&) = delete;
+
+		/**
+		 * Parse subscription request data
+		 *
+		 * @param data String with request data (interval,deadband,tag1,tag2,...)
+		 *
+		 * @return Subscription request
+		 */
+		static subscriptionRequest parseRequest(const std::string& data);
+
+		/**
+		 * Subscribe tags
+		 *
+		 * @param tags Tags to observe
+		 * @param minInterval Minimum interval between updates (milliseconds)
+		 * @param deadband Minimal value change of the numeric tags which triggers update
+		 */
+		void subscribe(const std::vector<Tag>& tags, unsigned int minInterval, double deadband);
+
+		/**
+		 * Cancel subscription
+		 */
+		void cancel();
+
+		/**
+		 * Check if subscription is active
+		 *
+		 * @return True if subscription is active
+		 */
+		bool isActive() const;
+
+		/**
+		 * Check if subscription needs to be updated
+		 *
+		 * @param generation Current process data generation
+		 *
+		 * @return True if process data changed and minimum interval passed
+		 */
+		bool isUpdateNeeded(unsigned long int generation) const;
+
+		/**
+		 * Get subscription update
+		 *
+		 * @param pr Process reader (with updated process data)
+		 * @param generation Process data generation
+		 *
+		 * @return String with changed tag values (empty if nothing changed)
+		 */
+		std::string getUpdate(ProcessReader& pr, unsigned long int generation);
+
+		/**
+		 * Get subscription update from current tag values
+		 *
+		 * @param values Current tag values (same order as subscribed tags)
+		 * @param generation Process data generation
+		 *
+		 * @return String with changed tag values (empty if nothing changed)
+		 */
+		std::string getUpdate(const std::vector<double>& values, unsigned long int generation);
+
+	private:
+		/**
+		 * Subscribed tag data structure
+		 */
+		typedef struct {
+			/// Tag
+			Tag tag;
+			/// Last sent value
+			double lastValue;
+			/// Value sent flag
+			bool sent;
+		} subscribedTag;
+
+		/**
+		 * Read tag value
+		 *
+		 * @param pr Process reader
+		 * @param tg Tag object
+		 *
+		 * @return Tag value
+		 */
+		double readValue(ProcessReader& pr, const Tag& tg) const;
+
+		/**
+		 * Check if tag value needs to be sent
+		 *
+		 * @param st Subscribed tag
+		 * @param val Current tag value
+		 *
+		 * @return True if value needs to be sent
+		 */
+		bool isChanged(const subscribedTag& st, double val) const;
+
+		/// Subscribed tags
+		std::vector<subscribedTag> tags;
+
+		/// Minimum interval between updates (milliseconds)
+		unsigned int interval;
+
+		/// Minimal value change of the numeric tags
+		double valueDeadband;
+
+		/// Subscription active flag
+		bool active;
+
+		/// First update flag (all values need to be sent)
+		bool firstUpdate;
+
+		/// Process data generation of the last update
+		unsigned long int lastGeneration;
+
+		/// Last update time
+		std::chrono::steady_clock::time_point lastUpdate;
+};
+
+}  // namespace onh
+
+#endif  // ONH_PARSER_TAGSUBSCRIPTION_H_
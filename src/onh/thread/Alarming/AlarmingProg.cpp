@@ -17,22 +17,22 @@
  */
 
 #include <sstream>
+#include <chrono>
 #include "AlarmingProg.h"
 #include "../../utils/Exception.h"
-#include "../../db/AlarmingDB.h"
 
 namespace onh {
 
 AlarmingProg::AlarmingProg(const ProcessReader& pr,
 							const ProcessWriter& pw,
-							const AlarmingDB& adb,
+							DBExecutorPtr dbe,
 							unsigned int updateInterval,
-							const GuardDataController<ThreadExitData> &gdcTED,
-							const GuardDataController<CycleTimeData> &gdcCTD):
+							const SharedDataController<ThreadExitData> &gdcTED,
+							const SharedDataController<CycleTimeData> &gdcCTD):
 	ThreadProgram(gdcTED, gdcCTD, updateInterval, "alarming", "alarmLog_"),
 	prReader(std::make_unique<ProcessReader>(pr)),
 	prWriter(std::make_unique<ProcessWriter>(pw)),
-	db(std::make_unique<AlarmingDB>(adb)) {
+	dbExecutor(dbe) {
 	getLogger() << LOG_INFO("Alarming program initialized");
 }
 
@@ -50,18 +50,30 @@ void AlarmingProg::operator()() {
         if (!prWriter)
             throw Exception("No writer object");
 
+		if (!dbExecutor)
+			throw Exception("No DB executor object");
+
 		while(!isExitFlag()) {
 			// Start thread cycle time measure
 			startCycleMeasure();
 
+			// Process data generation before reader update
+			unsigned long int generation = prReader->getProcessGeneration();
+
 			// Update process reader
 			prReader->updateProcessData();
+			markPhase(CP_PROCESS_COPY);
+
+			// Check previous feedback writes
+			checkFeedbackWrites();
 
 			// Check alarms
 			checkAlarms();
+			markPhase(CP_EVALUATION);
 
-			// Wait
-			threadWait();
+			// Wait on new process data (not longer than update interval)
+			prReader->waitForProcessChange(generation, getUpdateInterval());
+			markPhase(CP_WAIT);
 
 			// Stop thread cycle time measure
 			stopCycleMeasure();
@@ -74,9 +86,44 @@ void AlarmingProg::operator()() {
 	}
 }
 
+void AlarmingProg::readAlarms() {
+	alarmsRead = dbExecutor->read<std::vector<AlarmDefinitionItem>>(DBC_ALARMING, [](DBExecutorContext &ctx) {
+		return ctx.getAlarmingDB().getAlarms();
+	});
+}
+
+void AlarmingProg::writeAlarms(std::function<void(AlarmingDB&)> work) {
+	alarmWrites.push_back(work);
+}
+
+void AlarmingProg::commitAlarmWrites() {
+	if (alarmWrites.empty())
+		return;
+
+	std::vector<std::function<void(AlarmingDB&)>> works;
+	works.swap(alarmWrites);
+
+	dbWrites.push_back(dbExecutor->write(DBC_ALARMING, [works](DBExecutorContext &ctx) {
+		for (const auto& work : works)
+			work(ctx.getAlarmingDB());
+	}));
+}
+
 void AlarmingProg::checkAlarms() {
+	// Check results of the finished alarm state writes
+	if (unsigned int rejected = DBExecutor::checkFinished(dbWrites))
+		getLogger() << LOG_ERROR("Alarm states not written - DB executor queue is full (" << rejected << ")");
+
+	// Alarm definitions read (first cycle)
+	if (!alarmsRead.valid())
+		readAlarms();
+
+	// Do not wait on DB - alarms are checked when definitions are read
+	if (alarmsRead.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return;
+
 	// Get alarms
-	std::vector<AlarmDefinitionItem> ad = db->getAlarms();
+	std::vector<AlarmDefinitionItem> ad = alarmsRead.get();
 
 	// Alarm state - trigger return
 	AlarmDefinitionItem::triggerRet tr;
@@ -85,42 +132,42 @@ void AlarmingProg::checkAlarms() {
 		// Check tag type
 		if (ad[i].getTag().getType() == TT_BIT) {
 			// Get tag value
-			bool tv = prReader->getBitValue(ad[i].getTag());
+			bool tv = prReader->getHandle(ad[i].getTag(), TT_BIT).getBit();
 
 			// Check alarm state
 			tr = ad[i].checkTrigger(tv);
 
 		} else if (ad[i].getTag().getType() == TT_BYTE) {
 			// Get tag value
-			BYTE tv = prReader->getByte(ad[i].getTag());
+			BYTE tv = prReader->getHandle(ad[i].getTag(), TT_BYTE).getByte();
 
 			// Check alarm state
 			tr = ad[i].checkTrigger(tv);
 
 		} else if (ad[i].getTag().getType() == TT_WORD) {
 			// Get tag value
-			WORD tv = prReader->getWord(ad[i].getTag());
+			WORD tv = prReader->getHandle(ad[i].getTag(), TT_WORD).getWord();
 
 			// Check alarm state
 			tr = ad[i].checkTrigger(tv);
 
 		} else if (ad[i].getTag().getType() == TT_DWORD) {
 			// Get tag value
-			DWORD tv = prReader->getDWord(ad[i].getTag());
+			DWORD tv = prReader->getHandle(ad[i].getTag(), TT_DWORD).getDWord();
 
 			// Check alarm state
 			tr = ad[i].checkTrigger(tv);
 
 		} else if (ad[i].getTag().getType() == TT_INT) {
 			// Get tag value
-			int tv = prReader->getInt(ad[i].getTag());
+			int tv = prReader->getHandle(ad[i].getTag(), TT_INT).getInt();
 
 			// Check alarm state
 			tr = ad[i].checkTrigger(tv);
 
 		} else if (ad[i].getTag().getType() == TT_REAL) {
 			// Get tag value
-			float tv = prReader->getReal(ad[i].getTag());
+			float tv = prReader->getHandle(ad[i].getTag(), TT_REAL).getReal();
 
 			// Check alarm state
 			tr = ad[i].checkTrigger(tv);
@@ -128,19 +175,19 @@ void AlarmingProg::checkAlarms() {
 
 		if (tr.trigger) {
 			// Set alarm
-			db->setAlarm(ad[i]);
+			writeAlarms([alarm = ad[i]](AlarmingDB &db) { db.setAlarm(alarm); });
 
 		} else if (tr.activeUpdate) {
 			// Update alarm state
-			db->updateAlarmState(ad[i], tr.active);
+			writeAlarms([alarm = ad[i], active = tr.active](AlarmingDB &db) { db.updateAlarmState(alarm, active); });
 		}
 
 		// Feedback Tags
 		if (ad[i].isPending()) {
 			try {
 				// Set bit informs controller that alarm is not acknowledgment
-				if (!prReader->getBitValue(ad[i].getFeedbackNotAckTag())) {
-					prWriter->setBit(ad[i].getFeedbackNotAckTag());
+				if (!prReader->getHandle(ad[i].getFeedbackNotAckTag(), TT_BIT).getBit()) {
+					feedbackWrites.push_back(prWriter->setBitAsync(ad[i].getFeedbackNotAckTag(), PWP_HIGH));
 				}
 			} catch (AlarmException &e) {
 				if (e.getType() != AlarmException::ExceptionType::NO_FEEDBACK_NOT_ACK_TAG) {
@@ -151,8 +198,8 @@ void AlarmingProg::checkAlarms() {
 
 			try {
 				// HW alarm acknowledgment
-				if (prReader->getBitValue(ad[i].getHWAckTag())) {
-					db->ackAlarm(ad[i].getId());
+				if (prReader->getHandle(ad[i].getHWAckTag(), TT_BIT).getBit()) {
+					writeAlarms([id = ad[i].getId()](AlarmingDB &db) { db.ackAlarm(id); });
 				}
 			} catch (AlarmException &e) {
 				if (e.getType() != AlarmException::ExceptionType::NO_HW_ACK_TAG) {
@@ -164,8 +211,8 @@ void AlarmingProg::checkAlarms() {
 		} else {
 			try {
 				// Reset bit informs controller that alarm is not acknowledgment
-				if (prReader->getBitValue(ad[i].getFeedbackNotAckTag())) {
-					prWriter->resetBit(ad[i].getFeedbackNotAckTag());
+				if (prReader->getHandle(ad[i].getFeedbackNotAckTag(), TT_BIT).getBit()) {
+					feedbackWrites.push_back(prWriter->resetBitAsync(ad[i].getFeedbackNotAckTag(), PWP_HIGH));
 				}
 			} catch (AlarmException &e) {
 				if (e.getType() != AlarmException::ExceptionType::NO_FEEDBACK_NOT_ACK_TAG) {
@@ -175,6 +222,24 @@ void AlarmingProg::checkAlarms() {
 			}
 		}
 	}
+
+	// Alarm state writes (next alarm check waits on definitions read queued after them)
+	commitAlarmWrites();
+
+	// Alarm definitions for next cycle (read after queued alarm state writes)
+	readAlarms();
+}
+
+void AlarmingProg::checkFeedbackWrites() {
+	for (auto it = feedbackWrites.begin(); it != feedbackWrites.end(); ) {
+		if (it->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+			// Re-throw write exception
+			it->get();
+			it = feedbackWrites.erase(it);
+		} else {
+			++it;
+		}
+	}
 }
 
 }  // namespace onh
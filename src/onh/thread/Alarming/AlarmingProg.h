@@ -19,10 +19,12 @@
 #ifndef ONH_THREAD_ALARMING_ALARMINGPROG_H_
 #define ONH_THREAD_ALARMING_ALARMINGPROG_H_
 
+#include <vector>
+#include <future>
 #include "../../driver/ProcessReader.h"
 #include "../../driver/ProcessWriter.h"
 #include "../../db/objs/AlarmDefinitionItem.h"
-#include "../../db/AlarmingDB.h"
+#include "../../db/DBExecutor.h"
 #include "../ThreadProgram.h"
 
 namespace onh {
@@ -34,17 +36,17 @@ class AlarmingProg: public ThreadProgram {
 		 *
 		 * @param pr Process reader
 		 * @param pw Process writer
-		 * @param adb Alarming DB
+		 * @param dbe DB executor
 		 * @param updateInterval Alarm update interval (milliseconds)
 		 * @param gdcTED Thread exit data controller
 		 * @param gdcCTD Thread cycle time controller
 		 */
 		AlarmingProg(const ProcessReader& pr,
 						const ProcessWriter& pw,
-						const AlarmingDB& adb,
+						DBExecutorPtr dbe,
 						unsigned int updateInterval,
-						const GuardDataController<ThreadExitData> &gdcTED,
-						const GuardDataController<CycleTimeData> &gdcCTD);
+						const SharedDataController<ThreadExitData> &gdcTED,
+						const SharedDataController<CycleTimeData> &gdcCTD);
 
 		/**
 		 * Copy constructor - inactive
@@ -70,11 +72,39 @@ class AlarmingProg: public ThreadProgram {
 		/// Handle for process writer object
 		std::unique_ptr<ProcessWriter> prWriter;
 
-		/// Alarmin DB access
-		std::unique_ptr<AlarmingDB> db;
+		/// DB executor (alarming DB access)
+		DBExecutorPtr dbExecutor;
+
+		/// Pending alarm definitions read (queued after alarm state writes)
+		std::future<std::vector<AlarmDefinitionItem>> alarmsRead;
+
+		/// Pending alarm state writes (executed by DB executor threads)
+		std::vector<std::future<void>> dbWrites;
+
+		/// Alarm DB writes of the current alarm check
+		std::vector<std::function<void(AlarmingDB&)>> alarmWrites;
+
+		/// Pending feedback Tag writes (executed by driver writer threads)
+		std::vector<std::future<void>> feedbackWrites;
 
 		/// Check alarms
 		void checkAlarms();
+
+		/// Queue alarm definitions read
+		void readAlarms();
+
+		/**
+		 * Add alarm DB write (written with other writes of the current alarm check)
+		 *
+		 * @param work Write work
+		 */
+		void writeAlarms(std::function<void(AlarmingDB&)> work);
+
+		/// Queue alarm DB writes of the current alarm check (one DB executor work)
+		void commitAlarmWrites();
+
+		/// Check results of the finished feedback Tag writes
+		void checkFeedbackWrites();
 };
 
 }  // namespace onh
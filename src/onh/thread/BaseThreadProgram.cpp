@@ -21,12 +21,13 @@
 
 namespace onh {
 
-BaseThreadProgram::BaseThreadProgram(const GuardDataController<ThreadExitData> &gdcTED,
+BaseThreadProgram::BaseThreadProgram(const SharedDataController<ThreadExitData> &gdcTED,
 									const std::string& dirName,
 									const std::string& fPrefix,
 									bool printLogMsg):
 	printMsg(printLogMsg),
 	thExitController(gdcTED),
+	stopFlag(false),
 	log(std::make_unique<TextLogger>(dirName, fPrefix)) {
 	// Create info
 	if (printMsg)
@@ -38,17 +39,28 @@ BaseThreadProgram::~BaseThreadProgram() {
 		log->write(LOG_INFO("Closing thread logger"));
 }
 
-const GuardDataController<ThreadExitData>& BaseThreadProgram::getExitController() const {
+const SharedDataController<ThreadExitData>& BaseThreadProgram::getExitController() const {
 	return thExitController;
 }
 
+void BaseThreadProgram::stop() {
+	stopFlag.store(true);
+}
+
 bool BaseThreadProgram::isExitFlag() {
+	if (stopFlag.load())
+		return true;
+
 	ThreadExitData ex;
 	thExitController.getData(ex);
 
 	return ex.exit;
 }
 
+bool BaseThreadProgram::isStopFlag() const {
+	return stopFlag.load();
+}
+
 void BaseThreadProgram::exit(const std::string& info) {
 	ThreadExitData ex;
 	ex.exit = true;
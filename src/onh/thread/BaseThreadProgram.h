@@ -19,9 +19,10 @@
 #ifndef ONH_THREAD_BASETHREADPROGRAM_H_
 #define ONH_THREAD_BASETHREADPROGRAM_H_
 
+#include <atomic>
 #include <memory>
 #include "ThreadExitData.h"
-#include "../utils/GuardDataController.h"
+#include "../utils/SharedDataController.h"
 #include "../utils/logger/TextLogger.h"
 #include "../utils/CycleTime.h"
 #include "../utils/Delay.h"
@@ -41,7 +42,7 @@ class BaseThreadProgram {
 		 * @param fPrefix Log file name prefix
 		 * @param printLogMsg Flag prtints log init and destruct messages
 		 */
-		BaseThreadProgram(const GuardDataController<ThreadExitData> &gdcTED,
+		BaseThreadProgram(const SharedDataController<ThreadExitData> &gdcTED,
 				const std::string& dirName,
 				const std::string& fPrefix = "",
 				bool printLogMsg = true);
@@ -66,12 +67,20 @@ class BaseThreadProgram {
 		 */
 		BaseThreadProgram& operator=(const BaseThreadProgram&) = delete;
 
+		/**
+		 * Stop thread program (without application exit)
+		 */
+		void stop();
+
 	private:
 		/// Flag prints log init and destruct messages
 		bool printMsg;
 
 		/// Thread exit data controller
-		GuardDataController<ThreadExitData> thExitController;
+		SharedDataController<ThreadExitData> thExitController;
+
+		/// Thread program stop flag
+		std::atomic<bool> stopFlag;
 
 		/// Logger object
 		std::unique_ptr<ILogger> log;
@@ -82,7 +91,7 @@ class BaseThreadProgram {
 		 *
 		 * @return Exit data controller
 		 */
-		const GuardDataController<ThreadExitData>& getExitController() const;
+		const SharedDataController<ThreadExitData>& getExitController() const;
 
 		/**
 		 * Check if thread need to be closed
@@ -91,6 +100,13 @@ class BaseThreadProgram {
 		 */
 		bool isExitFlag();
 
+		/**
+		 * Check if thread program was stopped (application exit is ignored)
+		 *
+		 * @return True if thread program was stopped
+		 */
+		bool isStopFlag() const;
+
 		/**
 		 * Trigger exit from thread
 		 *
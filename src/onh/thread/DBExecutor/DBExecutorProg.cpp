@@ -0,0 +1,65 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBExecutorProg.h"
+#include "../../utils/Exception.h"
+
+namespace onh {
+
+DBExecutorProg::DBExecutorProg(DBExecutorPtr dbe,
+								unsigned int worker,
+								unsigned int updateInterval,
+								const SharedDataController<ThreadExitData> &gdcTED,
+								const SharedDataController<CycleTimeData> &gdcCTD):
+	ThreadProgram(gdcTED, gdcCTD, updateInterval, "db", "executor_"+std::to_string(worker)+"_"),
+	executor(dbe), workerNumber(worker), waitTime(updateInterval) {
+}
+
+DBExecutorProg::~DBExecutorProg() {
+}
+
+void DBExecutorProg::operator()() {
+	try {
+		getLogger() << LOG_INFO("Start main loop");
+
+		if (!executor)
+			throw Exception("No DB executor object");
+
+		// Run until stopped by thread manager (after all DB work producers exit)
+		while(!isStopFlag()) {
+			// Start thread cycle time measure
+			startCycleMeasure();
+
+			// Wait on works and execute them (errors are passed to the callers)
+			executor->execute(workerNumber, waitTime);
+
+			// Stop thread cycle time measure
+			stopCycleMeasure();
+		}
+
+		// Save works queued before stop
+		executor->execute(workerNumber, 0);
+	} catch (Exception &e) {
+		getLogger() << LOG_ERROR(e.what());
+
+		// Exit application
+		exit("DB executor");
+	}
+}
+
+}  // namespace onh
@@ -0,0 +1,77 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_DBEXECUTOR_DBEXECUTORPROG_H_
+#define ONH_THREAD_DBEXECUTOR_DBEXECUTORPROG_H_
+
+#include "../../db/DBExecutor.h"
+#include "../ThreadProgram.h"
+
+namespace onh {
+
+/**
+ * DB executor program class (executes DB works of one executor worker)
+ */
+class DBExecutorProg: public ThreadProgram {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param dbe DB executor
+		 * @param worker Executor worker number
+		 * @param updateInterval Maximum wait time on new works (milliseconds)
+		 * @param gdcTED Thread exit data controller
+		 * @param gdcCTD Thread cycle time controller
+		 */
+		DBExecutorProg(DBExecutorPtr dbe,
+						unsigned int worker,
+						unsigned int updateInterval,
+						const SharedDataController<ThreadExitData> &gdcTED,
+						const SharedDataController<CycleTimeData> &gdcCTD);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		DBExecutorProg(const DBExecutorProg&) = delete;
+
+		~DBExecutorProg() override;
+
+		/**
+		 * Thread program function
+		 */
+		void operator()() override;
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		DBExecutorProg& operator=(const DBExecutorProg&) = delete;
+
+	private:
+		/// DB executor
+		DBExecutorPtr executor;
+
+		/// Executor worker number
+		unsigned int workerNumber;
+
+		/// Maximum wait time on new works (milliseconds)
+		unsigned int waitTime;
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_DBEXECUTOR_DBEXECUTORPROG_H_
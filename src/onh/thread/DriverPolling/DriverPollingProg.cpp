@@ -28,8 +28,8 @@ namespace onh {
 DriverPollingProg::DriverPollingProg(const DriverBufferUpdater& dbu,
 										unsigned int connId,
 										unsigned int updateInterval,
-										const GuardDataController<ThreadExitData> &gdcTED,
-										const GuardDataController<CycleTimeData> &gdcCTD):
+										const SharedDataController<ThreadExitData> &gdcTED,
+										const SharedDataController<CycleTimeData> &gdcCTD):
 	ThreadProgram(gdcTED, gdcCTD, updateInterval, "driver", "polling_"+std::to_string(connId)+"_"),
 	drvUpdater(std::make_unique<DriverBufferUpdater>(dbu)) {
 }
@@ -42,8 +42,8 @@ class DriverPollingProg: public ThreadProgram {
 		DriverPollingProg(const DriverBufferUpdater& dbu,
 							unsigned int connId,
 							unsigned int updateInterval,
-							const GuardDataController<ThreadExitData> &gdcTED,
-							const GuardDataController<CycleTimeData> &gdcCTD);
+							const SharedDataController<ThreadExitData> &gdcTED,
+							const SharedDataController<CycleTimeData> &gdcCTD);
 
 		/**
 		 * Copy constructor - inactive
@@ -0,0 +1,61 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DriverWriterProg.h"
+#include "../../utils/Exception.h"
+
+namespace onh {
+
+DriverWriterProg::DriverWriterProg(DriverWriteQueuePtr dwq,
+									unsigned int connId,
+									unsigned int updateInterval,
+									const SharedDataController<ThreadExitData> &gdcTED,
+									const SharedDataController<CycleTimeData> &gdcCTD):
+	ThreadProgram(gdcTED, gdcCTD, updateInterval, "driver", "writer_"+std::to_string(connId)+"_"),
+	writeQueue(dwq), waitTime(updateInterval) {
+}
+
+DriverWriterProg::~DriverWriterProg() {
+}
+
+void DriverWriterProg::operator()() {
+	try {
+		getLogger() << LOG_INFO("Start main loop");
+
+		if (!writeQueue)
+			throw Exception("No driver write queue object");
+
+		while(!isExitFlag()) {
+			// Start thread cycle time measure
+			startCycleMeasure();
+
+			// Wait on writes and execute them (errors are passed to the writers)
+			writeQueue->execute(waitTime);
+
+			// Stop thread cycle time measure
+			stopCycleMeasure();
+		}
+	} catch (Exception &e) {
+		getLogger() << LOG_ERROR(e.what());
+
+		// Exit application
+		exit("Driver writer");
+	}
+}
+
+}  // namespace onh
@@ -0,0 +1,74 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_DRIVERWRITER_DRIVERWRITERPROG_H_
+#define ONH_THREAD_DRIVERWRITER_DRIVERWRITERPROG_H_
+
+#include "../../driver/DriverWriteQueue.h"
+#include "../ThreadProgram.h"
+
+namespace onh {
+
+/**
+ * Driver writer program class (executes driver write queue)
+ */
+class DriverWriterProg: public ThreadProgram {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param dwq Driver write queue
+		 * @param connId Driver connection identifier
+		 * @param updateInterval Maximum wait time on new writes (milliseconds)
+		 * @param gdcTED Thread exit data controller
+		 * @param gdcCTD Thread cycle time controller
+		 */
+		DriverWriterProg(DriverWriteQueuePtr dwq,
+							unsigned int connId,
+							unsigned int updateInterval,
+							const SharedDataController<ThreadExitData> &gdcTED,
+							const SharedDataController<CycleTimeData> &gdcCTD);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		DriverWriterProg(const DriverWriterProg&) = delete;
+
+		~DriverWriterProg() override;
+
+		/**
+		 * Thread program function
+		 */
+		void operator()() override;
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		DriverWriterProg& operator=(const DriverWriterProg&) = delete;
+
+	private:
+		/// Driver write queue
+		DriverWriteQueuePtr writeQueue;
+
+		/// Maximum wait time on new writes (milliseconds)
+		unsigned int waitTime;
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_DRIVERWRITER_DRIVERWRITERPROG_H_
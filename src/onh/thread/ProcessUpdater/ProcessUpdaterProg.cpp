@@ -27,8 +27,8 @@ namespace onh {
 ProcessUpdaterProg::ProcessUpdaterProg(const ProcessUpdater& pru,
 										unsigned int connId,
 										unsigned int updateInterval,
-										const GuardDataController<ThreadExitData> &gdcTED,
-										const GuardDataController<CycleTimeData> &gdcCTD):
+										const SharedDataController<ThreadExitData> &gdcTED,
+										const SharedDataController<CycleTimeData> &gdcCTD):
 	ThreadProgram(gdcTED, gdcCTD, updateInterval, "process", "procUpd_"+std::to_string(connId)+"_"),
 	prUpdater(std::make_unique<ProcessUpdater>(pru)) {
 }
@@ -49,6 +49,7 @@ void ProcessUpdaterProg::operator()() {
 
 			// Read data from controller
 			prUpdater->update();
+			markPhase(CP_PROCESS_COPY);
 
 			// Wait
 			threadWait();
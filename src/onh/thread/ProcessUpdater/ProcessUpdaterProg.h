@@ -42,8 +42,8 @@ class ProcessUpdaterProg: public ThreadProgram {
 		ProcessUpdaterProg(const ProcessUpdater& pru,
 							unsigned int connId,
 							unsigned int updateInterval,
-							const GuardDataController<ThreadExitData> &gdcTED,
-							const GuardDataController<CycleTimeData> &gdcCTD);
+							const SharedDataController<ThreadExitData> &gdcTED,
+							const SharedDataController<CycleTimeData> &gdcCTD);
 
 		/**
 		 * Copy constructor - inactive
@@ -0,0 +1,90 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_SCRIPT_SCRIPTBYTECODE_H_
+#define ONH_THREAD_SCRIPT_SCRIPTBYTECODE_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace onh {
+
+/**
+ * Embedded script operation codes (binary operations: SOP_ADD - SOP_MAX)
+ */
+typedef enum {
+	SOP_CONST = 0,
+	SOP_LOAD_TAG,
+	SOP_STORE_TAG,
+	SOP_LOAD_VAR,
+	SOP_STORE_VAR,
+	SOP_NEG,
+	SOP_NOT,
+	SOP_ABS,
+	SOP_ADD,
+	SOP_SUB,
+	SOP_MUL,
+	SOP_DIV,
+	SOP_MOD,
+	SOP_EQ,
+	SOP_NE,
+	SOP_LT,
+	SOP_LE,
+	SOP_GT,
+	SOP_GE,
+	SOP_AND,
+	SOP_OR,
+	SOP_MIN,
+	SOP_MAX,
+	SOP_JMP,
+	SOP_JMP_FALSE,
+	SOP_PRINT,
+	SOP_EXIT,
+	SOP_HALT
+} scriptOpCode;
+
+/**
+ * Embedded script instruction structure
+ */
+typedef struct {
+	/// Operation code
+	scriptOpCode op;
+	/// Operation argument (constant, tag, variable index or jump address)
+	unsigned int arg;
+} scriptInstruction;
+
+/**
+ * Embedded script bytecode structure
+ */
+typedef struct {
+	/// Instructions
+	std::vector<scriptInstruction> code;
+	/// Constants
+	std::vector<double> constants;
+	/// Names of the tags used by the script
+	std::vector<std::string> tags;
+	/// Local variable names
+	std::vector<std::string> variables;
+} ScriptBytecode;
+
+using ScriptBytecodePtr = std::shared_ptr<const ScriptBytecode>;
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_SCRIPT_SCRIPTBYTECODE_H_
@@ -0,0 +1,393 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptCompiler.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <sstream>
+#include "../../utils/Exception.h"
+
+namespace onh {
+
+namespace {
+
+/// Language keywords (can not be used as variable names)
+const std::vector<std::string> KEYWORDS = {
+	"if", "then", "else", "end", "while", "do", "print", "exit",
+	"and", "or", "not", "true", "false", "abs", "min", "max"
+};
+
+/// Two characters symbols
+const std::vector<std::string> SYMBOLS2 = {"==", "!=", "<=", ">=", "&&", "||"};
+
+/// One character symbols
+const std::string SYMBOLS1 = "=<>+-*/%!(),;";
+
+}  // namespace
+
+ScriptCompiler::ScriptCompiler():
+	pos(0), bc(std::make_shared<ScriptBytecode>()) {
+}
+
+ScriptCompiler::~ScriptCompiler() {
+}
+
+ScriptBytecodePtr ScriptCompiler::compile(const std::string& source) {
+	ScriptCompiler sc;
+
+	sc.tokenize(source);
+
+	std::string t = sc.parseBlock({});
+	if (!t.empty())
+		sc.error("Unexpected '" + t + "'");
+
+	sc.emit(SOP_HALT);
+
+	return sc.bc;
+}
+
+void ScriptCompiler::tokenize(const std::string& source) {
+	unsigned int line = 1;
+	size_t i = 0;
+
+	while (i < source.length()) {
+		char c = source[i];
+
+		if (c == '\n') {
+			++line;
+			++i;
+		} else if (isspace(static_cast<unsigned char>(c))) {
+			++i;
+		} else if (c == '#') {
+			// Comment
+			while (i < source.length() && source[i] != '\n')
+				++i;
+		} else if (isdigit(static_cast<unsigned char>(c)) || (c == '.' && i + 1 < source.length() &&
+					isdigit(static_cast<unsigned char>(source[i+1])))) {
+			// Number
+			const char *start = source.c_str() + i;
+			char *stop = nullptr;
+			double v = strtod(start, &stop);
+
+			tokens.push_back({STT_NUMBER, std::string(start, stop - start), v, line});
+			i += stop - start;
+		} else if (isalpha(static_cast<unsigned char>(c)) || c == '_' || c == '$') {
+			// Identifier or tag name
+			size_t start = (c == '$')?(i+1):(i);
+			size_t end = start;
+			while (end < source.length() && (isalnum(static_cast<unsigned char>(source[end])) || source[end] == '_'))
+				++end;
+
+			if (end == start) {
+				pos = tokens.size();
+				tokens.push_back({STT_SYMBOL, "$", 0, line});
+				error("Missing tag name after '$'");
+			}
+
+			tokens.push_back({(c == '$')?(STT_TAG):(STT_IDENT), source.substr(start, end - start), 0, line});
+			i = end;
+		} else {
+			// Symbols
+			std::string s2 = source.substr(i, 2);
+			if (std::find(SYMBOLS2.begin(), SYMBOLS2.end(), s2) != SYMBOLS2.end()) {
+				tokens.push_back({STT_SYMBOL, s2, 0, line});
+				i += 2;
+			} else if (SYMBOLS1.find(c) != std::string::npos) {
+				tokens.push_back({STT_SYMBOL, std::string(1, c), 0, line});
+				++i;
+			} else {
+				pos = tokens.size();
+				tokens.push_back({STT_SYMBOL, std::string(1, c), 0, line});
+				error("Invalid character '" + std::string(1, c) + "'");
+			}
+		}
+	}
+
+	tokens.push_back({STT_END, "", 0, line});
+	pos = 0;
+}
+
+std::string ScriptCompiler::parseBlock(const std::vector<std::string>& terminators) {
+	while (tokens[pos].type != STT_END) {
+		// Statement separators
+		if (accept(";"))
+			continue;
+
+		// End of the block
+		if (tokens[pos].type == STT_IDENT &&
+				std::find(terminators.begin(), terminators.end(), tokens[pos].text) != terminators.end()) {
+			return tokens[pos++].text;
+		}
+
+		parseStatement();
+	}
+
+	if (!terminators.empty())
+		error("Missing '" + terminators.back() + "'");
+
+	return "";
+}
+
+void ScriptCompiler::parseStatement() {
+	const token &t = tokens[pos];
+
+	if (t.type == STT_TAG) {
+		// Tag write
+		unsigned int idx = tagIndex(t.text);
+		++pos;
+		expect("=");
+		parseExpression();
+		emit(SOP_STORE_TAG, idx);
+	} else if (accept("if")) {
+		parseExpression();
+		expect("then");
+
+		unsigned int jFalse = emit(SOP_JMP_FALSE);
+		std::string term = parseBlock({"else", "end"});
+
+		if (term == "else") {
+			unsigned int jEnd = emit(SOP_JMP);
+			bc->code[jFalse].arg = bc->code.size();
+			parseBlock({"end"});
+			bc->code[jEnd].arg = bc->code.size();
+		} else {
+			bc->code[jFalse].arg = bc->code.size();
+		}
+	} else if (accept("while")) {
+		unsigned int start = bc->code.size();
+
+		parseExpression();
+		expect("do");
+
+		unsigned int jFalse = emit(SOP_JMP_FALSE);
+		parseBlock({"end"});
+		emit(SOP_JMP, start);
+		bc->code[jFalse].arg = bc->code.size();
+	} else if (accept("print")) {
+		parseExpression();
+		emit(SOP_PRINT);
+	} else if (accept("exit")) {
+		parseExpression();
+		emit(SOP_EXIT);
+	} else if (t.type == STT_IDENT) {
+		// Local variable write
+		if (std::find(KEYWORDS.begin(), KEYWORDS.end(), t.text) != KEYWORDS.end())
+			error("Unexpected '" + t.text + "'");
+
+		std::string name = t.text;
+		++pos;
+		expect("=");
+		parseExpression();
+		emit(SOP_STORE_VAR, variableIndex(name, true));
+	} else {
+		error("Unexpected '" + t.text + "'");
+	}
+}
+
+void ScriptCompiler::parseExpression() {
+	parseAnd();
+
+	while (accept("or") || accept("||")) {
+		parseAnd();
+		emit(SOP_OR);
+	}
+}
+
+void ScriptCompiler::parseAnd() {
+	parseComparison();
+
+	while (accept("and") || accept("&&")) {
+		parseComparison();
+		emit(SOP_AND);
+	}
+}
+
+void ScriptCompiler::parseComparison() {
+	parseTerm();
+
+	while (true) {
+		scriptOpCode op;
+
+		if (accept("=="))
+			op = SOP_EQ;
+		else if (accept("!="))
+			op = SOP_NE;
+		else if (accept("<"))
+			op = SOP_LT;
+		else if (accept("<="))
+			op = SOP_LE;
+		else if (accept(">"))
+			op = SOP_GT;
+		else if (accept(">="))
+			op = SOP_GE;
+		else
+			break;
+
+		parseTerm();
+		emit(op);
+	}
+}
+
+void ScriptCompiler::parseTerm() {
+	parseFactor();
+
+	while (true) {
+		scriptOpCode op;
+
+		if (accept("+"))
+			op = SOP_ADD;
+		else if (accept("-"))
+			op = SOP_SUB;
+		else
+			break;
+
+		parseFactor();
+		emit(op);
+	}
+}
+
+void ScriptCompiler::parseFactor() {
+	parseUnary();
+
+	while (true) {
+		scriptOpCode op;
+
+		if (accept("*"))
+			op = SOP_MUL;
+		else if (accept("/"))
+			op = SOP_DIV;
+		else if (accept("%"))
+			op = SOP_MOD;
+		else
+			break;
+
+		parseUnary();
+		emit(op);
+	}
+}
+
+void ScriptCompiler::parseUnary() {
+	if (accept("-")) {
+		parseUnary();
+		emit(SOP_NEG);
+	} else if (accept("!") || accept("not")) {
+		parseUnary();
+		emit(SOP_NOT);
+	} else {
+		parsePrimary();
+	}
+}
+
+void ScriptCompiler::parsePrimary() {
+	const token &t = tokens[pos];
+
+	if (t.type == STT_NUMBER) {
+		++pos;
+		bc->constants.push_back(t.number);
+		emit(SOP_CONST, bc->constants.size()-1);
+	} else if (t.type == STT_TAG) {
+		++pos;
+		emit(SOP_LOAD_TAG, tagIndex(t.text));
+	} else if (accept("(")) {
+		parseExpression();
+		expect(")");
+	} else if (accept("true") || accept("false")) {
+		bc->constants.push_back((tokens[pos-1].text == "true")?(1.0):(0.0));
+		emit(SOP_CONST, bc->constants.size()-1);
+	} else if (accept("abs")) {
+		expect("(");
+		parseExpression();
+		expect(")");
+		emit(SOP_ABS);
+	} else if (check("min") || check("max")) {
+		scriptOpCode op = (tokens[pos++].text == "min")?(SOP_MIN):(SOP_MAX);
+		expect("(");
+		parseExpression();
+		expect(",");
+		parseExpression();
+		expect(")");
+		emit(op);
+	} else if (t.type == STT_IDENT &&
+				std::find(KEYWORDS.begin(), KEYWORDS.end(), t.text) == KEYWORDS.end()) {
+		++pos;
+		emit(SOP_LOAD_VAR, variableIndex(t.text, false));
+	} else {
+		error((t.type == STT_END)?("Unexpected end of script"):("Unexpected '" + t.text + "'"));
+	}
+}
+
+bool ScriptCompiler::check(const std::string& text) const {
+	const token &t = tokens[pos];
+
+	return (t.type == STT_SYMBOL || t.type == STT_IDENT) && t.text == text;
+}
+
+bool ScriptCompiler::accept(const std::string& text) {
+	if (!check(text))
+		return false;
+
+	++pos;
+
+	return true;
+}
+
+void ScriptCompiler::expect(const std::string& text) {
+	if (!accept(text))
+		error("Expected '" + text + "'");
+}
+
+unsigned int ScriptCompiler::emit(scriptOpCode op, unsigned int arg) {
+	bc->code.push_back({op, arg});
+
+	return bc->code.size()-1;
+}
+
+unsigned int ScriptCompiler::tagIndex(const std::string& name) {
+	auto it = std::find(bc->tags.begin(), bc->tags.end(), name);
+
+	if (it != bc->tags.end())
+		return it - bc->tags.begin();
+
+	bc->tags.push_back(name);
+
+	return bc->tags.size()-1;
+}
+
+unsigned int ScriptCompiler::variableIndex(const std::string& name, bool create) {
+	auto it = std::find(bc->variables.begin(), bc->variables.end(), name);
+
+	if (it != bc->variables.end())
+		return it - bc->variables.begin();
+
+	if (!create)
+		error("Unknown variable '" + name + "'");
+
+	bc->variables.push_back(name);
+
+	return bc->variables.size()-1;
+}
+
+void ScriptCompiler::error(const std::string& msg) const {
+	std::stringstream s;
+	s << "Line " << tokens[(pos < tokens.size())?(pos):(tokens.size()-1)].line << ": " << msg;
+
+	throw Exception(s.str(), "ScriptCompiler::compile");
+}
+
+}  // namespace onh
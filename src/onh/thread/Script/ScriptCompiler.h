@@ -0,0 +1,219 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_SCRIPT_SCRIPTCOMPILER_H_
+#define ONH_THREAD_SCRIPT_SCRIPTCOMPILER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "ScriptBytecode.h"
+
+namespace onh {
+
+/**
+ * Embedded script compiler class
+ *
+ * Compiles embedded script source to the bytecode. Language:
+ * - statements: 'name = expr', '$TagName = expr', 'print expr', 'exit expr',
+ *   'if expr then ... [else ...] end', 'while expr do ... end'
+ * - expressions: numbers, true/false, local variables, $TagName, + - * / %,
+ *   == != < <= > >=, and/&&, or/||, not/!, abs(x), min(x, y), max(x, y)
+ * - statements may be separated by ';', '#' starts a comment
+ */
+class ScriptCompiler {
+	public:
+		/**
+		 * Copy constructor - inactive
+		 */
+		ScriptCompiler(const ScriptCompiler&) = delete;
+
+		virtual ~ScriptCompiler();
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		ScriptCompiler& operator=(const ScriptCompiler&) = delete;
+
+		/**
+		 * Compile script
+		 *
+		 * @param source Script source
+		 *
+		 * @return Script bytecode
+		 */
+		static ScriptBytecodePtr compile(const std::string& source);
+
+	private:
+		/**
+		 * Token types
+		 */
+		typedef enum {
+			STT_NUMBER = 0,
+			STT_IDENT,
+			STT_TAG,
+			STT_SYMBOL,
+			STT_END
+		} tokenType;
+
+		/**
+		 * Token structure
+		 */
+		typedef struct {
+			/// Token type
+			tokenType type;
+			/// Token text
+			std::string text;
+			/// Number value
+			double number;
+			/// Source line
+			unsigned int line;
+		} token;
+
+		/// Script tokens
+		std::vector<token> tokens;
+
+		/// Current token
+		unsigned int pos;
+
+		/// Compiled bytecode
+		std::shared_ptr<ScriptBytecode> bc;
+
+		ScriptCompiler();
+
+		/**
+		 * Split source into tokens
+		 *
+		 * @param source Script source
+		 */
+		void tokenize(const std::string& source);
+
+		/**
+		 * Parse statements until one of the keywords
+		 *
+		 * @param terminators Keywords which end the block
+		 *
+		 * @return Keyword which ended the block (empty on end of the script)
+		 */
+		std::string parseBlock(const std::vector<std::string>& terminators);
+
+		/**
+		 * Parse one statement
+		 */
+		void parseStatement();
+
+		/**
+		 * Parse expression (or)
+		 */
+		void parseExpression();
+
+		/**
+		 * Parse and expression
+		 */
+		void parseAnd();
+
+		/**
+		 * Parse comparison expression
+		 */
+		void parseComparison();
+
+		/**
+		 * Parse additive expression
+		 */
+		void parseTerm();
+
+		/**
+		 * Parse multiplicative expression
+		 */
+		void parseFactor();
+
+		/**
+		 * Parse unary expression
+		 */
+		void parseUnary();
+
+		/**
+		 * Parse primary expression
+		 */
+		void parsePrimary();
+
+		/**
+		 * Check current token
+		 *
+		 * @param text Expected token text (symbol or keyword)
+		 *
+		 * @return True if current token is the expected one
+		 */
+		bool check(const std::string& text) const;
+
+		/**
+		 * Skip current token if it is the expected one
+		 *
+		 * @param text Expected token text (symbol or keyword)
+		 *
+		 * @return True if token was skipped
+		 */
+		bool accept(const std::string& text);
+
+		/**
+		 * Skip expected token (throws if current token is different)
+		 *
+		 * @param text Expected token text (symbol or keyword)
+		 */
+		void expect(const std::string& text);
+
+		/**
+		 * Add instruction
+		 *
+		 * @param op Operation code
+		 * @param arg Operation argument
+		 *
+		 * @return Instruction address
+		 */
+		unsigned int emit(scriptOpCode op, unsigned int arg = 0);
+
+		/**
+		 * Get tag index
+		 *
+		 * @param name Tag name
+		 *
+		 * @return Tag index
+		 */
+		unsigned int tagIndex(const std::string& name);
+
+		/**
+		 * Get local variable index
+		 *
+		 * @param name Variable name
+		 * @param create Create variable if not exist
+		 *
+		 * @return Variable index
+		 */
+		unsigned int variableIndex(const std::string& name, bool create);
+
+		/**
+		 * Throw compilation error
+		 *
+		 * @param msg Error message
+		 */
+		[[noreturn]] void error(const std::string& msg) const;
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_SCRIPT_SCRIPTCOMPILER_H_
@@ -0,0 +1,304 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptEngine.h"
+#include <sys/stat.h>
+#include <math.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include "../../utils/Exception.h"
+
+namespace onh {
+
+namespace {
+
+/**
+ * Script host with access to the process data
+ * Tags are read from the reader snapshot and written in one process writer batch.
+ */
+class ProcessScriptHost: public ScriptHost {
+	public:
+		ProcessScriptHost(const embeddedScript& sc, ProcessReader& pr, ProcessWriter& pw, std::stringstream& output):
+			tags(sc.tags), writer(pw), out(output), batch(false) {
+			// Bind script tags
+			for (const auto& tg : tags)
+				handles.push_back(&pr.getHandle(tg, tg.getType()));
+		}
+
+		double readTag(unsigned int idx) override {
+			const ProcessTagHandle &h = *handles[idx];
+
+			switch (tags[idx].getType()) {
+				case TT_BIT: return (h.getBit())?(1.0):(0.0);
+				case TT_BYTE: return h.getByte();
+				case TT_WORD: return h.getWord();
+				case TT_DWORD: return h.getDWord();
+				case TT_INT: return h.getInt();
+				case TT_REAL: return h.getReal();
+			}
+
+			return 0.0;
+		}
+
+		void writeTag(unsigned int idx, double val) override {
+			const Tag &tg = tags[idx];
+
+			if (!batch) {
+				writer.beginBatch();
+				batch = true;
+			}
+
+			switch (tg.getType()) {
+				case TT_BIT: {
+					if (val != 0.0)
+						writer.setBit(tg);
+					else
+						writer.resetBit(tg);
+				}; break;
+				case TT_BYTE: writer.writeByte(tg, static_cast<BYTE>(llround(val))); break;
+				case TT_WORD: writer.writeWord(tg, static_cast<WORD>(llround(val))); break;
+				case TT_DWORD: writer.writeDWord(tg, static_cast<DWORD>(llround(val))); break;
+				case TT_INT: writer.writeInt(tg, static_cast<int>(llround(val))); break;
+				case TT_REAL: writer.writeReal(tg, static_cast<float>(val)); break;
+			}
+		}
+
+		void print(double val) override {
+			out << val << "\n";
+		}
+
+		/**
+		 * Write tags changed by the script
+		 */
+		void commit() {
+			if (batch)
+				writer.commitBatch();
+			batch = false;
+		}
+
+		/**
+		 * Drop tags changed by the script
+		 */
+		void cancel() {
+			if (batch)
+				writer.cancelBatch();
+			batch = false;
+		}
+
+	private:
+		/// Script tags
+		const std::vector<Tag> &tags;
+		/// Script tag handles
+		std::vector<const ProcessTagHandle*> handles;
+		/// Process writer
+		ProcessWriter &writer;
+		/// Script output
+		std::stringstream &out;
+		/// Write batch started
+		bool batch;
+};
+
+}  // namespace
+
+ScriptEngine::ScriptEngine(const ProcessReader& pr,
+							const ProcessWriter& pw,
+							unsigned int workers,
+							const scriptBudget& budget):
+	prReader(std::make_unique<ProcessReader>(pr)),
+	prWriter(std::make_unique<ProcessWriter>(pw)),
+	runBudget(budget),
+	exitFlag(false) {
+	if (workers == 0)
+		throw Exception("Workers count can not be 0", "ScriptEngine::ScriptEngine");
+
+	for (unsigned int i = 0; i < workers; ++i)
+		threads.emplace_back(&ScriptEngine::worker, this);
+}
+
+ScriptEngine::~ScriptEngine() {
+	{
+		std::lock_guard<std::mutex> lk(lock);
+		exitFlag = true;
+	}
+	queueCond.notify_all();
+
+	for (auto& th : threads)
+		th.join();
+}
+
+bool ScriptEngine::isEmbeddedScript(const std::string& scriptName) {
+	std::string ext = SCRIPT_ENGINE_EXTENSION;
+
+	return scriptName.length() > ext.length() &&
+			scriptName.compare(scriptName.length() - ext.length(), ext.length(), ext) == 0;
+}
+
+EmbeddedScriptPtr ScriptEngine::getCachedScript(const std::string& scriptPath) const {
+	struct stat st;
+
+	auto it = cache.find(scriptPath);
+	if (it == cache.end() || stat(scriptPath.c_str(), &st))
+		return nullptr;
+
+	// Script not changed since last compilation
+	if (it->second.size == st.st_size &&
+			it->second.mtime.tv_sec == st.st_mtim.tv_sec &&
+			it->second.mtime.tv_nsec == st.st_mtim.tv_nsec) {
+		return it->second.script;
+	}
+
+	return nullptr;
+}
+
+compiledScript ScriptEngine::compile(const std::string& scriptPath) {
+	struct stat st;
+
+	if (stat(scriptPath.c_str(), &st))
+		throw Exception("Can not read script file "+scriptPath, "ScriptEngine::compile");
+
+	// Read source
+	std::ifstream f(scriptPath);
+	std::stringstream src;
+	src << f.rdbuf();
+
+	return {scriptPath, st.st_mtim, st.st_size, ScriptCompiler::compile(src.str())};
+}
+
+EmbeddedScriptPtr ScriptEngine::addScript(const compiledScript& cs, const std::vector<Tag>& tags) {
+	if (!cs.bytecode || tags.size() != cs.bytecode->tags.size())
+		throw Exception("Script "+cs.path+" tags are not resolved", "ScriptEngine::addScript");
+
+	auto sc = std::make_shared<embeddedScript>();
+	sc->bytecode = cs.bytecode;
+	sc->tags = tags;
+
+	cache[cs.path] = {cs.mtime, cs.size, sc};
+
+	return sc;
+}
+
+void ScriptEngine::run(unsigned int id,
+						EmbeddedScriptPtr script,
+						const std::string& scriptPath,
+						const std::string& scriptOutputLogName) {
+	{
+		std::lock_guard<std::mutex> lk(lock);
+		queue.push_back({id, script, scriptPath, scriptOutputLogName});
+	}
+
+	queueCond.notify_one();
+}
+
+std::vector<scriptResult> ScriptEngine::getFinished() {
+	std::vector<scriptResult> ret;
+
+	std::lock_guard<std::mutex> lk(lock);
+	ret.swap(finished);
+
+	return ret;
+}
+
+void ScriptEngine::worker() {
+	// Own process data access
+	ProcessReader pr(*prReader);
+	ProcessWriter pw(*prWriter);
+	ScriptVM vm;
+
+	while (true) {
+		scriptJob job;
+
+		{
+			std::unique_lock<std::mutex> lk(lock);
+			queueCond.wait(lk, [this]{ return exitFlag || !queue.empty(); });
+
+			if (exitFlag)
+				break;
+
+			job = queue.front();
+			queue.pop_front();
+		}
+
+		scriptResult res = execute(job, vm, pr, pw);
+
+		std::lock_guard<std::mutex> lk(lock);
+		finished.push_back(res);
+	}
+}
+
+scriptResult ScriptEngine::execute(const scriptJob& job, ScriptVM& vm, ProcessReader& pr, ProcessWriter& pw) const {
+	scriptResult res = {job.id, SCRIPT_EXIT_CODE_ERROR, false, 0};
+
+	std::stringstream out;
+	std::stringstream summary;
+
+	auto start = std::chrono::steady_clock::now();
+	scriptRunResult rr = {SRS_ERROR, SCRIPT_EXIT_CODE_ERROR, 0, ""};
+
+	try {
+		// Current process data
+		pr.updateProcessData();
+
+		ProcessScriptHost host(*job.script, pr, pw, out);
+
+		rr = vm.run(*job.script->bytecode, host, runBudget);
+
+		// Tags are written only if script finished
+		if (rr.status == SRS_OK) {
+			host.commit();
+		} else {
+			host.cancel();
+		}
+	} catch (Exception &e) {
+		rr.status = SRS_ERROR;
+		rr.error = e.what();
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+	res.duration = elapsed.count() / 1000;
+
+	switch (rr.status) {
+		case SRS_OK: {
+			res.exitCode = rr.exitCode;
+			summary << "Script execution (" << elapsed.count() << " microseconds, " << rr.instructions;
+			summary << " instructions) finished with exit code " << res.exitCode << ".\n";
+		}; break;
+		case SRS_INSTRUCTION_LIMIT: {
+			res.timeout = true;
+			summary << "Script stopped - instruction limit exceeded (" << rr.instructions << " instructions).\n";
+		}; break;
+		case SRS_TIME_LIMIT: {
+			res.timeout = true;
+			summary << "Script stopped - time limit exceeded (" << elapsed.count() << " microseconds).\n";
+		}; break;
+		case SRS_ERROR: {
+			summary << "Script error: " << rr.error << "\n";
+		}; break;
+	}
+
+	// Script log
+	std::ofstream log(job.log);
+	log << "Run script " << job.path << " ...\n";
+	log << "Script output:\n";
+	log << out.str();
+	log << summary.str();
+
+	return res;
+}
+
+}  // namespace onh
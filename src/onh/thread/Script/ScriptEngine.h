@@ -0,0 +1,242 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_SCRIPT_SCRIPTENGINE_H_
+#define ONH_THREAD_SCRIPT_SCRIPTENGINE_H_
+
+#include <sys/types.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../driver/ProcessReader.h"
+#include "../../driver/ProcessWriter.h"
+#include "ScriptExecutor.h"
+#include "ScriptCompiler.h"
+#include "ScriptVM.h"
+
+/// Embedded script file extension
+#define SCRIPT_ENGINE_EXTENSION ".onhs"
+/// Maximum number of instructions executed in one embedded script run
+#define SCRIPT_ENGINE_INSTRUCTION_LIMIT 1000000
+
+namespace onh {
+
+/**
+ * Embedded script structure (bytecode with resolved tags)
+ */
+typedef struct {
+	/// Script bytecode
+	ScriptBytecodePtr bytecode;
+	/// Tags used by the script (same order as bytecode tag names)
+	std::vector<Tag> tags;
+} embeddedScript;
+
+using EmbeddedScriptPtr = std::shared_ptr<const embeddedScript>;
+
+/**
+ * Compiled script structure (bytecode waiting on tags resolution)
+ */
+typedef struct {
+	/// Path to the script
+	std::string path;
+	/// Script file modification time
+	struct timespec mtime;
+	/// Script file size
+	off_t size;
+	/// Script bytecode
+	ScriptBytecodePtr bytecode;
+} compiledScript;
+
+/**
+ * Embedded script engine class
+ *
+ * Runs embedded scripts (SCRIPT_ENGINE_EXTENSION) in the worker threads.
+ * Scripts read tags directly through the process reader tag handles and
+ * write tags in one process writer batch per run. Compiled scripts are
+ * cached until the script file changes.
+ */
+class ScriptEngine {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param pr Process reader
+		 * @param pw Process writer
+		 * @param workers Number of worker threads
+		 * @param budget Script run budget
+		 */
+		ScriptEngine(const ProcessReader& pr,
+						const ProcessWriter& pw,
+						unsigned int workers,
+						const scriptBudget& budget);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		ScriptEngine(const ScriptEngine&) = delete;
+
+		virtual ~ScriptEngine();
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		ScriptEngine& operator=(const ScriptEngine&) = delete;
+
+		/**
+		 * Check if script is the embedded script
+		 *
+		 * @param scriptName Script name
+		 *
+		 * @return True if script should be run by the engine
+		 */
+		static bool isEmbeddedScript(const std::string& scriptName);
+
+		/**
+		 * Get cached script (script file not changed since last compilation)
+		 * Not thread safe - called only by the engine owner.
+		 *
+		 * @param scriptPath Path to the script
+		 *
+		 * @return Cached script or nullptr if script needs compilation
+		 */
+		EmbeddedScriptPtr getCachedScript(const std::string& scriptPath) const;
+
+		/**
+		 * Compile script (tags are resolved by the caller)
+		 *
+		 * @param scriptPath Path to the script
+		 *
+		 * @return Compiled script
+		 */
+		static compiledScript compile(const std::string& scriptPath);
+
+		/**
+		 * Put compiled script with resolved tags into the cache
+		 * Not thread safe - called only by the engine owner.
+		 *
+		 * @param cs Compiled script
+		 * @param tags Tags used by the script (same order as bytecode tag names)
+		 *
+		 * @return Script ready to run
+		 */
+		EmbeddedScriptPtr addScript(const compiledScript& cs, const std::vector<Tag>& tags);
+
+		/**
+		 * Put script to the run queue
+		 *
+		 * @param id Script item identifier
+		 * @param script Compiled script
+		 * @param scriptPath Path to the script
+		 * @param scriptOutputLogName Name of the file containing output from the script
+		 */
+		void run(unsigned int id,
+					EmbeddedScriptPtr script,
+					const std::string& scriptPath,
+					const std::string& scriptOutputLogName);
+
+		/**
+		 * Get results of the finished scripts (results are removed from the engine)
+		 *
+		 * @return Finished scripts results
+		 */
+		std::vector<scriptResult> getFinished();
+
+	private:
+		/**
+		 * Script job structure
+		 */
+		typedef struct {
+			/// Script item identifier
+			unsigned int id;
+			/// Compiled script
+			EmbeddedScriptPtr script;
+			/// Path to the script
+			std::string path;
+			/// Name of the file containing output from the script
+			std::string log;
+		} scriptJob;
+
+		/**
+		 * Compiled script cache entry structure
+		 */
+		typedef struct {
+			/// Script file modification time
+			struct timespec mtime;
+			/// Script file size
+			off_t size;
+			/// Compiled script
+			EmbeddedScriptPtr script;
+		} cacheEntry;
+
+		/// Process reader (copied by the workers)
+		std::unique_ptr<ProcessReader> prReader;
+
+		/// Process writer (copied by the workers)
+		std::unique_ptr<ProcessWriter> prWriter;
+
+		/// Script run budget
+		const scriptBudget runBudget;
+
+		/// Compiled scripts <script path, cache entry>
+		std::map<std::string, cacheEntry> cache;
+
+		/// Queued scripts
+		std::deque<scriptJob> queue;
+
+		/// Finished scripts results
+		std::vector<scriptResult> finished;
+
+		/// Queue and results lock
+		std::mutex lock;
+
+		/// Queue condition
+		std::condition_variable queueCond;
+
+		/// Workers exit flag
+		bool exitFlag;
+
+		/// Worker threads
+		std::vector<std::thread> threads;
+
+		/**
+		 * Worker thread function
+		 */
+		void worker();
+
+		/**
+		 * Run one script
+		 *
+		 * @param job Script job
+		 * @param vm Script virtual machine
+		 * @param pr Worker process reader
+		 * @param pw Worker process writer
+		 *
+		 * @return Script result
+		 */
+		scriptResult execute(const scriptJob& job, ScriptVM& vm, ProcessReader& pr, ProcessWriter& pw) const;
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_SCRIPT_SCRIPTENGINE_H_
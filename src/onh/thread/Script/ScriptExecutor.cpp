@@ -0,0 +1,328 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptExecutor.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/wait.h>
+#include <sstream>
+#include "../../utils/Exception.h"
+
+extern char **environ;
+
+namespace onh {
+
+ScriptExecutor::ScriptExecutor(unsigned int poolSize, unsigned int timeout):
+	pool(poolSize),
+	execTimeout(timeout),
+	epollFd(-1),
+	wakeFd(-1),
+	exitFlag(false) {
+	if (pool == 0)
+		throw Exception("Pool size can not be 0", "ScriptExecutor::ScriptExecutor");
+
+	epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (epollFd == -1)
+		throw Exception("Can not create epoll instance", "ScriptExecutor::ScriptExecutor");
+
+	wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (wakeFd == -1) {
+		close(epollFd);
+		throw Exception("Can not create wake event", "ScriptExecutor::ScriptExecutor");
+	}
+
+	struct epoll_event ev;
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.fd = wakeFd;
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+
+	// Start executor thread
+	th = std::thread(&ScriptExecutor::loop, this);
+}
+
+ScriptExecutor::~ScriptExecutor() {
+	exitFlag = true;
+	wake();
+
+	th.join();
+
+	close(wakeFd);
+	close(epollFd);
+}
+
+void ScriptExecutor::run(unsigned int id, const std::string &scriptPath, const std::string &scriptOutputLogName) {
+	{
+		std::lock_guard<std::mutex> lk(lock);
+		queue.push_back({id, scriptPath, scriptOutputLogName});
+	}
+
+	wake();
+}
+
+std::vector<scriptResult> ScriptExecutor::getFinished() {
+	std::vector<scriptResult> ret;
+
+	std::lock_guard<std::mutex> lk(lock);
+	ret.swap(finished);
+
+	return ret;
+}
+
+unsigned int ScriptExecutor::getQueued() const {
+	std::lock_guard<std::mutex> lk(lock);
+
+	return queue.size();
+}
+
+void ScriptExecutor::wake() {
+	uint64_t v = 1;
+
+	// Error means that event is already signaled
+	while (write(wakeFd, &v, sizeof(v)) == -1 && errno == EINTR) {
+	}
+}
+
+void ScriptExecutor::loop() {
+	struct epoll_event events[16];
+
+	while (!exitFlag) {
+		// Start waiting scripts
+		startQueued();
+
+		// Wait on script output (running scripts are checked periodically)
+		int n = epoll_wait(epollFd, events, 16, (running.empty())?(-1):(SCRIPT_EXECUTOR_INTERVAL));
+
+		for (int i = 0; i < n; ++i) {
+			if (events[i].data.fd == wakeFd) {
+				uint64_t v;
+				while (read(wakeFd, &v, sizeof(v)) == -1 && errno == EINTR) {
+				}
+			} else {
+				auto it = running.find(events[i].data.fd);
+				if (it != running.end())
+					readOutput(it->second);
+			}
+		}
+
+		// Check finished scripts and timeouts
+		checkProcesses();
+	}
+
+	// Kill scripts which are still running
+	for (auto& r : running) {
+		scriptProcess &sp = r.second;
+		int status = 0;
+
+		kill(-sp.pid, SIGKILL);
+		waitpid(sp.pid, &status, 0);
+
+		readOutput(sp);
+		writeString(sp.logFd, "Script killed (script system closed).\n");
+
+		close(sp.outFd);
+		close(sp.logFd);
+	}
+	running.clear();
+}
+
+void ScriptExecutor::startQueued() {
+	while (running.size() < pool) {
+		scriptJob job;
+
+		{
+			std::lock_guard<std::mutex> lk(lock);
+
+			if (queue.empty())
+				break;
+
+			job = queue.front();
+			queue.pop_front();
+		}
+
+		if (!spawn(job))
+			storeResult({job.id, SCRIPT_EXIT_CODE_ERROR, false, 0});
+	}
+}
+
+bool ScriptExecutor::spawn(const scriptJob &job) {
+	// Log file
+	int logFd = open(job.log.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (logFd == -1)
+		return false;
+
+	writeString(logFd, "Run script " + job.script + " ...\nScript output:\n");
+
+	// Script output pipe (stdout and stderr)
+	int p[2];
+	if (pipe2(p, O_CLOEXEC)) {
+		writeString(logFd, "Can not create script output pipe\n");
+		close(logFd);
+		return false;
+	}
+	fcntl(p[0], F_SETFL, O_NONBLOCK);
+
+	posix_spawn_file_actions_t fa;
+	posix_spawn_file_actions_init(&fa);
+	posix_spawn_file_actions_addopen(&fa, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+	posix_spawn_file_actions_adddup2(&fa, p[1], STDOUT_FILENO);
+	posix_spawn_file_actions_adddup2(&fa, p[1], STDERR_FILENO);
+
+	// Own process group (timeout kills script children too) and default signals
+	posix_spawnattr_t attr;
+	sigset_t sigs;
+	posix_spawnattr_init(&attr);
+	posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+	posix_spawnattr_setpgroup(&attr, 0);
+	sigemptyset(&sigs);
+	posix_spawnattr_setsigmask(&attr, &sigs);
+	sigfillset(&sigs);
+	posix_spawnattr_setsigdefault(&attr, &sigs);
+
+	char *const argv[] = {const_cast<char*>(job.script.c_str()), nullptr};
+
+	pid_t pid = 0;
+	int err = posix_spawn(&pid, job.script.c_str(), &fa, &attr, argv, environ);
+
+	// Script without shebang line - run it with the shell
+	if (err == ENOEXEC) {
+		char *const shArgv[] = {const_cast<char*>("/bin/sh"), const_cast<char*>(job.script.c_str()), nullptr};
+
+		err = posix_spawn(&pid, "/bin/sh", &fa, &attr, shArgv, environ);
+	}
+
+	posix_spawnattr_destroy(&attr);
+	posix_spawn_file_actions_destroy(&fa);
+	close(p[1]);
+
+	if (err) {
+		writeString(logFd, "Can not start script: " + std::string(strerror(err)) + "\n");
+		close(p[0]);
+		close(logFd);
+		return false;
+	}
+
+	struct epoll_event ev;
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN;
+	ev.data.fd = p[0];
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, p[0], &ev);
+
+	running[p[0]] = {job, pid, p[0], logFd, std::chrono::steady_clock::now(), false};
+
+	return true;
+}
+
+void ScriptExecutor::readOutput(scriptProcess &sp) {
+	char buff[4096];
+
+	while (true) {
+		ssize_t n = read(sp.outFd, buff, sizeof(buff));
+
+		if (n > 0) {
+			writeString(sp.logFd, std::string(buff, n));
+		} else if (n == 0) {
+			// All writers closed
+			epoll_ctl(epollFd, EPOLL_CTL_DEL, sp.outFd, nullptr);
+			break;
+		} else if (errno != EINTR) {
+			break;
+		}
+	}
+}
+
+void ScriptExecutor::checkProcesses() {
+	auto now = std::chrono::steady_clock::now();
+
+	for (auto it = running.begin(); it != running.end(); ) {
+		scriptProcess &sp = it->second;
+		int status = 0;
+
+		if (waitpid(sp.pid, &status, WNOHANG) == sp.pid) {
+			// Rest of the output
+			readOutput(sp);
+
+			finish(sp, status);
+
+			epoll_ctl(epollFd, EPOLL_CTL_DEL, sp.outFd, nullptr);
+			close(sp.outFd);
+			close(sp.logFd);
+
+			it = running.erase(it);
+			continue;
+		}
+
+		// Check timeout
+		if (execTimeout && !sp.killed &&
+				std::chrono::duration_cast<std::chrono::milliseconds>(now - sp.start).count() >= execTimeout) {
+			kill(-sp.pid, SIGKILL);
+			sp.killed = true;
+		}
+
+		++it;
+	}
+}
+
+void ScriptExecutor::finish(scriptProcess &sp, int status) {
+	scriptResult res = {sp.job.id, SCRIPT_EXIT_CODE_ERROR, sp.killed, 0};
+	res.duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sp.start).count();
+
+	std::stringstream s;
+
+	if (sp.killed) {
+		s << "Script killed after timeout (" << res.duration << " milliseconds).\n";
+	} else if (WIFEXITED(status)) {
+		res.exitCode = WEXITSTATUS(status);
+		s << "Script execution (" << res.duration << " milliseconds) finished with exit code " << res.exitCode << ".\n";
+	} else if (WIFSIGNALED(status)) {
+		s << "Script terminated by signal " << WTERMSIG(status) << " (" << res.duration << " milliseconds).\n";
+	}
+
+	writeString(sp.logFd, s.str());
+
+	storeResult(res);
+}
+
+void ScriptExecutor::storeResult(const scriptResult &result) {
+	std::lock_guard<std::mutex> lk(lock);
+	finished.push_back(result);
+}
+
+void ScriptExecutor::writeString(int fd, const std::string &s) {
+	size_t pos = 0;
+
+	while (pos < s.length()) {
+		ssize_t n = write(fd, s.data() + pos, s.length() - pos);
+
+		if (n > 0) {
+			pos += n;
+		} else if (n == -1 && errno == EINTR) {
+			continue;
+		} else {
+			break;
+		}
+	}
+}
+
+}  // namespace onh
@@ -0,0 +1,229 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_SCRIPT_SCRIPTEXECUTOR_H_
+#define ONH_THREAD_SCRIPT_SCRIPTEXECUTOR_H_
+
+#include <sys/types.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Maximum time between checks of the running scripts (ms)
+#define SCRIPT_EXECUTOR_INTERVAL 100
+/// Exit code of the script which could not be started or was killed
+#define SCRIPT_EXIT_CODE_ERROR -1
+
+namespace onh {
+
+/**
+ * Script execution result structure
+ */
+typedef struct {
+	/// Script item identifier
+	unsigned int id;
+	/// Script exit code (SCRIPT_EXIT_CODE_ERROR if not started or killed)
+	int exitCode;
+	/// Script was killed after timeout
+	bool timeout;
+	/// Script execution time (milliseconds)
+	unsigned long int duration;
+} scriptResult;
+
+/**
+ * Script executor class
+ * Runs scripts in a pool of child processes (posix_spawn). Script output
+ * (stdout and stderr) is streamed to the log file by one background thread
+ * (epoll). Scripts above the pool size wait in the queue.
+ */
+class ScriptExecutor {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param poolSize Maximum number of running scripts
+		 * @param timeout Script execution timeout (milliseconds, 0 - no timeout)
+		 */
+		ScriptExecutor(unsigned int poolSize, unsigned int timeout);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		ScriptExecutor(const ScriptExecutor&) = delete;
+
+		/**
+		 * Destructor (running scripts are killed)
+		 */
+		virtual ~ScriptExecutor();
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		ScriptExecutor& operator=(const ScriptExecutor&) = delete;
+
+		/**
+		 * Put script to the execution queue
+		 *
+		 * @param id Script item identifier
+		 * @param scriptPath Path to the script to be executed
+		 * @param scriptOutputLogName Name of the file containing output from the script
+		 */
+		void run(unsigned int id, const std::string &scriptPath, const std::string &scriptOutputLogName);
+
+		/**
+		 * Get results of the finished scripts (results are removed from the executor)
+		 *
+		 * @return Finished scripts results
+		 */
+		std::vector<scriptResult> getFinished();
+
+		/**
+		 * Get number of the scripts waiting in the queue
+		 *
+		 * @return Number of the queued scripts
+		 */
+		unsigned int getQueued() const;
+
+	private:
+		/**
+		 * Script job structure
+		 */
+		typedef struct {
+			/// Script item identifier
+			unsigned int id;
+			/// Path to the script to be executed
+			std::string script;
+			/// Name of the file containing output from the script
+			std::string log;
+		} scriptJob;
+
+		/**
+		 * Running script structure
+		 */
+		typedef struct {
+			/// Script job
+			scriptJob job;
+			/// Script process identifier
+			pid_t pid;
+			/// Script output pipe (read end)
+			int outFd;
+			/// Log file
+			int logFd;
+			/// Start time
+			std::chrono::steady_clock::time_point start;
+			/// Script was killed after timeout
+			bool killed;
+		} scriptProcess;
+
+		/// Maximum number of running scripts
+		const unsigned int pool;
+
+		/// Script execution timeout (milliseconds, 0 - no timeout)
+		const unsigned int execTimeout;
+
+		/// Queued scripts
+		std::deque<scriptJob> queue;
+
+		/// Finished scripts results
+		std::vector<scriptResult> finished;
+
+		/// Queue and results lock
+		mutable std::mutex lock;
+
+		/// Running scripts <output pipe, script process> (used only by executor thread)
+		std::map<int, scriptProcess> running;
+
+		/// Epoll instance
+		int epollFd;
+
+		/// Event used to wake executor thread
+		int wakeFd;
+
+		/// Executor thread exit flag
+		std::atomic<bool> exitFlag;
+
+		/// Executor thread
+		std::thread th;
+
+		/**
+		 * Executor thread function
+		 */
+		void loop();
+
+		/**
+		 * Wake executor thread
+		 */
+		void wake();
+
+		/**
+		 * Start queued scripts (if there are free places in the pool)
+		 */
+		void startQueued();
+
+		/**
+		 * Start script process
+		 *
+		 * @param job Script job
+		 * @return True if script was started
+		 */
+		bool spawn(const scriptJob &job);
+
+		/**
+		 * Copy available script output to the log file
+		 *
+		 * @param sp Script process
+		 */
+		void readOutput(scriptProcess &sp);
+
+		/**
+		 * Check finished scripts and timeouts
+		 */
+		void checkProcesses();
+
+		/**
+		 * Finish script (write summary to the log and store result)
+		 *
+		 * @param sp Script process
+		 * @param status Process status (waitpid)
+		 */
+		void finish(scriptProcess &sp, int status);
+
+		/**
+		 * Store script result
+		 *
+		 * @param result Script result
+		 */
+		void storeResult(const scriptResult &result);
+
+		/**
+		 * Write string to the file
+		 *
+		 * @param fd File descriptor
+		 * @param s String to write
+		 */
+		static void writeString(int fd, const std::string &s);
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_SCRIPT_SCRIPTEXECUTOR_H_
@@ -20,28 +20,35 @@
 #include <sys/stat.h>
 #include <errno.h>
 #include <sstream>
+#include <chrono>
 #include "ScriptProg.h"
 #include "../../utils/Exception.h"
 #include "../../utils/DateUtils.h"
-#include "../../db/ScriptDB.h"
+#include "../../utils/Clock.h"
 
 namespace onh {
 
-// Max number running scripts
-const unsigned int RUNNERS_POOL = 5;
-
 ScriptProg::ScriptProg(const ProcessReader& pr,
 						const ProcessWriter& pw,
-						const ScriptDB& sdb,
+						DBExecutorPtr dbe,
 						unsigned int updateInterval,
 						const std::string& scriptDirPath,
-						const GuardDataController<ThreadExitData> &gdcTED,
-						const GuardDataController<CycleTimeData> &gdcCTD):
+						unsigned int poolSize,
+						unsigned int timeout,
+						const SharedDataController<ThreadExitData> &gdcTED,
+						const SharedDataController<CycleTimeData> &gdcCTD):
 	ThreadProgram(gdcTED, gdcCTD, updateInterval, "script", "scriptLog_"),
 	prReader(std::make_unique<ProcessReader>(pr)),
 	prWriter(std::make_unique<ProcessWriter>(pw)),
-	db(std::make_unique<ScriptDB>(sdb)),
-	scriptDirectoryPath(scriptDirPath) {
+	dbExecutor(dbe),
+	scriptDirectoryPath(scriptDirPath),
+	executor(std::make_unique<ScriptExecutor>(poolSize, timeout)),
+	engine(std::make_unique<ScriptEngine>(pr, pw, poolSize,
+											scriptBudget{SCRIPT_ENGINE_INSTRUCTION_LIMIT, timeout*1000ul})),
+	lastReloadCheck(0),
+	driverGeneration(0),
+	evaluatedGeneration(0),
+	evaluationNeeded(true) {
 	// Dir flag
 	dirReady = false;
 
@@ -70,7 +77,7 @@ void ScriptProg::operator()() {
 
 		if (!prWriter)
 			throw Exception("No writer object");
-		if (!db)
+		if (!dbExecutor)
 			throw Exception("No DB object!");
 
 		if (!dirReady)
@@ -80,17 +87,38 @@ void ScriptProg::operator()() {
 			// Start thread cycle time measure
 			startCycleMeasure();
 
+			// Process data generation before reader update
+			unsigned long int generation = prReader->getProcessGeneration();
+
 			// Update process reader
 			prReader->updateProcessData();
+			markPhase(CP_PROCESS_COPY);
+
+			// Reload changed script definitions
+			reloadScripts();
+			markPhase(CP_DB_IO);
 
-			// Check started scripts
-			checkScriptRunners();
+			// Start compiled scripts and check started scripts
+			checkPendingScripts();
+			checkScriptResults();
 
-			// Check if new script need to be started
-			checkScriptItems();
+			// Evaluate triggers only if process data or script state changed
+			if (evaluationNeeded || generation != evaluatedGeneration) {
+				checkScriptItems();
+				updateControllerTags();
+
+				evaluatedGeneration = generation;
+				evaluationNeeded = false;
+			}
+			markPhase(CP_EVALUATION);
 
-			// Wait
-			threadWait();
+			// Save changed script states
+			saveScriptStates();
+			markPhase(CP_DB_IO);
+
+			// Wait on new process data (not longer than update interval)
+			prReader->waitForProcessChange(generation, getUpdateInterval());
+			markPhase(CP_WAIT);
 
 			// Stop thread cycle time measure
 			stopCycleMeasure();
@@ -103,103 +131,216 @@ void ScriptProg::operator()() {
 	}
 }
 
-void ScriptProg::checkScriptItems() {
-	// Get scripts
-	std::vector<ScriptItem> scripts = db->getScripts();
-
-	for (auto& script : scripts) {
-		// Run script - check flags
-		if (!script.isRunning() && !script.isLocked()) {
-			// Check trigger Tag value - only true triggers script
-			if (prReader->getBitValue(script.getTag())) {
-				// Run assigned script
-				startScript(script);
-			}
-		}
+void ScriptProg::reloadScripts() {
+	// Driver connections reloaded - tag handles need to be bound again
+	if (prReader->getDriverGeneration() != driverGeneration)
+		bindScriptTags();
 
-		// Update controller script tags
-		updateControllerTags(script);
+	// Pending definitions read
+	if (scriptsRead.valid()) {
+		if (scriptsRead.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		scriptDefinitions defs = scriptsRead.get();
+		if (defs.changed) {
+			loadScripts(defs.items);
+			scriptsChecksum = defs.checksum;
+		}
 	}
+
+	long long int now = Clock::now().monotonic;
+
+	if (lastReloadCheck != 0 && now - lastReloadCheck < SCRIPT_RELOAD_INTERVAL)
+		return;
+
+	lastReloadCheck = now;
+
+	// Check if definitions changed (read scripts only if checksum changed)
+	std::string checksum = scriptsChecksum;
+	scriptsRead = dbExecutor->read<scriptDefinitions>(DBC_SCRIPT, [checksum](DBExecutorContext &ctx) {
+		scriptDefinitions defs = {ctx.getScriptDB().getScriptsChecksum(), false, {}};
+
+		if (defs.checksum != checksum) {
+			defs.items = ctx.getScriptDB().getScripts();
+			defs.changed = true;
+		}
+
+		return defs;
+	});
 }
 
-void ScriptProg::checkScriptRunners() {
-	// Check running scripts
-	for(auto it = runners.begin(); it != runners.end(); ) {
-        if (it->second.finished()) {
-			// Clear run flag
-			db->clearScriptRun(it->first);
-			// Remove runner
-			it = runners.erase(it);
-		} else {
+void ScriptProg::loadScripts(const std::vector<ScriptItem>& items) {
+	scripts.load(items);
+	bindScriptTags();
+
+	std::stringstream s;
+	s << "Script definitions loaded (" << scripts.size() << " scripts)";
+	getLogger() << LOG_INFO(s.str());
+}
+
+void ScriptProg::bindScriptTags() {
+	triggerHandles = prReader->bindTags(scripts.getTriggerTags());
+	feedbackHandles = prReader->bindTags(scripts.getFeedbackTags());
+	driverGeneration = prReader->getDriverGeneration();
+	evaluationNeeded = true;
+}
+
+void ScriptProg::checkScriptItems() {
+	// Read trigger tags
+	prReader->readBits(triggerHandles, triggerValues);
+
+	scripts.checkTriggers(triggerValues, startedScripts, unlockedScripts);
+
+	for (unsigned int idx : startedScripts)
+		startScript(scripts.at(idx));
+
+	for (unsigned int idx : unlockedScripts)
+		getLogger() << LOG_INFO("Script unlocked: "+scripts.at(idx).item.getName());
+}
+
+void ScriptProg::checkPendingScripts() {
+	for (auto it = pendingScripts.begin(); it != pendingScripts.end(); ) {
+		if (it->tagsRead.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
 			++it;
+			continue;
 		}
-    }
-}
 
-void ScriptProg::updateControllerTags(const ScriptItem &sc) {
-	// Set feedback tag
-	if (sc.isRunning()) {
 		try {
-			// Set bit informs controller that script is running
-			if (!prReader->getBitValue(sc.getFeedbackRunTag()))
-				prWriter->setBit(sc.getFeedbackRunTag());
-		} catch (ScriptException &e) {
-			if (e.getType() != ScriptException::ExceptionType::NO_FEEDBACK_RUN_TAG) {
-				// Re-throw exception
-				throw;
-			}
+			EmbeddedScriptPtr script = engine->addScript(it->script, it->tagsRead.get());
+
+			// Run embedded script (queued if all workers are busy)
+			engine->run(it->id, script, it->script.path, it->log);
+		} catch (Exception &e) {
+			getLogger() << LOG_ERROR("Script compile error: "+std::string(e.what()));
+
+			// Script stays locked until trigger reset
+			scripts.setFinished(it->id, SCRIPT_EXIT_CODE_ERROR);
+			evaluationNeeded = true;
 		}
 
-	} else {
-		try {
-			// Reset bit informs controller that script is running
-			if (prReader->getBitValue(sc.getFeedbackRunTag()))
-				prWriter->resetBit(sc.getFeedbackRunTag());
-		} catch (ScriptException &e) {
-			if (e.getType() != ScriptException::ExceptionType::NO_FEEDBACK_RUN_TAG) {
-				// Re-throw exception
-				throw;
-			}
+		it = pendingScripts.erase(it);
+	}
+}
+
+void ScriptProg::checkScriptResults() {
+	// Finished scripts (external and embedded)
+	std::vector<scriptResult> results = executor->getFinished();
+	std::vector<scriptResult> engineResults = engine->getFinished();
+	results.insert(results.end(), engineResults.begin(), engineResults.end());
+
+	// Check finished scripts
+	for (const auto& res : results) {
+		scripts.setFinished(res.id, res.exitCode);
+
+		if (res.timeout) {
+			std::stringstream s;
+			s << "Script " << res.id << " killed after timeout (" << res.duration << " ms)";
+			getLogger() << LOG_INFO(s.str());
 		}
+
+		evaluationNeeded = true;
 	}
+}
+
+void ScriptProg::updateControllerTags() {
+	// Read feedback tags
+	prReader->readBits(feedbackHandles, feedbackValues);
+
+	bool batch = false;
+
+	const std::vector<unsigned int>& feedbackScripts = scripts.getFeedbackScripts();
 
-	// Check lock flag
-	if (sc.isLocked() && !sc.isRunning()) {
-		// Check trigger tag value
-		if (!prReader->getBitValue(sc.getTag())) {
-			// Reset lock flag
-			db->clearScriptLock(sc);
+	for (unsigned int i = 0; i < feedbackScripts.size(); ++i) {
+		const ScriptItem &sc = scripts.at(feedbackScripts[i]).item;
 
-			getLogger() << LOG_INFO("Script unlocked: "+sc.getName());
+		// Feedback bit informs controller that script is running
+		if ((feedbackValues[i] != 0) != sc.isRunning()) {
+			if (!batch) {
+				prWriter->beginBatch();
+				batch = true;
+			}
+
+			if (sc.isRunning())
+				prWriter->setBit(sc.getFeedbackRunTag());
+			else
+				prWriter->resetBit(sc.getFeedbackRunTag());
 		}
 	}
+
+	if (batch)
+		prWriter->commitBatch();
 }
 
-void ScriptProg::startScript(const ScriptItem &sc) {
+void ScriptProg::startScript(scriptData &sd) {
 	// Script path
-	std::string scriptPath = createScriptPath(scriptDirectoryPath, sc.getName());
+	std::string scriptPath = createScriptPath(scriptDirectoryPath, sd.item.getName());
+
+	// Log file name (script output)
+	std::string logFile = "logs/scriptOutput/";
+	logFile += DateUtils::getTimestampString(false, '-', '_', '_');
+	logFile += "_"+sd.item.getName()+".log";
+
+	getLogger() << LOG_INFO("Run script: "+scriptPath);
 
-	// Check runners pool
-	if (runners.size() < RUNNERS_POOL) {
-		// Log file name (script output)
-		std::string logFile = "logs/scriptOutput/";
-		logFile += DateUtils::getTimestampString(false, '-', '_', '_');
-		logFile += "_"+sc.getName()+".log";
+	if (ScriptEngine::isEmbeddedScript(sd.item.getName())) {
+		// Compiled script from cache (not changed)
+		EmbeddedScriptPtr script = engine->getCachedScript(scriptPath);
+
+		if (script) {
+			// Run embedded script (queued if all workers are busy)
+			engine->run(sd.item.getId(), script, scriptPath, logFile);
+			return;
+		}
 
-		// Set run flag
-		db->setScriptRun(sc);
+		pendingScript ps = {sd.item.getId(), {}, logFile, {}};
+
+		try {
+			ps.script = ScriptEngine::compile(scriptPath);
+		} catch (Exception &e) {
+			getLogger() << LOG_ERROR("Script compile error: "+std::string(e.what()));
+
+			// Script stays locked until trigger reset
+			scripts.setFinished(sd.item.getId(), SCRIPT_EXIT_CODE_ERROR);
+			return;
+		}
 
-		getLogger() << LOG_INFO("Run script: "+scriptPath);
+		// Tag definitions read only during compilation (script is started when tags are read)
+		std::vector<std::string> names = ps.script.bytecode->tags;
+		ps.tagsRead = dbExecutor->read<std::vector<Tag>>(DBC_SCRIPT, [names](DBExecutorContext &ctx) {
+			std::vector<Tag> tags;
 
-		// Run script
-		runners.emplace(std::piecewise_construct,
-			std::forward_as_tuple(sc.getId()),
-			std::forward_as_tuple(scriptPath, logFile));
+			for (const auto& name : names)
+				tags.push_back(ctx.getScriptDB().getTag(name));
+
+			return tags;
+		});
+
+		pendingScripts.push_back(std::move(ps));
 	} else {
-		getLogger() << LOG_INFO("No empty runners for script: "+scriptPath);
+		// Run script (queued if all pool places are busy)
+		executor->run(sd.item.getId(), scriptPath, logFile);
 	}
 }
 
+void ScriptProg::saveScriptStates() {
+	// Check finished writes (rejected states are lost)
+	if (unsigned int rejected = DBExecutor::checkFinished(dbWrites))
+		getLogger() << LOG_ERROR("Script states not written - DB executor queue is full (" << rejected << ")");
+
+	// Previous write in progress - states stay in the script table
+	if (!dbWrites.empty())
+		return;
+
+	std::vector<scriptState> states = scripts.takeStates();
+
+	if (states.empty())
+		return;
+
+	dbWrites.push_back(dbExecutor->write(DBC_SCRIPT, [states](DBExecutorContext &ctx) {
+		ctx.getScriptDB().saveScriptStates(states);
+	}));
+}
+
 std::string ScriptProg::createScriptPath(const std::string &scriptDir, const std::string &scriptName) const {
 	// Check last letter
 	if (scriptDir.back() == '/') {
@@ -19,13 +19,21 @@
 #ifndef ONH_THREAD_SCRIPT_SCRIPTPROG_H_
 #define ONH_THREAD_SCRIPT_SCRIPTPROG_H_
 
-#include <unordered_map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <future>
 #include "../../driver/ProcessReader.h"
 #include "../../driver/ProcessWriter.h"
 #include "../../utils/Delay.h"
 #include "../ThreadProgram.h"
-#include "../../db/ScriptDB.h"
-#include "ScriptRunner.h"
+#include "../../db/DBExecutor.h"
+#include "ScriptExecutor.h"
+#include "ScriptEngine.h"
+#include "ScriptTable.h"
+
+/// Interval of the script definitions change check (milliseconds)
+#define SCRIPT_RELOAD_INTERVAL 1000
 
 namespace onh {
 
@@ -39,19 +47,23 @@ class ScriptProg: public ThreadProgram {
 		 *
 		 * @param pr Process reader
 		 * @param pw Proces writer
-		 * @param sdb Script DB
+		 * @param dbe DB executor
 		 * @param updateInterval Script system update interval (milliseconds)
 		 * @param scriptDirPath Full path to the user script directory
+		 * @param poolSize Maximum number of running scripts
+		 * @param timeout Script execution timeout (milliseconds, 0 - no timeout)
 		 * @param gdcTED Thread exit data controller
 		 * @param gdcCTD Thread cycle time controller
 		 */
 		ScriptProg(const ProcessReader& pr,
 					const ProcessWriter& pw,
-					const ScriptDB& sdb,
+					DBExecutorPtr dbe,
 					unsigned int updateInterval,
 					const std::string& scriptDirPath,
-					const GuardDataController<ThreadExitData> &gdcTED,
-					const GuardDataController<CycleTimeData> &gdcCTD);
+					unsigned int poolSize,
+					unsigned int timeout,
+					const SharedDataController<ThreadExitData> &gdcTED,
+					const SharedDataController<CycleTimeData> &gdcCTD);
 
 		/**
 		 * Copy constructor - inactive
@@ -77,8 +89,8 @@ class ScriptProg: public ThreadProgram {
 		/// Handle for process writer object
 		std::unique_ptr<ProcessWriter> prWriter;
 
-		/// Script DB access
-		std::unique_ptr<ScriptDB> db;
+		/// DB executor (script DB access)
+		DBExecutorPtr dbExecutor;
 
 		/// Full path to the user script directory
 		const std::string scriptDirectoryPath;
@@ -86,32 +98,131 @@ class ScriptProg: public ThreadProgram {
 		/// Flag informs that log (redirected script output) directory exist
 		bool dirReady;
 
-		/// Script runners <script item identifier, script runner>
-		std::unordered_map<unsigned int, ScriptRunner> runners;
+		/// Script executor (external scripts)
+		std::unique_ptr<ScriptExecutor> executor;
+
+		/// Script engine (embedded scripts)
+		std::unique_ptr<ScriptEngine> engine;
+
+		/// Cached scripts with runtime state
+		ScriptTable scripts;
+
+		/// Trigger tag handles (same order as scripts)
+		std::vector<ProcessTagHandle> triggerHandles;
+
+		/// Feedback run tag handles
+		std::vector<ProcessTagHandle> feedbackHandles;
+
+		/// Trigger values read in current evaluation
+		std::vector<BYTE> triggerValues;
+
+		/// Feedback values read in current evaluation
+		std::vector<BYTE> feedbackValues;
+
+		/// Indexes of the scripts started in current evaluation
+		std::vector<unsigned int> startedScripts;
+
+		/// Indexes of the scripts unlocked in current evaluation
+		std::vector<unsigned int> unlockedScripts;
+
+		/**
+		 * Script definitions read result
+		 */
+		typedef struct {
+			/// Script definitions checksum
+			std::string checksum;
+			/// Definitions changed (items are valid)
+			bool changed;
+			/// Script definitions
+			std::vector<ScriptItem> items;
+		} scriptDefinitions;
+
+		/// Pending script definitions read
+		std::future<scriptDefinitions> scriptsRead;
 
 		/**
-		 * Check if script need to be started
+		 * Embedded script waiting on tags read (started when tags are read)
+		 */
+		typedef struct {
+			/// Script item identifier
+			unsigned int id;
+			/// Compiled script
+			compiledScript script;
+			/// Name of the file containing output from the script
+			std::string log;
+			/// Pending tags read
+			std::future<std::vector<Tag>> tagsRead;
+		} pendingScript;
+
+		/// Embedded scripts waiting on tags read
+		std::vector<pendingScript> pendingScripts;
+
+		/// Pending script state write (one write in flight)
+		std::vector<std::future<void>> dbWrites;
+
+		/// Script definitions checksum
+		std::string scriptsChecksum;
+
+		/// Last script definitions check (monotonic milliseconds)
+		long long int lastReloadCheck;
+
+		/// Driver registry generation of the bound tag handles
+		unsigned long int driverGeneration;
+
+		/// Process data generation of the last evaluation
+		unsigned long int evaluatedGeneration;
+
+		/// Scripts need evaluation (state or definition changed)
+		bool evaluationNeeded;
+
+		/**
+		 * Reload scripts definitions if changed in DB (or bind tags again after driver connections reload)
+		 */
+		void reloadScripts();
+
+		/**
+		 * Replace cached scripts with new definitions (runtime state of the loaded scripts is kept)
+		 *
+		 * @param items New script definitions
+		 */
+		void loadScripts(const std::vector<ScriptItem>& items);
+
+		/**
+		 * Bind trigger and feedback run tags of the cached scripts
+		 */
+		void bindScriptTags();
+
+		/**
+		 * Check if script need to be started (rising edge of the trigger tag)
 		 */
 		void checkScriptItems();
 
+		/**
+		 * Start embedded scripts with read tags
+		 */
+		void checkPendingScripts();
+
 		/**
 		 * Check if started script finished its work
 		 */
-		void checkScriptRunners();
+		void checkScriptResults();
 
 		/**
-		 * Update controller script tags
-		 *
-		 * @param sc Script item
+		 * Update controller feedback run tags (one write batch)
 		 */
-		void updateControllerTags(const ScriptItem &sc);
+		void updateControllerTags();
 
 		/**
 		 * Run script assigned to the Tag
 		 *
-		 * @param sc Script item
+		 * @param sd Script data
+		 */
+		void startScript(scriptData &sd);
+
+		/**
+		 * Save changed script states in DB
 		 */
-		void startScript(const ScriptItem &sc);
+		void saveScriptStates();
 
 		/**
 		 * Create full script path
@@ -0,0 +1,173 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptTable.h"
+#include "../../utils/Exception.h"
+
+namespace onh {
+
+ScriptTable::ScriptTable() {
+}
+
+ScriptTable::~ScriptTable() {
+}
+
+void ScriptTable::load(const std::vector<ScriptItem>& items) {
+	std::vector<scriptData> newScripts;
+
+	feedbackScripts.clear();
+
+	for (auto& item : items) {
+		scriptData sd = {item, false, true, false, false, 0};
+
+		// Keep runtime state of the already loaded script
+		for (auto& old : scripts) {
+			if (old.item.getId() == item.getId()) {
+				sd.item.setRun(old.item.isRunning());
+				sd.item.setLock(old.item.isLocked());
+				sd.trigger = old.trigger;
+				sd.dirty = old.dirty;
+				sd.exitCodeValid = old.exitCodeValid;
+				sd.exitCode = old.exitCode;
+				old.dirty = false;
+				break;
+			}
+		}
+
+		try {
+			item.getFeedbackRunTag();
+			feedbackScripts.push_back(newScripts.size());
+		} catch (ScriptException &e) {
+			if (e.getType() != ScriptException::ExceptionType::NO_FEEDBACK_RUN_TAG) {
+				// Re-throw exception
+				throw;
+			}
+			sd.hasFeedback = false;
+		}
+
+		newScripts.push_back(sd);
+	}
+
+	// Not saved states of the removed scripts
+	for (const auto& old : scripts) {
+		if (old.dirty)
+			orphanStates.push_back({old.item.getId(), old.item.isRunning(), old.item.isLocked(),
+									old.exitCodeValid, old.exitCode});
+	}
+
+	scripts.swap(newScripts);
+}
+
+unsigned int ScriptTable::size() const {
+	return scripts.size();
+}
+
+scriptData& ScriptTable::at(unsigned int idx) {
+	if (idx >= scripts.size())
+		throw Exception("Script index out of range", "ScriptTable::at");
+
+	return scripts[idx];
+}
+
+std::vector<Tag> ScriptTable::getTriggerTags() const {
+	std::vector<Tag> tags;
+
+	for (const auto& sd : scripts)
+		tags.push_back(sd.item.getTag());
+
+	return tags;
+}
+
+std::vector<Tag> ScriptTable::getFeedbackTags() const {
+	std::vector<Tag> tags;
+
+	for (unsigned int idx : feedbackScripts)
+		tags.push_back(scripts[idx].item.getFeedbackRunTag());
+
+	return tags;
+}
+
+const std::vector<unsigned int>& ScriptTable::getFeedbackScripts() const {
+	return feedbackScripts;
+}
+
+void ScriptTable::checkTriggers(const std::vector<BYTE>& triggers,
+								std::vector<unsigned int>& started,
+								std::vector<unsigned int>& unlocked) {
+	if (triggers.size() != scripts.size())
+		throw Exception("Wrong number of trigger values", "ScriptTable::checkTriggers");
+
+	started.clear();
+	unlocked.clear();
+
+	for (unsigned int i = 0; i < scripts.size(); ++i) {
+		scriptData &sd = scripts[i];
+		bool trigger = triggers[i];
+
+		// Run script on trigger rising edge - check flags
+		if (trigger && !sd.trigger && !sd.item.isRunning() && !sd.item.isLocked()) {
+			sd.item.setRun(true);
+			sd.item.setLock(true);
+			sd.dirty = true;
+			started.push_back(i);
+		}
+
+		// Reset lock flag (trigger tag released)
+		if (!trigger && sd.item.isLocked() && !sd.item.isRunning()) {
+			sd.item.setLock(false);
+			sd.dirty = true;
+			unlocked.push_back(i);
+		}
+
+		sd.trigger = trigger;
+	}
+}
+
+bool ScriptTable::setFinished(unsigned int id, int exitCode) {
+	for (auto& sd : scripts) {
+		if (sd.item.getId() == id) {
+			// Clear run flag and store exit code
+			sd.item.setRun(false);
+			sd.exitCodeValid = true;
+			sd.exitCode = exitCode;
+			sd.dirty = true;
+			return true;
+		}
+	}
+
+	// Script removed from definitions during execution
+	orphanStates.push_back({id, false, true, true, exitCode});
+
+	return false;
+}
+
+std::vector<scriptState> ScriptTable::takeStates() {
+	std::vector<scriptState> states;
+	states.swap(orphanStates);
+
+	for (auto& sd : scripts) {
+		if (sd.dirty) {
+			states.push_back({sd.item.getId(), sd.item.isRunning(), sd.item.isLocked(), sd.exitCodeValid, sd.exitCode});
+			sd.dirty = false;
+		}
+	}
+
+	return states;
+}
+
+}  // namespace onh
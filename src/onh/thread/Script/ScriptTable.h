@@ -0,0 +1,140 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_SCRIPT_SCRIPTTABLE_H_
+#define ONH_THREAD_SCRIPT_SCRIPTTABLE_H_
+
+#include <vector>
+#include "../../db/ScriptDB.h"
+#include "../../driver/DriverRegisterTypes.h"
+
+namespace onh {
+
+/**
+ * Script runtime data structure
+ */
+typedef struct {
+	/// Script definition with current run and lock flags
+	ScriptItem item;
+	/// Trigger value from the last evaluation
+	bool trigger;
+	/// Script has feedback run tag
+	bool hasFeedback;
+	/// Script state not saved in DB
+	bool dirty;
+	/// Exit code of the last execution is valid
+	bool exitCodeValid;
+	/// Exit code of the last execution
+	int exitCode;
+} scriptData;
+
+/**
+ * Script table class (cached script definitions with runtime state)
+ */
+class ScriptTable {
+	public:
+		ScriptTable();
+
+		virtual ~ScriptTable();
+
+		/**
+		 * Replace cached scripts with new definitions (runtime state of the loaded scripts is kept)
+		 *
+		 * @param items New script definitions
+		 */
+		void load(const std::vector<ScriptItem>& items);
+
+		/**
+		 * Get number of the cached scripts
+		 *
+		 * @return Number of the scripts
+		 */
+		unsigned int size() const;
+
+		/**
+		 * Get script data
+		 *
+		 * @param idx Script index
+		 *
+		 * @return Script data
+		 */
+		scriptData& at(unsigned int idx);
+
+		/**
+		 * Get trigger tags (same order as scripts)
+		 *
+		 * @return Trigger tags
+		 */
+		std::vector<Tag> getTriggerTags() const;
+
+		/**
+		 * Get feedback run tags (same order as feedback scripts)
+		 *
+		 * @return Feedback run tags
+		 */
+		std::vector<Tag> getFeedbackTags() const;
+
+		/**
+		 * Get script indexes of the feedback run tags
+		 *
+		 * @return Script indexes
+		 */
+		const std::vector<unsigned int>& getFeedbackScripts() const;
+
+		/**
+		 * Check trigger values (start script on rising edge, unlock script after trigger release)
+		 *
+		 * @param triggers Trigger values (same order as scripts)
+		 * @param started Indexes of the scripts to start (run and lock flags are set)
+		 * @param unlocked Indexes of the unlocked scripts
+		 */
+		void checkTriggers(const std::vector<BYTE>& triggers,
+							std::vector<unsigned int>& started,
+							std::vector<unsigned int>& unlocked);
+
+		/**
+		 * Store result of the finished script
+		 *
+		 * @param id Script identifier
+		 * @param exitCode Script exit code
+		 *
+		 * @return False if script was removed from definitions during execution
+		 */
+		bool setFinished(unsigned int id, int exitCode);
+
+		/**
+		 * Get not saved script states (states are marked as saved)
+		 *
+		 * @return Script states
+		 */
+		std::vector<scriptState> takeStates();
+
+	private:
+		/// Cached scripts
+		std::vector<scriptData> scripts;
+
+		/// Script index of the feedback run tags
+		std::vector<unsigned int> feedbackScripts;
+
+		/// States of the scripts removed from cache (not saved in DB)
+		std::vector<scriptState> orphanStates;
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_SCRIPT_SCRIPTTABLE_H_
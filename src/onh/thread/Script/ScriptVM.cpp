@@ -0,0 +1,129 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptVM.h"
+#include <chrono>
+#include <cmath>
+
+namespace onh {
+
+ScriptVM::ScriptVM() {
+	stack.reserve(64);
+}
+
+ScriptVM::~ScriptVM() {
+}
+
+scriptRunResult ScriptVM::run(const ScriptBytecode& bc, ScriptHost& host, const scriptBudget& budget) {
+	scriptRunResult res = {SRS_OK, 0, 0, ""};
+
+	auto start = std::chrono::steady_clock::now();
+
+	stack.clear();
+	variables.assign(bc.variables.size(), 0.0);
+
+	const std::vector<scriptInstruction> &code = bc.code;
+	unsigned int pc = 0;
+	double a = 0, b = 0;
+
+	while (pc < code.size()) {
+		const scriptInstruction &ins = code[pc++];
+
+		// Budget check
+		++res.instructions;
+		if (budget.instructions && res.instructions > budget.instructions) {
+			res.status = SRS_INSTRUCTION_LIMIT;
+			break;
+		}
+		if (budget.time && (res.instructions % SCRIPT_VM_TIME_CHECK) == 0) {
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			if (static_cast<unsigned long int>(elapsed.count()) > budget.time) {
+				res.status = SRS_TIME_LIMIT;
+				break;
+			}
+		}
+
+		// Binary operations arguments
+		if (ins.op >= SOP_ADD && ins.op <= SOP_MAX) {
+			b = stack.back();
+			stack.pop_back();
+			a = stack.back();
+			stack.pop_back();
+		}
+
+		switch (ins.op) {
+			case SOP_CONST: stack.push_back(bc.constants[ins.arg]); break;
+			case SOP_LOAD_TAG: stack.push_back(host.readTag(ins.arg)); break;
+			case SOP_STORE_TAG: host.writeTag(ins.arg, stack.back()); stack.pop_back(); break;
+			case SOP_LOAD_VAR: stack.push_back(variables[ins.arg]); break;
+			case SOP_STORE_VAR: variables[ins.arg] = stack.back(); stack.pop_back(); break;
+			case SOP_ADD: stack.push_back(a + b); break;
+			case SOP_SUB: stack.push_back(a - b); break;
+			case SOP_MUL: stack.push_back(a * b); break;
+			case SOP_DIV: {
+				if (b == 0.0) {
+					res.status = SRS_ERROR;
+					res.error = "Division by zero";
+				} else {
+					stack.push_back(a / b);
+				}
+			}; break;
+			case SOP_MOD: {
+				if (b == 0.0) {
+					res.status = SRS_ERROR;
+					res.error = "Division by zero";
+				} else {
+					stack.push_back(std::fmod(a, b));
+				}
+			}; break;
+			case SOP_NEG: stack.back() = -stack.back(); break;
+			case SOP_NOT: stack.back() = (stack.back() == 0.0)?(1.0):(0.0); break;
+			case SOP_EQ: stack.push_back((a == b)?(1.0):(0.0)); break;
+			case SOP_NE: stack.push_back((a != b)?(1.0):(0.0)); break;
+			case SOP_LT: stack.push_back((a < b)?(1.0):(0.0)); break;
+			case SOP_LE: stack.push_back((a <= b)?(1.0):(0.0)); break;
+			case SOP_GT: stack.push_back((a > b)?(1.0):(0.0)); break;
+			case SOP_GE: stack.push_back((a >= b)?(1.0):(0.0)); break;
+			case SOP_AND: stack.push_back((a != 0.0 && b != 0.0)?(1.0):(0.0)); break;
+			case SOP_OR: stack.push_back((a != 0.0 || b != 0.0)?(1.0):(0.0)); break;
+			case SOP_ABS: stack.back() = std::fabs(stack.back()); break;
+			case SOP_MIN: stack.push_back((a < b)?(a):(b)); break;
+			case SOP_MAX: stack.push_back((a > b)?(a):(b)); break;
+			case SOP_JMP: pc = ins.arg; break;
+			case SOP_JMP_FALSE: {
+				if (stack.back() == 0.0)
+					pc = ins.arg;
+				stack.pop_back();
+			}; break;
+			case SOP_PRINT: host.print(stack.back()); stack.pop_back(); break;
+			case SOP_EXIT: {
+				res.exitCode = static_cast<int>(stack.back());
+				stack.pop_back();
+				pc = code.size();
+			}; break;
+			case SOP_HALT: pc = code.size(); break;
+		}
+
+		if (res.status != SRS_OK)
+			break;
+	}
+
+	return res;
+}
+
+}  // namespace onh
@@ -0,0 +1,137 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_THREAD_SCRIPT_SCRIPTVM_H_
+#define ONH_THREAD_SCRIPT_SCRIPTVM_H_
+
+#include <string>
+#include <vector>
+#include "ScriptBytecode.h"
+
+/// Number of instructions between time budget checks
+#define SCRIPT_VM_TIME_CHECK 256
+
+namespace onh {
+
+/**
+ * Embedded script host interface (tag access and output)
+ */
+class ScriptHost {
+	public:
+		virtual ~ScriptHost() {}
+
+		/**
+		 * Read tag value
+		 *
+		 * @param idx Tag index (bytecode tag table)
+		 *
+		 * @return Tag value
+		 */
+		virtual double readTag(unsigned int idx) = 0;
+
+		/**
+		 * Write tag value
+		 *
+		 * @param idx Tag index (bytecode tag table)
+		 * @param val Tag value
+		 */
+		virtual void writeTag(unsigned int idx, double val) = 0;
+
+		/**
+		 * Script output
+		 *
+		 * @param val Printed value
+		 */
+		virtual void print(double val) = 0;
+};
+
+/**
+ * Embedded script run status
+ */
+typedef enum {
+	SRS_OK = 0,
+	SRS_INSTRUCTION_LIMIT,
+	SRS_TIME_LIMIT,
+	SRS_ERROR
+} scriptRunStatus;
+
+/**
+ * Embedded script run budget structure
+ */
+typedef struct {
+	/// Maximum number of executed instructions (0 - no limit)
+	unsigned long int instructions;
+	/// Maximum run time (microseconds, 0 - no limit)
+	unsigned long int time;
+} scriptBudget;
+
+/**
+ * Embedded script run result structure
+ */
+typedef struct {
+	/// Run status
+	scriptRunStatus status;
+	/// Script exit code
+	int exitCode;
+	/// Number of executed instructions
+	unsigned long int instructions;
+	/// Error description (status SRS_ERROR)
+	std::string error;
+} scriptRunResult;
+
+/**
+ * Embedded script virtual machine class (stack machine executing script bytecode)
+ */
+class ScriptVM {
+	public:
+		ScriptVM();
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		ScriptVM(const ScriptVM&) = delete;
+
+		virtual ~ScriptVM();
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		ScriptVM& operator=(const ScriptVM&) = delete;
+
+		/**
+		 * Run script
+		 *
+		 * @param bc Script bytecode
+		 * @param host Script host
+		 * @param budget Run budget
+		 *
+		 * @return Run result
+		 */
+		scriptRunResult run(const ScriptBytecode& bc, ScriptHost& host, const scriptBudget& budget);
+
+	private:
+		/// Value stack (reused between runs)
+		std::vector<double> stack;
+
+		/// Local variables (reused between runs)
+		std::vector<double> variables;
+};
+
+}  // namespace onh
+
+#endif  // ONH_THREAD_SCRIPT_SCRIPTVM_H_
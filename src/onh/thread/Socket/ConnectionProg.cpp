@@ -18,24 +18,36 @@
 
 #include <string.h>
 #include <unistd.h>
+#include <poll.h>
 #include <sstream>
 #include "ConnectionProg.h"
 #include "Socket.h"
 
 namespace onh {
 
+/// Subscription loop - maximum wait time on process data change (client data is checked after it, milliseconds)
+const int SUBSCRIPTION_WAIT_TIME = 50;
+
 ConnectionProgram::ConnectionProgram(int connDescriptor,
 										const ProcessReader& pr,
 										const ProcessWriter& pw,
-										const ThreadCycleControllers& cc,
+										ThreadCycleRegistryPtr cc,
 										const DBCredentials& db,
-										const GuardDataController<ThreadExitData> &gdcTED):
+										const SharedDataController<ThreadExitData> &gdcTED,
+										ReplyCachePtr rc,
+										std::shared_ptr<std::atomic<unsigned int>> subCount,
+										unsigned int subMax,
+										std::shared_ptr<std::atomic<bool>> finishFlag):
 	BaseThreadProgram(gdcTED, "parser", std::string("connection_th_" + std::to_string(connDescriptor) + "_"), false),
 	connDesc(connDescriptor),
 	pReader(std::make_unique<ProcessReader>(pr)),
 	pWriter(std::make_unique<ProcessWriter>(pw)),
 	dbCredentials(db),
-	cycleController(cc) {
+	cycleController(cc),
+	replyCache(rc),
+	subscriptions(subCount),
+	maxSubscriptions(subMax),
+	finished(finishFlag) {
 }
 
 ConnectionProgram::ConnectionProgram(const ConnectionProgram& rhs):
@@ -44,7 +56,11 @@ ConnectionProgram::ConnectionProgram(const ConnectionProgram& rhs):
 	pReader(std::make_unique<ProcessReader>(*rhs.pReader)),
 	pWriter(std::make_unique<ProcessWriter>(*rhs.pWriter)),
 	dbCredentials(rhs.dbCredentials),
-	cycleController(rhs.cycleController)  {
+	cycleController(rhs.cycleController),
+	replyCache(rhs.replyCache),
+	subscriptions(rhs.subscriptions),
+	maxSubscriptions(rhs.maxSubscriptions),
+	finished(rhs.finished) {
 }
 
 ConnectionProgram::~ConnectionProgram() {
@@ -54,6 +70,9 @@ void ConnectionProgram::operator()() {
 	// Buffer
 	char buffer[MAX_BUFF_SIZE] = {0};
 
+	// Subscription place reserved
+	bool subscribed = false;
+
 	try {
 		// Parser
 		std::unique_ptr<IParser> parser = std::make_unique<CommandParser>(*pReader,
@@ -61,6 +80,7 @@ void ConnectionProgram::operator()() {
 																			dbCredentials,
 																			cycleController,
 																			getExitController(),
+																			replyCache,
 																			connDesc);
 
 		// Read client data
@@ -71,16 +91,110 @@ void ConnectionProgram::operator()() {
 		// Prepare reply
 		std::string reply = parser->getReply(buffer);
 
+		// Client subscribed tags - check subscription limit
+		if (parser->isSubscribed()) {
+			subscribed = acquireSubscription();
+
+			if (!subscribed) {
+				getLogger() << LOG_ERROR("Tag subscription limit reached");
+
+				std::stringstream s;
+				s << NOK << CMD_SEPARATOR << SUBSCRIPTION_LIMIT;
+				reply = s.str();
+			}
+		}
+
 		// Send reply
-		if (send(connDesc, reply.c_str(), strlen(reply.c_str()), 0) == -1) {
-			throw SocketException("Error while socket send data", errno, "ConnectionProgram::operator()");
+		sendData(reply);
+
+		// Client subscribed tags - keep connection open
+		if (subscribed) {
+			subscriptionLoop(*parser);
 		}
 	} catch (Exception &e) {
 		getLogger() << LOG_ERROR(e.what());
 	}
 
+	// Release subscription place
+	if (subscribed && subscriptions)
+		subscriptions->fetch_sub(1);
+
 	// Close connection descriptor
 	close(connDesc);
+
+	// Inform socket program that connection is closed
+	if (finished)
+		*finished = true;
+}
+
+void ConnectionProgram::subscriptionLoop(IParser& parser) {
+	// Buffer
+	char buffer[MAX_BUFF_SIZE] = {0};
+
+	// Client data wait structure
+	struct pollfd pfd;
+	pfd.fd = connDesc;
+	pfd.events = POLLIN;
+
+	while (!isExitFlag() && parser.isSubscribed()) {
+		// Process data generation before update (change during update wakes next wait)
+		unsigned long int generation = pReader->getProcessGeneration();
+
+		// Send changed tag values
+		std::string update = parser.getSubscriptionUpdate();
+		if (update.length() > 0) {
+			sendData(update);
+		}
+
+		// Check client data
+		pfd.revents = 0;
+		int ret = poll(&pfd, 1, 0);
+		if (ret == -1) {
+			throw SocketException("Error while socket poll", errno, "ConnectionProgram::subscriptionLoop");
+		}
+
+		// No client data - wait on process data change
+		if (ret == 0) {
+			pReader->waitForProcessChange(generation, SUBSCRIPTION_WAIT_TIME);
+			continue;
+		}
+
+		// Connection closed by client
+		if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))
+			break;
+
+		// Read client data
+		memset(buffer, 0, MAX_BUFF_SIZE);
+		ssize_t cnt = read(connDesc, buffer, MAX_BUFF_SIZE-1);
+		if (cnt == -1) {
+			throw SocketException("Error while socket read data", errno, "ConnectionProgram::subscriptionLoop");
+		}
+
+		// Connection closed by client
+		if (cnt == 0)
+			break;
+
+		// Reply on client command (subscription can be changed)
+		sendData(parser.getReply(buffer));
+	}
+}
+
+bool ConnectionProgram::acquireSubscription() {
+	if (!subscriptions)
+		return true;
+
+	if (subscriptions->fetch_add(1) >= maxSubscriptions) {
+		subscriptions->fetch_sub(1);
+		return false;
+	}
+
+	return true;
+}
+
+void ConnectionProgram::sendData(const std::string& data) {
+	if (send(connDesc, data.c_str(), data.length(), MSG_NOSIGNAL) == -1) {
+		throw SocketException("Error while socket send data", errno, "ConnectionProgram::sendData");
+	}
 }
 
 }  // namespace onh
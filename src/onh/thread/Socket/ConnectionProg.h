@@ -19,11 +19,12 @@
 #ifndef ONH_THREAD_SOCKET_CONNECTIONPROG_H_
 #define ONH_THREAD_SOCKET_CONNECTIONPROG_H_
 
+#include <atomic>
 #include "../../driver/ProcessReader.h"
 #include "../../driver/ProcessWriter.h"
 #include "../../thread/ThreadCycleControllers.h"
 #include "../BaseThreadProgram.h"
-#include "../../utils/GuardDataController.h"
+#include "../../utils/SharedDataController.h"
 #include "../../db/DBCredentials.h"
 #include "../../parser/CommandParser.h"
 
@@ -40,16 +41,24 @@ class ConnectionProgram: public BaseThreadProgram {
 		 * @param connDescriptor Connection file descriptor
 		 * @param pr Process reader
 		 * @param pw Process writer
-		 * @param cc Cycle time controllers
+		 * @param cc Cycle time controllers registry
 		 * @param db Database credentials
 		 * @param gdcTED Thread exit controller
+		 * @param rc Reply cache
+		 * @param subCount Number of the tag subscription connections (shared by connections)
+		 * @param subMax Maximum number of the tag subscription connections
+		 * @param finishFlag Flag informs that connection thread finished its work
 		 */
 		ConnectionProgram(int connDescriptor,
 							const ProcessReader& pr,
 							const ProcessWriter& pw,
-							const ThreadCycleControllers& cc,
+							ThreadCycleRegistryPtr cc,
 							const DBCredentials& db,
-							const GuardDataController<ThreadExitData> &gdcTED);
+							const SharedDataController<ThreadExitData> &gdcTED,
+							ReplyCachePtr rc,
+							std::shared_ptr<std::atomic<unsigned int>> subCount,
+							unsigned int subMax,
+							std::shared_ptr<std::atomic<bool>> finishFlag);
 
 		/**
 		 * Copy constructor
@@ -86,8 +95,41 @@ class ConnectionProgram: public BaseThreadProgram {
 		/// DB credentials
 		DBCredentials dbCredentials;
 
-		/// Cycle controllers
-		ThreadCycleControllers cycleController;
+		/// Cycle controllers registry
+		ThreadCycleRegistryPtr cycleController;
+
+		/// Reply cache
+		ReplyCachePtr replyCache;
+
+		/// Number of the tag subscription connections
+		std::shared_ptr<std::atomic<unsigned int>> subscriptions;
+
+		/// Maximum number of the tag subscription connections
+		unsigned int maxSubscriptions;
+
+		/// Connection thread finish flag
+		std::shared_ptr<std::atomic<bool>> finished;
+
+		/**
+		 * Keep connection open and send subscription updates to the client
+		 *
+		 * @param parser Command parser
+		 */
+		void subscriptionLoop(IParser& parser);
+
+		/**
+		 * Reserve place for the tag subscription connection
+		 *
+		 * @return False if subscription limit is reached
+		 */
+		bool acquireSubscription();
+
+		/**
+		 * Send data to the client
+		 *
+		 * @param data Data to send
+		 */
+		void sendData(const std::string& data);
 };
 
 }  // namespace onh
@@ -17,6 +17,8 @@
  */
 
 #include <stdlib.h>
+#include <unistd.h>
+#include <chrono>
 #include <sstream>
 #include "SocketProg.h"
 #include "ConnectionProg.h"
@@ -28,9 +30,9 @@ SocketProgram::SocketProgram(const ProcessReader& pr,
 								const DBCredentials& dbc,
 								int port,
 								int maxConn,
-								const ThreadCycleControllers& cc,
-								const GuardDataController<ThreadExitData> &gdcTED,
-								const GuardDataController<int> &gdcSockDesc):
+								ThreadCycleRegistryPtr cc,
+								const SharedDataController<ThreadExitData> &gdcTED,
+								const SharedDataController<int> &gdcSockDesc):
 	ThreadSocket(gdcTED, gdcSockDesc, "socket", "serv_"),
 	pReader(std::make_unique<ProcessReader>(pr)),
 	pWriter(std::make_unique<ProcessWriter>(pw)),
@@ -38,7 +40,9 @@ SocketProgram::SocketProgram(const ProcessReader& pr,
 	cycleController(cc),
 	sPort(port),
 	sMaxConn(maxConn),
-	sock(std::make_unique<Socket>(port, maxConn)) {
+	sock(std::make_unique<Socket>(port, maxConn)),
+	replyCache(std::make_shared<ReplyCache>()),
+	subscriptions(std::make_shared<std::atomic<unsigned int>>(0)) {
 	getLogger() << LOG_INFO("Socket program initialized");
 }
 
@@ -86,35 +90,55 @@ void SocketProgram::operator()() {
 }
 
 void SocketProgram::createConnectionThread(int connFD) {
+	// Check connection vector
+	removeFinishedThreads();
+	while (tConn.size() >= (THREADS_POOL-1)) {
+		// Wait until some connection will be closed (subscriptions use only part of the pool)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		removeFinishedThreads();
+
+		if (isExitFlag()) {
+			close(connFD);
+			return;
+		}
+	}
+
+	// Connection thread finish flag
+	auto finishFlag = std::make_shared<std::atomic<bool>>(false);
+
 	// Start thread
 	std::thread* newThread = new std::thread((ConnectionProgram(connFD,
 																*pReader,
 																*pWriter,
 																cycleController,
 																dbCredentials,
-																getExitController())));
+																getExitController(),
+																replyCache,
+																subscriptions,
+																SUBSCRIPTION_MAX_CONN,
+																finishFlag)));
 
-	// Check connection vector
-	if (tConn.size() >= (THREADS_POOL-1)) {
-		// Check old threads
-		for (auto thConn : tConn) {
-			thConn->join();
-			delete thConn;
-		}
+	// Add connection thread to the vector
+	tConn.push_back(ConnectionThreadData{newThread, finishFlag});
+}
 
-		// Clear connection vector
-		tConn.clear();
+void SocketProgram::removeFinishedThreads() {
+	for (auto it = tConn.begin(); it != tConn.end(); ) {
+		if (*(it->finished)) {
+			it->th->join();
+			delete it->th;
+			it = tConn.erase(it);
+		} else {
+			++it;
+		}
 	}
-
-	// Add connection thread to the vector
-	tConn.push_back(newThread);
 }
 
 void SocketProgram::waitOnThreads() {
 	// Check threads finished
-	for (auto thConn : tConn) {
-		thConn->join();
-		delete thConn;
+	for (auto& thConn : tConn) {
+		thConn.th->join();
+		delete thConn.th;
 	}
 
 	tConn.clear();
@@ -21,14 +21,20 @@
 
 #define THREADS_POOL 20
 
+/// Maximum number of the tag subscription connections (rest of the pool is kept for other clients)
+#define SUBSCRIPTION_MAX_CONN 10
+
 #include <thread>
 #include <vector>
+#include <atomic>
+#include <memory>
 #include "Socket.h"
 #include "../ThreadSocket.h"
 #include "../ThreadCycleControllers.h"
 #include "../../driver/ProcessReader.h"
 #include "../../driver/ProcessWriter.h"
 #include "../../db/DBCredentials.h"
+#include "../../parser/ReplyCache.h"
 
 namespace onh {
 
@@ -45,7 +51,7 @@ class SocketProgram: public ThreadSocket {
 		 * @param dbc DB data
 		 * @param port Socket port
 		 * @param maxConn Socket max connection number
-		 * @param cc Thread cycle controllers
+		 * @param cc Thread cycle controllers registry
 		 * @param gdcTED Thread exit data controller
 		 * @param gdcSockDesc Socket file descriptor controller
 		 */
@@ -54,9 +60,9 @@ class SocketProgram: public ThreadSocket {
 						const DBCredentials& dbc,
 						int port,
 						int maxConn,
-						const ThreadCycleControllers& cc,
-						const GuardDataController<ThreadExitData> &gdcTED,
-						const GuardDataController<int> &gdcSockDesc);
+						ThreadCycleRegistryPtr cc,
+						const SharedDataController<ThreadExitData> &gdcTED,
+						const SharedDataController<int> &gdcSockDesc);
 
 		/**
 		 * Copy constructor - inactive
@@ -80,15 +86,31 @@ class SocketProgram: public ThreadSocket {
 		std::unique_ptr<ProcessReader> pReader;
 		std::unique_ptr<ProcessWriter> pWriter;
 		DBCredentials dbCredentials;
-		ThreadCycleControllers cycleController;
+		ThreadCycleRegistryPtr cycleController;
 		int sPort;
 		int sMaxConn;
 
 		/// Socket object
 		std::unique_ptr<Socket> sock;
 
+		/// Reply cache shared by all connections
+		ReplyCachePtr replyCache;
+
+		/// Number of the tag subscription connections
+		std::shared_ptr<std::atomic<unsigned int>> subscriptions;
+
+		/**
+		 * Connection thread data structure
+		 */
+		typedef struct {
+			/// Connection thread
+			std::thread* th;
+			/// Flag informs that connection thread finished its work
+			std::shared_ptr<std::atomic<bool>> finished;
+		} ConnectionThreadData;
+
 		/// Connection threads pool
-		std::vector<std::thread*> tConn;
+		std::vector<ConnectionThreadData> tConn;
 
 		/**
 		 * Create connection thread
@@ -97,6 +119,11 @@ class SocketProgram: public ThreadSocket {
 		 */
 		void createConnectionThread(int connFD);
 
+		/**
+		 * Remove finished connection threads from pool
+		 */
+		void removeFinishedThreads();
+
 		/**
 		 * Wait on threads
 		 */
@@ -20,21 +20,21 @@
 
 #include <stdlib.h>
 #include <sstream>
+#include <chrono>
 #include "../../utils/Exception.h"
 #include "../../utils/DateUtils.h"
-#include "../../db/TagLoggerDB.h"
 
 namespace onh {
 
 TagLoggerProg::TagLoggerProg(const ProcessReader& pr,
-								const TagLoggerDB& tldb,
+								DBExecutorPtr dbe,
 								const TagLoggerBufferController& tlbc,
 								unsigned int updateInterval,
-								const GuardDataController<ThreadExitData> &gdcTED,
-								const GuardDataController<CycleTimeData> &gdcCTD):
+								const SharedDataController<ThreadExitData> &gdcTED,
+								const SharedDataController<CycleTimeData> &gdcCTD):
 	ThreadProgram(gdcTED, gdcCTD, updateInterval, "taglogger", "tagLog_"),
 	prReader(std::make_unique<ProcessReader>(pr)),
-	db(std::make_unique<TagLoggerDB>(tldb)),
+	dbExecutor(dbe),
 	tagLoggerBuffer(std::make_unique<TagLoggerBufferController>(tlbc)) {
 	getLogger() << LOG_INFO("Tag logger program initialized");
 }
@@ -50,8 +50,8 @@ void TagLoggerProg::operator()() {
 		if (!prReader)
 			throw Exception("No reader object");
 
-		if (!db)
-			throw Exception("No db object");
+		if (!dbExecutor)
+			throw Exception("No DB executor object");
 
 		if (!tagLoggerBuffer)
 			throw Exception("No buffer object");
@@ -60,17 +60,20 @@ void TagLoggerProg::operator()() {
 			// Start thread cycle time measure
 			startCycleMeasure();
 
-			// Start delay
-			threadWaitStart();
+			// Process data generation before reader update
+			unsigned long int generation = prReader->getProcessGeneration();
 
 			// Update process reader
 			prReader->updateProcessData();
+			markPhase(CP_PROCESS_COPY);
 
 			// Tag update in DB
 			updateTags();
+			markPhase(CP_EVALUATION);
 
-			// Wait
-			threadWaitAfterStart();
+			// Wait on new process data (not longer than update interval)
+			prReader->waitForProcessChange(generation, getUpdateInterval());
+			markPhase(CP_WAIT);
 
 			// Stop thread cycle time measure
 			stopCycleMeasure();
@@ -89,8 +92,19 @@ void TagLoggerProg::operator()() {
 }
 
 void TagLoggerProg::updateTags() {
-	// Get enabled loggers
-	std::vector<TagLoggerItem> vTagLogger = db->getLoggers();
+	// New logger definitions read from DB
+	if (loggersRead.valid() && loggersRead.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+		loggers = loggersRead.get();
+
+	// Read enabled loggers for next cycles (do not wait on DB - last values are stored in memory)
+	if (!loggersRead.valid()) {
+		loggersRead = dbExecutor->read<std::vector<TagLoggerItem>>(DBC_TAG_LOGGER, [](DBExecutorContext &ctx) {
+			return ctx.getTagLoggerDB().getLoggers();
+		});
+	}
+
+	// Enabled loggers
+	std::vector<TagLoggerItem> vTagLogger = loggers;
 
 	// Vector with loggers to save in DB
 	std::vector<TagLoggerItem> tagLoggerToSave;
@@ -105,7 +119,7 @@ void TagLoggerProg::updateTags() {
 		// Check Tag type
 		if (vTagLogger[i].getTag().getType() == TT_BIT) {
 			// Get current Tag value
-			bool tagVal = prReader->getBitValue(vTagLogger[i].getTag());
+			bool tagVal = prReader->getHandle(vTagLogger[i].getTag(), TT_BIT).getBit();
 
 			// Convert to the string
 			s.str("");
@@ -121,7 +135,7 @@ void TagLoggerProg::updateTags() {
 			}
 		} else if (vTagLogger[i].getTag().getType() == TT_BYTE) {
 			// Get current Tag value
-			BYTE tagVal = prReader->getByte(vTagLogger[i].getTag());
+			BYTE tagVal = prReader->getHandle(vTagLogger[i].getTag(), TT_BYTE).getByte();
 
 			// Convert to the string
 			s.str("");
@@ -137,7 +151,7 @@ void TagLoggerProg::updateTags() {
 			}
 		} else if (vTagLogger[i].getTag().getType() == TT_WORD) {
 			// Get current Tag value
-			WORD tagVal = prReader->getWord(vTagLogger[i].getTag());
+			WORD tagVal = prReader->getHandle(vTagLogger[i].getTag(), TT_WORD).getWord();
 
 			// Convert to the string
 			s.str("");
@@ -153,7 +167,7 @@ void TagLoggerProg::updateTags() {
 			}
 		} else if (vTagLogger[i].getTag().getType() == TT_DWORD) {
 			// Get current Tag value
-			DWORD tagVal = prReader->getDWord(vTagLogger[i].getTag());
+			DWORD tagVal = prReader->getHandle(vTagLogger[i].getTag(), TT_DWORD).getDWord();
 
 			// Convert to the string
 			s.str("");
@@ -169,7 +183,7 @@ void TagLoggerProg::updateTags() {
 			}
 		} else if (vTagLogger[i].getTag().getType() == TT_INT) {
 			// Get current Tag value
-			int tagVal = prReader->getInt(vTagLogger[i].getTag());
+			int tagVal = prReader->getHandle(vTagLogger[i].getTag(), TT_INT).getInt();
 
 			// Convert to the string
 			s.str("");
@@ -185,7 +199,7 @@ void TagLoggerProg::updateTags() {
 			}
 		} else if (vTagLogger[i].getTag().getType() == TT_REAL) {
 			// Get current Tag value
-			float tagVal = prReader->getReal(vTagLogger[i].getTag());
+			float tagVal = prReader->getHandle(vTagLogger[i].getTag(), TT_REAL).getReal();
 
 			// Convert to the string
 			s.str("");
@@ -220,6 +234,11 @@ void TagLoggerProg::initLoggerLastValue(TagLoggerItem& tagLog) {
 
 	if (it != loggerLastValue.end()) {
 		tagLog.setLastTimeValue(it->second);
+	} else {
+		// Store DB values with resolved time (timestamp string parsed only once)
+		TagLoggerItem::timeVal tv = tagLog.getLastTimeValue();
+		loggerLastValue[tagLog.getId()] = tv;
+		tagLog.setLastTimeValue(tv);
 	}
 }
 
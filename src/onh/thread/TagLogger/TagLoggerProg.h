@@ -20,10 +20,12 @@
 #define ONH_THREAD_TAGLOGGER_TAGLOGGERPROG_H_
 
 #include <map>
+#include <vector>
+#include <future>
 #include "../../driver/ProcessReader.h"
 #include "../../utils/Delay.h"
 #include "../../db/objs/TagLoggerItem.h"
-#include "../../db/TagLoggerDB.h"
+#include "../../db/DBExecutor.h"
 #include "../ThreadProgram.h"
 #include "TagLoggerBufferController.h"
 
@@ -38,18 +40,18 @@ class TagLoggerProg: public ThreadProgram {
 		 * Constructor
 		 *
 		 * @param pr Process reader
-		 * @param tldb Tag logger DB
+		 * @param dbe DB executor
 		 * @param tlbc Tag logger buffer controller
 		 * @param updateInterval Logger update interval (milliseconds)
 		 * @param gdcTED Thread exit data controller
 		 * @param gdcCTD Thread cycle time controller
 		 */
 		TagLoggerProg(const ProcessReader& pr,
-						const TagLoggerDB& tldb,
+						DBExecutorPtr dbe,
 						const TagLoggerBufferController& tlbc,
 						unsigned int updateInterval,
-						const GuardDataController<ThreadExitData> &gdcTED,
-						const GuardDataController<CycleTimeData> &gdcCTD);
+						const SharedDataController<ThreadExitData> &gdcTED,
+						const SharedDataController<CycleTimeData> &gdcCTD);
 
 		/**
 		 * Copy constructor - inactive
@@ -72,8 +74,14 @@ class TagLoggerProg: public ThreadProgram {
 		/// Handle for process reader object
 		std::unique_ptr<ProcessReader> prReader;
 
-		/// Tag Logger DB access
-		std::unique_ptr<TagLoggerDB> db;
+		/// DB executor (tag logger DB access)
+		DBExecutorPtr dbExecutor;
+
+		/// Tag loggers (last read definitions)
+		std::vector<TagLoggerItem> loggers;
+
+		/// Pending tag loggers read
+		std::future<std::vector<TagLoggerItem>> loggersRead;
 
 		/// Tag logger buffer controller
 		std::unique_ptr<TagLoggerBufferController> tagLoggerBuffer;
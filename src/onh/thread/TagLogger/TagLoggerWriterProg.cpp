@@ -20,13 +20,13 @@
 
 namespace onh {
 
-TagLoggerWriterProg::TagLoggerWriterProg(const TagLoggerDB& tldb,
+TagLoggerWriterProg::TagLoggerWriterProg(DBExecutorPtr dbe,
 											const TagLoggerBufferController& tlbc,
 											unsigned int updateInterval,
-											const GuardDataController<ThreadExitData> &gdcTED,
-											const GuardDataController<CycleTimeData> &gdcCTD):
+											const SharedDataController<ThreadExitData> &gdcTED,
+											const SharedDataController<CycleTimeData> &gdcCTD):
 	ThreadProgram(gdcTED, gdcCTD, updateInterval, "taglogger", "tagLogWriter_"),
-	db(std::make_unique<TagLoggerDB>(tldb)),
+	dbExecutor(dbe),
 	tagLoggerBuffer(std::make_unique<TagLoggerBufferController>(tlbc)) {
 	getLogger() << LOG_INFO("Tag logger writer program initialized");
 }
@@ -39,8 +39,8 @@ void TagLoggerWriterProg::operator()() {
 	try {
 		getLogger() << LOG_INFO("Start main loop");
 
-		if (!db)
-			throw Exception("No db object");
+		if (!dbExecutor)
+			throw Exception("No DB executor object");
 
 		if (!tagLoggerBuffer)
 			throw Exception("No buffer object");
@@ -52,6 +52,7 @@ void TagLoggerWriterProg::operator()() {
 
 			// Write data to DB
 			writeDataToDB();
+			markPhase(CP_DB_IO);
 
 			// Wait
 			threadWait();
@@ -85,13 +86,26 @@ void TagLoggerWriterProg::writeDataToDB() {
 	// Vector with loggers to save in DB
 	std::vector<TagLoggerItem> tagLogger;
 
+	// Check results of the finished writes (rejected values are lost)
+	if (unsigned int rejected = DBExecutor::checkFinished(dbWrites))
+		getLogger() << LOG_ERROR("Tag logger values not written - DB executor queue is full (" << rejected << ")");
+
+	// Previous write in progress - data stays in the buffer
+	if (!dbWrites.empty())
+		return;
+
 	// Read data from buffer
 	tagLoggerBuffer->getData(tagLogger);
 
-	for (unsigned int i=0; i < tagLogger.size(); ++i) {
-		// Write to DB
-		db->logTag(tagLogger[i]);
-	}
+	if (tagLogger.size() == 0)
+		return;
+
+	// Write to DB (all values in one transaction)
+	dbWrites.push_back(dbExecutor->write(DBC_TAG_LOGGER_WRITER, [tagLogger](DBExecutorContext &ctx) {
+		for (unsigned int i=0; i < tagLogger.size(); ++i) {
+			ctx.getTagLoggerDB().logTag(tagLogger[i]);
+		}
+	}));
 }
 
 }  // namespace onh
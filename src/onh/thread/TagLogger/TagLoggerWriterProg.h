@@ -19,10 +19,12 @@
 #ifndef ONH_THREAD_TAGLOGGER_TAGLOGGERWRITERPROG_H_
 #define ONH_THREAD_TAGLOGGER_TAGLOGGERWRITERPROG_H_
 
+#include <vector>
+#include <future>
 #include "../../driver/ProcessReader.h"
 #include "../../utils/Delay.h"
 #include "../../db/objs/TagLoggerItem.h"
-#include "../../db/TagLoggerDB.h"
+#include "../../db/DBExecutor.h"
 #include "../ThreadProgram.h"
 #include "TagLoggerBufferController.h"
 
@@ -36,17 +38,17 @@ class TagLoggerWriterProg: public ThreadProgram {
 		/**
 		 * Constructor
 		 *
-		 * @param tldb Tag logger DB
+		 * @param dbe DB executor
 		 * @param tlbc Tag logger buffer controller
 		 * @param updateInterval Logger update interval (milliseconds)
 		 * @param gdcTED Thread exit data controller
 		 * @param gdcCTD Thread cycle time controller
 		 */
-		TagLoggerWriterProg(const TagLoggerDB& tldb,
+		TagLoggerWriterProg(DBExecutorPtr dbe,
 							const TagLoggerBufferController& tlbc,
 							unsigned int updateInterval,
-							const GuardDataController<ThreadExitData> &gdcTED,
-							const GuardDataController<CycleTimeData> &gdcCTD);
+							const SharedDataController<ThreadExitData> &gdcTED,
+							const SharedDataController<CycleTimeData> &gdcCTD);
 
 		/**
 		 * Copy constructor - inactive
@@ -66,8 +68,11 @@ class TagLoggerWriterProg: public ThreadProgram {
 		TagLoggerWriterProg& operator=(const TagLoggerWriterProg&) = delete;
 
 	private:
-		/// Tag Logger DB access
-		std::unique_ptr<TagLoggerDB> db;
+		/// DB executor (tag logger DB access)
+		DBExecutorPtr dbExecutor;
+
+		/// Pending tag logger write (one write in flight - executed by DB executor threads)
+		std::vector<std::future<void>> dbWrites;
 
 		/// Tag logger buffer controller
 		std::unique_ptr<TagLoggerBufferController> tagLoggerBuffer;
@@ -20,13 +20,34 @@
 #define ONH_THREAD_THREADCYCLECONTROLLERS_H_
 
 #include <map>
+#include <memory>
+#include <string>
 #include "../utils/CycleTime.h"
-#include "../utils/GuardDataController.h"
+#include "../utils/SharedDataController.h"
+#include "../utils/SnapshotContainer.h"
+#include "../utils/ThreadCycleStats.h"
 
 namespace onh {
 
-typedef std::map<std::string, GuardDataController<CycleTimeData>> ThreadCycleControllers;
-typedef std::pair<std::string, GuardDataController<CycleTimeData>> CycleControllerPair;
+/**
+ * Thread cycle controller structure
+ */
+typedef struct {
+	/// Cycle time data controller
+	SharedDataController<CycleTimeData> cycleTime;
+	/// Cycle statistics
+	ThreadCycleStatsPtr stats;
+} ThreadCycleController;
+
+typedef std::map<std::string, ThreadCycleController> ThreadCycleControllers;
+typedef std::pair<std::string, ThreadCycleController> CycleControllerPair;
+
+/// Thread cycle controllers registry (published by ThreadManager after threads are added or removed)
+using ThreadCycleRegistry = SnapshotContainer<ThreadCycleControllers>;
+using ThreadCycleRegistryPtr = std::shared_ptr<ThreadCycleRegistry>;
+
+/// Thread cycle controllers snapshot
+using ThreadCycleSnapshot = std::shared_ptr<const ThreadCycleControllers>;
 
 }  // namespace onh
 
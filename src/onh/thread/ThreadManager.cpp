@@ -17,9 +17,13 @@
  */
 
 #include <sys/socket.h>
+#include <algorithm>
+#include <chrono>
 #include "ThreadManager.h"
 #include "Alarming/AlarmingProg.h"
+#include "DBExecutor/DBExecutorProg.h"
 #include "DriverPolling/DriverPollingProg.h"
+#include "DriverWriter/DriverWriterProg.h"
 #include "ProcessUpdater/ProcessUpdaterProg.h"
 #include "Script/ScriptProg.h"
 #include "Socket/SocketProg.h"
@@ -30,9 +34,10 @@
 namespace onh {
 
 ThreadManager::ThreadManager():
-	thSocket(nullptr), threadSocket(nullptr), updatersInited(false), driverBuffersInited(false) {
+	thSocket(nullptr), threadSocket(nullptr), started(false), updaterInterval(0), writerInterval(0),
+	updatersInited(false), driverBuffersInited(false), driverWritersInited(false),
+	dbExecutorInited(false), cycleRegistry(std::make_shared<ThreadCycleRegistry>(ThreadCycleControllers())) {
 	thProgramData.clear();
-	threadProgs.clear();
 }
 
 ThreadManager::~ThreadManager() {
@@ -42,19 +47,11 @@ void ThreadManager::initProcessUpdater(const std::vector<ProcessUpdaterData>& pu
 	if (updatersInited)
 		throw Exception("Process updater threads already initialized", "ThreadManager::initProcessUpdater");
 
-	std::string nm = "";
+	updaterInterval = updateInterval;
 
 	// Prepare all updaters thread program data
-	for (unsigned int i=0; i < pu.size(); ++i) {
-		// Prepare updater name
-		nm = "Updater_"+std::to_string(pu[i].connId);
-
-		auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData())).first;
-		inserted->second.thProgram = std::make_unique<ProcessUpdaterProg>(pu[i].procUpdater,
-															pu[i].connId,
-															updateInterval,
-															tmExit.getController(false),
-															inserted->second.cycleContainer.getController(false));
+	for (const ProcessUpdaterData& updater : pu) {
+		addProcessUpdater(updater);
 	}
 
 	updatersInited = true;
@@ -64,27 +61,50 @@ void ThreadManager::initDriverPolling(const std::vector<DriverBufferUpdaterData>
 	if (driverBuffersInited)
 		throw Exception("Driver polling thread already initialized", "ThreadManager::initDriverPolling");
 
-	std::string nm = "";
-
 	// Prepare all buffers thread program data
-	for (unsigned int i=0; i < dbu.size(); ++i) {
-		// Prepare buffer name
-		nm = "DriverBuffer_"+std::to_string(dbu[i].connId);
+	for (const DriverBufferUpdaterData& buffUpdater : dbu) {
+		addDriverPolling(buffUpdater);
+	}
+
+	driverBuffersInited = true;
+}
+
+void ThreadManager::initDriverWriter(const std::vector<DriverWriteQueueData>& dwq, unsigned int updateInterval) {
+	if (driverWritersInited)
+		throw Exception("Driver writer threads already initialized", "ThreadManager::initDriverWriter");
+
+	writerInterval = updateInterval;
+
+	// Prepare all write queues thread program data
+	for (const DriverWriteQueueData& wq : dwq) {
+		addDriverWriter(wq);
+	}
+
+	driverWritersInited = true;
+}
+
+void ThreadManager::initDBExecutor(DBExecutorPtr dbe, unsigned int updateInterval) {
+	if (dbExecutorInited)
+		throw Exception("DB executor threads already initialized", "ThreadManager::initDBExecutor");
+
+	// Prepare all executor workers thread program data
+	for (unsigned int i = 0; i < dbe->getWorkersCount(); ++i) {
+		std::string nm = DB_EXECUTOR_THREAD_PREFIX+std::to_string(i);
 
 		auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData())).first;
-		inserted->second.thProgram = std::make_unique<DriverPollingProg>(dbu[i].buffUpdater,
-														dbu[i].connId,
-														dbu[i].updateInterval,
+		inserted->second.thProgram = std::make_unique<DBExecutorProg>(dbe,
+														i,
+														updateInterval,
 														tmExit.getController(false),
 														inserted->second.cycleContainer.getController(false));
 	}
 
-	driverBuffersInited = true;
+	dbExecutorInited = true;
 }
 
 void ThreadManager::initAlarmingThread(const ProcessReader& pr,
 										const ProcessWriter& pw,
-										const AlarmingDB& adb,
+										DBExecutorPtr dbe,
 										unsigned int updateInterval) {
 	std::string nm = "Alarming";
 
@@ -94,14 +114,14 @@ void ThreadManager::initAlarmingThread(const ProcessReader& pr,
 	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData())).first;
 	inserted->second.thProgram = std::make_unique<AlarmingProg>(pr,
 											pw,
-											adb,
+											dbe,
 											updateInterval,
 											tmExit.getController(false),
 											inserted->second.cycleContainer.getController(false));
 }
 
 void ThreadManager::initTagLoggerThread(const ProcessReader& pr,
-										const TagLoggerDB& tldb,
+										DBExecutorPtr dbe,
 										unsigned int updateInterval) {
 	std::string nm = "TagLogger";
 
@@ -110,14 +130,14 @@ void ThreadManager::initTagLoggerThread(const ProcessReader& pr,
 
 	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData())).first;
 	inserted->second.thProgram = std::make_unique<TagLoggerProg>(pr,
-											tldb,
+											dbe,
 											tagLoggerBuffer.getController(),
 											updateInterval,
 											tmExit.getController(false),
 											inserted->second.cycleContainer.getController(false));
 }
 
-void ThreadManager::initTagLoggerWriterThread(const TagLoggerDB& tldb,
+void ThreadManager::initTagLoggerWriterThread(DBExecutorPtr dbe,
 												unsigned int updateInterval) {
 	std::string nm = "TagLoggerWriter";
 
@@ -125,7 +145,7 @@ void ThreadManager::initTagLoggerWriterThread(const TagLoggerDB& tldb,
 		throw Exception("Tag logger writer thread already initialized", "ThreadManager::initTagLoggerWriterThread");
 
 	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData())).first;
-	inserted->second.thProgram = std::make_unique<TagLoggerWriterProg>(tldb,
+	inserted->second.thProgram = std::make_unique<TagLoggerWriterProg>(dbe,
 																tagLoggerBuffer.getController(true),
 																updateInterval,
 																tmExit.getController(false),
@@ -134,9 +154,11 @@ void ThreadManager::initTagLoggerWriterThread(const TagLoggerDB& tldb,
 
 void ThreadManager::initScriptThread(const ProcessReader& pr,
 										const ProcessWriter& pw,
-										const ScriptDB& sdb,
+										DBExecutorPtr dbe,
 										unsigned int updateInterval,
-										const std::string& scriptDirPath) {
+										const std::string& scriptDirPath,
+										unsigned int poolSize,
+										unsigned int timeout) {
 	std::string nm = "Script";
 
 	if (thProgramData.count(nm) != 0)
@@ -145,9 +167,11 @@ void ThreadManager::initScriptThread(const ProcessReader& pr,
 	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData())).first;
 	inserted->second.thProgram = std::make_unique<ScriptProg>(pr,
 													pw,
-													sdb,
+													dbe,
 													updateInterval,
 													scriptDirPath,
+													poolSize,
+													timeout,
 													tmExit.getController(false),
 													inserted->second.cycleContainer.getController(false));
 }
@@ -160,61 +184,215 @@ void ThreadManager::initSocketThread(const ProcessReader& pr,
 	if (thSocket)
 		throw Exception("Socket thread already initialized", "ThreadManager::initSocketThread");
 
-	ThreadCycleControllers cc;
-
-	for (auto& thProg : thProgramData) {
-		cc.insert(CycleControllerPair(thProg.first, thProg.second.cycleContainer.getController()));
-	}
+	publishCycleControllers();
 
 	thSocket = std::make_unique<SocketProgram>(pr,
 									pw,
 									dbc,
 									port,
 									maxConn,
-									cc,
+									cycleRegistry,
 									tmExit.getController(false),
 									tmSockDesc.getController(false));
 }
 
-void ThreadManager::run() {
+void ThreadManager::start() {
 	// Check thread initialization
 	if (!updatersInited)
-		throw Exception("Process updater thread not initialized", "ThreadManager::run");
+		throw Exception("Process updater thread not initialized", "ThreadManager::start");
+
+	if (!driverWritersInited)
+		throw Exception("Driver writer threads not initialized", "ThreadManager::start");
+
+	if (!dbExecutorInited)
+		throw Exception("DB executor threads not initialized", "ThreadManager::start");
 
 	if (thProgramData.count("Alarming") == 0)
-		throw Exception("Alarming thread not initialized", "ThreadManager::run");
+		throw Exception("Alarming thread not initialized", "ThreadManager::start");
 
 	if (thProgramData.count("TagLogger") == 0)
-		throw Exception("TagLogger thread not initialized", "ThreadManager::run");
+		throw Exception("TagLogger thread not initialized", "ThreadManager::start");
 
 	if (thProgramData.count("TagLoggerWriter") == 0)
-		throw Exception("Logger writer thread not initialized", "ThreadManager::run");
+		throw Exception("Logger writer thread not initialized", "ThreadManager::start");
 
 	if (thProgramData.count("Script") == 0)
-		throw Exception("Script thread not initialized", "ThreadManager::run");
+		throw Exception("Script thread not initialized", "ThreadManager::start");
 
 	if (!thSocket)
-		throw Exception("Socket thread not initialized", "ThreadManager::run");
+		throw Exception("Socket thread not initialized", "ThreadManager::start");
 
-	if (!threadProgs.empty())
-		throw Exception("Thread vector is not empty", "ThreadManager::run");
+	if (started)
+		throw Exception("Threads already started", "ThreadManager::start");
 
 	// Start threads
 	for (auto& thData : thProgramData) {
-		threadProgs.push_back(std::thread(std::ref(*thData.second.thProgram)));
+		thData.second.thread = std::thread(std::ref(*thData.second.thProgram));
 	}
 
 	// Run socket thread
 	threadSocket = std::make_unique<std::thread>(std::ref(*thSocket));
 
-	// Join threads
-	for (auto& thProg : threadProgs) {
-		thProg.join();
+	started = true;
+}
+
+bool ThreadManager::waitForExit(unsigned int timeout) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+	ThreadExitData ex;
+
+	while (true) {
+		tmExit.getController().getData(ex);
+
+		if (ex.exit)
+			return true;
+
+		auto now = std::chrono::steady_clock::now();
+		if (now >= deadline)
+			return false;
+
+		std::this_thread::sleep_for(std::min(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now),
+												std::chrono::milliseconds(100)));
+	}
+}
+
+void ThreadManager::join() {
+	if (!started)
+		throw Exception("Threads not started", "ThreadManager::join");
+
+	// Join threads (DB executor threads execute works queued by other threads till they exit)
+	for (auto& thData : thProgramData) {
+		if (!isDBExecutorThread(thData.first) && thData.second.thread.joinable())
+			thData.second.thread.join();
+	}
+
+	// Stop DB executor threads (queued works are executed before stop)
+	for (auto& thData : thProgramData) {
+		if (isDBExecutorThread(thData.first)) {
+			thData.second.thProgram->stop();
+
+			if (thData.second.thread.joinable())
+				thData.second.thread.join();
+		}
 	}
 
 	// Close socket
 	shutdownSocket();
 	threadSocket->join();
+
+	started = false;
+}
+
+void ThreadManager::reloadDrivers(const driverReloadData& rd) {
+	// Stop threads of the removed connections
+	for (unsigned int connId : rd.stopConn) {
+		removeThread("Updater_"+std::to_string(connId));
+		removeThread("DriverBuffer_"+std::to_string(connId));
+		removeThread("DriverWriter_"+std::to_string(connId));
+	}
+
+	// Prepare threads of the added connections
+	std::vector<std::string> added;
+
+	for (const ProcessUpdaterData& updater : rd.updaters) {
+		addProcessUpdater(updater);
+		added.push_back("Updater_"+std::to_string(updater.connId));
+	}
+
+	for (const DriverBufferUpdaterData& buffUpdater : rd.bufferUpdaters) {
+		addDriverPolling(buffUpdater);
+		added.push_back("DriverBuffer_"+std::to_string(buffUpdater.connId));
+	}
+
+	for (const DriverWriteQueueData& wq : rd.writeQueues) {
+		addDriverWriter(wq);
+		added.push_back("DriverWriter_"+std::to_string(wq.connId));
+	}
+
+	// Start threads
+	if (started) {
+		for (const std::string& nm : added) {
+			threadProgramData& thData = thProgramData.at(nm);
+			thData.thread = std::thread(std::ref(*thData.thProgram));
+		}
+	}
+
+	// Socket thread reads cycle times of the current threads
+	publishCycleControllers();
+}
+
+void ThreadManager::addProcessUpdater(const ProcessUpdaterData& pu) {
+	// Prepare updater name
+	std::string nm = "Updater_"+std::to_string(pu.connId);
+
+	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData()));
+	if (!inserted.second)
+		throw Exception("Process updater thread "+nm+" already exist", "ThreadManager::addProcessUpdater");
+
+	inserted.first->second.thProgram = std::make_unique<ProcessUpdaterProg>(pu.procUpdater,
+														pu.connId,
+														updaterInterval,
+														tmExit.getController(false),
+														inserted.first->second.cycleContainer.getController(false));
+}
+
+void ThreadManager::addDriverPolling(const DriverBufferUpdaterData& dbu) {
+	// Prepare buffer name
+	std::string nm = "DriverBuffer_"+std::to_string(dbu.connId);
+
+	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData()));
+	if (!inserted.second)
+		throw Exception("Driver polling thread "+nm+" already exist", "ThreadManager::addDriverPolling");
+
+	inserted.first->second.thProgram = std::make_unique<DriverPollingProg>(dbu.buffUpdater,
+														dbu.connId,
+														dbu.updateInterval,
+														tmExit.getController(false),
+														inserted.first->second.cycleContainer.getController(false));
+}
+
+void ThreadManager::addDriverWriter(const DriverWriteQueueData& dwq) {
+	// Prepare writer name
+	std::string nm = "DriverWriter_"+std::to_string(dwq.connId);
+
+	auto inserted = thProgramData.insert(std::pair<std::string, threadProgramData>(nm, threadProgramData()));
+	if (!inserted.second)
+		throw Exception("Driver writer thread "+nm+" already exist", "ThreadManager::addDriverWriter");
+
+	inserted.first->second.thProgram = std::make_unique<DriverWriterProg>(dwq.writeQueue,
+														dwq.connId,
+														writerInterval,
+														tmExit.getController(false),
+														inserted.first->second.cycleContainer.getController(false));
+}
+
+void ThreadManager::removeThread(const std::string& nm) {
+	auto it = thProgramData.find(nm);
+	if (it == thProgramData.end())
+		return;
+
+	// Stop thread program
+	it->second.thProgram->stop();
+
+	if (it->second.thread.joinable())
+		it->second.thread.join();
+
+	thProgramData.erase(it);
+}
+
+bool ThreadManager::isDBExecutorThread(const std::string& nm) {
+	return nm.compare(0, std::string(DB_EXECUTOR_THREAD_PREFIX).length(), DB_EXECUTOR_THREAD_PREFIX) == 0;
+}
+
+void ThreadManager::publishCycleControllers() {
+	auto cc = std::make_shared<ThreadCycleControllers>();
+
+	for (auto& thProg : thProgramData) {
+		cc->insert(CycleControllerPair(thProg.first, {thProg.second.cycleContainer.getController(),
+														thProg.second.thProgram->getCycleStats()}));
+	}
+
+	cycleRegistry->publish(cc);
 }
 
 void ThreadManager::exitMain() {
@@ -26,20 +26,24 @@
 #include <memory>
 #include "ThreadProgram.h"
 #include "ThreadSocket.h"
-#include "../utils/GuardDataContainer.h"
+#include "../utils/SharedDataContainer.h"
 #include "TagLogger/TagLoggerBufferContainer.h"
 #include "ThreadExitData.h"
+#include "ThreadCycleControllers.h"
 #include "../driver/DriverBufferUpdater.h"
 #include "../driver/DriverBufferUpdaterData.h"
+#include "../driver/DriverWriteQueueData.h"
+#include "../driver/DriverManager.h"
 #include "../driver/ProcessUpdaterData.h"
 #include "../driver/ProcessReader.h"
 #include "../driver/ProcessWriter.h"
-#include "../db/AlarmingDB.h"
-#include "../db/TagLoggerDB.h"
-#include "../db/ScriptDB.h"
+#include "../db/DBExecutor.h"
 #include "../db/DBCredentials.h"
 #include "../utils/Exception.h"
 
+/// Name prefix of the DB executor worker threads
+#define DB_EXECUTOR_THREAD_PREFIX "DBExecutor_"
+
 namespace onh {
 
 /**
@@ -82,37 +86,53 @@ class ThreadManager {
 		 */
 		void initDriverPolling(const std::vector<DriverBufferUpdaterData>& dbu);
 
+		/**
+		 * Initialize driver writer threads
+		 *
+		 * @param dwq Driver write queues
+		 * @param updateInterval Maximum wait time on new writes (milliseconds)
+		 */
+		void initDriverWriter(const std::vector<DriverWriteQueueData>& dwq, unsigned int updateInterval);
+
+		/**
+		 * Initialize DB executor threads (one thread per executor worker)
+		 *
+		 * @param dbe DB executor
+		 * @param updateInterval Maximum wait time on new DB works (milliseconds)
+		 */
+		void initDBExecutor(DBExecutorPtr dbe, unsigned int updateInterval);
+
 		/**
 		 * Initialize Alarming thread
 		 *
 		 * @param pr Process reader
 		 * @param pw Process writer
-		 * @param adb Alarming DB
+		 * @param dbe DB executor
 		 * @param updateInterval Thread update interval (milliseconds)
 		 */
 		void initAlarmingThread(const ProcessReader& pr,
 								const ProcessWriter& pw,
-								const AlarmingDB& adb,
+								DBExecutorPtr dbe,
 								unsigned int updateInterval);
 
 		/**
 		 * Initialize Tag logger thread
 		 *
 		 * @param pr Process reader
-		 * @param tldb Tag logger DB
+		 * @param dbe DB executor
 		 * @param updateInterval Thread update interval (milliseconds)
 		 */
 		void initTagLoggerThread(const ProcessReader& pr,
-									const TagLoggerDB& tldb,
+									DBExecutorPtr dbe,
 									unsigned int updateInterval);
 
 		/**
 		 * Initialize Tag logger writer thread
 		 *
-		 * @param tldb Tag logger DB
+		 * @param dbe DB executor
 		 * @param updateInterval Thread update interval (milliseconds)
 		 */
-		void initTagLoggerWriterThread(const TagLoggerDB& tldb,
+		void initTagLoggerWriterThread(DBExecutorPtr dbe,
 										unsigned int updateInterval);
 
 		/**
@@ -120,15 +140,19 @@ class ThreadManager {
 		 *
 		 * @param pr Process reader
 		 * @param pw Process writer
-		 * @param sdb Script DB
+		 * @param dbe DB executor
 		 * @param updateInterval Thread update interval (milliseconds)
 		 * @param scriptDirPath Full path to the user script directory
+		 * @param poolSize Maximum number of running scripts
+		 * @param timeout Script execution timeout (milliseconds, 0 - no timeout)
 		 */
 		void initScriptThread(const ProcessReader& pr,
 								const ProcessWriter& pw,
-								const ScriptDB& sdb,
+								DBExecutorPtr dbe,
 								unsigned int updateInterval,
-								const std::string& scriptDirPath);
+								const std::string& scriptDirPath,
+								unsigned int poolSize,
+								unsigned int timeout);
 
 		/**
 		 * Initialize Socket thread
@@ -146,9 +170,32 @@ class ThreadManager {
 								int maxConn);
 
 		/**
-		 * Run threads
+		 * Start threads
 		 */
-		void run();
+		void start();
+
+		/**
+		 * Wait on application exit
+		 *
+		 * @param timeout Maximum wait time (milliseconds)
+		 *
+		 * @return True if application exit is triggered
+		 */
+		bool waitForExit(unsigned int timeout);
+
+		/**
+		 * Join threads (after application exit is triggered)
+		 */
+		void join();
+
+		/**
+		 * Switch driver connection threads after driver reload
+		 * Threads of the removed/changed connections are stopped, threads of
+		 * the added/changed connections are started. Other threads are not touched.
+		 *
+		 * @param rd Driver reload data
+		 */
+		void reloadDrivers(const driverReloadData& rd);
 
 		/**
 		 * Trigger exit
@@ -168,23 +215,67 @@ class ThreadManager {
 		void shutdownSocket();
 
 	private:
+		/**
+		 * Add process updater thread program
+		 *
+		 * @param pu Process updater
+		 */
+		void addProcessUpdater(const ProcessUpdaterData& pu);
+
+		/**
+		 * Add driver polling thread program
+		 *
+		 * @param dbu Driver buffer updater
+		 */
+		void addDriverPolling(const DriverBufferUpdaterData& dbu);
+
+		/**
+		 * Add driver writer thread program
+		 *
+		 * @param dwq Driver write queue
+		 */
+		void addDriverWriter(const DriverWriteQueueData& dwq);
+
+		/**
+		 * Stop thread program and remove it
+		 *
+		 * @param nm Thread program name
+		 */
+		void removeThread(const std::string& nm);
+
+		/**
+		 * Check if thread program is the DB executor worker
+		 *
+		 * @param nm Thread program name
+		 *
+		 * @return True if thread program executes DB works
+		 */
+		static bool isDBExecutorThread(const std::string& nm);
+
+		/**
+		 * Publish cycle controllers of the current threads (read by socket thread)
+		 */
+		void publishCycleControllers();
+
 		/**
 		 * Thread program data structure
 		 */
 		struct threadProgramData {
 			/// Cycle time container
-			GuardDataContainer<CycleTimeData> cycleContainer;
+			SharedDataContainer<CycleTimeData> cycleContainer;
 			/// Thread program
 			std::unique_ptr<ThreadProgram> thProgram;
+			/// Program thread
+			std::thread thread;
 
 			threadProgramData(): thProgram(nullptr) {}
 		};
 
 		/// Thread exit
-		GuardDataContainer<ThreadExitData> tmExit;
+		SharedDataContainer<ThreadExitData> tmExit;
 
 		/// Socket file descriptor
-		GuardDataContainer<int> tmSockDesc;
+		SharedDataContainer<int> tmSockDesc;
 
 		/// Program threads data
 		std::map<std::string, threadProgramData> thProgramData;
@@ -198,14 +289,29 @@ class ThreadManager {
 		/// Socket thread
 		std::unique_ptr<std::thread> threadSocket;
 
-		/// Program threads
-		std::vector<std::thread> threadProgs;
+		/// Threads started flag
+		bool started;
+
+		/// Process updater threads update interval (milliseconds)
+		unsigned int updaterInterval;
+
+		/// Driver writer threads maximum wait time on new writes (milliseconds)
+		unsigned int writerInterval;
 
 		/// Process updater init flag
 		bool updatersInited;
 
 		/// Driver buffers init flag
 		bool driverBuffersInited;
+
+		/// Driver writers init flag
+		bool driverWritersInited;
+
+		/// DB executor threads init flag
+		bool dbExecutorInited;
+
+		/// Thread cycle controllers registry
+		ThreadCycleRegistryPtr cycleRegistry;
 };
 
 }  // namespace onh
@@ -21,38 +21,62 @@
 
 namespace onh {
 
-ThreadProgram::ThreadProgram(const GuardDataController<ThreadExitData> &gdcTED,
-								const GuardDataController<CycleTimeData> &gdcCTD,
+ThreadProgram::ThreadProgram(const SharedDataController<ThreadExitData> &gdcTED,
+								const SharedDataController<CycleTimeData> &gdcCTD,
 								unsigned int updateInterval,
 								const std::string& dirName,
 								const std::string& fPrefix):
-	BaseThreadProgram(gdcTED, dirName, fPrefix), thDelay(updateInterval), thCycleTimeController(gdcCTD) {
+	BaseThreadProgram(gdcTED, dirName, fPrefix), thScheduler(updateInterval), thUpdateInterval(updateInterval), thCycleTimeController(gdcCTD),
+	thCycleStats(std::make_shared<ThreadCycleStats>()) {
 }
 
 ThreadProgram::~ThreadProgram() {
 }
 
+ThreadCycleStatsPtr ThreadProgram::getCycleStats() const {
+	return thCycleStats;
+}
+
 void ThreadProgram::startCycleMeasure() {
 	thCycle.start();
+
+	thCycleStart = std::chrono::steady_clock::now();
+	thPhaseStart = thCycleStart;
 }
 
 void ThreadProgram::stopCycleMeasure() {
 	thCycle.stop();
 
+	CycleTimeData ctd = thCycle.getCycle();
+	ctd.sched = thScheduler.getStats();
+
 	// Pass counted value to the cycle time controller
-	thCycleTimeController.setData(thCycle.getCycle());
+	thCycleTimeController.setData(ctd);
+
+	// Cycle statistics
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	thCycleStats->record(CP_CYCLE, std::chrono::duration_cast<std::chrono::microseconds>(now - thCycleStart).count());
+	thCycleStats->cycleFinished();
 }
 
 void ThreadProgram::threadWait() {
-	thDelay.wait();
+	// Not marked work before wait is counted only in the cycle time
+	thPhaseStart = std::chrono::steady_clock::now();
+
+	thScheduler.wait();
+
+	markPhase(CP_WAIT);
 }
 
-void ThreadProgram::threadWaitStart() {
-	thDelay.startDelay();
+void ThreadProgram::markPhase(cyclePhase phase) {
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+	thCycleStats->record(phase, std::chrono::duration_cast<std::chrono::microseconds>(now - thPhaseStart).count());
+	thPhaseStart = now;
 }
 
-void ThreadProgram::threadWaitAfterStart() {
-	thDelay.waitAfterStart();
+unsigned int ThreadProgram::getUpdateInterval() const {
+	return thUpdateInterval;
 }
 
 }  // namespace onh
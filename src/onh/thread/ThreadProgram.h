@@ -19,10 +19,12 @@
 #ifndef ONH_THREAD_THREADPROGRAM_H_
 #define ONH_THREAD_THREADPROGRAM_H_
 
+#include <chrono>
 #include "BaseThreadProgram.h"
-#include "../utils/GuardDataController.h"
+#include "../utils/SharedDataController.h"
 #include "../utils/CycleTime.h"
-#include "../utils/Delay.h"
+#include "../utils/PeriodicScheduler.h"
+#include "../utils/ThreadCycleStats.h"
 
 namespace onh {
 
@@ -40,8 +42,8 @@ class ThreadProgram: public BaseThreadProgram {
 		 * @param dirName Name of the directory where to write log files
 		 * @param fPrefix Log file name prefix
 		 */
-		ThreadProgram(const GuardDataController<ThreadExitData> &gdcTED,
-				const GuardDataController<CycleTimeData> &gdcCTD,
+		ThreadProgram(const SharedDataController<ThreadExitData> &gdcTED,
+				const SharedDataController<CycleTimeData> &gdcCTD,
 				unsigned int updateInterval,
 				const std::string& dirName,
 				const std::string& fPrefix = "");
@@ -61,15 +63,34 @@ class ThreadProgram: public BaseThreadProgram {
 		 */
 		ThreadProgram& operator=(const ThreadProgram&) = delete;
 
+		/**
+		 * Get thread cycle statistics
+		 *
+		 * @return Thread cycle statistics
+		 */
+		ThreadCycleStatsPtr getCycleStats() const;
+
 	private:
 		/// Thread program cycle time
 		CycleTime thCycle;
 
-		/// Timer delay object
-		Delay thDelay;
+		/// Thread periodic scheduler
+		PeriodicScheduler thScheduler;
+
+		/// Thread update interval (ms)
+		unsigned int thUpdateInterval;
 
 		/// Thread cycle time data controller
-		GuardDataController<CycleTimeData> thCycleTimeController;
+		SharedDataController<CycleTimeData> thCycleTimeController;
+
+		/// Thread cycle statistics
+		ThreadCycleStatsPtr thCycleStats;
+
+		/// Current cycle start
+		std::chrono::steady_clock::time_point thCycleStart;
+
+		/// Current phase start
+		std::chrono::steady_clock::time_point thPhaseStart;
 
 	protected:
 		/**
@@ -83,19 +104,26 @@ class ThreadProgram: public BaseThreadProgram {
 		void stopCycleMeasure();
 
 		/**
-		 * Thread wait
+		 * Thread wait (till the next cycle deadline)
 		 */
 		void threadWait();
 
 		/**
-		 * Thread wait (no blocking)
+		 * Finish cycle phase
+		 *
+		 * Time since the previous phase (or cycle start) is recorded
+		 * in the phase histogram.
+		 *
+		 * @param phase Finished cycle phase
 		 */
-		void threadWaitStart();
+		void markPhase(cyclePhase phase);
 
 		/**
-		 * Thread wait after start called (blocking)
+		 * Get thread update interval
+		 *
+		 * @return Thread update interval (ms)
 		 */
-		void threadWaitAfterStart();
+		unsigned int getUpdateInterval() const;
 };
 
 }  // namespace onh
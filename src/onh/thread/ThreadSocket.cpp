@@ -21,8 +21,8 @@
 
 namespace onh {
 
-ThreadSocket::ThreadSocket(const GuardDataController<ThreadExitData> &gdcTED,
-							const GuardDataController<int> &gdcSockDesc,
+ThreadSocket::ThreadSocket(const SharedDataController<ThreadExitData> &gdcTED,
+							const SharedDataController<int> &gdcSockDesc,
 							const std::string& dirName,
 							const std::string& fPrefix):
 	BaseThreadProgram(gdcTED, dirName, fPrefix),
@@ -20,7 +20,7 @@
 #define ONH_THREAD_THREADSOCKET_H_
 
 #include "BaseThreadProgram.h"
-#include "../utils/GuardDataController.h"
+#include "../utils/SharedDataController.h"
 
 namespace onh {
 
@@ -37,8 +37,8 @@ class ThreadSocket: public BaseThreadProgram {
 		 * @param dirName Name of the directory where to write log files
 		 * @param fPrefix Log file name prefix
 		 */
-		ThreadSocket(const GuardDataController<ThreadExitData> &gdcTED,
-						const GuardDataController<int> &gdcSockDesc,
+		ThreadSocket(const SharedDataController<ThreadExitData> &gdcTED,
+						const SharedDataController<int> &gdcSockDesc,
 						const std::string& dirName,
 						const std::string& fPrefix = "");
 
@@ -59,7 +59,7 @@ class ThreadSocket: public BaseThreadProgram {
 
 	private:
 		/// Socket file descriptor controller
-		GuardDataController<int> thSockDecsController;
+		SharedDataController<int> thSockDecsController;
 
 	protected:
 		/**
@@ -0,0 +1,152 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Clock.h"
+#include <time.h>
+#include <string.h>
+#include "Exception.h"
+
+namespace onh {
+
+namespace {
+
+/// Two digits table (00-99)
+const char DIGITS[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/// Length of the cached part (YYYY-MM-DD HH:MM:SS)
+const unsigned int PREFIX_LENGTH = 19;
+
+/**
+ * Formatted second cache (one per thread)
+ */
+typedef struct {
+	/// Cached second (since epoch)
+	long long int second;
+
+	/// Formatted date and time
+	char prefix[PREFIX_LENGTH];
+} secondCache;
+
+thread_local secondCache cache = {-1, {0}};
+
+inline void put2(char *buff, int v) {
+	memcpy(buff, &DIGITS[v * 2], 2);
+}
+
+inline int parseNumber(const std::string& s, unsigned int pos, unsigned int len) {
+	int ret = 0;
+
+	for (unsigned int i = pos; i < pos + len; ++i) {
+		if (s[i] < '0' || s[i] > '9')
+			throw Exception("Timestamp string wrong format", "Clock::parseTimestamp");
+
+		ret = ret * 10 + (s[i] - '0');
+	}
+
+	return ret;
+}
+
+}  // namespace
+
+ClockTime Clock::now() {
+	ClockTime ret;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ret.monotonic = static_cast<long long int>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ret.realtime = static_cast<long long int>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+
+	return ret;
+}
+
+std::string Clock::getTimestampString(long long int realtime) {
+	char buff[TIMESTAMP_LENGTH];
+
+	formatTimestamp(realtime, buff);
+
+	return std::string(buff, TIMESTAMP_LENGTH);
+}
+
+void Clock::formatTimestamp(long long int realtime, char *buff) {
+	long long int sec = realtime / 1000;
+	int ms = static_cast<int>(realtime % 1000);
+
+	// Rebuild date and time only when second changes
+	if (sec != cache.second) {
+		time_t t = static_cast<time_t>(sec);
+		struct tm date;
+		localtime_r(&t, &date);
+
+		int year = date.tm_year + 1900;
+		put2(&cache.prefix[0], year / 100);
+		put2(&cache.prefix[2], year % 100);
+		cache.prefix[4] = '-';
+		put2(&cache.prefix[5], date.tm_mon + 1);
+		cache.prefix[7] = '-';
+		put2(&cache.prefix[8], date.tm_mday);
+		cache.prefix[10] = ' ';
+		put2(&cache.prefix[11], date.tm_hour);
+		cache.prefix[13] = ':';
+		put2(&cache.prefix[14], date.tm_min);
+		cache.prefix[16] = ':';
+		put2(&cache.prefix[17], date.tm_sec);
+
+		cache.second = sec;
+	}
+
+	memcpy(buff, cache.prefix, PREFIX_LENGTH);
+	buff[19] = '.';
+	buff[20] = '0' + ms / 100;
+	put2(&buff[21], ms % 100);
+}
+
+long long int Clock::parseTimestamp(const std::string& timestamp) {
+	if (timestamp.length() != TIMESTAMP_LENGTH)
+		throw Exception("Timestamp string wrong length", "Clock::parseTimestamp");
+
+	struct tm date;
+	memset(&date, 0, sizeof(struct tm));
+
+	date.tm_year = parseNumber(timestamp, 0, 4) - 1900;
+	date.tm_mon = parseNumber(timestamp, 5, 2) - 1;
+	date.tm_mday = parseNumber(timestamp, 8, 2);
+	date.tm_hour = parseNumber(timestamp, 11, 2);
+	date.tm_min = parseNumber(timestamp, 14, 2);
+	date.tm_sec = parseNumber(timestamp, 17, 2);
+	date.tm_isdst = -1;
+
+	time_t t = mktime(&date);
+	if (t == -1)
+		throw Exception("Error during creation timestamp", "Clock::parseTimestamp");
+
+	return static_cast<long long int>(t) * 1000 + parseNumber(timestamp, 20, 3);
+}
+
+}  // namespace onh
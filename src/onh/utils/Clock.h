@@ -0,0 +1,91 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_CLOCK_H_
+#define ONH_UTILS_CLOCK_H_
+
+#include <string>
+
+namespace onh {
+
+/**
+ * Clock time structure (monotonic and wall-clock pair)
+ */
+typedef struct ClockTime {
+	/// Monotonic time (milliseconds)
+	long long int monotonic;
+
+	/// Wall-clock time (milliseconds since epoch)
+	long long int realtime;
+
+	ClockTime(): monotonic(0), realtime(0) {
+	}
+} ClockTime;
+
+/**
+ * Clock class
+ *
+ * Timestamp service for hot paths. Formatted date and time (up to the seconds)
+ * is cached per thread and rebuilt only when the second changes - milliseconds
+ * are appended from a digit table.
+ */
+class Clock {
+	public:
+		/// Timestamp string length (YYYY-MM-DD HH:MM:SS.MSS)
+		static const unsigned int TIMESTAMP_LENGTH = 23;
+
+		/**
+		 * Get current time
+		 *
+		 * @return Monotonic and wall-clock time pair
+		 */
+		static ClockTime now();
+
+		/**
+		 * Get timestamp string (YYYY-MM-DD HH:MM:SS.MSS)
+		 *
+		 * @param realtime Wall-clock time (milliseconds since epoch)
+		 *
+		 * @return String with timestamp
+		 */
+		static std::string getTimestampString(long long int realtime);
+
+		/**
+		 * Write timestamp (YYYY-MM-DD HH:MM:SS.MSS) to the buffer
+		 *
+		 * @param realtime Wall-clock time (milliseconds since epoch)
+		 * @param buff Output buffer (at least TIMESTAMP_LENGTH characters, not null terminated)
+		 */
+		static void formatTimestamp(long long int realtime, char *buff);
+
+		/**
+		 * Parse timestamp string (YYYY-MM-DD HH:MM:SS.MSS)
+		 *
+		 * @param timestamp Timestamp string (local time)
+		 *
+		 * @return Wall-clock time (milliseconds since epoch)
+		 */
+		static long long int parseTimestamp(const std::string& timestamp);
+
+	private:
+		Clock();
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_CLOCK_H_
@@ -22,6 +22,7 @@
 #include <chrono>
 #include <string>
 #include "Exception.h"
+#include "PeriodicScheduler.h"
 
 namespace onh {
 
@@ -35,8 +36,10 @@ typedef struct CycleTimeData {
 	double max;
 	/// Current cycle time (ms) of the program
 	double current;
+	/// Periodic scheduler statistics of the program
+	SchedulerStats sched;
 
-	CycleTimeData(): min(0), max(0), current(0) {}
+	CycleTimeData(): min(0), max(0), current(0), sched() {}
 } CycleTimeData;
 
 /**
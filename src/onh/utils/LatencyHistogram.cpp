@@ -0,0 +1,107 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LatencyHistogram.h"
+
+namespace onh {
+
+/// Number of bits of the linear sub-bucket index
+static const unsigned int subBucketBits = 3;
+
+/// Percentiles (per mille) computed from the histogram
+static const unsigned long int percentiles[4] = {500, 900, 990, 999};
+
+LatencyHistogram::LatencyHistogram():
+	maxValue(0) {
+	for (auto& c : counts)
+		c.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::~LatencyHistogram() {
+}
+
+void LatencyHistogram::record(unsigned long int us) {
+	counts[bucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+
+	// Only owner thread records - plain compare is enough
+	if (us > maxValue.load(std::memory_order_relaxed))
+		maxValue.store(us, std::memory_order_relaxed);
+}
+
+LatencyPercentiles LatencyHistogram::getPercentiles() const {
+	LatencyPercentiles lp;
+	unsigned long int snapshot[LATENCY_HISTOGRAM_BUCKETS];
+
+	for (unsigned int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; ++i) {
+		snapshot[i] = counts[i].load(std::memory_order_relaxed);
+		lp.count += snapshot[i];
+	}
+	lp.max = maxValue.load(std::memory_order_relaxed);
+
+	if (lp.count == 0)
+		return lp;
+
+	unsigned long int *result[4] = {&lp.p50, &lp.p90, &lp.p99, &lp.p999};
+	unsigned long int cumulative = 0;
+	unsigned int p = 0;
+
+	for (unsigned int i = 0; i < LATENCY_HISTOGRAM_BUCKETS && p < 4; ++i) {
+		cumulative += snapshot[i];
+
+		// Rank of the percentile (at least first value)
+		while (p < 4 && cumulative * 1000 >= lp.count * percentiles[p]) {
+			unsigned long int v = bucketValue(i);
+			*result[p] = (v < lp.max)?(v):(lp.max);
+			++p;
+		}
+	}
+
+	return lp;
+}
+
+void LatencyHistogram::reset() {
+	for (auto& c : counts)
+		c.exchange(0, std::memory_order_relaxed);
+
+	maxValue.exchange(0, std::memory_order_relaxed);
+}
+
+unsigned int LatencyHistogram::bucketIndex(unsigned long int us) {
+	// Linear range
+	if (us < LATENCY_HISTOGRAM_SUB_BUCKETS)
+		return us;
+
+	unsigned int msb = (sizeof(unsigned long int) * 8 - 1) - __builtin_clzl(us);
+	unsigned int idx = (msb - subBucketBits + 1) * LATENCY_HISTOGRAM_SUB_BUCKETS +
+						((us >> (msb - subBucketBits)) & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1));
+
+	return (idx < LATENCY_HISTOGRAM_BUCKETS)?(idx):(LATENCY_HISTOGRAM_BUCKETS - 1);
+}
+
+unsigned long int LatencyHistogram::bucketValue(unsigned int idx) {
+	// Linear range
+	if (idx < LATENCY_HISTOGRAM_SUB_BUCKETS)
+		return idx;
+
+	unsigned int shift = idx / LATENCY_HISTOGRAM_SUB_BUCKETS - 1;
+	unsigned long int sub = idx % LATENCY_HISTOGRAM_SUB_BUCKETS;
+
+	return ((LATENCY_HISTOGRAM_SUB_BUCKETS + sub + 1) << shift) - 1;
+}
+
+}  // namespace onh
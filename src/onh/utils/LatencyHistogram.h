@@ -0,0 +1,126 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_LATENCYHISTOGRAM_H_
+#define ONH_UTILS_LATENCYHISTOGRAM_H_
+
+#include <atomic>
+
+/// Number of linear sub-buckets in every power of two range
+#define LATENCY_HISTOGRAM_SUB_BUCKETS 8
+/// Number of histogram buckets (values up to 2^32 us)
+#define LATENCY_HISTOGRAM_BUCKETS 240
+
+namespace onh {
+
+/**
+ * Latency percentiles structure
+ */
+typedef struct LatencyPercentiles {
+	/// Number of recorded values
+	unsigned long int count;
+	/// 50th percentile (us)
+	unsigned long int p50;
+	/// 90th percentile (us)
+	unsigned long int p90;
+	/// 99th percentile (us)
+	unsigned long int p99;
+	/// 99.9th percentile (us)
+	unsigned long int p999;
+	/// Maximum recorded value (us)
+	unsigned long int max;
+
+	LatencyPercentiles(): count(0), p50(0), p90(0), p99(0), p999(0), max(0) {}
+} LatencyPercentiles;
+
+/**
+ * Latency histogram class
+ *
+ * Log-linear (HDR style) histogram of microsecond values. Every power
+ * of two range is split into LATENCY_HISTOGRAM_SUB_BUCKETS linear buckets,
+ * so the relative error of the reported value is below 12.5%.
+ * Values are recorded with relaxed atomic increments - one thread records,
+ * other threads can read percentiles without locking.
+ */
+class LatencyHistogram {
+	public:
+		/**
+		 * Constructor
+		 */
+		LatencyHistogram();
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		LatencyHistogram(const LatencyHistogram&) = delete;
+
+		virtual ~LatencyHistogram();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+		/**
+		 * Record value
+		 *
+		 * @param us Value (microseconds)
+		 */
+		void record(unsigned long int us);
+
+		/**
+		 * Get percentiles of the recorded values
+		 *
+		 * @return Percentiles structure
+		 */
+		LatencyPercentiles getPercentiles() const;
+
+		/**
+		 * Clear recorded values
+		 */
+		void reset();
+
+		/**
+		 * Get bucket index of the value
+		 *
+		 * @param us Value (microseconds)
+		 *
+		 * @return Bucket index
+		 */
+		static unsigned int bucketIndex(unsigned long int us);
+
+		/**
+		 * Get highest value stored in the bucket
+		 *
+		 * @param idx Bucket index
+		 *
+		 * @return Highest bucket value (microseconds)
+		 */
+		static unsigned long int bucketValue(unsigned int idx);
+
+	private:
+		/// Bucket counters
+		std::atomic<unsigned long int> counts[LATENCY_HISTOGRAM_BUCKETS];
+
+		/// Maximum recorded value
+		std::atomic<unsigned long int> maxValue;
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_LATENCYHISTOGRAM_H_
@@ -0,0 +1,103 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PeriodicScheduler.h"
+#include <errno.h>
+
+namespace onh {
+
+/// Upper limits of the jitter histogram buckets (us)
+static const unsigned long int jitterLimits[SCHEDULER_JITTER_BUCKETS-1] = {10, 50, 100, 500, 1000, 5000, 10000};
+
+PeriodicScheduler::PeriodicScheduler(unsigned int msec):
+	period(static_cast<long long int>(msec)*1000000), deadline{0, 0}, started(false) {
+}
+
+PeriodicScheduler::~PeriodicScheduler() {
+}
+
+void PeriodicScheduler::wait() {
+	// No period - no wait
+	if (period == 0) {
+		stats.cycles++;
+		return;
+	}
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	// First cycle - start schedule
+	if (!started) {
+		deadline = now;
+		started = true;
+	}
+
+	// Next cycle deadline
+	addPeriods(deadline, 1);
+
+	long long int late = diff(now, deadline);
+
+	// Deadline passed during cycle work
+	if (late > 0) {
+		stats.overruns++;
+
+		// Skip missed periods (keep schedule phase)
+		unsigned long int missed = late / period;
+		stats.skipped += missed;
+		addPeriods(deadline, missed);
+		stats.cycles++;
+
+		return;
+	}
+
+	// Sleep to absolute deadline
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+	}
+
+	// Wake-up jitter
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	long long int jitter = diff(now, deadline);
+	unsigned long int jitterUs = (jitter > 0)?(jitter / 1000):(0);
+
+	if (jitterUs > stats.jitterMax)
+		stats.jitterMax = jitterUs;
+
+	unsigned int bucket = 0;
+	while (bucket < SCHEDULER_JITTER_BUCKETS-1 && jitterUs >= jitterLimits[bucket])
+		bucket++;
+	stats.jitterHist[bucket]++;
+
+	stats.cycles++;
+}
+
+const SchedulerStats& PeriodicScheduler::getStats() const {
+	return stats;
+}
+
+void PeriodicScheduler::addPeriods(struct timespec &ts, unsigned long int periods) const {
+	long long int ns = ts.tv_nsec + period * periods;
+
+	ts.tv_sec += ns / 1000000000;
+	ts.tv_nsec = ns % 1000000000;
+}
+
+long long int PeriodicScheduler::diff(const struct timespec &t1, const struct timespec &t2) {
+	return (static_cast<long long int>(t1.tv_sec) - t2.tv_sec) * 1000000000 + (t1.tv_nsec - t2.tv_nsec);
+}
+
+}  // namespace onh
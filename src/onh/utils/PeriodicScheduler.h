@@ -0,0 +1,123 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_PERIODICSCHEDULER_H_
+#define ONH_UTILS_PERIODICSCHEDULER_H_
+
+#include <time.h>
+
+/// Number of wake-up jitter histogram buckets
+#define SCHEDULER_JITTER_BUCKETS 8
+
+namespace onh {
+
+/**
+ * Periodic scheduler statistics structure
+ */
+typedef struct SchedulerStats {
+	/// Number of scheduled cycles
+	unsigned long int cycles;
+	/// Number of cycles which finished after the deadline
+	unsigned long int overruns;
+	/// Number of whole periods skipped because of overruns
+	unsigned long int skipped;
+	/// Maximum wake-up jitter (us)
+	unsigned long int jitterMax;
+	/// Wake-up jitter histogram (<10us, <50us, <100us, <500us, <1ms, <5ms, <10ms, >=10ms)
+	unsigned long int jitterHist[SCHEDULER_JITTER_BUCKETS];
+
+	SchedulerStats(): cycles(0), overruns(0), skipped(0), jitterMax(0), jitterHist{0} {}
+} SchedulerStats;
+
+/**
+ * Periodic scheduler class
+ *
+ * Sleeps to absolute deadlines (clock_nanosleep with TIMER_ABSTIME on
+ * CLOCK_MONOTONIC), so the period does not drift with the cycle work time.
+ */
+class PeriodicScheduler {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param msec Period (milliseconds)
+		 */
+		explicit PeriodicScheduler(unsigned int msec);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		PeriodicScheduler(const PeriodicScheduler&) = delete;
+
+		virtual ~PeriodicScheduler();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		PeriodicScheduler& operator=(const PeriodicScheduler&) = delete;
+
+		/**
+		 * Wait till the next cycle deadline
+		 *
+		 * First call starts the schedule. If the deadline already passed
+		 * the overrun is counted and missed periods are skipped (no sleep).
+		 */
+		void wait();
+
+		/**
+		 * Get scheduler statistics
+		 *
+		 * @return Scheduler statistics
+		 */
+		const SchedulerStats& getStats() const;
+
+	private:
+		/**
+		 * Add period to the time point
+		 *
+		 * @param ts Time point
+		 * @param periods Number of periods to add
+		 */
+		void addPeriods(struct timespec &ts, unsigned long int periods) const;
+
+		/**
+		 * Get difference between time points
+		 *
+		 * @param t1 Time point
+		 * @param t2 Time point
+		 *
+		 * @return t1 - t2 (nanoseconds)
+		 */
+		static long long int diff(const struct timespec &t1, const struct timespec &t2);
+
+		/// Period (nanoseconds)
+		long long int period;
+
+		/// Next cycle deadline
+		struct timespec deadline;
+
+		/// Schedule started flag
+		bool started;
+
+		/// Scheduler statistics
+		SchedulerStats stats;
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_PERIODICSCHEDULER_H_
@@ -0,0 +1,102 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_SHAREDDATACONTAINER_H_
+#define ONH_UTILS_SHAREDDATACONTAINER_H_
+
+#include <memory>
+#include "SharedDataStorage.h"
+#include "SharedDataController.h"
+
+namespace onh {
+
+/**
+ * Shared data container class (readers-writer variant of GuardDataContainer)
+ */
+template <class T>
+class SharedDataContainer {
+	public:
+		/**
+		 * Default constructor
+		 */
+		SharedDataContainer();
+
+		/**
+		 * Constructor with data
+		 *
+		 * @param newData Data to store in container
+		 */
+		explicit SharedDataContainer(const T& newData);
+
+		/**
+		 * Copy constructor
+		 *
+		 * @param sdc Data container object to copy
+		 */
+		SharedDataContainer(const SharedDataContainer& sdc);
+
+		virtual ~SharedDataContainer();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		SharedDataContainer& operator=(const SharedDataContainer&) = delete;
+
+		/**
+		 * Get shared data controller object
+		 *
+		 * @return Shared data controller object
+		 */
+		SharedDataController<T> getController(bool readOnly = true);
+
+	private:
+		/// Shared data
+		std::shared_ptr<SharedDataStorage<T>> data;
+};
+
+template <class T>
+SharedDataContainer<T>::SharedDataContainer():
+	data(std::make_shared<SharedDataStorage<T>>(T())) {
+}
+
+template <class T>
+SharedDataContainer<T>::SharedDataContainer(const T& newData):
+	data(std::make_shared<SharedDataStorage<T>>(newData)) {
+}
+
+template <class T>
+SharedDataContainer<T>::SharedDataContainer(const SharedDataContainer& sdc):
+	data(nullptr) {
+	T tmp;
+	sdc.data->load(tmp);
+
+	data = std::make_shared<SharedDataStorage<T>>(tmp);
+}
+
+template <class T>
+SharedDataContainer<T>::~SharedDataContainer() {
+}
+
+template <class T>
+SharedDataController<T> SharedDataContainer<T>::getController(bool readOnly) {
+	return SharedDataController<T>(data, readOnly);
+}
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_SHAREDDATACONTAINER_H_
@@ -0,0 +1,122 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_SHAREDDATACONTROLLER_H_
+#define ONH_UTILS_SHAREDDATACONTROLLER_H_
+
+#include <memory>
+#include "SharedDataStorage.h"
+#include "Exception.h"
+
+namespace onh {
+
+/// Forward declaration
+template <class T>
+class SharedDataContainer;
+
+/**
+ * Shared data controller class
+ *
+ * Same interface as GuardDataController (getData/setData) but readers
+ * do not take an exclusive lock (see getSharedDataPolicy).
+ */
+template <class T>
+class SharedDataController {
+	public:
+		friend class SharedDataContainer<T>;
+
+		/**
+		 * Copy constructor
+		 *
+		 * @param sdc Data controller object to copy
+		 */
+		SharedDataController(const SharedDataController& sdc);
+
+		virtual ~SharedDataController();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		SharedDataController& operator=(const SharedDataController&) = delete;
+
+		/**
+		 * Get data
+		 *
+		 * @param dt Copy of the data
+		 */
+		void getData(T &dt) const;
+
+		/**
+		 * Set data
+		 *
+		 * @param newData Data to copy
+		 */
+		void setData(const T& newData);
+
+	private:
+		/**
+		 * Constructor (allowed only from SharedDataContainer)
+		 *
+		 * @param dt Pointer to the data storage
+		 * @param readFlag Read only flag
+		 */
+		SharedDataController(std::shared_ptr<SharedDataStorage<T>> dt, bool readFlag);
+
+		/// Pointer to the data storage
+		std::shared_ptr<SharedDataStorage<T>> data;
+
+		/// Read only flag
+		bool readOnly;
+};
+
+template <class T>
+SharedDataController<T>::SharedDataController(const SharedDataController& sdc):
+	data(sdc.data), readOnly(sdc.readOnly) {
+}
+
+template <class T>
+SharedDataController<T>::SharedDataController(std::shared_ptr<SharedDataStorage<T>> dt, bool readFlag):
+	data(dt), readOnly(readFlag) {
+}
+
+template <class T>
+SharedDataController<T>::~SharedDataController() {
+}
+
+template <class T>
+void SharedDataController<T>::getData(T &dt) const {
+	if (!data)
+		throw Exception("Data handle not initialized", "SharedDataController::getData");
+
+	data->load(dt);
+}
+
+template <class T>
+void SharedDataController<T>::setData(const T& newData) {
+	if (!data)
+		throw Exception("Data handle not initialized", "SharedDataController::setData");
+
+	if (readOnly)
+		throw Exception("Data controller is in read only state", "SharedDataController::setData");
+
+	data->store(newData);
+}
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_SHAREDDATACONTROLLER_H_
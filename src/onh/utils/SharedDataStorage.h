@@ -0,0 +1,219 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_SHAREDDATASTORAGE_H_
+#define ONH_UTILS_SHAREDDATASTORAGE_H_
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <string.h>
+
+namespace onh {
+
+/**
+ * Shared data access policy
+ */
+typedef enum {
+	SDP_ATOMIC = 1,
+	SDP_SEQLOCK = 2,
+	SDP_SHARED_MUTEX = 3
+} sharedDataPolicy;
+
+/**
+ * Get access policy used for the data type
+ *
+ * Lock-free atomic for small trivially copyable types, seqlock
+ * for other trivially copyable types, readers-writer lock for the rest.
+ *
+ * @return Access policy
+ */
+template <class T>
+constexpr sharedDataPolicy getSharedDataPolicy() {
+	if constexpr (std::is_trivially_copyable<T>::value) {
+		if constexpr (std::atomic<T>::is_always_lock_free) {
+			return SDP_ATOMIC;
+		} else {
+			return SDP_SEQLOCK;
+		}
+	} else {
+		return SDP_SHARED_MUTEX;
+	}
+}
+
+/**
+ * Shared data storage (readers-writer lock)
+ */
+template <class T, sharedDataPolicy P = getSharedDataPolicy<T>()>
+class SharedDataStorage {
+	public:
+		explicit SharedDataStorage(const T& dt):
+			data(dt) {
+		}
+
+		/**
+		 * Copy stored data (readers do not block each other)
+		 *
+		 * @param dt Copy of the data
+		 */
+		void load(T &dt) const {
+			std::shared_lock<std::shared_mutex> lock(dataLock);
+			dt = data;
+		}
+
+		/**
+		 * Store new data
+		 *
+		 * @param dt Data to copy
+		 */
+		void store(const T& dt) {
+			std::unique_lock<std::shared_mutex> lock(dataLock);
+			data = dt;
+		}
+
+	private:
+		/// Stored data
+		T data;
+
+		/// Readers-writer lock
+		mutable std::shared_mutex dataLock;
+};
+
+/**
+ * Shared data storage (lock-free atomic)
+ */
+template <class T>
+class SharedDataStorage<T, SDP_ATOMIC> {
+	public:
+		explicit SharedDataStorage(const T& dt):
+			data(dt) {
+		}
+
+		/**
+		 * Copy stored data
+		 *
+		 * @param dt Copy of the data
+		 */
+		void load(T &dt) const {
+			dt = data.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * Store new data
+		 *
+		 * @param dt Data to copy
+		 */
+		void store(const T& dt) {
+			data.store(dt, std::memory_order_release);
+		}
+
+	private:
+		/// Stored data
+		std::atomic<T> data;
+};
+
+/**
+ * Shared data storage (seqlock)
+ *
+ * Data is kept in atomic words, readers never block the writer
+ * and retry the copy if the writer changed data in the meantime.
+ */
+template <class T>
+class SharedDataStorage<T, SDP_SEQLOCK> {
+	public:
+		explicit SharedDataStorage(const T& dt):
+			sequence(0) {
+			unsigned long int buff[WORDS] = {0};
+			memcpy(buff, &dt, sizeof(T));
+
+			for (unsigned int i = 0; i < WORDS; ++i)
+				words[i].store(buff[i], std::memory_order_relaxed);
+		}
+
+		/**
+		 * Copy stored data
+		 *
+		 * @param dt Copy of the data
+		 */
+		void load(T &dt) const {
+			unsigned long int buff[WORDS];
+			unsigned long int seq1, seq2;
+
+			do {
+				seq1 = sequence.load(std::memory_order_acquire);
+
+				// Writer in progress
+				if (seq1 & 1) {
+					std::this_thread::yield();
+					continue;
+				}
+
+				for (unsigned int i = 0; i < WORDS; ++i)
+					buff[i] = words[i].load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				seq2 = sequence.load(std::memory_order_relaxed);
+
+				if (seq1 == seq2)
+					break;
+			} while (true);
+
+			memcpy(&dt, buff, sizeof(T));
+		}
+
+		/**
+		 * Store new data
+		 *
+		 * @param dt Data to copy
+		 */
+		void store(const T& dt) {
+			unsigned long int buff[WORDS] = {0};
+			memcpy(buff, &dt, sizeof(T));
+
+			// Writers are serialized
+			std::lock_guard<std::mutex> lock(writeLock);
+
+			unsigned long int seq = sequence.load(std::memory_order_relaxed);
+			sequence.store(seq+1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			for (unsigned int i = 0; i < WORDS; ++i)
+				words[i].store(buff[i], std::memory_order_relaxed);
+
+			sequence.store(seq+2, std::memory_order_release);
+		}
+
+	private:
+		/// Number of words needed for the data
+		static constexpr unsigned int WORDS = (sizeof(T) + sizeof(unsigned long int) - 1) / sizeof(unsigned long int);
+
+		/// Data words
+		std::atomic<unsigned long int> words[WORDS];
+
+		/// Data sequence (odd while writer changes data)
+		std::atomic<unsigned long int> sequence;
+
+		/// Writers lock
+		std::mutex writeLock;
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_SHAREDDATASTORAGE_H_
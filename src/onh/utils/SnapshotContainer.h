@@ -0,0 +1,119 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_SNAPSHOTCONTAINER_H_
+#define ONH_UTILS_SNAPSHOTCONTAINER_H_
+
+#include <atomic>
+#include <memory>
+#include "Exception.h"
+
+namespace onh {
+
+/**
+ * Snapshot container class
+ *
+ * Holds immutable, reference counted data snapshot published by one writer
+ * and shared read-only by all readers. Readers keep acquired snapshot
+ * as long as they need it - publishing does not modify it.
+ */
+template <class T>
+class SnapshotContainer {
+	public:
+		/**
+		 * Constructor with initial data
+		 *
+		 * @param initData Initial snapshot data
+		 */
+		explicit SnapshotContainer(const T& initData);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		SnapshotContainer(const SnapshotContainer&) = delete;
+
+		virtual ~SnapshotContainer();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		SnapshotContainer& operator=(const SnapshotContainer&) = delete;
+
+		/**
+		 * Publish new snapshot
+		 *
+		 * @param snap New snapshot
+		 */
+		void publish(std::shared_ptr<const T> snap);
+
+		/**
+		 * Acquire current snapshot (pointer load and reference count increment)
+		 *
+		 * @return Current snapshot
+		 */
+		std::shared_ptr<const T> acquire() const;
+
+		/**
+		 * Get snapshot generation
+		 *
+		 * @return Snapshot generation (incremented on every publish)
+		 */
+		unsigned long int getGeneration() const;
+
+	private:
+		/// Current snapshot
+		std::shared_ptr<const T> current;
+
+		/// Snapshot generation
+		std::atomic<unsigned long int> generation;
+};
+
+template <class T>
+using SnapshotContainerPtr = std::shared_ptr<SnapshotContainer<T>>;
+
+template <class T>
+SnapshotContainer<T>::SnapshotContainer(const T& initData):
+	current(std::make_shared<const T>(initData)), generation(0) {
+}
+
+template <class T>
+SnapshotContainer<T>::~SnapshotContainer() {
+}
+
+template <class T>
+void SnapshotContainer<T>::publish(std::shared_ptr<const T> snap) {
+	if (!snap)
+		throw Exception("Snapshot is empty", "SnapshotContainer::publish");
+
+	std::atomic_store_explicit(&current, std::move(snap), std::memory_order_release);
+	generation.fetch_add(1, std::memory_order_release);
+}
+
+template <class T>
+std::shared_ptr<const T> SnapshotContainer<T>::acquire() const {
+	return std::atomic_load_explicit(&current, std::memory_order_acquire);
+}
+
+template <class T>
+unsigned long int SnapshotContainer<T>::getGeneration() const {
+	return generation.load(std::memory_order_acquire);
+}
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_SNAPSHOTCONTAINER_H_
@@ -0,0 +1,79 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ThreadCycleStats.h"
+
+namespace onh {
+
+using namespace std::chrono;
+
+ThreadCycleStats::ThreadCycleStats(unsigned int windowLength):
+	window(windowLength), windowStart(steady_clock::now().time_since_epoch().count()),
+	lastWindowController(lastWindow.getController(false)) {
+}
+
+ThreadCycleStats::~ThreadCycleStats() {
+}
+
+void ThreadCycleStats::record(cyclePhase phase, unsigned long int us) {
+	hist[phase].record(us);
+}
+
+void ThreadCycleStats::cycleFinished() {
+	steady_clock::time_point now = steady_clock::now();
+	steady_clock::time_point start(steady_clock::duration(windowStart.load(std::memory_order_relaxed)));
+
+	if (now - start < window)
+		return;
+
+	// Close window
+	lastWindowController.setData(prepareWindow(now));
+
+	// Start new window
+	for (auto& h : hist)
+		h.reset();
+	windowStart.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+ThreadCycleWindow ThreadCycleStats::getCurrentWindow() const {
+	return prepareWindow(steady_clock::now());
+}
+
+ThreadCycleWindow ThreadCycleStats::getLastWindow() const {
+	ThreadCycleWindow w;
+
+	lastWindowController.getData(w);
+
+	return w;
+}
+
+ThreadCycleWindow ThreadCycleStats::prepareWindow(steady_clock::time_point now) const {
+	ThreadCycleWindow w;
+	steady_clock::time_point start(steady_clock::duration(windowStart.load(std::memory_order_relaxed)));
+
+	for (unsigned int i = 0; i < CP_COUNT; ++i)
+		w.phase[i] = hist[i].getPercentiles();
+
+	w.duration = duration_cast<milliseconds>(now - start).count();
+	w.cycles = w.phase[CP_CYCLE].count;
+	w.rate = (w.duration > 0)?(w.cycles * 1000.0 / w.duration):(0);
+
+	return w;
+}
+
+}  // namespace onh
@@ -0,0 +1,148 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_THREADCYCLESTATS_H_
+#define ONH_UTILS_THREADCYCLESTATS_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include "LatencyHistogram.h"
+#include "SharedDataContainer.h"
+
+/// Default statistics window length (ms)
+#define THREAD_CYCLE_STATS_WINDOW 60000
+
+namespace onh {
+
+/**
+ * Thread cycle phase
+ */
+typedef enum {
+	CP_CYCLE = 0,
+	CP_PROCESS_COPY = 1,
+	CP_EVALUATION = 2,
+	CP_DB_IO = 3,
+	CP_WAIT = 4,
+	CP_COUNT = 5
+} cyclePhase;
+
+/**
+ * Thread cycle statistics window structure
+ */
+typedef struct ThreadCycleWindow {
+	/// Window length (ms)
+	unsigned long int duration;
+	/// Number of cycles in the window
+	unsigned long int cycles;
+	/// Cycle rate (cycles per second)
+	double rate;
+	/// Percentiles of the cycle time and of the cycle phases
+	LatencyPercentiles phase[CP_COUNT];
+
+	ThreadCycleWindow(): duration(0), cycles(0), rate(0) {}
+} ThreadCycleWindow;
+
+/**
+ * Thread cycle statistics class
+ *
+ * Latency histograms of the thread cycle and its phases, collected
+ * in periodic windows. Owner thread records values and rolls the window,
+ * other threads read current or last completed window.
+ */
+class ThreadCycleStats {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param windowLength Statistics window length (ms)
+		 */
+		explicit ThreadCycleStats(unsigned int windowLength = THREAD_CYCLE_STATS_WINDOW);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		ThreadCycleStats(const ThreadCycleStats&) = delete;
+
+		virtual ~ThreadCycleStats();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		ThreadCycleStats& operator=(const ThreadCycleStats&) = delete;
+
+		/**
+		 * Record phase time (owner thread)
+		 *
+		 * @param phase Cycle phase
+		 * @param us Phase time (microseconds)
+		 */
+		void record(cyclePhase phase, unsigned long int us);
+
+		/**
+		 * Finish thread cycle (owner thread)
+		 *
+		 * Close the window when its length elapsed.
+		 */
+		void cycleFinished();
+
+		/**
+		 * Get statistics of the current window
+		 *
+		 * @return Statistics window
+		 */
+		ThreadCycleWindow getCurrentWindow() const;
+
+		/**
+		 * Get statistics of the last completed window
+		 *
+		 * @return Statistics window
+		 */
+		ThreadCycleWindow getLastWindow() const;
+
+	private:
+		/**
+		 * Prepare statistics of the current window
+		 *
+		 * @param now Current time point
+		 *
+		 * @return Statistics window
+		 */
+		ThreadCycleWindow prepareWindow(std::chrono::steady_clock::time_point now) const;
+
+		/// Histograms of the cycle time and of the cycle phases
+		LatencyHistogram hist[CP_COUNT];
+
+		/// Window length
+		std::chrono::milliseconds window;
+
+		/// Current window start (steady clock ticks)
+		std::atomic<std::chrono::steady_clock::rep> windowStart;
+
+		/// Last completed window
+		SharedDataContainer<ThreadCycleWindow> lastWindow;
+
+		/// Last completed window controller
+		SharedDataController<ThreadCycleWindow> lastWindowController;
+};
+
+typedef std::shared_ptr<ThreadCycleStats> ThreadCycleStatsPtr;
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_THREADCYCLESTATS_H_
@@ -0,0 +1,190 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BinaryLogDecoder.h"
+#include <cstdint>
+#include <ctime>
+#include <sstream>
+
+namespace onh {
+
+BinaryLogDecoder::BinaryLogDecoder(std::istream& input):
+	in(input) {
+	char magic[BINARY_LOG_MAGIC_LENGTH];
+
+	if (!in.read(magic, BINARY_LOG_MAGIC_LENGTH) ||
+			std::string(magic, BINARY_LOG_MAGIC_LENGTH) != BINARY_LOG_MAGIC)
+		throw Exception("Not a binary log file", "BinaryLogDecoder::BinaryLogDecoder");
+}
+
+BinaryLogDecoder::~BinaryLogDecoder() {
+}
+
+template <class T>
+void BinaryLogDecoder::readRaw(const std::string& payload, size_t& pos, T& val) {
+	if (pos + sizeof(T) > payload.length())
+		throw Exception("Truncated record payload", "BinaryLogDecoder::readRaw");
+
+	payload.copy(reinterpret_cast<char*>(&val), sizeof(T), pos);
+	pos += sizeof(T);
+}
+
+bool BinaryLogDecoder::next(std::string& line) {
+	unsigned char type;
+	std::string payload;
+
+	while (readRecord(type, payload)) {
+		switch (type) {
+			case BLR_FORMAT: readFormat(payload); break;
+			case BLR_ENTRY: line = formatEntry(payload); return true;
+			default:
+				throw Exception("Unknown record type: "+std::to_string(type), "BinaryLogDecoder::next");
+		}
+	}
+
+	return false;
+}
+
+bool BinaryLogDecoder::readRecord(unsigned char& type, std::string& payload) {
+	char t;
+	uint32_t len;
+
+	// End of the log
+	if (!in.get(t))
+		return false;
+
+	type = static_cast<unsigned char>(t);
+
+	if (!in.read(reinterpret_cast<char*>(&len), sizeof(len)))
+		throw Exception("Truncated record header", "BinaryLogDecoder::readRecord");
+
+	payload.resize(len);
+	if (!in.read(&payload[0], len))
+		throw Exception("Truncated record", "BinaryLogDecoder::readRecord");
+
+	return true;
+}
+
+void BinaryLogDecoder::readFormat(const std::string& payload) {
+	size_t pos = 0;
+	uint32_t id;
+	unsigned char level;
+	uint16_t len;
+	decodedFormat fmt;
+
+	readRaw(payload, pos, id);
+	readRaw(payload, pos, level);
+	fmt.level = static_cast<binaryLogLevel>(level);
+
+	readRaw(payload, pos, len);
+	if (pos + len > payload.length())
+		throw Exception("Truncated format record", "BinaryLogDecoder::readFormat");
+	fmt.function = payload.substr(pos, len);
+	pos += len;
+
+	readRaw(payload, pos, len);
+	if (pos + len > payload.length())
+		throw Exception("Truncated format record", "BinaryLogDecoder::readFormat");
+	fmt.format = payload.substr(pos, len);
+
+	formats[id] = fmt;
+}
+
+std::string BinaryLogDecoder::formatEntry(const std::string& payload) const {
+	size_t pos = 0;
+	uint64_t us;
+	uint32_t id;
+
+	readRaw(payload, pos, us);
+	readRaw(payload, pos, id);
+
+	auto it = formats.find(id);
+	if (it == formats.end())
+		throw Exception("Unknown log format: "+std::to_string(id), "BinaryLogDecoder::formatEntry");
+
+	// Timestamp
+	std::time_t t = us / 1000000;
+	struct tm date;
+	char ts[32];
+	localtime_r(&t, &date);
+	strftime(ts, sizeof(ts), "%Y-%m-%d %H:%M:%S", &date);
+
+	std::stringstream s;
+	s << ts << '|' << ((it->second.level == BLL_ERROR)?(" ERROR ["):(" INFO [")) << it->second.function << "] ";
+
+	// Replace {} with arguments
+	const std::string& fmt = it->second.format;
+	size_t start = 0;
+	size_t ph;
+
+	while ((ph = fmt.find("{}", start)) != std::string::npos && pos < payload.length()) {
+		s << fmt.substr(start, ph - start) << readArg(payload, pos);
+		start = ph + 2;
+	}
+	s << fmt.substr(start);
+
+	// Arguments without placeholders
+	while (pos < payload.length())
+		s << ' ' << readArg(payload, pos);
+
+	return s.str();
+}
+
+std::string BinaryLogDecoder::readArg(const std::string& payload, size_t& pos) {
+	unsigned char type;
+	std::stringstream s;
+
+	readRaw(payload, pos, type);
+
+	switch (type) {
+		case BLA_INT: {
+			int64_t v;
+			readRaw(payload, pos, v);
+			s << v;
+		} break;
+		case BLA_UINT: {
+			uint64_t v;
+			readRaw(payload, pos, v);
+			s << v;
+		} break;
+		case BLA_REAL: {
+			double v;
+			readRaw(payload, pos, v);
+			s << v;
+		} break;
+		case BLA_BOOL: {
+			unsigned char v;
+			readRaw(payload, pos, v);
+			s << ((v)?(1):(0));
+		} break;
+		case BLA_STRING: {
+			uint16_t len;
+			readRaw(payload, pos, len);
+			if (pos + len > payload.length())
+				throw Exception("Truncated string argument", "BinaryLogDecoder::readArg");
+			s << payload.substr(pos, len);
+			pos += len;
+		} break;
+		default:
+			throw Exception("Unknown argument type: "+std::to_string(type), "BinaryLogDecoder::readArg");
+	}
+
+	return s.str();
+}
+
+}  // namespace onh
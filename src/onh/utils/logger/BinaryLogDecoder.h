@@ -0,0 +1,133 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_LOGGER_BINARYLOGDECODER_H_
+#define ONH_UTILS_LOGGER_BINARYLOGDECODER_H_
+
+#include <istream>
+#include <map>
+#include <string>
+#include "BinaryLogFormat.h"
+#include "../Exception.h"
+
+namespace onh {
+
+/**
+ * Binary log decoder class
+ *
+ * Reads binary log file and formats entries as text log lines.
+ */
+class BinaryLogDecoder {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param input Binary log stream
+		 */
+		explicit BinaryLogDecoder(std::istream& input);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		BinaryLogDecoder(const BinaryLogDecoder&) = delete;
+
+		virtual ~BinaryLogDecoder();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		BinaryLogDecoder& operator=(const BinaryLogDecoder&) = delete;
+
+		/**
+		 * Decode next log entry
+		 *
+		 * @param line Text log line
+		 *
+		 * @return True if entry was decoded (false at the end of the log)
+		 */
+		bool next(std::string& line);
+
+	private:
+		/**
+		 * Decoded log format structure
+		 */
+		typedef struct {
+			/// Log level
+			binaryLogLevel level;
+			/// Function name
+			std::string function;
+			/// Format string
+			std::string format;
+		} decodedFormat;
+
+		/**
+		 * Read record from the log
+		 *
+		 * @param type Record type
+		 * @param payload Record payload
+		 *
+		 * @return True if record was read (false at the end of the log)
+		 */
+		bool readRecord(unsigned char& type, std::string& payload);
+
+		/**
+		 * Read format definition record
+		 *
+		 * @param payload Record payload
+		 */
+		void readFormat(const std::string& payload);
+
+		/**
+		 * Format entry record
+		 *
+		 * @param payload Record payload
+		 *
+		 * @return Text log line
+		 */
+		std::string formatEntry(const std::string& payload) const;
+
+		/**
+		 * Read entry argument as text
+		 *
+		 * @param payload Record payload
+		 * @param pos Argument position (moved to the next argument)
+		 *
+		 * @return Argument text
+		 */
+		static std::string readArg(const std::string& payload, size_t& pos);
+
+		/**
+		 * Read raw value from the payload
+		 *
+		 * @param payload Record payload
+		 * @param pos Value position (moved after value)
+		 * @param val Value
+		 */
+		template <class T>
+		static void readRaw(const std::string& payload, size_t& pos, T& val);
+
+		/// Binary log stream
+		std::istream& in;
+
+		/// Log formats
+		std::map<unsigned int, decodedFormat> formats;
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_LOGGER_BINARYLOGDECODER_H_
@@ -0,0 +1,87 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_LOGGER_BINARYLOGFORMAT_H_
+#define ONH_UTILS_LOGGER_BINARYLOGFORMAT_H_
+
+/// Binary log file header
+#define BINARY_LOG_MAGIC "ONHBLOG1"
+/// Binary log file header length
+#define BINARY_LOG_MAGIC_LENGTH 8
+/// Binary log file extension
+#define BINARY_LOG_EXTENSION ".blog"
+/// Maximum number of log formats
+#define BINARY_LOG_MAX_FORMATS 4096
+
+namespace onh {
+
+/*
+ * Binary log file layout (native byte order):
+ *
+ * file:      BINARY_LOG_MAGIC record...
+ * record:    u8 type, u32 payload length, payload
+ * BLR_FORMAT payload: u32 format id, u8 level, u16 length + function name, u16 length + format
+ * BLR_ENTRY payload:  u64 time (microseconds since epoch), u32 format id, argument...
+ * argument:  u8 type, value (i64, u64, f64, u8 or u16 length + characters)
+ *
+ * Format definition is written to the file before the first entry which uses it.
+ * Entry arguments replace "{}" in the format string.
+ */
+
+/**
+ * Binary log record type
+ */
+typedef enum {
+	BLR_FORMAT = 1,
+	BLR_ENTRY = 2
+} binaryLogRecord;
+
+/**
+ * Binary log argument type
+ */
+typedef enum {
+	BLA_INT = 'i',
+	BLA_UINT = 'u',
+	BLA_REAL = 'd',
+	BLA_BOOL = 'b',
+	BLA_STRING = 's'
+} binaryLogArg;
+
+/**
+ * Binary log level
+ */
+typedef enum {
+	BLL_INFO = 1,
+	BLL_ERROR = 2
+} binaryLogLevel;
+
+/**
+ * Binary log format structure
+ */
+typedef struct {
+	/// Log level
+	binaryLogLevel level;
+	/// Function name
+	const char *function;
+	/// Format string
+	const char *format;
+} binaryLogFormat;
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_LOGGER_BINARYLOGFORMAT_H_
@@ -0,0 +1,95 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BinaryLogger.h"
+#include <string.h>
+#include <ctime>
+
+namespace onh {
+
+/// Registered log formats
+static std::atomic<const binaryLogFormat*> formats[BINARY_LOG_MAX_FORMATS];
+
+/// Number of registered log formats
+static std::atomic<unsigned int> formatsCount(0);
+
+BinaryLogger::BinaryLogger(const std::string& dirName, const std::string& fPrefix):
+	target(std::make_shared<const logTarget>(logTarget{dirName, fPrefix, true})),
+	dirReady(LogWriter::prepareDirectory(dirName)) {
+}
+
+BinaryLogger::~BinaryLogger() {
+}
+
+void BinaryLogger::flush() {
+	LogWriter::getWriter().flush();
+}
+
+std::string BinaryLogger::getLoggerPath() const {
+	std::time_t t = time(nullptr);
+	struct tm now;
+	localtime_r(&t, &now);
+
+	return LogWriter::getFilePath(*target, now);
+}
+
+unsigned int BinaryLogger::addFormat(binaryLogLevel level, const char *function, const char *format) {
+	unsigned int id = formatsCount.fetch_add(1);
+
+	if (id >= BINARY_LOG_MAX_FORMATS)
+		throw Exception("Too many binary log formats", "BinaryLogger::addFormat");
+
+	// Formats live till the application end
+	formats[id].store(new binaryLogFormat{level, function, format}, std::memory_order_release);
+
+	return id;
+}
+
+const binaryLogFormat* BinaryLogger::getFormat(unsigned int formatId) {
+	if (formatId >= BINARY_LOG_MAX_FORMATS)
+		return nullptr;
+
+	return formats[formatId].load(std::memory_order_acquire);
+}
+
+std::string& BinaryLogger::getBuffer() {
+	thread_local std::string buff;
+
+	return buff;
+}
+
+void BinaryLogger::appendString(std::string& buff, const char *str, size_t len) {
+	uint16_t l = (len > UINT16_MAX)?(UINT16_MAX):(len);
+
+	buff += static_cast<char>(BLA_STRING);
+	appendRaw(buff, l);
+	buff.append(str, l);
+}
+
+void BinaryLogger::appendArg(std::string& buff, const std::string& val) {
+	appendString(buff, val.data(), val.length());
+}
+
+void BinaryLogger::appendArg(std::string& buff, const char *val) {
+	if (val)
+		appendString(buff, val, strlen(val));
+	else
+		appendString(buff, "", 0);
+}
+
+}  // namespace onh
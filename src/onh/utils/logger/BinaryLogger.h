@@ -0,0 +1,222 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_LOGGER_BINARYLOGGER_H_
+#define ONH_UTILS_LOGGER_BINARYLOGGER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include "BinaryLogFormat.h"
+#include "LogWriter.h"
+#include "../Exception.h"
+
+namespace onh {
+
+/**
+ * Write binary log entry
+ *
+ * Format is registered once per call site, arguments are stored raw
+ * and formatted by the log decoder tool.
+ */
+#define BLOG_WRITE(logger, level, fmt, ...)											\
+	do {																			\
+		static const unsigned int blogFormatId = onh::BinaryLogger::addFormat(		\
+															level, __FUNCTION__, fmt);	\
+		(logger).log(blogFormatId, ##__VA_ARGS__);									\
+	} while (0)
+
+#define BLOG_INFO(logger, fmt, ...) BLOG_WRITE(logger, onh::BLL_INFO, fmt, ##__VA_ARGS__)
+
+#define BLOG_ERROR(logger, fmt, ...) BLOG_WRITE(logger, onh::BLL_ERROR, fmt, ##__VA_ARGS__)
+
+/**
+ * Binary logger class
+ *
+ * Entries are encoded in the thread local buffer and queued
+ * to the asynchronous log writer.
+ */
+class BinaryLogger {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param dirName Name of the directory where to write log files
+		 * @param fPrefix Log file name prefix
+		 */
+		explicit BinaryLogger(const std::string& dirName, const std::string& fPrefix = "");
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		BinaryLogger(const BinaryLogger&) = delete;
+
+		virtual ~BinaryLogger();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		BinaryLogger& operator=(const BinaryLogger&) = delete;
+
+		/**
+		 * Write entry to the log file (use BLOG_INFO/BLOG_ERROR)
+		 *
+		 * Entry is dropped when the log writer queue is full.
+		 *
+		 * @param formatId Format identifier
+		 * @param args Format arguments
+		 */
+		template <class... Args>
+		void log(unsigned int formatId, const Args&... args);
+
+		/**
+		 * Wait until queued entries are written to the log file
+		 */
+		void flush();
+
+		/**
+		 * Get log file path
+		 *
+		 * @return Log file path
+		 */
+		std::string getLoggerPath() const;
+
+		/**
+		 * Register log format
+		 *
+		 * @param level Log level
+		 * @param function Function name
+		 * @param format Format string
+		 *
+		 * @return Format identifier
+		 */
+		static unsigned int addFormat(binaryLogLevel level, const char *function, const char *format);
+
+		/**
+		 * Get registered log format
+		 *
+		 * @param formatId Format identifier
+		 *
+		 * @return Log format (nullptr if not registered)
+		 */
+		static const binaryLogFormat* getFormat(unsigned int formatId);
+
+	private:
+		/// Log target (directory and file prefix)
+		std::shared_ptr<const logTarget> target;
+
+		/// Flag informs that directory is ready to write
+		bool dirReady;
+
+		/**
+		 * Get thread local entry buffer
+		 *
+		 * @return Entry buffer
+		 */
+		static std::string& getBuffer();
+
+		/**
+		 * Append raw value to the buffer
+		 *
+		 * @param buff Entry buffer
+		 * @param val Value
+		 */
+		template <class T>
+		static void appendRaw(std::string& buff, const T& val);
+
+		/**
+		 * Append argument to the buffer
+		 *
+		 * @param buff Entry buffer
+		 * @param val Argument
+		 */
+		template <class T>
+		static void appendArg(std::string& buff, const T& val);
+
+		/**
+		 * Append string argument to the buffer
+		 *
+		 * @param buff Entry buffer
+		 * @param str String
+		 * @param len String length
+		 */
+		static void appendString(std::string& buff, const char *str, size_t len);
+
+		/**
+		 * Append string argument to the buffer
+		 *
+		 * @param buff Entry buffer
+		 * @param val String
+		 */
+		static void appendArg(std::string& buff, const std::string& val);
+
+		/**
+		 * Append string argument to the buffer
+		 *
+		 * @param buff Entry buffer
+		 * @param val String
+		 */
+		static void appendArg(std::string& buff, const char *val);
+};
+
+template <class... Args>
+void BinaryLogger::log(unsigned int formatId, const Args&... args) {
+	if (!dirReady)
+		throw Exception("Logger error: Log "+target->directoryName+" directory not ready", "BinaryLogger::log");
+
+	std::string& buff = getBuffer();
+
+	buff.clear();
+	appendRaw(buff, static_cast<uint32_t>(formatId));
+	(appendArg(buff, args), ...);
+
+	// Queue log (never blocks)
+	LogWriter::getWriter().write(target, buff);
+}
+
+template <class T>
+void BinaryLogger::appendRaw(std::string& buff, const T& val) {
+	buff.append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <class T>
+void BinaryLogger::appendArg(std::string& buff, const T& val) {
+	if constexpr (std::is_same<T, bool>::value) {
+		buff += static_cast<char>(BLA_BOOL);
+		buff += static_cast<char>(val?1:0);
+	} else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+		buff += static_cast<char>(BLA_INT);
+		appendRaw(buff, static_cast<int64_t>(val));
+	} else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) {
+		buff += static_cast<char>(BLA_UINT);
+		appendRaw(buff, static_cast<uint64_t>(val));
+	} else if constexpr (std::is_floating_point<T>::value) {
+		buff += static_cast<char>(BLA_REAL);
+		appendRaw(buff, static_cast<double>(val));
+	} else if constexpr (std::is_convertible<T, const char*>::value) {
+		appendArg(buff, static_cast<const char*>(val));
+	} else {
+		static_assert(std::is_arithmetic<T>::value, "Not supported binary log argument type");
+	}
+}
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_LOGGER_BINARYLOGGER_H_
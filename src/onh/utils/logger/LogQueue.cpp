@@ -0,0 +1,99 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogQueue.h"
+#include "../Exception.h"
+
+namespace onh {
+
+/// Slot buffer size reserved on start
+static const size_t slotBufferReserve = 128;
+
+/// Slot buffer size kept for next entries
+static const size_t slotBufferKeep = 1024;
+
+LogQueue::LogQueue(unsigned int capacity):
+	mask(capacity - 1), pushPos(0), popPos(0) {
+	if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+		throw Exception("Queue capacity must be a power of two", "LogQueue::LogQueue");
+
+	slots = std::make_unique<slot[]>(capacity);
+
+	for (unsigned long int i = 0; i < capacity; ++i) {
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+		// Producers do not allocate for typical entries
+		slots[i].entry.message.reserve(slotBufferReserve);
+	}
+}
+
+LogQueue::~LogQueue() {
+}
+
+bool LogQueue::push(const struct timeval& time,
+					const std::shared_ptr<const logTarget>& target,
+					const std::string& message) {
+	unsigned long int pos = pushPos.load(std::memory_order_relaxed);
+	slot *s;
+
+	for (;;) {
+		s = &slots[pos & mask];
+		long int diff = static_cast<long int>(s->sequence.load(std::memory_order_acquire)) - static_cast<long int>(pos);
+
+		if (diff == 0) {
+			// Slot free - claim it
+			if (pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		} else if (diff < 0) {
+			// Queue full
+			return false;
+		} else {
+			// Other producer claimed slot
+			pos = pushPos.load(std::memory_order_relaxed);
+		}
+	}
+
+	s->entry.time = time;
+	s->entry.target = target;
+	s->entry.message.assign(message);
+	s->sequence.store(pos + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool LogQueue::pop(logEntry& entry) {
+	slot *s = &slots[popPos & mask];
+
+	// Slot not written yet
+	if (s->sequence.load(std::memory_order_acquire) != popPos + 1)
+		return false;
+
+	entry.time = s->entry.time;
+	entry.target = std::move(s->entry.target);
+	entry.message.assign(s->entry.message);
+
+	// Release big buffer
+	if (s->entry.message.capacity() > slotBufferKeep)
+		std::string().swap(s->entry.message);
+
+	s->sequence.store(popPos + mask + 1, std::memory_order_release);
+	++popPos;
+
+	return true;
+}
+
+}  // namespace onh
@@ -0,0 +1,132 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_LOGGER_LOGQUEUE_H_
+#define ONH_UTILS_LOGGER_LOGQUEUE_H_
+
+#include <sys/time.h>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace onh {
+
+/**
+ * Log target structure
+ */
+typedef struct {
+	/// Logger directory name
+	std::string directoryName;
+	/// Log file name prefix
+	std::string filePrefix;
+	/// Binary log (entries encoded by the binary logger)
+	bool binary;
+} logTarget;
+
+/**
+ * Log entry structure
+ */
+typedef struct {
+	/// Entry time
+	struct timeval time;
+	/// Log target
+	std::shared_ptr<const logTarget> target;
+	/// Log message
+	std::string message;
+} logEntry;
+
+/**
+ * Log queue class
+ *
+ * Bounded lock-free ring with many producers and one consumer.
+ * Every slot has a sequence number which tells producers and consumer
+ * if the slot is free or holds an entry.
+ */
+class LogQueue {
+	public:
+		/**
+		 * Constructor
+		 *
+		 * @param capacity Queue capacity (power of two)
+		 */
+		explicit LogQueue(unsigned int capacity);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		LogQueue(const LogQueue&) = delete;
+
+		virtual ~LogQueue();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		LogQueue& operator=(const LogQueue&) = delete;
+
+		/**
+		 * Put entry to the queue (any thread)
+		 *
+		 * Message is copied to the slot buffer (no allocation
+		 * when slot buffer is big enough).
+		 *
+		 * @param time Entry time
+		 * @param target Log target
+		 * @param message Log message
+		 *
+		 * @return True if entry was queued (false if queue is full)
+		 */
+		bool push(const struct timeval& time,
+					const std::shared_ptr<const logTarget>& target,
+					const std::string& message);
+
+		/**
+		 * Get entry from the queue (consumer thread only)
+		 *
+		 * @param entry Log entry
+		 *
+		 * @return True if entry was taken (false if queue is empty)
+		 */
+		bool pop(logEntry& entry);
+
+	private:
+		/**
+		 * Queue slot structure
+		 */
+		typedef struct {
+			/// Slot sequence number
+			std::atomic<unsigned long int> sequence;
+			/// Slot entry
+			logEntry entry;
+		} slot;
+
+		/// Queue slots
+		std::unique_ptr<slot[]> slots;
+
+		/// Slot index mask
+		unsigned long int mask;
+
+		/// Producers position
+		alignas(64) std::atomic<unsigned long int> pushPos;
+
+		/// Consumer position
+		alignas(64) unsigned long int popPos;
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_LOGGER_LOGQUEUE_H_
@@ -0,0 +1,444 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogWriter.h"
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#include <cstdint>
+#include "BinaryLogger.h"
+
+namespace onh {
+
+/**
+ * Write all buffers to the file
+ *
+ * @param fd File descriptor
+ * @param iov Buffers
+ *
+ * @return True if all buffers were written
+ */
+static bool writeAll(int fd, std::vector<struct iovec>& iov) {
+	struct iovec *v = iov.data();
+	int cnt = iov.size();
+
+	while (cnt > 0) {
+		ssize_t n = writev(fd, v, cnt);
+
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		// Skip written buffers
+		while (cnt > 0 && static_cast<size_t>(n) >= v->iov_len) {
+			n -= v->iov_len;
+			++v;
+			--cnt;
+		}
+
+		// Partially written buffer
+		if (cnt > 0) {
+			v->iov_base = static_cast<char*>(v->iov_base) + n;
+			v->iov_len -= n;
+		}
+	}
+
+	return true;
+}
+
+LogWriter::LogWriter():
+	queue(LOG_WRITER_QUEUE_CAPACITY), queued(0), processed(0), written(0), dropped(0), errors(0),
+	wakeRequest(false), exitFlag(false) {
+	writerThread = std::thread(&LogWriter::run, this);
+}
+
+LogWriter::~LogWriter() {
+	{
+		std::lock_guard<std::mutex> lock(wakeLock);
+		exitFlag = true;
+	}
+	wakeCond.notify_one();
+
+	if (writerThread.joinable())
+		writerThread.join();
+
+	for (auto& f : files)
+		close(f.second.fd);
+}
+
+LogWriter& LogWriter::getWriter() {
+	static LogWriter writer;
+
+	return writer;
+}
+
+bool LogWriter::write(const std::shared_ptr<const logTarget>& target, const std::string& log) {
+	struct timeval time;
+
+	gettimeofday(&time, nullptr);
+
+	if (!queue.push(time, target, log)) {
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	queued.fetch_add(1, std::memory_order_release);
+
+	return true;
+}
+
+void LogWriter::flush() {
+	unsigned long int target = queued.load(std::memory_order_acquire);
+
+	std::unique_lock<std::mutex> lock(wakeLock);
+
+	wakeRequest = true;
+	wakeCond.notify_one();
+
+	flushCond.wait(lock, [this, target] {
+		return processed.load(std::memory_order_acquire) >= target;
+	});
+}
+
+void LogWriter::closeFiles(const std::string& directoryName) {
+	flush();
+
+	std::string dirPath = "logs/" + directoryName + '/';
+
+	std::lock_guard<std::mutex> lock(filesLock);
+
+	for (auto it = files.begin(); it != files.end();) {
+		if (it->first.compare(0, dirPath.length(), dirPath) == 0) {
+			close(it->second.fd);
+			it = files.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+logWriterStats LogWriter::getStats() const {
+	logWriterStats st;
+
+	st.written = written.load(std::memory_order_relaxed);
+	st.dropped = dropped.load(std::memory_order_relaxed);
+	st.errors = errors.load(std::memory_order_relaxed);
+
+	return st;
+}
+
+std::string LogWriter::getFilePath(const logTarget& target, const struct tm& date) {
+	char dt[16];
+	strftime(dt, sizeof(dt), "%Y.%m.%d", &date);
+
+	return "logs/" + target.directoryName + '/' + target.filePrefix + dt +
+			((target.binary)?(BINARY_LOG_EXTENSION):(".log"));
+}
+
+bool LogWriter::prepareDirectory(const std::string& directoryName) {
+	bool createDir = false;
+	bool dirReady = false;
+	std::string tmpDir = "logs/" + directoryName;
+
+	// Create main log directory
+	if (mkdir("logs", S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH)) {
+		if (errno == EEXIST) {
+			createDir = true;
+		}
+	} else {
+		createDir = true;
+	}
+
+	// Create subdirectory
+	if (createDir) {
+		if (mkdir(tmpDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH)) {
+			if (errno == EEXIST) {
+				dirReady = true;
+			}
+		} else {
+			dirReady = true;
+		}
+	}
+
+	return dirReady;
+}
+
+void LogWriter::run() {
+	for (;;) {
+		// More entries waiting - next batch without sleep
+		if (writeBatch() == LOG_WRITER_BATCH)
+			continue;
+
+		std::unique_lock<std::mutex> lock(wakeLock);
+
+		// Exit when all entries are written
+		if (exitFlag && processed.load() == queued.load())
+			break;
+
+		wakeCond.wait_for(lock, std::chrono::milliseconds(LOG_WRITER_INTERVAL), [this] {
+			return wakeRequest || exitFlag;
+		});
+		wakeRequest = false;
+	}
+}
+
+unsigned int LogWriter::writeBatch() {
+	std::vector<logEntry> entries;
+	logEntry entry;
+
+	while (entries.size() < LOG_WRITER_BATCH && queue.pop(entry))
+		entries.push_back(std::move(entry));
+
+	if (entries.empty()) {
+		std::lock_guard<std::mutex> lock(filesLock);
+		closeIdleFiles();
+
+		return 0;
+	}
+
+	// Format lines (timestamp changes once per second)
+	std::vector<std::string> lines(entries.size());
+	std::map<std::string, std::pair<bool, std::vector<const std::string*>>> fileLines;
+	std::time_t lastSec = -1;
+	struct tm date;
+	char ts[32];
+
+	for (unsigned int i = 0; i < entries.size(); ++i) {
+		const logEntry& e = entries[i];
+
+		if (e.time.tv_sec != lastSec) {
+			lastSec = e.time.tv_sec;
+			localtime_r(&lastSec, &date);
+			strftime(ts, sizeof(ts), "%Y-%m-%d %H:%M:%S", &date);
+		}
+
+		if (e.target->binary) {
+			// Binary entry record (message contains format id and arguments)
+			uint32_t len = sizeof(uint64_t) + e.message.length();
+			uint64_t us = static_cast<uint64_t>(e.time.tv_sec) * 1000000 + e.time.tv_usec;
+
+			lines[i].reserve(1 + sizeof(len) + len);
+			lines[i] += static_cast<char>(BLR_ENTRY);
+			lines[i].append(reinterpret_cast<const char*>(&len), sizeof(len));
+			lines[i].append(reinterpret_cast<const char*>(&us), sizeof(us));
+			lines[i] += e.message;
+		} else {
+			lines[i].reserve(e.message.length() + 22);
+			lines[i] += ts;
+			lines[i] += '|';
+			lines[i] += e.message;
+			lines[i] += '\n';
+		}
+
+		auto& fl = fileLines[getFilePath(*e.target, date)];
+		fl.first = e.target->binary;
+		fl.second.push_back(&lines[i]);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(filesLock);
+
+		for (const auto& fl : fileLines)
+			writeFile(fl.first, fl.second.second, fl.second.first);
+
+		closeIdleFiles();
+	}
+
+	// Inform waiting flush
+	processed.fetch_add(entries.size(), std::memory_order_release);
+	{
+		std::lock_guard<std::mutex> lock(wakeLock);
+	}
+	flushCond.notify_all();
+
+	return entries.size();
+}
+
+void LogWriter::writeFile(const std::string& path, const std::vector<const std::string*>& lines, bool binary) {
+	openFile *f = getFile(path);
+
+	if (!f) {
+		errors.fetch_add(lines.size(), std::memory_order_relaxed);
+		return;
+	}
+
+	std::vector<const std::string*> binLines;
+	std::deque<std::string> extra;
+
+	if (binary)
+		prepareBinaryRecords(*f, lines, binLines, extra);
+
+	const std::vector<const std::string*>& out = (binary)?(binLines):(lines);
+	unsigned int i = 0;
+
+	while (i < out.size()) {
+		std::vector<struct iovec> iov;
+		unsigned long int len = 0;
+		unsigned int entriesCnt = 0;
+
+		for (; i < out.size() && iov.size() < IOV_MAX; ++i) {
+			iov.push_back({const_cast<char*>(out[i]->data()), out[i]->length()});
+			len += out[i]->length();
+
+			// Do not count file header and format definitions
+			if (!binary || (*out[i])[0] == BLR_ENTRY)
+				entriesCnt++;
+		}
+
+		if (writeAll(f->fd, iov)) {
+			written.fetch_add(entriesCnt, std::memory_order_relaxed);
+			f->size += len;
+		} else {
+			errors.fetch_add(entriesCnt, std::memory_order_relaxed);
+		}
+	}
+
+	f->lastUse = time(nullptr);
+
+	if (f->size >= LOG_FILE_MAX_SIZE)
+		rotateFile(path);
+}
+
+void LogWriter::prepareBinaryRecords(openFile& f,
+										const std::vector<const std::string*>& lines,
+										std::vector<const std::string*>& out,
+										std::deque<std::string>& extra) {
+	// New file - header
+	if (f.size == 0 && f.formats.empty()) {
+		extra.push_back(std::string(BINARY_LOG_MAGIC, BINARY_LOG_MAGIC_LENGTH));
+		out.push_back(&extra.back());
+	}
+
+	// Format identifier offset in the entry record
+	const size_t idPos = 1 + sizeof(uint32_t) + sizeof(uint64_t);
+
+	for (const std::string* ln : lines) {
+		uint32_t id;
+		ln->copy(reinterpret_cast<char*>(&id), sizeof(id), idPos);
+
+		if (id >= f.formats.size())
+			f.formats.resize(id + 1, false);
+
+		// Format definition before first entry
+		if (!f.formats[id]) {
+			const binaryLogFormat *fmt = BinaryLogger::getFormat(id);
+
+			if (fmt) {
+				uint16_t fnLen = strlen(fmt->function);
+				uint16_t fmtLen = strlen(fmt->format);
+				uint32_t len = sizeof(id) + 1 + sizeof(fnLen) + fnLen + sizeof(fmtLen) + fmtLen;
+				std::string rec;
+
+				rec += static_cast<char>(BLR_FORMAT);
+				rec.append(reinterpret_cast<const char*>(&len), sizeof(len));
+				rec.append(reinterpret_cast<const char*>(&id), sizeof(id));
+				rec += static_cast<char>(fmt->level);
+				rec.append(reinterpret_cast<const char*>(&fnLen), sizeof(fnLen));
+				rec.append(fmt->function, fnLen);
+				rec.append(reinterpret_cast<const char*>(&fmtLen), sizeof(fmtLen));
+				rec.append(fmt->format, fmtLen);
+
+				extra.push_back(std::move(rec));
+				out.push_back(&extra.back());
+			}
+
+			f.formats[id] = true;
+		}
+
+		out.push_back(ln);
+	}
+}
+
+LogWriter::openFile* LogWriter::getFile(const std::string& path) {
+	auto it = files.find(path);
+	struct stat st;
+
+	if (it != files.end()) {
+		// File removed - open new one
+		if (fstat(it->second.fd, &st) == 0 && st.st_nlink > 0)
+			return &it->second;
+
+		close(it->second.fd);
+		files.erase(it);
+	}
+
+	int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	if (fd < 0)
+		return nullptr;
+
+	unsigned long int size = (fstat(fd, &st) == 0)?(st.st_size):(0);
+
+	openFile f;
+	f.fd = fd;
+	f.size = size;
+	f.lastUse = time(nullptr);
+
+	return &files.insert(std::pair<std::string, openFile>(path, f)).first->second;
+}
+
+void LogWriter::rotateFile(const std::string& path) {
+	auto it = files.find(path);
+
+	if (it != files.end()) {
+		close(it->second.fd);
+		files.erase(it);
+	}
+
+	// File extension is kept (text and binary logs)
+	std::string base = path;
+	std::string ext;
+	size_t dot = path.rfind('.');
+	size_t slash = path.rfind('/');
+
+	if (dot != std::string::npos && (slash == std::string::npos || dot > slash)) {
+		base = path.substr(0, dot);
+		ext = path.substr(dot);
+	}
+
+	// Next free file name
+	std::string newPath;
+	unsigned int n = 1;
+
+	do {
+		newPath = base + '_' + std::to_string(n++) + ext;
+	} while (access(newPath.c_str(), F_OK) == 0);
+
+	rename(path.c_str(), newPath.c_str());
+}
+
+void LogWriter::closeIdleFiles() {
+	std::time_t now = time(nullptr);
+
+	for (auto it = files.begin(); it != files.end();) {
+		if (now - it->second.lastUse >= LOG_FILE_IDLE_CLOSE) {
+			close(it->second.fd);
+			it = files.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+}  // namespace onh
@@ -0,0 +1,256 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ONH_UTILS_LOGGER_LOGWRITER_H_
+#define ONH_UTILS_LOGGER_LOGWRITER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "LogQueue.h"
+
+/// Log queue capacity (entries)
+#define LOG_WRITER_QUEUE_CAPACITY 8192
+/// Maximum number of entries written in one batch
+#define LOG_WRITER_BATCH 1024
+/// Writer thread wake-up interval (ms)
+#define LOG_WRITER_INTERVAL 20
+/// Log file size which starts new file (bytes)
+#define LOG_FILE_MAX_SIZE (10*1024*1024)
+/// Time after which not used log file is closed (s)
+#define LOG_FILE_IDLE_CLOSE 10
+
+namespace onh {
+
+/**
+ * Log writer statistics structure
+ */
+typedef struct {
+	/// Number of written entries
+	unsigned long int written;
+	/// Number of entries dropped because of full queue
+	unsigned long int dropped;
+	/// Number of entries not written because of file errors
+	unsigned long int errors;
+} logWriterStats;
+
+/**
+ * Log writer class
+ *
+ * Asynchronous backend of the text loggers. Logger threads put entries
+ * to the lock-free queue (entry is dropped when the queue is full) and one
+ * background thread formats them and writes batches to the log files.
+ */
+class LogWriter {
+	public:
+		/**
+		 * Copy constructor - inactive
+		 */
+		LogWriter(const LogWriter&) = delete;
+
+		virtual ~LogWriter();
+
+		/**
+		 * Assign operator - inactive
+		 */
+		LogWriter& operator=(const LogWriter&) = delete;
+
+		/**
+		 * Get log writer of the application
+		 *
+		 * @return Log writer
+		 */
+		static LogWriter& getWriter();
+
+		/**
+		 * Put log entry to the queue (never blocks)
+		 *
+		 * @param target Log target
+		 * @param log String with information to write
+		 *
+		 * @return True if entry was queued (false if dropped)
+		 */
+		bool write(const std::shared_ptr<const logTarget>& target, const std::string& log);
+
+		/**
+		 * Wait until all queued entries are written
+		 */
+		void flush();
+
+		/**
+		 * Close log files of the directory
+		 *
+		 * Queued entries are written before closing.
+		 *
+		 * @param directoryName Logger directory name
+		 */
+		void closeFiles(const std::string& directoryName);
+
+		/**
+		 * Get log writer statistics
+		 *
+		 * @return Log writer statistics
+		 */
+		logWriterStats getStats() const;
+
+		/**
+		 * Get log file path
+		 *
+		 * @param target Log target
+		 * @param date Log date
+		 *
+		 * @return Log file path
+		 */
+		static std::string getFilePath(const logTarget& target, const struct tm& date);
+
+		/**
+		 * Create log directory
+		 *
+		 * @param directoryName Logger directory name
+		 *
+		 * @return True if directory is ready to write
+		 */
+		static bool prepareDirectory(const std::string& directoryName);
+
+	private:
+		/**
+		 * Constructor
+		 */
+		LogWriter();
+
+		/**
+		 * Open log file structure
+		 */
+		typedef struct {
+			/// File descriptor
+			int fd;
+			/// File size
+			unsigned long int size;
+			/// Last write time
+			std::time_t lastUse;
+			/// Binary log formats written to the file
+			std::vector<bool> formats;
+		} openFile;
+
+		/**
+		 * Writer thread main loop
+		 */
+		void run();
+
+		/**
+		 * Write entries from the queue
+		 *
+		 * @return Number of entries taken from the queue
+		 */
+		unsigned int writeBatch();
+
+		/**
+		 * Write lines to the log file
+		 *
+		 * @param path Log file path
+		 * @param lines Log lines (binary log records)
+		 * @param binary Binary log file
+		 */
+		void writeFile(const std::string& path, const std::vector<const std::string*>& lines, bool binary);
+
+		/**
+		 * Prepare binary log records which must precede entries in the file
+		 * (file header and not written format definitions)
+		 *
+		 * @param f Open file
+		 * @param lines Binary log records
+		 * @param out Records to write
+		 * @param extra Storage for added records
+		 */
+		void prepareBinaryRecords(openFile& f,
+									const std::vector<const std::string*>& lines,
+									std::vector<const std::string*>& out,
+									std::deque<std::string>& extra);
+
+		/**
+		 * Get open log file
+		 *
+		 * @param path Log file path
+		 *
+		 * @return Open file (nullptr if file can not be opened)
+		 */
+		openFile* getFile(const std::string& path);
+
+		/**
+		 * Move full log file to the next free name
+		 *
+		 * @param path Log file path
+		 */
+		void rotateFile(const std::string& path);
+
+		/**
+		 * Close log files not used for LOG_FILE_IDLE_CLOSE seconds
+		 */
+		void closeIdleFiles();
+
+		/// Log entries queue
+		LogQueue queue;
+
+		/// Open log files (writer thread)
+		std::map<std::string, openFile> files;
+
+		/// Open log files lock
+		std::mutex filesLock;
+
+		/// Number of queued entries
+		std::atomic<unsigned long int> queued;
+
+		/// Number of entries taken from the queue
+		std::atomic<unsigned long int> processed;
+
+		/// Number of written entries
+		std::atomic<unsigned long int> written;
+
+		/// Number of dropped entries
+		std::atomic<unsigned long int> dropped;
+
+		/// Number of not written entries
+		std::atomic<unsigned long int> errors;
+
+		/// Writer thread wake-up and flush lock
+		std::mutex wakeLock;
+
+		/// Writer thread wake-up condition
+		std::condition_variable wakeCond;
+
+		/// Flush finished condition
+		std::condition_variable flushCond;
+
+		/// Writer thread wake-up request
+		bool wakeRequest;
+
+		/// Writer thread exit flag
+		bool exitFlag;
+
+		/// Writer thread
+		std::thread writerThread;
+};
+
+}  // namespace onh
+
+#endif  // ONH_UTILS_LOGGER_LOGWRITER_H_
@@ -17,105 +17,27 @@
  */
 
 #include "TextLogger.h"
-#include <sys/stat.h>
-#include <errno.h>
-#include <sstream>
-#include "../DateUtils.h"
+#include <ctime>
+#include <fstream>
 
 namespace onh {
 
 TextLogger::TextLogger(const std::string& dirName, const std::string& fPrefix):
-	directoryName(dirName), filePrefix(fPrefix), dirReady(false), logFileName(""), filePath("") {
-	bool createDir = false;
-	std::string tmpDir = "logs/" + dirName;
-
-	// Create main log directory
-	if (mkdir("logs", S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH)) {
-		if (errno == EEXIST) {
-			createDir = true;
-		}
-	} else {
-		createDir = true;
-	}
-
-	// Create subdirectory
-	if (createDir) {
-		if (mkdir(tmpDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH)) {
-			if (errno == EEXIST) {
-				dirReady = true;
-			}
-		} else {
-			dirReady = true;
-		}
-	}
+	target(std::make_shared<const logTarget>(logTarget{dirName, fPrefix, false})),
+	dirReady(LogWriter::prepareDirectory(dirName)) {
 }
 
 TextLogger::~TextLogger() {
-	if (logFile.is_open()) {
-		logFile.close();
-	}
-}
-
-std::string TextLogger::generateFileName() {
-	std::stringstream s;
-
-	// File prefix
-	if (filePrefix != "")
-		s << filePrefix;
-
-	// Current date
-	s << DateUtils::getDate('.');
-
-	return s.str();
-}
-
-void TextLogger::checkFiles() {
-	// Temporary file name
-	std::string tmpFileName = generateFileName();
-
-	// Path to the log file
-	filePath = "logs/" + directoryName + '/' + tmpFileName + ".log";
-
-	// Check if file is already opened
-	if (logFile.is_open()) {
-		// Check file names
-		if (tmpFileName != logFileName) {
-			// Close current file
-			logFile.close();
-
-			// Open new file
-			logFile.open(filePath.c_str(), std::ios::out | std::ios::app);
-
-			logFileName = tmpFileName;
-		}
-	} else {
-		// Open new file
-		logFile.open(filePath.c_str(), std::ios::out | std::ios::app);
-
-		logFileName = tmpFileName;
-	}
-
-	if (!logFile.is_open()) {
-		std::string s = "Logger error: Log "+filePath+" not opened";
-		throw Exception(s, "TextLogger::checkFiles");
-	}
 }
 
 void TextLogger::write(const std::string& log) {
 	if (!dirReady) {
-		std::string s = "Logger error: Log "+directoryName+" directory not ready";
+		std::string s = "Logger error: Log "+target->directoryName+" directory not ready";
 		throw Exception(s, "TextLogger::write");
 	}
 
-	// Entry timestamp
-	std::string ts = DateUtils::getTimestampString();
-
-	// Check log files
-	checkFiles();
-
-	// Write log
-	logFile << ts << '|' << log << std::endl;
-	logFile.close();
+	// Queue log (never blocks)
+	LogWriter::getWriter().write(target, log);
 }
 
 void TextLogger::operator<<(const std::string& log) {
@@ -123,13 +45,11 @@ void TextLogger::operator<<(const std::string& log) {
 }
 
 void TextLogger::clear() {
-	// Check if file is already opened
-	if (logFile.is_open()) {
-		logFile.close();
-	}
+	// Write queued entries and close files
+	LogWriter::getWriter().closeFiles(target->directoryName);
 
 	// Path to the logs
-	std::string filePath = "logs/" + directoryName + "/*.log";
+	std::string filePath = "logs/" + target->directoryName + "/*.log";
 	// Prepare remove command
 	std::string cmd = "rm "+filePath;
 
@@ -137,11 +57,24 @@ void TextLogger::clear() {
 	system(cmd.c_str());
 
 	// Open blank file
-	checkFiles();
+	std::ofstream logFile(getLoggerPath().c_str(), std::ios::out | std::ios::app);
+
+	if (!logFile.is_open()) {
+		std::string s = "Logger error: Log "+getLoggerPath()+" not opened";
+		throw Exception(s, "TextLogger::clear");
+	}
+}
+
+void TextLogger::flush() {
+	LogWriter::getWriter().flush();
 }
 
 std::string TextLogger::getLoggerPath() const {
-	return filePath;
+	std::time_t t = time(nullptr);
+	struct tm now;
+	localtime_r(&t, &now);
+
+	return LogWriter::getFilePath(*target, now);
 }
 
 }  // namespace onh
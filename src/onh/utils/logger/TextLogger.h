@@ -20,14 +20,18 @@
 #define ONH_UTILS_LOGGER_TEXTLOGGER_H_
 
 #include <string>
-#include <fstream>
+#include <memory>
 #include "ILogger.h"
+#include "LogWriter.h"
 #include "../Exception.h"
 
 namespace onh {
 
 /**
  * TextLogger class
+ *
+ * Entries are queued to the asynchronous log writer and written
+ * to the files by the writer thread.
  */
 class TextLogger: public ILogger {
 	public:
@@ -54,6 +58,8 @@ class TextLogger: public ILogger {
 		/**
 		 * Write to the log file
 		 *
+		 * Entry is dropped when the log writer queue is full.
+		 *
 		 * @param log String with information to write
 		 */
 		void write(const std::string& log) override;
@@ -77,36 +83,17 @@ class TextLogger: public ILogger {
 		 */
 		void clear();
 
-	private:
-		/// Logger directory name
-		std::string directoryName;
+		/**
+		 * Wait until queued entries are written to the log file
+		 */
+		void flush();
 
-		/// Log file name prefix
-		std::string filePrefix;
+	private:
+		/// Log target (directory and file prefix)
+		std::shared_ptr<const logTarget> target;
 
 		/// Flag informs that directory is ready to write
 		bool dirReady;
-
-		/// Logger file handle
-		std::ofstream logFile;
-
-		/// Log file name
-		std::string logFileName;
-
-		/// Path to the log file
-		std::string filePath;
-
-		/**
-		 * Generate file name based on current date
-		 *
-		 * @return String with file name
-		 */
-		std::string generateFileName();
-
-		/**
-		 * Check log file names (create new log file when date changes)
-		 */
-		void checkFiles();
 };
 
 }  // namespace onh
@@ -0,0 +1,46 @@
+# Source files
+
+# Benchmark files
+target_sources(${PROJECT_NAME} PRIVATE
+    "src/onh_benchmark.cpp"
+	"src/benchmarks/BenchmarkUtils.h"
+	"src/benchmarks/parser/ParserBenchmark.h"
+	"src/benchmarks/driver/ConnectionTableBenchmark.h"
+	"src/benchmarks/logger/LoggerBenchmark.h"
+	"src/benchmarks/script/ScriptBenchmark.h"
+)
+
+# Program files to benchmark
+target_sources(${PROJECT_NAME} PRIVATE
+    "../../src/onh/utils/Exception.h"
+	"../../src/onh/utils/Exception.cpp"
+	"../../src/onh/utils/StringUtils.h"
+	"../../src/onh/utils/StringUtils.cpp"
+	"../../src/onh/parser/CommandList.h"
+	"../../src/onh/parser/CommandParserException.h"
+	"../../src/onh/parser/CommandParserException.cpp"
+	"../../src/onh/parser/CommandTokenizer.h"
+	"../../src/onh/parser/CommandTokenizer.cpp"
+	"../../src/onh/driver/ConnectionTable.h"
+	"../../src/onh/driver/DriverRegisterTypes.h"
+	"../../src/onh/driver/ProcessDataTypes.h"
+	"../../src/onh/driver/DriverProcessReader.h"
+	"../../src/onh/driver/DriverProcessReader.cpp"
+	"../../src/onh/utils/logger/ILogger.h"
+	"../../src/onh/utils/logger/LogQueue.h"
+	"../../src/onh/utils/logger/LogQueue.cpp"
+	"../../src/onh/utils/logger/LogWriter.h"
+	"../../src/onh/utils/logger/LogWriter.cpp"
+	"../../src/onh/utils/logger/TextLogger.h"
+	"../../src/onh/utils/logger/TextLogger.cpp"
+	"../../src/onh/utils/logger/BinaryLogFormat.h"
+	"../../src/onh/utils/logger/BinaryLogger.h"
+	"../../src/onh/utils/logger/BinaryLogger.cpp"
+	"../../src/onh/thread/Script/ScriptBytecode.h"
+	"../../src/onh/thread/Script/ScriptCompiler.h"
+	"../../src/onh/thread/Script/ScriptCompiler.cpp"
+	"../../src/onh/thread/Script/ScriptVM.h"
+	"../../src/onh/thread/Script/ScriptVM.cpp"
+	"../../src/onh/thread/Script/ScriptExecutor.h"
+	"../../src/onh/thread/Script/ScriptExecutor.cpp"
+)
@@ -0,0 +1,84 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_BENCHMARKUTILS_H_
+#define BENCHMARKS_BENCHMARKUTILS_H_
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/// Heap allocations counter of the thread (incremented by the global operator new)
+extern thread_local unsigned long int benchmarkAllocations;
+
+/**
+ * Benchmark result structure
+ */
+typedef struct {
+	/// Operations per second
+	double opsPerSec;
+	/// Heap allocations per operation (benchmark thread only)
+	double allocPerOp;
+} benchmarkResult;
+
+/**
+ * Run benchmark function
+ *
+ * @param iterations Number of iterations
+ * @param fn Benchmarked function
+ *
+ * @return Benchmark result
+ */
+inline benchmarkResult runBenchmark(unsigned long int iterations, const std::function<void()>& fn) {
+	// Warm up
+	for (unsigned long int i = 0; i < iterations/10; ++i)
+		fn();
+
+	unsigned long int allocStart = benchmarkAllocations;
+	auto timeStart = std::chrono::steady_clock::now();
+
+	for (unsigned long int i = 0; i < iterations; ++i)
+		fn();
+
+	auto timeStop = std::chrono::steady_clock::now();
+	unsigned long int allocStop = benchmarkAllocations;
+
+	std::chrono::duration<double> elapsed = timeStop - timeStart;
+
+	benchmarkResult res;
+	res.opsPerSec = (elapsed.count() > 0)?(iterations / elapsed.count()):(0);
+	res.allocPerOp = static_cast<double>(allocStop - allocStart) / iterations;
+
+	return res;
+}
+
+/**
+ * Print benchmark result
+ *
+ * @param name Benchmark name
+ * @param res Benchmark result
+ */
+inline void printBenchmark(const std::string& name, const benchmarkResult& res) {
+	std::cout << std::left << std::setw(40) << name
+				<< std::right << std::setw(14) << std::fixed << std::setprecision(0) << res.opsPerSec << " ops/s"
+				<< std::setw(10) << std::setprecision(2) << res.allocPerOp << " alloc/op" << std::endl;
+}
+
+#endif  // BENCHMARKS_BENCHMARKUTILS_H_
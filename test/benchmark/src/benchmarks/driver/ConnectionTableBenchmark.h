@@ -0,0 +1,151 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_DRIVER_CONNECTIONTABLEBENCHMARK_H_
+#define BENCHMARKS_DRIVER_CONNECTIONTABLEBENCHMARK_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <driver/ConnectionTable.h>
+#include <driver/DriverProcessReader.h>
+#include "../BenchmarkUtils.h"
+
+/// Volatile sink preventing the optimizer from removing benchmarked code
+static volatile BYTE connectionBenchmarkSink = 0;
+
+/**
+ * Driver process reader used by connection benchmarks (in-memory process data)
+ */
+class BenchmarkProcessReader: public onh::DriverProcessReader {
+	public:
+		BenchmarkProcessReader():
+			data(256, 1) {
+		}
+
+		bool getBitValue(onh::processDataAddress addr) override {
+			return data[addr.byteAddr] & (1 << addr.bitAddr);
+		}
+
+		std::vector<bool> getBitsValue(const std::vector<onh::processDataAddress>& addr) override {
+			std::vector<bool> ret;
+			for (const onh::processDataAddress& a : addr)
+				ret.push_back(getBitValue(a));
+			return ret;
+		}
+
+		BYTE getByte(onh::processDataAddress addr) override {
+			return data[addr.byteAddr];
+		}
+
+		WORD getWord(onh::processDataAddress addr) override {
+			return data[addr.byteAddr];
+		}
+
+		DWORD getDWord(onh::processDataAddress addr) override {
+			return data[addr.byteAddr];
+		}
+
+		int getInt(onh::processDataAddress addr) override {
+			return data[addr.byteAddr];
+		}
+
+		float getReal(onh::processDataAddress addr) override {
+			return data[addr.byteAddr];
+		}
+
+		const BYTE* const* getDataSlot(onh::processDataAddress addr, unsigned int byteCount) override {
+			slot = data.data();
+			return &slot;
+		}
+
+		void updateProcessData() override {
+		}
+
+		std::unique_ptr<onh::DriverProcessReader> createNew() override {
+			return std::make_unique<BenchmarkProcessReader>();
+		}
+
+	private:
+		/// Process data
+		std::vector<BYTE> data;
+
+		/// Process data slot
+		const BYTE *slot;
+};
+
+/**
+ * Benchmark tag structure
+ */
+typedef struct {
+	/// Driver connection identifier
+	unsigned int connId;
+	/// Connection table slot (resolved on load)
+	unsigned int slot;
+	/// Process data address
+	onh::processDataAddress addr;
+} benchmarkTag;
+
+/**
+ * Run driver connection routing benchmarks (one byte read per operation)
+ *
+ * @param iterations Number of iterations
+ */
+inline void connectionTableBenchmark(unsigned long int iterations) {
+	std::cout << "Driver connection routing benchmark (" << iterations << " iterations)" << std::endl;
+
+	for (unsigned int connCount : {1, 8, 64}) {
+		std::map<unsigned int, onh::DriverProcessReaderPtr> readerMap;
+		onh::ConnectionTable<onh::DriverProcessReaderPtr> readerTable;
+
+		// Connection identifiers are not contiguous (database ids)
+		for (unsigned int i = 0; i < connCount; ++i) {
+			unsigned int id = 3*i+1;
+			readerMap.insert(std::pair<unsigned int, onh::DriverProcessReaderPtr>(id, std::make_unique<BenchmarkProcessReader>()));
+			readerTable.insert(std::pair<unsigned int, onh::DriverProcessReaderPtr>(id, std::make_unique<BenchmarkProcessReader>()));
+		}
+
+		// Tags spread over all connections
+		std::vector<benchmarkTag> tags;
+		for (unsigned int i = 0; i < 1024; ++i) {
+			unsigned int id = 3*((i*7) % connCount)+1;
+			tags.push_back({id, readerTable.getSlot(id), {onh::PDA_INPUT, i % 256, 0}});
+		}
+
+		unsigned int mapPos = 0;
+		unsigned int tablePos = 0;
+		unsigned int slotPos = 0;
+		std::string suffix = " ("+std::to_string(connCount)+" connections)";
+
+		printBenchmark("std::map read"+suffix, runBenchmark(iterations, [&]() {
+			const benchmarkTag& tg = tags[mapPos++ % tags.size()];
+			connectionBenchmarkSink = readerMap.at(tg.connId)->getByte(tg.addr);
+		}));
+		printBenchmark("connection table read"+suffix, runBenchmark(iterations, [&]() {
+			const benchmarkTag& tg = tags[tablePos++ % tags.size()];
+			connectionBenchmarkSink = (*readerTable.get(tg.connId))->getByte(tg.addr);
+		}));
+		printBenchmark("connection table slot read"+suffix, runBenchmark(iterations, [&]() {
+			const benchmarkTag& tg = tags[slotPos++ % tags.size()];
+			connectionBenchmarkSink = readerTable.atSlot(tg.slot)->getByte(tg.addr);
+		}));
+	}
+}
+
+#endif  // BENCHMARKS_DRIVER_CONNECTIONTABLEBENCHMARK_H_
@@ -0,0 +1,77 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_LOGGER_LOGGERBENCHMARK_H_
+#define BENCHMARKS_LOGGER_LOGGERBENCHMARK_H_
+
+#include <sys/stat.h>
+#include <algorithm>
+#include <string>
+#include <utils/logger/TextLogger.h>
+#include <utils/logger/BinaryLogger.h>
+#include "../BenchmarkUtils.h"
+
+/**
+ * Get file size
+ *
+ * @param path File path
+ *
+ * @return File size (bytes)
+ */
+inline unsigned long int loggerBenchmarkFileSize(const std::string& path) {
+	struct stat st;
+
+	return (stat(path.c_str(), &st) == 0)?(st.st_size):(0);
+}
+
+/**
+ * Run text and binary logger benchmarks (one error entry per operation)
+ *
+ * @param iterations Number of iterations
+ */
+inline void loggerBenchmark(unsigned long int iterations) {
+	// Stay below queue capacity (entries over capacity are dropped)
+	unsigned long int cnt = std::min(iterations, static_cast<unsigned long int>(LOG_WRITER_QUEUE_CAPACITY/2));
+
+	std::cout << "Logger benchmark (" << cnt << " iterations)" << std::endl;
+
+	system("rm -r -f logs/benchmark");
+
+	onh::TextLogger textLog("benchmark", "text_");
+	onh::BinaryLogger binLog("benchmark", "bin_");
+	std::string fName = "ModbusUpdater::updateBuffer";
+	std::string msg = "Connection timed out";
+	unsigned int connId = 1;
+
+	printBenchmark("text logger error", runBenchmark(cnt, [&]() {
+		textLog << LOG_ERROR(fName << ": " << msg << " (connection " << connId << ")");
+	}));
+	textLog.flush();
+
+	printBenchmark("binary logger error", runBenchmark(cnt, [&]() {
+		BLOG_ERROR(binLog, "{}: {} (connection {})", fName, msg, connId);
+	}));
+	binLog.flush();
+
+	std::cout << "text log size: " << loggerBenchmarkFileSize(textLog.getLoggerPath()) << " B, ";
+	std::cout << "binary log size: " << loggerBenchmarkFileSize(binLog.getLoggerPath()) << " B" << std::endl;
+
+	system("rm -r -f logs/benchmark");
+}
+
+#endif  // BENCHMARKS_LOGGER_LOGGERBENCHMARK_H_
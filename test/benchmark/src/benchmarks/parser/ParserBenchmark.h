@@ -0,0 +1,106 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_PARSER_PARSERBENCHMARK_H_
+#define BENCHMARKS_PARSER_PARSERBENCHMARK_H_
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <parser/CommandList.h>
+#include <parser/CommandTokenizer.h>
+#include <utils/StringUtils.h>
+#include "../BenchmarkUtils.h"
+
+/// Volatile sink preventing the optimizer from removing benchmarked code
+static volatile int parserBenchmarkSink = 0;
+
+/**
+ * Command parsing with explode (previous parser implementation)
+ *
+ * @param query Query string
+ */
+inline void parserExplode(const std::string& query) {
+	std::vector<std::string> v = onh::StringUtils::explode(query, CMD_SEPARATOR);
+
+	int val = 0;
+	std::istringstream iss(v[0]);
+	iss >> val;
+
+	if (val == onh::MULTI_CMD) {
+		std::vector<std::string> cmds = onh::StringUtils::explode(v[1], CMD_MULTI_SEPARATOR);
+
+		for (const std::string& c : cmds) {
+			std::string cmd = onh::StringUtils::replaceChar(c, CMD_MULTI_VALUE_SEPARATOR, CMD_SEPARATOR);
+			std::vector<std::string> cv = onh::StringUtils::explode(cmd, CMD_SEPARATOR);
+
+			int cval = 0;
+			std::istringstream ciss(cv[0]);
+			ciss >> cval;
+
+			parserBenchmarkSink = cval + cv[1].length();
+		}
+	} else {
+		parserBenchmarkSink = val + v[1].length();
+	}
+}
+
+/**
+ * Command parsing with tokenizer (string views)
+ *
+ * @param query Query string
+ */
+inline void parserTokenizer(const std::string& query) {
+	onh::commandTokens ct = onh::CommandTokenizer::split(query, CMD_SEPARATOR);
+
+	if (ct.command == onh::MULTI_CMD) {
+		std::string_view cmds = ct.data;
+
+		while (!cmds.empty()) {
+			std::string_view cmd = onh::CommandTokenizer::nextToken(cmds, CMD_MULTI_SEPARATOR);
+			onh::commandTokens cct = onh::CommandTokenizer::split(cmd, CMD_MULTI_VALUE_SEPARATOR);
+
+			parserBenchmarkSink = cct.command + cct.data.length();
+		}
+	} else {
+		parserBenchmarkSink = ct.command + ct.data.length();
+	}
+}
+
+/**
+ * Run parser benchmarks
+ *
+ * @param iterations Number of iterations
+ */
+inline void parserBenchmark(unsigned long int iterations) {
+	const std::vector<std::pair<std::string, std::string>> queries = {
+		{"GET_BIT", "10|TEST_BIT_TAG_1"},
+		{"WRITE_INT", "37|TEST_INT_TAG_NUMBER_1,-12345"},
+		{"MULTI_CMD", "50|10?TEST_BIT_TAG_1!36?TEST_INT_TAG_1!38?TEST_REAL_TAG_1!39?TEST_REAL_TAG_2,12.5"}
+	};
+
+	std::cout << "Parser benchmark (" << iterations << " iterations)" << std::endl;
+
+	for (const auto& q : queries) {
+		printBenchmark("explode: "+q.first, runBenchmark(iterations, [&q]() { parserExplode(q.second); }));
+		printBenchmark("tokenizer: "+q.first, runBenchmark(iterations, [&q]() { parserTokenizer(q.second); }));
+	}
+}
+
+#endif  // BENCHMARKS_PARSER_PARSERBENCHMARK_H_
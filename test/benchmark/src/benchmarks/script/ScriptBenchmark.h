@@ -0,0 +1,102 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_SCRIPT_SCRIPTBENCHMARK_H_
+#define BENCHMARKS_SCRIPT_SCRIPTBENCHMARK_H_
+
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <thread/Script/ScriptCompiler.h>
+#include <thread/Script/ScriptVM.h>
+#include <thread/Script/ScriptExecutor.h>
+#include "../BenchmarkUtils.h"
+
+/**
+ * Benchmark script host (tags stored in memory)
+ */
+class BenchmarkScriptHost: public onh::ScriptHost {
+	public:
+		explicit BenchmarkScriptHost(unsigned int tagsCount):
+			tags(tagsCount, 0.0) {
+		}
+
+		double readTag(unsigned int idx) override {
+			return tags[idx];
+		}
+
+		void writeTag(unsigned int idx, double val) override {
+			tags[idx] = val;
+		}
+
+		void print(double) override {
+		}
+
+		/// Tag values
+		std::vector<double> tags;
+};
+
+/**
+ * Run embedded script engine and external script runner benchmarks (one interlock script run per operation)
+ *
+ * @param iterations Number of iterations
+ */
+inline void scriptBenchmark(unsigned long int iterations) {
+	// External scripts are slow - limit iterations
+	unsigned long int extCnt = std::min(iterations, 200ul);
+
+	std::cout << "Script benchmark (" << iterations << " embedded, " << extCnt << " external iterations)" << std::endl;
+
+	// Embedded script
+	onh::ScriptBytecodePtr bc = onh::ScriptCompiler::compile(
+		"if $Start and not $Stop then $Motor = 1 else $Motor = 0 end\n"
+		"$Speed = min($Speed + 1, 100)\n");
+
+	onh::ScriptVM vm;
+	BenchmarkScriptHost host(bc->tags.size());
+	host.tags[0] = 1;
+
+	printBenchmark("embedded script run", runBenchmark(iterations, [&]() {
+		vm.run(*bc, host, {SCRIPT_VM_TIME_CHECK*4, 0});
+	}));
+
+	// External script (same logic)
+	std::string scriptPath = "/tmp/onh_benchmark_script.sh";
+	std::ofstream f(scriptPath);
+	f << "#!/bin/sh\nSTART=1\nSTOP=0\nif [ $START -eq 1 ] && [ $STOP -eq 0 ]; then MOTOR=1; else MOTOR=0; fi\n";
+	f.close();
+	chmod(scriptPath.c_str(), S_IRWXU);
+
+	onh::ScriptExecutor ex(1, 0);
+
+	printBenchmark("external script run", runBenchmark(extCnt, [&]() {
+		ex.run(1, scriptPath, "/tmp/onh_benchmark_script.log");
+
+		// Wait for result
+		while (ex.getFinished().empty())
+			std::this_thread::yield();
+	}));
+
+	remove(scriptPath.c_str());
+	remove("/tmp/onh_benchmark_script.log");
+}
+
+#endif  // BENCHMARKS_SCRIPT_SCRIPTBENCHMARK_H_
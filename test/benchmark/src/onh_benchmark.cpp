@@ -0,0 +1,62 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "benchmarks/BenchmarkUtils.h"
+#include "benchmarks/parser/ParserBenchmark.h"
+#include "benchmarks/driver/ConnectionTableBenchmark.h"
+#include "benchmarks/logger/LoggerBenchmark.h"
+#include "benchmarks/script/ScriptBenchmark.h"
+
+thread_local unsigned long int benchmarkAllocations = 0;
+
+void* operator new(std::size_t size) {
+	benchmarkAllocations++;
+
+	void *p = std::malloc((size)?(size):(1));
+	if (!p)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+void operator delete(void *p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+	std::free(p);
+}
+
+int main(int argc, char **argv) {
+	unsigned long int iterations = 1000000;
+
+	if (argc > 1)
+		iterations = std::stoul(argv[1]);
+
+	parserBenchmark(iterations);
+	connectionTableBenchmark(iterations);
+	loggerBenchmark(iterations);
+	scriptBenchmark(iterations);
+
+	return 0;
+}
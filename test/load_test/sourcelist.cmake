@@ -0,0 +1,16 @@
+# Source files
+
+target_sources(${PROJECT_NAME} PRIVATE
+    "src/onh_load_test.cpp"
+	"src/LoadTest.cpp"
+	"src/LoadTest.h"
+	"src/LatencyStats.cpp"
+	"src/LatencyStats.h"
+)
+
+# Program files
+target_sources(${PROJECT_NAME} PRIVATE
+    "../../src/onh/utils/Exception.h"
+	"../../src/onh/utils/Exception.cpp"
+	"../../src/onh/parser/CommandList.h"
+)
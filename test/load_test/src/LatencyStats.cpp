@@ -0,0 +1,72 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LatencyStats.h"
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+
+LatencyStats::LatencyStats():
+	errors(0) {
+}
+
+LatencyStats::~LatencyStats() {
+}
+
+void LatencyStats::add(double us) {
+	latencies.push_back(us);
+}
+
+void LatencyStats::addError() {
+	errors++;
+}
+
+void LatencyStats::merge(const LatencyStats& ls) {
+	latencies.insert(latencies.end(), ls.latencies.begin(), ls.latencies.end());
+	errors += ls.errors;
+}
+
+void LatencyStats::report(std::ostream& os, double seconds) {
+	std::sort(latencies.begin(), latencies.end());
+
+	double avg = 0;
+	if (latencies.size() > 0)
+		avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+
+	os << std::fixed << std::setprecision(1);
+	os << "Requests:   " << latencies.size() << " (errors: " << errors << ")" << std::endl;
+	os << "Throughput: " << ((seconds > 0)?(latencies.size() / seconds):(0)) << " req/s" << std::endl;
+	os << "Latency [us]:" << std::endl;
+	os << "  avg:   " << avg << std::endl;
+	os << "  min:   " << percentile(0) << std::endl;
+	os << "  p50:   " << percentile(50) << std::endl;
+	os << "  p90:   " << percentile(90) << std::endl;
+	os << "  p99:   " << percentile(99) << std::endl;
+	os << "  p99.9: " << percentile(99.9) << std::endl;
+	os << "  max:   " << percentile(100) << std::endl;
+}
+
+double LatencyStats::percentile(double p) const {
+	if (latencies.size() == 0)
+		return 0;
+
+	// Nearest rank
+	size_t rank = static_cast<size_t>((p / 100.0) * (latencies.size() - 1) + 0.5);
+
+	return latencies[std::min(rank, latencies.size() - 1)];
+}
@@ -0,0 +1,78 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATENCYSTATS_H_
+#define LATENCYSTATS_H_
+
+#include <ostream>
+#include <vector>
+
+/**
+ * Request latency statistics class
+ */
+class LatencyStats {
+	public:
+		LatencyStats();
+
+		virtual ~LatencyStats();
+
+		/**
+		 * Add request latency
+		 *
+		 * @param us Request latency (microseconds)
+		 */
+		void add(double us);
+
+		/**
+		 * Add failed request
+		 */
+		void addError();
+
+		/**
+		 * Merge statistics from other object
+		 *
+		 * @param ls Statistics to merge
+		 */
+		void merge(const LatencyStats& ls);
+
+		/**
+		 * Print statistics report
+		 *
+		 * @param os Output stream
+		 * @param seconds Test duration (seconds)
+		 */
+		void report(std::ostream& os, double seconds);
+
+	private:
+		/// Request latencies (microseconds)
+		std::vector<double> latencies;
+
+		/// Failed requests
+		unsigned long int errors;
+
+		/**
+		 * Get latency percentile (latencies have to be sorted)
+		 *
+		 * @param p Percentile (0-100)
+		 *
+		 * @return Latency (microseconds)
+		 */
+		double percentile(double p) const;
+};
+
+#endif  // LATENCYSTATS_H_
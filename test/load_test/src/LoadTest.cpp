@@ -0,0 +1,145 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoadTest.h"
+#include <netdb.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <parser/CommandList.h>
+#include <utils/Exception.h>
+
+/// Reply buffer size
+const int REPLY_BUFF_SIZE = 2048;
+
+LoadTest::LoadTest(const loadTestConfig& cfg):
+	config(cfg), stopFlag(false) {
+	if (config.threads == 0)
+		throw onh::Exception("Wrong number of client threads", "LoadTest::LoadTest");
+
+	if (config.requests.size() == 0)
+		throw onh::Exception("No requests", "LoadTest::LoadTest");
+}
+
+LoadTest::~LoadTest() {
+}
+
+LatencyStats LoadTest::run() {
+	std::vector<LatencyStats> stats(config.threads);
+	std::vector<std::thread> clients;
+
+	stopFlag = false;
+
+	// Start clients
+	for (unsigned int i = 0; i < config.threads; ++i) {
+		clients.push_back(std::thread(&LoadTest::client, this, i, &stats[i]));
+	}
+
+	std::this_thread::sleep_for(std::chrono::seconds(config.duration));
+	stopFlag = true;
+
+	// Wait on clients
+	for (std::thread& th : clients) {
+		th.join();
+	}
+
+	LatencyStats all;
+	for (const LatencyStats& st : stats) {
+		all.merge(st);
+	}
+
+	return all;
+}
+
+void LoadTest::client(unsigned int id, LatencyStats *stats) {
+	// Every client starts from other request
+	size_t req = id % config.requests.size();
+
+	// Error reply prefix
+	std::string errPrefix = std::to_string(onh::NOK) + CMD_SEPARATOR;
+
+	while (!stopFlag) {
+		const std::string& request = config.requests[req];
+		req = (req + 1) % config.requests.size();
+
+		try {
+			auto start = std::chrono::steady_clock::now();
+
+			std::string reply = sendRequest(request);
+
+			std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - start;
+
+			if (reply.length() == 0 || reply.compare(0, errPrefix.length(), errPrefix) == 0) {
+				stats->addError();
+			} else {
+				stats->add(latency.count());
+			}
+		} catch (onh::Exception &e) {
+			stats->addError();
+		}
+	}
+}
+
+std::string LoadTest::sendRequest(const std::string& request) {
+	struct addrinfo hints;
+	struct addrinfo *addr = nullptr;
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	if (getaddrinfo(config.host.c_str(), config.port.c_str(), &hints, &addr) != 0 || !addr)
+		throw onh::Exception("Can not resolve service address", "LoadTest::sendRequest");
+
+	int fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+	if (fd == -1) {
+		freeaddrinfo(addr);
+		throw onh::Exception("Can not create socket", "LoadTest::sendRequest");
+	}
+
+	if (connect(fd, addr->ai_addr, addr->ai_addrlen) == -1) {
+		freeaddrinfo(addr);
+		close(fd);
+		throw onh::Exception("Can not connect to the service", "LoadTest::sendRequest");
+	}
+	freeaddrinfo(addr);
+
+	if (send(fd, request.c_str(), request.length(), MSG_NOSIGNAL) == -1) {
+		close(fd);
+		throw onh::Exception("Can not send request", "LoadTest::sendRequest");
+	}
+
+	// Read reply (service closes connection after reply)
+	std::string reply;
+	char buff[REPLY_BUFF_SIZE];
+	ssize_t cnt = 0;
+
+	while ((cnt = read(fd, buff, REPLY_BUFF_SIZE)) > 0) {
+		reply.append(buff, cnt);
+	}
+
+	close(fd);
+
+	if (cnt == -1)
+		throw onh::Exception("Can not read reply", "LoadTest::sendRequest");
+
+	return reply;
+}
@@ -0,0 +1,99 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADTEST_H_
+#define LOADTEST_H_
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "LatencyStats.h"
+
+/**
+ * Load test configuration structure
+ */
+typedef struct {
+	/// Service address
+	std::string host;
+	/// Service port
+	std::string port;
+	/// Number of client threads
+	unsigned int threads;
+	/// Test duration (seconds)
+	unsigned int duration;
+	/// Requests sent by clients (round robin)
+	std::vector<std::string> requests;
+} loadTestConfig;
+
+/**
+ * Socket server load test class
+ */
+class LoadTest {
+	public:
+		/**
+		 * Load test constructor
+		 *
+		 * @param cfg Load test configuration
+		 */
+		explicit LoadTest(const loadTestConfig& cfg);
+
+		/**
+		 * Copy constructor - inactive
+		 */
+		LoadTest(const LoadTest&) = delete;
+
+		virtual ~LoadTest();
+
+		/**
+		 * Assignment operator - inactive
+		 */
+		LoadTest& operator=(const LoadTest&) = delete;
+
+		/**
+		 * Run load test
+		 *
+		 * @return Latency statistics of all clients
+		 */
+		LatencyStats run();
+
+	private:
+		/// Load test configuration
+		loadTestConfig config;
+
+		/// Stop clients flag
+		std::atomic<bool> stopFlag;
+
+		/**
+		 * Client thread function
+		 *
+		 * @param id Client identifier
+		 * @param stats Client latency statistics
+		 */
+		void client(unsigned int id, LatencyStats *stats);
+
+		/**
+		 * Send request to the service (one connection per request)
+		 *
+		 * @param request Request string
+		 *
+		 * @return Reply string
+		 */
+		std::string sendRequest(const std::string& request);
+};
+
+#endif  // LOADTEST_H_
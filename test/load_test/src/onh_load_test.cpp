@@ -0,0 +1,99 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <unistd.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "LoadTest.h"
+#include <utils/Exception.h>
+
+/**
+ * Print program usage
+ */
+void usage() {
+	std::cout << "Usage: onh_load_test [options] -f requests_file | -q request ..." << std::endl;
+	std::cout << "  -a address   Service address (default: 127.0.0.1)" << std::endl;
+	std::cout << "  -p port      Service port (default: 8201)" << std::endl;
+	std::cout << "  -c clients   Number of client threads (default: 4)" << std::endl;
+	std::cout << "  -d seconds   Test duration (default: 10)" << std::endl;
+	std::cout << "  -f file      File with requests (one request per line, # comments)" << std::endl;
+	std::cout << "  -q request   Request (can be repeated)" << std::endl;
+}
+
+/**
+ * Read requests from file
+ *
+ * @param fileName File name
+ * @param cfg Load test configuration
+ */
+void readRequests(const std::string& fileName, loadTestConfig& cfg) {
+	std::ifstream f(fileName);
+	if (!f.is_open())
+		throw onh::Exception("Can not open requests file "+fileName, "readRequests");
+
+	std::string line;
+	while (std::getline(f, line)) {
+		if (line.length() == 0 || line[0] == '#')
+			continue;
+
+		cfg.requests.push_back(line);
+	}
+}
+
+int main(int argc, char **argv) {
+	loadTestConfig cfg;
+	cfg.host = "127.0.0.1";
+	cfg.port = "8201";
+	cfg.threads = 4;
+	cfg.duration = 10;
+
+	try {
+		int opt = 0;
+		while ((opt = getopt(argc, argv, "a:p:c:d:f:q:h")) != -1) {
+			switch (opt) {
+				case 'a': cfg.host = optarg; break;
+				case 'p': cfg.port = optarg; break;
+				case 'c': cfg.threads = std::stoul(optarg); break;
+				case 'd': cfg.duration = std::stoul(optarg); break;
+				case 'f': readRequests(optarg, cfg); break;
+				case 'q': cfg.requests.push_back(optarg); break;
+				default: usage(); return 1;
+			}
+		}
+
+		if (cfg.requests.size() == 0) {
+			usage();
+			return 1;
+		}
+
+		std::cout << "Load test: " << cfg.host << ":" << cfg.port << ", " << cfg.threads << " clients, ";
+		std::cout << cfg.duration << " s, " << cfg.requests.size() << " requests" << std::endl;
+
+		LoadTest test(cfg);
+		LatencyStats stats = test.run();
+
+		stats.report(std::cout, cfg.duration);
+	} catch (std::exception &e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -5,6 +5,10 @@ target_sources(${PROJECT_NAME} PRIVATE
     "src/openNetworkHMI_test.cpp"
 	"src/tests/driver/DriverTestsFixtures.h"
 	"src/tests/driver/DriverTypesTests.h"
+	"src/tests/driver/ConnectionTableTests.h"
+	"src/tests/driver/DriverWriteQueueTests.h"
+	"src/tests/driver/DriverManagerTests.h"
+	"src/tests/driver/ProcessChangeNotifierTests.h"
 	"src/tests/driver/SHM/ShmDriverRealTests.h"
 	"src/tests/driver/SHM/ShmDriverWordTests.h"
 	"src/tests/driver/SHM/ShmDriverByteTests.h"
@@ -24,11 +28,25 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/tests/utils/MutexTestsFixtures.h"
 	"src/tests/utils/MutexTests.h"
 	"src/tests/utils/LoggerTests.h"
+	"src/tests/utils/LogQueueTests.h"
+	"src/tests/utils/BinaryLoggerTests.h"
 	"src/tests/utils/StringUtilsTests.h"
 	"src/tests/utils/LoggerTestsFixtures.h"
 	"src/tests/utils/DelayTests.h"
+	"src/tests/utils/PeriodicSchedulerTests.h"
+	"src/tests/utils/LatencyHistogramTests.h"
+	"src/tests/utils/ClockTests.h"
 	"src/tests/utils/CycleTimeTests.h"
 	"src/tests/utils/GuardDataControllerTests.h"
+	"src/tests/utils/SnapshotContainerTests.h"
+	"src/tests/utils/SharedDataControllerTests.h"
+	"src/tests/parser/ReplyCacheTests.h"
+	"src/tests/parser/TagSubscriptionTests.h"
+	"src/tests/parser/CommandTokenizerTests.h"
+	"src/tests/parser/CommandDispatcherTests.h"
+	"src/tests/thread/ScriptExecutorTests.h"
+	"src/tests/thread/ScriptVMTests.h"
+	"src/tests/thread/ScriptTableTests.h"
 	"src/tests/testGlobalData.h"
 	"src/tests/db/objs/AlarmDefinitionItemTestsDWord.h"
 	"src/tests/db/objs/AlarmDefinitionItemTestsWord.h"
@@ -44,6 +62,8 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"src/tests/db/objs/TagLoggerItemTests.h"
 	"src/tests/db/objs/AlarmDefinitionItemTestsFixtures.h"
 	"src/tests/db/objs/ScriptItemTests.h"
+	"src/tests/db/objs/ConfigSnapshotTests.h"
+	"src/tests/db/DBExecutorTests.h"
 )
 
 # Program files to test
@@ -63,8 +83,85 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"../../src/onh/driver/DriverProcessReader.h"
 	"../../src/onh/driver/DriverBufferUpdater.cpp"
 	"../../src/onh/driver/ProcessUpdater.h"
+	"../../src/onh/driver/ProcessChangeNotifier.h"
+	"../../src/onh/driver/ProcessChangeNotifier.cpp"
+	"../../src/onh/parser/ReplyCache.h"
+	"../../src/onh/parser/ReplyCache.cpp"
+	"../../src/onh/parser/CommandParserException.h"
+	"../../src/onh/parser/CommandParserException.cpp"
+	"../../src/onh/parser/TagSubscription.h"
+	"../../src/onh/parser/TagSubscription.cpp"
+	"../../src/onh/parser/CommandTokenizer.h"
+	"../../src/onh/parser/CommandTokenizer.cpp"
+	"../../src/onh/parser/CommandDispatcher.h"
+	"../../src/onh/parser/CommandDispatcher.cpp"
+	"../../src/onh/parser/ParserCommands/GetReplyCacheStatsCommand.h"
+	"../../src/onh/parser/ParserCommands/GetReplyCacheStatsCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetThreadCycleStatsCommand.h"
+	"../../src/onh/parser/ParserCommands/GetThreadCycleStatsCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetLogWriterStatsCommand.h"
+	"../../src/onh/parser/ParserCommands/GetLogWriterStatsCommand.cpp"
+	"../../src/onh/parser/ParserCommands/ErrorCommand.h"
+	"../../src/onh/parser/ParserCommands/ErrorCommand.cpp"
+	"../../src/onh/parser/ParserCommands/TagErrorCommand.h"
+	"../../src/onh/parser/ParserCommands/TagErrorCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetBitCommand.h"
+	"../../src/onh/parser/ParserCommands/GetBitCommand.cpp"
+	"../../src/onh/parser/ParserCommands/SetBitCommand.h"
+	"../../src/onh/parser/ParserCommands/SetBitCommand.cpp"
+	"../../src/onh/parser/ParserCommands/ResetBitCommand.h"
+	"../../src/onh/parser/ParserCommands/ResetBitCommand.cpp"
+	"../../src/onh/parser/ParserCommands/InvertBitCommand.h"
+	"../../src/onh/parser/ParserCommands/InvertBitCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetBitsCommand.h"
+	"../../src/onh/parser/ParserCommands/GetBitsCommand.cpp"
+	"../../src/onh/parser/ParserCommands/SetBitsCommand.h"
+	"../../src/onh/parser/ParserCommands/SetBitsCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetByteCommand.h"
+	"../../src/onh/parser/ParserCommands/GetByteCommand.cpp"
+	"../../src/onh/parser/ParserCommands/WriteByteCommand.h"
+	"../../src/onh/parser/ParserCommands/WriteByteCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetWordCommand.h"
+	"../../src/onh/parser/ParserCommands/GetWordCommand.cpp"
+	"../../src/onh/parser/ParserCommands/WriteWordCommand.h"
+	"../../src/onh/parser/ParserCommands/WriteWordCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetDWordCommand.h"
+	"../../src/onh/parser/ParserCommands/GetDWordCommand.cpp"
+	"../../src/onh/parser/ParserCommands/WriteDWordCommand.h"
+	"../../src/onh/parser/ParserCommands/WriteDWordCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetIntCommand.h"
+	"../../src/onh/parser/ParserCommands/GetIntCommand.cpp"
+	"../../src/onh/parser/ParserCommands/WriteIntCommand.h"
+	"../../src/onh/parser/ParserCommands/WriteIntCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetRealCommand.h"
+	"../../src/onh/parser/ParserCommands/GetRealCommand.cpp"
+	"../../src/onh/parser/ParserCommands/WriteRealCommand.h"
+	"../../src/onh/parser/ParserCommands/WriteRealCommand.cpp"
+	"../../src/onh/parser/ParserCommands/AckAlarmCommand.h"
+	"../../src/onh/parser/ParserCommands/AckAlarmCommand.cpp"
+	"../../src/onh/parser/ParserCommands/GetThreadCycleTimeCommand.h"
+	"../../src/onh/parser/ParserCommands/GetThreadCycleTimeCommand.cpp"
+	"../../src/onh/parser/ParserCommands/ExitAppCommand.h"
+	"../../src/onh/parser/ParserCommands/ExitAppCommand.cpp"
+	"../../src/onh/parser/ParserCommands/MultiCommand.h"
+	"../../src/onh/parser/ParserCommands/MultiCommand.cpp"
+	"../../src/onh/parser/ParserCommands/SubscribeCommand.h"
+	"../../src/onh/parser/ParserCommands/SubscribeCommand.cpp"
+	"../../src/onh/thread/Script/ScriptExecutor.h"
+	"../../src/onh/thread/Script/ScriptExecutor.cpp"
+	"../../src/onh/thread/Script/ScriptBytecode.h"
+	"../../src/onh/thread/Script/ScriptCompiler.h"
+	"../../src/onh/thread/Script/ScriptCompiler.cpp"
+	"../../src/onh/thread/Script/ScriptVM.h"
+	"../../src/onh/thread/Script/ScriptVM.cpp"
+	"../../src/onh/thread/Script/ScriptTable.h"
+	"../../src/onh/thread/Script/ScriptTable.cpp"
 	"../../src/onh/driver/DriverProcessReader.cpp"
 	"../../src/onh/driver/DriverUtils.h"
+	"../../src/onh/driver/ConnectionTable.h"
+	"../../src/onh/driver/DriverRegistry.h"
+	"../../src/onh/driver/DriverWriteQueue.h"
+	"../../src/onh/driver/DriverWriteQueueData.h"
 	"../../src/onh/driver/SHM/ShmProcessUpdater.cpp"
 	"../../src/onh/driver/SHM/ShmProcessReader.h"
 	"../../src/onh/driver/SHM/ShmProcessReader.cpp"
@@ -82,7 +179,10 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"../../src/onh/driver/DriverRegisterTypes.h"
 	"../../src/onh/driver/ProcessReader.h"
 	"../../src/onh/driver/ProcessReader.cpp"
+	"../../src/onh/driver/ProcessTagHandle.cpp"
+	"../../src/onh/driver/ProcessTagHandle.h"
 	"../../src/onh/driver/DriverUtils.cpp"
+	"../../src/onh/driver/DriverWriteQueue.cpp"
 	"../../src/onh/driver/ProcessUtils.cpp"
 	"../../src/onh/driver/DriverProcessWriter.cpp"
 	"../../src/onh/driver/Modbus/ModbusUpdater.cpp"
@@ -122,19 +222,41 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"../../src/onh/utils/Exception.h"
 	"../../src/onh/utils/MutexAccess.cpp"
 	"../../src/onh/utils/Delay.cpp"
+	"../../src/onh/utils/PeriodicScheduler.cpp"
+	"../../src/onh/utils/LatencyHistogram.cpp"
+	"../../src/onh/utils/ThreadCycleStats.cpp"
+	"../../src/onh/utils/Clock.cpp"
 	"../../src/onh/utils/logger/ILogger.h"
 	"../../src/onh/utils/logger/TextLogger.h"
 	"../../src/onh/utils/logger/TextLogger.cpp"
+	"../../src/onh/utils/logger/LogQueue.h"
+	"../../src/onh/utils/logger/LogQueue.cpp"
+	"../../src/onh/utils/logger/LogWriter.h"
+	"../../src/onh/utils/logger/LogWriter.cpp"
+	"../../src/onh/utils/logger/BinaryLogFormat.h"
+	"../../src/onh/utils/logger/BinaryLogger.h"
+	"../../src/onh/utils/logger/BinaryLogger.cpp"
+	"../../src/onh/utils/logger/BinaryLogDecoder.h"
+	"../../src/onh/utils/logger/BinaryLogDecoder.cpp"
 	"../../src/onh/utils/DateUtils.h"
 	"../../src/onh/utils/GuardDataContainer.h"
 	"../../src/onh/utils/GuardDataController.h"
+	"../../src/onh/utils/SnapshotContainer.h"
+	"../../src/onh/utils/SharedDataStorage.h"
+	"../../src/onh/utils/SharedDataController.h"
+	"../../src/onh/utils/SharedDataContainer.h"
 	"../../src/onh/utils/MutexContainer.cpp"
 	"../../src/onh/utils/Delay.h"
+	"../../src/onh/utils/PeriodicScheduler.h"
+	"../../src/onh/utils/LatencyHistogram.h"
+	"../../src/onh/utils/ThreadCycleStats.h"
+	"../../src/onh/utils/Clock.h"
 	"../../src/onh/db/TagLoggerDB.cpp"
 	"../../src/onh/db/DBManager.cpp"
 	"../../src/onh/db/DBManager.h"
 	"../../src/onh/db/ScriptDB.cpp"
 	"../../src/onh/db/DBResult.cpp"
+	"../../src/onh/db/DBStatement.cpp"
 	"../../src/onh/db/ScriptDB.h"
 	"../../src/onh/db/DB.h"
 	"../../src/onh/db/ParserDB.cpp"
@@ -143,6 +265,12 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"../../src/onh/db/TagLoggerDB.h"
 	"../../src/onh/db/ParserDB.h"
 	"../../src/onh/db/DBResult.h"
+	"../../src/onh/db/DBStatement.h"
+	"../../src/onh/db/DBRowDecoder.h"
+	"../../src/onh/db/DBExecutor.cpp"
+	"../../src/onh/db/DBExecutor.h"
+	"../../src/onh/db/DBExecutorContext.cpp"
+	"../../src/onh/db/DBExecutorContext.h"
 	"../../src/onh/db/DB.cpp"
 	"../../src/onh/db/AlarmingDB.cpp"
 	"../../src/onh/db/Config.cpp"
@@ -162,6 +290,8 @@ target_sources(${PROJECT_NAME} PRIVATE
 	"../../src/onh/db/objs/AlarmDefinitionItem.cpp"
 	"../../src/onh/db/objs/Tag.h"
 	"../../src/onh/db/objs/ScriptException.cpp"
+	"../../src/onh/db/objs/ConfigSnapshot.h"
+	"../../src/onh/db/objs/ConfigSnapshot.cpp"
 	"../../src/onh/db/AlarmingDB.h"
 	"../../src/onh/db/DBException.cpp"
 	"../../src/onh/db/DBException.h"
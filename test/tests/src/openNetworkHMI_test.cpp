@@ -28,10 +28,26 @@
 
 #include "tests/utils/StringUtilsTests.h"
 #include "tests/utils/LoggerTests.h"
+#include "tests/utils/LogQueueTests.h"
+#include "tests/utils/BinaryLoggerTests.h"
 #include "tests/utils/MutexTests.h"
 #include "tests/utils/CycleTimeTests.h"
 #include "tests/utils/DelayTests.h"
+#include "tests/utils/PeriodicSchedulerTests.h"
+#include "tests/utils/LatencyHistogramTests.h"
+#include "tests/utils/ClockTests.h"
 #include "tests/utils/GuardDataControllerTests.h"
+#include "tests/utils/SnapshotContainerTests.h"
+#include "tests/utils/SharedDataControllerTests.h"
+
+#include "tests/parser/ReplyCacheTests.h"
+#include "tests/parser/TagSubscriptionTests.h"
+#include "tests/parser/CommandTokenizerTests.h"
+#include "tests/parser/CommandDispatcherTests.h"
+
+#include "tests/thread/ScriptExecutorTests.h"
+#include "tests/thread/ScriptVMTests.h"
+#include "tests/thread/ScriptTableTests.h"
 
 #include "tests/db/objs/TagTests.h"
 #include "tests/db/objs/TagLoggerItemTests.h"
@@ -44,8 +60,14 @@
 #include "tests/db/objs/AlarmDefinitionItemTestsReal.h"
 #include "tests/db/objs/ScriptItemTests.h"
 #include "tests/db/objs/DriverConnectionTests.h"
+#include "tests/db/objs/ConfigSnapshotTests.h"
+#include "tests/db/DBExecutorTests.h"
 
 #include "tests/driver/DriverTypesTests.h"
+#include "tests/driver/ConnectionTableTests.h"
+#include "tests/driver/DriverWriteQueueTests.h"
+#include "tests/driver/DriverManagerTests.h"
+#include "tests/driver/ProcessChangeNotifierTests.h"
 #include "tests/driver/SHM/ShmDriverBitTests.h"
 #include "tests/driver/SHM/ShmDriverByteTests.h"
 #include "tests/driver/SHM/ShmDriverWordTests.h"
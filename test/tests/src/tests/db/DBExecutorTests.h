@@ -0,0 +1,233 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_DB_DBEXECUTORTESTS_H_
+#define TEST_SRC_TESTS_DB_DBEXECUTORTESTS_H_
+
+#include <gtest/gtest.h>
+#include <string>
+#include <db/DBExecutor.h>
+
+/**
+ * DB executor context recording transactions (without DB connection)
+ */
+class RecordingExecutorContext: public onh::DBExecutorContext {
+	public:
+		RecordingExecutorContext(unsigned int workerNr, std::shared_ptr<std::vector<std::string>> log):
+			onh::DBExecutorContext(nullptr), worker(workerNr), value(0), events(log) {
+		}
+
+		void beginTransaction() override {
+			events->push_back("begin");
+		}
+
+		void commitTransaction() override {
+			events->push_back("commit");
+		}
+
+		/// Worker number
+		unsigned int worker;
+
+		/// Value changed by test writes
+		int value;
+
+		/// Recorded events
+		std::shared_ptr<std::vector<std::string>> events;
+};
+
+/**
+ * DB executor test fixture
+ */
+class DBExecutorTests: public ::testing::Test {
+	protected:
+		void SetUp() override {
+			events = std::make_shared<std::vector<std::string>>();
+			executor = createExecutor(DB_EXECUTOR_CAPACITY);
+		}
+
+		onh::DBExecutorPtr createExecutor(unsigned int capacity) {
+			std::shared_ptr<std::vector<std::string>> log = events;
+
+			return std::make_shared<onh::DBExecutor>(2, [log](unsigned int worker) {
+				return std::unique_ptr<onh::DBExecutorContext>(new RecordingExecutorContext(worker, log));
+			}, capacity);
+		}
+
+		std::future<void> write(onh::dbExecutorChannel channel, const std::string& name, bool fail = false) {
+			std::shared_ptr<std::vector<std::string>> log = events;
+
+			return executor->write(channel, [log, name, fail](onh::DBExecutorContext &ctx) {
+				RecordingExecutorContext &rc = dynamic_cast<RecordingExecutorContext&>(ctx);
+
+				if (fail)
+					throw onh::DBException("Write failed", "DBExecutorTests::write");
+
+				rc.value++;
+				log->push_back(name + ":" + std::to_string(rc.worker));
+			});
+		}
+
+		/// Recorded events
+		std::shared_ptr<std::vector<std::string>> events;
+
+		/// Tested executor
+		onh::DBExecutorPtr executor;
+};
+
+/**
+ * Check works from one channel are executed in order by one worker
+ */
+TEST_F(DBExecutorTests, ChannelOrder) {
+
+	std::future<void> f1 = write(onh::DBC_TAG_LOGGER, "w1");
+	std::future<void> f2 = write(onh::DBC_ALARMING, "a1");
+	std::future<void> f3 = write(onh::DBC_TAG_LOGGER, "w2");
+	std::future<void> f4 = write(onh::DBC_TAG_LOGGER, "w3");
+
+	ASSERT_EQ(2u, executor->getWorkersCount());
+	ASSERT_EQ(4u, executor->size());
+
+	// Worker of the tag logger channel
+	ASSERT_EQ(3u, executor->execute(1, 0));
+	ASSERT_EQ(1u, executor->size());
+
+	std::vector<std::string> exp = {"begin", "w1:1", "w2:1", "w3:1", "commit"};
+	ASSERT_EQ(exp, *events);
+
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_NO_THROW(f3.get());
+	ASSERT_NO_THROW(f4.get());
+	ASSERT_EQ(std::future_status::timeout, f2.wait_for(std::chrono::seconds(0)));
+
+	ASSERT_EQ(1u, executor->execute(0, 0));
+	ASSERT_NO_THROW(f2.get());
+	ASSERT_EQ("a1:0", (*events)[6]);
+}
+
+/**
+ * Check failed write does not stop other writes from the same transaction
+ */
+TEST_F(DBExecutorTests, WritesInOneTransaction) {
+
+	std::future<void> f1 = write(onh::DBC_ALARMING, "w1");
+	std::future<void> f2 = write(onh::DBC_ALARMING, "w2", true);
+	std::future<void> f3 = write(onh::DBC_ALARMING, "w3");
+
+	ASSERT_EQ(3u, executor->execute(0, 0));
+
+	std::vector<std::string> exp = {"begin", "w1:0", "w3:0", "commit"};
+	ASSERT_EQ(exp, *events);
+
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_THROW(f2.get(), onh::DBException);
+	ASSERT_NO_THROW(f3.get());
+}
+
+/**
+ * Check read sees previous writes from the same channel
+ */
+TEST_F(DBExecutorTests, ReadAfterWrites) {
+
+	std::future<void> f1 = write(onh::DBC_SCRIPT, "w1");
+	std::future<void> f2 = write(onh::DBC_SCRIPT, "w2");
+	std::future<int> r = executor->read<int>(onh::DBC_SCRIPT, [this](onh::DBExecutorContext &ctx) {
+		events->push_back("read");
+		return dynamic_cast<RecordingExecutorContext&>(ctx).value;
+	});
+
+	ASSERT_EQ(3u, executor->execute(1, 0));
+
+	// Writes are committed before read
+	std::vector<std::string> exp = {"begin", "w1:1", "w2:1", "commit", "read"};
+	ASSERT_EQ(exp, *events);
+
+	ASSERT_EQ(2, r.get());
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_NO_THROW(f2.get());
+}
+
+/**
+ * Check work is rejected when queue is full
+ */
+TEST_F(DBExecutorTests, QueueFull) {
+
+	executor = createExecutor(1);
+
+	std::vector<std::future<void>> futures;
+	futures.push_back(write(onh::DBC_ALARMING, "w1"));
+	futures.push_back(write(onh::DBC_ALARMING, "w2"));
+
+	ASSERT_EQ(1u, executor->size());
+	ASSERT_EQ(1u, executor->getRejectedCount());
+
+	try {
+		futures[1].get();
+		FAIL() << "Work should be rejected";
+	} catch (onh::DBQueueFullException &e) {
+		ASSERT_NE(std::string::npos, std::string(e.what()).find("queue is full"));
+	}
+
+	// Rejected work is counted by the caller
+	futures[1] = write(onh::DBC_ALARMING, "w3");
+	ASSERT_EQ(2u, executor->getRejectedCount());
+	ASSERT_EQ(1u, onh::DBExecutor::checkFinished(futures));
+	ASSERT_EQ(1u, futures.size());
+
+	ASSERT_EQ(1u, executor->execute(0, 0));
+	ASSERT_EQ(0u, onh::DBExecutor::checkFinished(futures));
+	ASSERT_EQ(0u, futures.size());
+}
+
+/**
+ * Check failed work is re-thrown by the caller
+ */
+TEST_F(DBExecutorTests, CheckFinishedRethrows) {
+
+	std::vector<std::future<void>> futures;
+	futures.push_back(write(onh::DBC_ALARMING, "w1", true));
+
+	ASSERT_EQ(1u, executor->execute(0, 0));
+	ASSERT_THROW(onh::DBExecutor::checkFinished(futures), onh::DBException);
+	ASSERT_EQ(0u, futures.size());
+}
+
+/**
+ * Check pending works are completed when executor is closed
+ */
+TEST_F(DBExecutorTests, ClosedWithPendingWorks) {
+
+	std::future<void> f1 = write(onh::DBC_ALARMING, "w1");
+	std::future<int> r = executor->read<int>(onh::DBC_TAG_LOGGER, [](onh::DBExecutorContext&) {
+		return 1;
+	});
+
+	executor.reset();
+
+	ASSERT_TRUE(events->empty());
+
+	try {
+		f1.get();
+		FAIL() << "Work should not be executed";
+	} catch (onh::DBException &e) {
+		ASSERT_NE(std::string::npos, std::string(e.what()).find("DB executor closed"));
+	}
+
+	ASSERT_THROW(r.get(), onh::DBException);
+}
+
+#endif /* TEST_SRC_TESTS_DB_DBEXECUTORTESTS_H_ */
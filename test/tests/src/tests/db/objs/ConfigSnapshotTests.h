@@ -0,0 +1,109 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_DB_OBJS_CONFIGSNAPSHOTTESTS_H_
+#define TEST_SRC_TESTS_DB_OBJS_CONFIGSNAPSHOTTESTS_H_
+
+#include <gtest/gtest.h>
+#include <db/objs/ConfigSnapshot.h>
+#include <utils/Exception.h>
+
+/**
+ * Check typed values
+ */
+TEST(ConfigSnapshotTests, Values) {
+
+	onh::ConfigSnapshot cs;
+	cs.add("socketPort", "8201");
+	cs.add("offset", "-15");
+	cs.add("userScriptsPath", "/usr/share/onh/scripts/");
+
+	ASSERT_EQ((size_t)3, cs.size());
+	ASSERT_TRUE(cs.contains("socketPort"));
+	ASSERT_FALSE(cs.contains("socketMaxConn"));
+
+	ASSERT_EQ(8201, cs.getInt("socketPort"));
+	ASSERT_EQ((unsigned int)8201, cs.getUInt("socketPort"));
+	ASSERT_EQ(-15, cs.getInt("offset"));
+	ASSERT_STREQ("8201", cs.getString("socketPort").c_str());
+	ASSERT_STREQ("/usr/share/onh/scripts/", cs.getString("userScriptsPath").c_str());
+}
+
+/**
+ * Check invalid values
+ */
+TEST(ConfigSnapshotTests, InvalidValues) {
+
+	onh::ConfigSnapshot cs;
+	cs.add("offset", "-15");
+	cs.add("path", "/tmp");
+	cs.add("empty", "");
+	cs.add("big", "99999999999");
+
+	ASSERT_THROW(cs.getUInt("offset"), onh::Exception);
+	ASSERT_THROW(cs.getInt("path"), onh::Exception);
+	ASSERT_THROW(cs.getInt("empty"), onh::Exception);
+	ASSERT_THROW(cs.getInt("big"), onh::Exception);
+	ASSERT_THROW(cs.getString("missing"), onh::Exception);
+	ASSERT_THROW(cs.add("", "1"), onh::Exception);
+}
+
+/**
+ * Check copy and replace
+ */
+TEST(ConfigSnapshotTests, CopyReplace) {
+
+	onh::ConfigSnapshot cs;
+	cs.add("serverRestart", "1");
+
+	onh::ConfigSnapshot cs2(cs);
+	cs2.add("serverRestart", "0");
+
+	ASSERT_EQ(1, cs.getInt("serverRestart"));
+	ASSERT_EQ(0, cs2.getInt("serverRestart"));
+	ASSERT_EQ((size_t)1, cs2.size());
+}
+
+/**
+ * Check changed values
+ */
+TEST(ConfigSnapshotTests, ChangedNames) {
+
+	onh::ConfigSnapshot cs;
+	cs.add("serverRestart", "0");
+	cs.add("socketPort", "8201");
+	cs.add("userScriptsPath", "/tmp");
+
+	onh::ConfigSnapshot cs2(cs);
+	ASSERT_TRUE(cs.getChangedNames(cs2).empty());
+
+	cs2.add("serverRestart", "1");
+	cs2.add("socketPort", "8202");
+	cs2.add("scriptSystemPoolSize", "5");
+
+	std::vector<std::string> changed = cs.getChangedNames(cs2);
+	ASSERT_EQ(std::vector<std::string>({"scriptSystemPoolSize", "serverRestart", "socketPort"}), changed);
+
+	// Removed value
+	onh::ConfigSnapshot cs3;
+	cs3.add("serverRestart", "0");
+	cs3.add("socketPort", "8201");
+	ASSERT_EQ(std::vector<std::string>({"userScriptsPath"}), cs.getChangedNames(cs3));
+}
+
+#endif /* TEST_SRC_TESTS_DB_OBJS_CONFIGSNAPSHOTTESTS_H_ */
@@ -214,4 +214,52 @@ TEST(DriverConnectionTests, CreateException4) {
 	}
 }
 
+/**
+ * Check driver configuration compare
+ */
+TEST(DriverConnectionTests, SameConfig) {
+
+	onh::DriverConnection shm1;
+	shm1.setId(1);
+	shm1.setName("testConn");
+	shm1.setType(onh::DriverType::DT_SHM);
+	shm1.setShmCfg("shm1");
+
+	onh::DriverConnection shm2(shm1);
+	shm2.setName("renamedConn");
+	shm2.setEnable(true);
+
+	// Name and enable flag do not change driver
+	ASSERT_TRUE(shm1.isSameConfig(shm2));
+
+	shm2.setShmCfg("shm2");
+	ASSERT_FALSE(shm1.isSameConfig(shm2));
+
+	modbusM::ModbusCfg mbc;
+	mbc.mode = modbusM::MM_TCP;
+	mbc.slaveID = 10;
+	mbc.registerCount = 20;
+	mbc.TCP_addr = "127.0.0.1";
+	mbc.TCP_port = 502;
+
+	onh::DriverConnection mb1;
+	mb1.setId(1);
+	mb1.setName("testConn");
+	mb1.setType(onh::DriverType::DT_Modbus);
+	mb1.setModbusCfg(mbc);
+
+	onh::DriverConnection mb2(mb1);
+
+	ASSERT_TRUE(mb1.isSameConfig(mb2));
+	ASSERT_FALSE(mb1.isSameConfig(shm1));
+
+	mbc.TCP_port = 503;
+	mb2.setModbusCfg(mbc);
+	ASSERT_FALSE(mb1.isSameConfig(mb2));
+
+	mb2 = mb1;
+	mb2.setId(2);
+	ASSERT_FALSE(mb1.isSameConfig(mb2));
+}
+
 #endif /* TEST_SRC_TESTS_DB_OBJS_DRIVERCONNECTIONTESTS_H_ */
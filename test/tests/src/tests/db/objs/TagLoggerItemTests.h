@@ -20,6 +20,8 @@
 #define TESTS_DB_OBJS_TAGLOGGERITEMTESTS_H_
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
 #include "TagLoggerItemTestsFixtures.h"
 
 /**
@@ -927,4 +929,156 @@ TEST_F(tagLoggerItemTests, UpdateTest10) {
 	ASSERT_TRUE(tgLog.isNeededUpdate("0"));
 }
 
+/**
+ * Check tag logger item update trigger (1 second interval)
+ */
+TEST_F(tagLoggerItemTests, UpdateTest11) {
+
+	onh::TagLoggerItem tgLog(
+			1,
+			*tg,
+			onh::TagLoggerItem::I_1S,
+			0,
+			createTimestamp(0, -500),
+			"1",
+			true
+	);
+
+	ASSERT_FALSE(tgLog.isNeededUpdate("0"));
+}
+
+/**
+ * Check tag logger item update trigger (1 second interval)
+ */
+TEST_F(tagLoggerItemTests, UpdateTest12) {
+
+	onh::TagLoggerItem tgLog(
+			1,
+			*tg,
+			onh::TagLoggerItem::I_1S,
+			0,
+			createTimestamp(-1, 0),
+			"1",
+			true
+	);
+
+	ASSERT_TRUE(tgLog.isNeededUpdate("0"));
+}
+
+/**
+ * Check tag logger item update trigger (last update from DB in the future)
+ */
+TEST_F(tagLoggerItemTests, UpdateTest13) {
+
+	onh::TagLoggerItem tgLog(
+			1,
+			*tg,
+			onh::TagLoggerItem::I_100MS,
+			0,
+			createTimestamp(5, 0),
+			"1",
+			true
+	);
+
+	// Millisecond intervals are updated after the clock change
+	ASSERT_TRUE(tgLog.isNeededUpdate("0"));
+
+	tgLog.setInterval(onh::TagLoggerItem::I_1S);
+
+	ASSERT_FALSE(tgLog.isNeededUpdate("0"));
+}
+
+/**
+ * Check tag logger item update trigger (X seconds interval equal 0)
+ */
+TEST_F(tagLoggerItemTests, UpdateTest14) {
+
+	onh::TagLoggerItem tgLog(
+			1,
+			*tg,
+			onh::TagLoggerItem::I_XS,
+			0,
+			createTimestamp(-5, 0),
+			"1",
+			true
+	);
+
+	try {
+
+		tgLog.isNeededUpdate("0");
+
+		FAIL() << "Expected onh::Exception";
+
+	} catch (onh::Exception &e) {
+
+		ASSERT_STREQ(e.what(), "TagLoggerItem::isNeededUpdate: Interval seconds can not be 0");
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+}
+
+/**
+ * Check tag logger item update trigger (last update resolved to the monotonic time)
+ */
+TEST_F(tagLoggerItemTests, UpdateTest15) {
+
+	onh::TagLoggerItem tgLog(
+			1,
+			*tg,
+			onh::TagLoggerItem::I_200MS,
+			0,
+			createTimestamp(-1, 0),
+			"1",
+			true
+	);
+
+	ASSERT_TRUE(tgLog.isNeededUpdate("0"));
+
+	// Value written to the DB
+	tgLog.setLastTimeValue(tgLog.getCurrentTimeValue());
+
+	ASSERT_NE(0, tgLog.getLastTimeValue().time.monotonic);
+	ASSERT_FALSE(tgLog.isNeededUpdate("0"));
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(210));
+
+	ASSERT_TRUE(tgLog.isNeededUpdate("0"));
+}
+
+/**
+ * Check tag logger item last time resolved from the DB timestamp
+ */
+TEST_F(tagLoggerItemTests, LastTimeFromDB) {
+
+	std::string ts = createTimestamp(-2, 0);
+
+	onh::TagLoggerItem tgLog(
+			1,
+			*tg,
+			onh::TagLoggerItem::I_XS,
+			5,
+			ts,
+			"1",
+			true
+	);
+
+	onh::TagLoggerItem::timeVal tv = tgLog.getLastTimeValue();
+	onh::ClockTime now = onh::Clock::now();
+
+	ASSERT_STREQ(ts.c_str(), tv.timestamp.c_str());
+	ASSERT_EQ(onh::Clock::parseTimestamp(ts), tv.time.realtime);
+
+	// Monotonic time of the last update is 2 seconds before now
+	ASSERT_GE(now.monotonic - tv.time.monotonic, 1990);
+	ASSERT_LE(now.monotonic - tv.time.monotonic, 2100);
+
+	ASSERT_FALSE(tgLog.isNeededUpdate("0"));
+
+	// New timestamp loaded from the DB is resolved again
+	tgLog.setLastUpdate(createTimestamp(-6, 0));
+
+	ASSERT_TRUE(tgLog.isNeededUpdate("0"));
+}
+
 #endif /* TESTS_DB_OBJS_TAGLOGGERITEMTESTS_H_ */
@@ -0,0 +1,113 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TESTS_DRIVER_CONNECTIONTABLETESTS_H_
+#define TESTS_DRIVER_CONNECTIONTABLETESTS_H_
+
+#include <gtest/gtest.h>
+#include <driver/ConnectionTable.h>
+
+/**
+ * Check connection table insert and access
+ */
+TEST(ConnectionTableTests, Access) {
+
+	onh::ConnectionTable<int> tab;
+
+	ASSERT_TRUE(tab.insert(std::pair<unsigned int, int>(7, 70)));
+	ASSERT_TRUE(tab.insert(std::pair<unsigned int, int>(2, 20)));
+	ASSERT_FALSE(tab.insert(std::pair<unsigned int, int>(7, 71)));
+
+	ASSERT_EQ(2u, tab.size());
+	ASSERT_EQ(70, *tab.get(7));
+	ASSERT_EQ(20, *tab.get(2));
+	ASSERT_EQ(1u, tab.count(2));
+	ASSERT_EQ(0u, tab.count(3));
+	ASSERT_EQ(0u, tab.count(100));
+
+	ASSERT_TRUE(tab.find(3) == tab.end());
+	ASSERT_EQ(20, tab.find(2)->second);
+
+	// Insert order
+	ASSERT_EQ(7u, tab.begin()->first);
+
+	ASSERT_TRUE(tab.get(3) == nullptr);
+	ASSERT_TRUE(tab.get(100) == nullptr);
+
+	tab.clear();
+	ASSERT_EQ(0u, tab.size());
+	ASSERT_EQ(0u, tab.count(7));
+}
+
+/**
+ * Check connection table item remove
+ */
+TEST(ConnectionTableTests, Erase) {
+
+	onh::ConnectionTable<int> tab;
+	tab.insert(std::pair<unsigned int, int>(7, 70));
+	tab.insert(std::pair<unsigned int, int>(2, 20));
+	tab.insert(std::pair<unsigned int, int>(5, 50));
+
+	ASSERT_TRUE(tab.erase(7));
+	ASSERT_FALSE(tab.erase(7));
+	ASSERT_FALSE(tab.erase(100));
+
+	ASSERT_EQ(2u, tab.size());
+	ASSERT_EQ(0u, tab.count(7));
+	ASSERT_EQ(20, *tab.get(2));
+	ASSERT_EQ(50, *tab.get(5));
+
+	// Removed connection can be added again
+	ASSERT_TRUE(tab.insert(std::pair<unsigned int, int>(7, 71)));
+	ASSERT_EQ(71, *tab.get(7));
+
+	ASSERT_TRUE(tab.erase(7));
+	ASSERT_TRUE(tab.erase(5));
+	ASSERT_EQ(1u, tab.size());
+	ASSERT_EQ(20, *tab.get(2));
+}
+
+/**
+ * Check connection table slots
+ */
+TEST(ConnectionTableTests, Slots) {
+
+	onh::ConnectionTable<int> tab;
+
+	// Database identifiers are only keys
+	ASSERT_TRUE(tab.insert(std::pair<unsigned int, int>(70000, 1)));
+	ASSERT_TRUE(tab.insert(std::pair<unsigned int, int>(4000000000u, 2)));
+	ASSERT_TRUE(tab.insert(std::pair<unsigned int, int>(3, 3)));
+
+	ASSERT_EQ(0u, tab.getSlot(70000));
+	ASSERT_EQ(1u, tab.getSlot(4000000000u));
+	ASSERT_EQ(2u, tab.getSlot(3));
+	ASSERT_EQ(CONNECTION_TABLE_NO_SLOT, tab.getSlot(4));
+
+	ASSERT_EQ(2, tab.atSlot(tab.getSlot(4000000000u)));
+
+	// Last item moves to the removed item slot
+	ASSERT_TRUE(tab.erase(70000));
+	ASSERT_EQ(0u, tab.getSlot(3));
+	ASSERT_EQ(1u, tab.getSlot(4000000000u));
+	ASSERT_EQ(CONNECTION_TABLE_NO_SLOT, tab.getSlot(70000));
+	ASSERT_EQ(3, tab.atSlot(0));
+}
+
+#endif /* TESTS_DRIVER_CONNECTIONTABLETESTS_H_ */
@@ -0,0 +1,107 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TESTS_DRIVER_DRIVERMANAGERTESTS_H_
+#define TESTS_DRIVER_DRIVERMANAGERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <driver/DriverManager.h>
+#include "../testGlobalData.h"
+
+/**
+ * Create SHM driver connection
+ *
+ * @param id Connection identifier
+ * @param segment SHM segment name
+ *
+ * @return SHM driver connection
+ */
+static onh::DriverConnection createShmConnection(unsigned int id, const std::string& segment) {
+	onh::DriverConnection dc;
+	dc.setId(id);
+	dc.setName("TestConn"+std::to_string(id));
+	dc.setType(onh::DriverType::DT_SHM);
+	dc.setEnable(true);
+	dc.setShmCfg(segment);
+
+	return dc;
+}
+
+/**
+ * Check driver connections reload
+ */
+TEST(DriverManagerTests, Reload) {
+
+	onh::DriverConnection dc1 = createShmConnection(1, SHM_SEGMENT_NAME);
+	onh::DriverConnection dc3 = createShmConnection(3, SHM_SEGMENT_NAME);
+
+	onh::Tag tag1(20, dc1.getId(), "ReloadTag1", onh::TT_BIT, {onh::PDA_MEMORY, 20, 0});
+	onh::Tag tag3(21, dc3.getId(), "ReloadTag3", onh::TT_BIT, {onh::PDA_MEMORY, 20, 1});
+
+	onh::DriverManager drvM({dc1});
+	onh::ProcessReader pr(drvM.getProcessReader());
+	onh::ProcessWriter pw(drvM.getProcessWriter());
+
+	ASSERT_TRUE(pr.bindTag(tag1).isBound());
+	ASSERT_THROW(pr.bindTag(tag3), onh::Exception);
+
+	// Add connection
+	onh::driverReloadData rd = drvM.reload({dc1, dc3});
+
+	ASSERT_EQ(1u, rd.added);
+	ASSERT_EQ(0u, rd.removed);
+	ASSERT_EQ(0u, rd.changed);
+	ASSERT_EQ(1u, rd.unchanged);
+	ASSERT_EQ(0u, rd.stopConn.size());
+	ASSERT_EQ(1u, rd.updaters.size());
+	ASSERT_EQ(3u, rd.updaters[0].connId);
+	ASSERT_EQ(1u, rd.writeQueues.size());
+	ASSERT_EQ(0u, rd.bufferUpdaters.size());
+	ASSERT_EQ(2u, drvM.getDriverWriteQueues().size());
+
+	// Reader switches to the new drivers on process data update
+	unsigned long int gen = pr.getDriverGeneration();
+	pr.updateProcessData();
+	ASSERT_NE(gen, pr.getDriverGeneration());
+	ASSERT_TRUE(pr.bindTag(tag3).isBound());
+
+	// Remove connection (rename is not a driver change)
+	dc3.setName("RenamedConn3");
+	rd = drvM.reload({dc3});
+
+	ASSERT_EQ(0u, rd.added);
+	ASSERT_EQ(1u, rd.removed);
+	ASSERT_EQ(1u, rd.unchanged);
+	ASSERT_EQ(1u, rd.stopConn.size());
+	ASSERT_EQ(1u, rd.stopConn[0]);
+	ASSERT_EQ(0u, rd.updaters.size());
+
+	pr.updateProcessData();
+	ASSERT_THROW(pr.bindTag(tag1), onh::Exception);
+	ASSERT_TRUE(pr.bindTag(tag3).isBound());
+	ASSERT_THROW(pw.setBitAsync(tag1), onh::Exception);
+
+	// Failed reload does not change running drivers
+	ASSERT_THROW(drvM.reload({createShmConnection(3, "onh_SHM_segment_missing")}), onh::Exception);
+	ASSERT_THROW(drvM.reload({}), onh::Exception);
+
+	ASSERT_EQ(1u, drvM.getDriverWriteQueues().size());
+	ASSERT_EQ(3u, drvM.getDriverWriteQueues()[0].connId);
+}
+
+#endif /* TESTS_DRIVER_DRIVERMANAGERTESTS_H_ */
@@ -0,0 +1,199 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_DRIVER_DRIVERWRITEQUEUETESTS_H_
+#define TEST_SRC_TESTS_DRIVER_DRIVERWRITEQUEUETESTS_H_
+
+#include <gtest/gtest.h>
+#include <driver/DriverWriteQueue.h>
+#include <driver/DriverException.h>
+
+/**
+ * Driver process writer recording executed write operations
+ */
+class RecordingProcessWriter: public onh::DriverProcessWriter {
+	public:
+		explicit RecordingProcessWriter(std::shared_ptr<std::vector<onh::processWriteOp>> ops):
+			executed(ops), failAt(-1) {
+		}
+
+		void setBit(onh::processDataAddress addr) override { add(onh::PWO_SET_BIT, addr, 0); }
+		void resetBit(onh::processDataAddress addr) override { add(onh::PWO_RESET_BIT, addr, 0); }
+		void invertBit(onh::processDataAddress addr) override { add(onh::PWO_INVERT_BIT, addr, 0); }
+		void setBits(std::vector<onh::processDataAddress> addr) override {
+			for (onh::processDataAddress& a : addr)
+				add(onh::PWO_SET_BIT, a, 0);
+		}
+		void writeByte(onh::processDataAddress addr, BYTE val) override { add(onh::PWO_BYTE, addr, val); }
+		void writeWord(onh::processDataAddress addr, WORD val) override { add(onh::PWO_WORD, addr, val); }
+		void writeDWord(onh::processDataAddress addr, DWORD val) override { add(onh::PWO_DWORD, addr, val); }
+		void writeInt(onh::processDataAddress addr, int val) override { add(onh::PWO_INT, addr, val); }
+		void writeReal(onh::processDataAddress, float) override {}
+
+		void writeBatch(const std::vector<onh::processWriteOp>& ops, unsigned int& applied) override {
+			for (applied = 0; applied < ops.size(); ++applied) {
+				if (static_cast<int>(executed->size()) == failAt)
+					throw onh::DriverException("Write failed", "RecordingProcessWriter::writeBatch");
+
+				executed->push_back(ops[applied]);
+			}
+		}
+
+		/**
+		 * Fail write operation
+		 *
+		 * @param idx Index of the failed operation (in all executed operations)
+		 */
+		void setFailAt(int idx) {
+			failAt = idx;
+		}
+
+		onh::DriverProcessWriterPtr createNew() override {
+			return onh::DriverProcessWriterPtr(new RecordingProcessWriter(executed));
+		}
+
+	private:
+		void add(onh::processWriteType type, onh::processDataAddress addr, DWORD val) {
+			executed->push_back({type, addr, val});
+		}
+
+		/// Executed write operations
+		std::shared_ptr<std::vector<onh::processWriteOp>> executed;
+
+		/// Index of the failed operation (-1 - no failure)
+		int failAt;
+};
+
+/**
+ * Driver write queue test fixture
+ */
+class DriverWriteQueueTests: public ::testing::Test {
+	protected:
+		void SetUp() override {
+			executed = std::make_shared<std::vector<onh::processWriteOp>>();
+			writer = new RecordingProcessWriter(executed);
+			queue = std::make_shared<onh::DriverWriteQueue>(onh::DriverProcessWriterPtr(writer));
+		}
+
+		/// Executed write operations
+		std::shared_ptr<std::vector<onh::processWriteOp>> executed;
+
+		/// Driver process writer (owned by queue)
+		RecordingProcessWriter *writer;
+
+		/// Tested queue
+		onh::DriverWriteQueuePtr queue;
+};
+
+/**
+ * Check high priority writes are executed first
+ */
+TEST_F(DriverWriteQueueTests, HighPriorityFirst) {
+
+	queue->push({onh::PWO_WORD, {onh::PDA_MEMORY, 10, 0}, 5});
+	queue->push({onh::PWO_WORD, {onh::PDA_MEMORY, 20, 0}, 6}, onh::PWP_HIGH);
+
+	ASSERT_EQ(2u, queue->execute(0));
+	ASSERT_EQ(2u, executed->size());
+	ASSERT_EQ(20u, (*executed)[0].addr.byteAddr);
+	ASSERT_EQ(10u, (*executed)[1].addr.byteAddr);
+}
+
+/**
+ * Check newer high priority write replaces older normal write to the same address
+ */
+TEST_F(DriverWriteQueueTests, HighPrioritySupersedesNormal) {
+
+	std::future<void> f1 = queue->push({onh::PWO_WORD, {onh::PDA_MEMORY, 10, 0}, 5});
+	std::future<void> f2 = queue->push({onh::PWO_WORD, {onh::PDA_MEMORY, 10, 0}, 7}, onh::PWP_HIGH);
+
+	ASSERT_EQ(1u, queue->size());
+	ASSERT_EQ(1u, queue->execute(0));
+
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_NO_THROW(f2.get());
+
+	ASSERT_EQ(1u, executed->size());
+	ASSERT_EQ(7u, (*executed)[0].value);
+}
+
+/**
+ * Check older overlapping normal write is executed before newer high priority write
+ */
+TEST_F(DriverWriteQueueTests, HighPriorityKeepsAddressOrder) {
+
+	queue->push({onh::PWO_BYTE, {onh::PDA_MEMORY, 30, 0}, 1});
+	queue->push({onh::PWO_WORD, {onh::PDA_MEMORY, 11, 0}, 5});
+	queue->push({onh::PWO_SET_BIT, {onh::PDA_MEMORY, 40, 2}, 0});
+	queue->push({onh::PWO_DWORD, {onh::PDA_MEMORY, 10, 0}, 9}, onh::PWP_HIGH);
+	queue->push({onh::PWO_INVERT_BIT, {onh::PDA_MEMORY, 40, 2}, 0}, onh::PWP_HIGH);
+	queue->push({onh::PWO_SET_BIT, {onh::PDA_MEMORY, 40, 3}, 0}, onh::PWP_HIGH);
+
+	ASSERT_EQ(6u, queue->execute(0));
+	ASSERT_EQ(6u, executed->size());
+
+	// Word overlapping the double word goes first
+	ASSERT_EQ(onh::PWO_WORD, (*executed)[0].type);
+	ASSERT_EQ(onh::PWO_DWORD, (*executed)[1].type);
+	// Set before invert of the same bit
+	ASSERT_EQ(onh::PWO_SET_BIT, (*executed)[2].type);
+	ASSERT_EQ(2u, (*executed)[2].addr.bitAddr);
+	ASSERT_EQ(onh::PWO_INVERT_BIT, (*executed)[3].type);
+	// Other bit does not move normal writes
+	ASSERT_EQ(onh::PWO_SET_BIT, (*executed)[4].type);
+	ASSERT_EQ(3u, (*executed)[4].addr.bitAddr);
+	ASSERT_EQ(onh::PWO_BYTE, (*executed)[5].type);
+}
+
+/**
+ * Check normal write after high priority write to the same address
+ */
+TEST_F(DriverWriteQueueTests, NormalAfterHighPriority) {
+
+	queue->push({onh::PWO_INT, {onh::PDA_MEMORY, 10, 0}, 3}, onh::PWP_HIGH);
+	queue->push({onh::PWO_INT, {onh::PDA_MEMORY, 10, 0}, 4});
+
+	ASSERT_EQ(2u, queue->execute(0));
+	ASSERT_EQ(3u, (*executed)[0].value);
+	ASSERT_EQ(4u, (*executed)[1].value);
+}
+
+/**
+ * Check failed batch completes applied writes and never repeats the rest
+ */
+TEST_F(DriverWriteQueueTests, FailedBatchNotRepeated) {
+
+	writer->setFailAt(1);
+
+	std::future<void> f1 = queue->push({onh::PWO_INVERT_BIT, {onh::PDA_MEMORY, 40, 2}, 0});
+	std::future<void> f2 = queue->push({onh::PWO_WORD, {onh::PDA_MEMORY, 10, 0}, 5});
+	std::future<void> f3 = queue->push({onh::PWO_INVERT_BIT, {onh::PDA_MEMORY, 41, 0}, 0});
+
+	ASSERT_EQ(3u, queue->execute(0));
+
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_THROW(f2.get(), onh::DriverException);
+	ASSERT_THROW(f3.get(), onh::DriverException);
+
+	// Invert is written only once
+	ASSERT_EQ(1u, executed->size());
+	ASSERT_EQ(onh::PWO_INVERT_BIT, (*executed)[0].type);
+	ASSERT_EQ(40u, (*executed)[0].addr.byteAddr);
+}
+
+#endif /* TEST_SRC_TESTS_DRIVER_DRIVERWRITEQUEUETESTS_H_ */
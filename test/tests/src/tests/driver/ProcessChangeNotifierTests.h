@@ -0,0 +1,71 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TESTS_DRIVER_PROCESSCHANGENOTIFIERTESTS_H_
+#define TESTS_DRIVER_PROCESSCHANGENOTIFIERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <driver/ProcessChangeNotifier.h>
+
+/**
+ * Check process change wait timeout
+ */
+TEST(ProcessChangeNotifierTests, WaitTimeout) {
+
+	onh::ProcessChangeNotifier pcn;
+
+	ASSERT_EQ(0u, pcn.getGeneration());
+	ASSERT_FALSE(pcn.waitForChange(0, 10));
+}
+
+/**
+ * Check process change wait (generation already changed)
+ */
+TEST(ProcessChangeNotifierTests, WaitChanged) {
+
+	onh::ProcessChangeNotifier pcn;
+
+	unsigned long int gen = pcn.getGeneration();
+	pcn.notifyChange();
+
+	ASSERT_TRUE(pcn.waitForChange(gen, 0));
+	ASSERT_EQ(gen+1, pcn.getGeneration());
+}
+
+/**
+ * Check process change wait wake up
+ */
+TEST(ProcessChangeNotifierTests, WaitNotify) {
+
+	onh::ProcessChangeNotifier pcn;
+
+	unsigned long int gen = pcn.getGeneration();
+
+	std::thread updater([&pcn]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		pcn.notifyChange();
+	});
+
+	// Wake up before timeout
+	ASSERT_TRUE(pcn.waitForChange(gen, 5000));
+
+	updater.join();
+}
+
+#endif /* TESTS_DRIVER_PROCESSCHANGENOTIFIERTESTS_H_ */
@@ -1316,4 +1316,191 @@ TEST_F(driverTests, processReaderGetRealException4) {
 	}
 }
 
+/**
+ * Check process reader generation (process data change information)
+ */
+TEST_F(driverTests, processReaderProcessGeneration) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	// No process data change
+	procUpdaterSHM->update();
+	unsigned long int gen = procReader->getProcessGeneration();
+	procUpdaterSHM->update();
+	ASSERT_EQ(gen, procReader->getProcessGeneration());
+
+	// Change bit
+	procWriter->setBit(testShmTag);
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	// Process data changed
+	ASSERT_LT(gen, procReader->getProcessGeneration());
+	ASSERT_TRUE(procReader->getBitValue(testShmTag));
+}
+
+/**
+ * Check process reader tag handles (bound once, updated with process data)
+ */
+TEST_F(driverTests, processReaderTagHandle) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	// Bind tags before process data change
+	onh::ProcessTagHandle shmBit = procReader->bindTag(testShmTag);
+	onh::ProcessTagHandle modbusBit = procReader->bindTag(testModbusTag);
+	onh::Tag shmInt = createIntTag({onh::PDA_MEMORY, 30, 0});
+	onh::Tag modbusReal = createRealTag({onh::PDA_OUTPUT, 9, 0}, onh::DT_Modbus);
+	onh::ProcessTagHandle shmIntH = procReader->bindTag(shmInt);
+	onh::ProcessTagHandle modbusRealH = procReader->bindTag(modbusReal);
+
+	ASSERT_TRUE(shmBit.isBound());
+	ASSERT_TRUE(shmBit.isBoundTo(testShmTag));
+	ASSERT_FALSE(shmBit.isBoundTo(testModbusTag));
+	ASSERT_FALSE(onh::ProcessTagHandle().isBound());
+
+	ASSERT_FALSE(shmBit.getBit());
+	ASSERT_FALSE(modbusBit.getBit());
+	ASSERT_EQ(0, shmIntH.getInt());
+	ASSERT_EQ(0, modbusRealH.getReal());
+
+	// Change process data
+	procWriter->setBit(testShmTag);
+	procWriter->setBit(testModbusTag);
+	procWriter->writeInt(shmInt, -4567);
+	procWriter->writeReal(modbusReal, 3.5);
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	// Handles read the same values as process reader
+	ASSERT_TRUE(shmBit.getBit());
+	ASSERT_TRUE(modbusBit.getBit());
+	ASSERT_EQ(procReader->getInt(shmInt), shmIntH.getInt());
+	ASSERT_EQ(-4567, shmIntH.getInt());
+	ASSERT_EQ(procReader->getReal(modbusReal), modbusRealH.getReal());
+	ASSERT_FLOAT_EQ(3.5, modbusRealH.getReal());
+
+	// Cached handle
+	ASSERT_TRUE(procReader->getHandle(testShmTag, onh::TT_BIT).getBit());
+	ASSERT_EQ(-4567, procReader->getHandle(shmInt, onh::TT_INT).getInt());
+}
+
+/**
+ * Check process reader tag handle wrong byte address
+ */
+TEST_F(driverTests, processReaderTagHandleException1) {
+
+	onh::Tag tg = createDWordTag({onh::PDA_INPUT, maxShmBytes-2, 0});
+
+	try {
+
+		procReader->bindTag(tg);
+
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+
+		std::stringstream s;
+		s << "ProcessReader::bindTag: (" << tg.getName() << "): ";
+		s << "ShmProcessData::getRawData: Byte address is out of range";
+
+		ASSERT_STREQ(e.what(), s.str().c_str());
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+}
+
+/**
+ * Check process reader tag handle wrong Tag type
+ */
+TEST_F(driverTests, processReaderTagHandleException2) {
+
+	testShmTag.setType(onh::TT_BYTE);
+
+	try {
+
+		procReader->getHandle(testShmTag, onh::TT_BIT);
+
+		FAIL() << "Expected onh::TagException";
+	} catch (onh::TagException &e) {
+
+		std::stringstream s;
+		s << "ProcessReader::getHandle: ";
+		s << "Tag: " << testShmTag.getName() << " has wrong type";
+
+		ASSERT_STREQ(e.what(), s.str().c_str());
+		ASSERT_EQ(onh::TagException::WRONG_TYPE, e.getType());
+
+	} catch(...) {
+		FAIL() << "Expected onh::TagException";
+	}
+}
+
+/**
+ * Check process reader bulk reads through tag handles
+ */
+TEST_F(driverTests, processReaderBulkRead) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	std::vector<onh::Tag> vBitTags{testShmTag, testModbusTag};
+	std::vector<onh::Tag> vWordTags{
+		createWordTag({onh::PDA_OUTPUT, 20, 0}),
+		createWordTag({onh::PDA_OUTPUT, 8, 0}, onh::DT_Modbus)
+	};
+
+	std::vector<onh::ProcessTagHandle> vBits = procReader->bindTags(vBitTags);
+	std::vector<onh::ProcessTagHandle> vWords = procReader->bindTags(vWordTags);
+
+	std::vector<BYTE> vBitValues;
+	std::vector<WORD> vWordValues;
+
+	procReader->readBits(vBits, vBitValues);
+	procReader->readWords(vWords, vWordValues);
+
+	ASSERT_EQ(2u, vBitValues.size());
+	ASSERT_FALSE(vBitValues[0]);
+	ASSERT_FALSE(vBitValues[1]);
+	ASSERT_EQ(2u, vWordValues.size());
+	ASSERT_EQ(0, vWordValues[0]);
+	ASSERT_EQ(0, vWordValues[1]);
+
+	// Change process data
+	procWriter->setBit(testModbusTag);
+	procWriter->writeWord(vWordTags[0], 1234);
+	procWriter->writeWord(vWordTags[1], 4321);
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	procReader->readBits(vBits, vBitValues);
+	procReader->readWords(vWords, vWordValues);
+
+	ASSERT_FALSE(vBitValues[0]);
+	ASSERT_TRUE(vBitValues[1]);
+	ASSERT_EQ(1234, vWordValues[0]);
+	ASSERT_EQ(4321, vWordValues[1]);
+
+	// Not bound handle
+	vWords.push_back(onh::ProcessTagHandle());
+
+	try {
+
+		procReader->readWords(vWords, vWordValues);
+
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+
+		ASSERT_STREQ(e.what(), "ProcessReader::readWords: Tag handle is not bound");
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+}
+
 #endif /* TESTS_DRIVER_PROCESSREADERTESTS_H_ */
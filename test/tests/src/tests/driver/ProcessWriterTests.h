@@ -20,6 +20,8 @@
 #define TESTS_DRIVER_PROCESSWRITERTESTS_H_
 
 #include <gtest/gtest.h>
+#include <future>
+#include <chrono>
 #include "DriverTestsFixtures.h"
 
 /**
@@ -1579,4 +1581,215 @@ TEST_F(driverTests, processWriterSetRealException4) {
 	}
 }
 
+/**
+ * Check process writer write batch
+ */
+TEST_F(driverTests, processWriterBatch) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	onh::Tag wShm = createWordTag({onh::PDA_MEMORY, 10, 0});
+	onh::Tag rShm = createRealTag({onh::PDA_OUTPUT, 20, 0});
+	onh::Tag wModbus = createWordTag({onh::PDA_OUTPUT, 8, 0}, onh::DT_Modbus);
+	onh::Tag bModbus = createByteTag({onh::PDA_OUTPUT, 11, 0}, onh::DT_Modbus);
+
+	procWriter->beginBatch();
+	ASSERT_TRUE(procWriter->isBatchActive());
+
+	procWriter->setBit(testShmTag);
+	procWriter->setBit(testModbusTag);
+	procWriter->writeWord(wShm, 1200);
+	procWriter->writeReal(rShm, 3.5);
+	procWriter->writeWord(wModbus, 3400);
+	procWriter->writeByte(bModbus, 7);
+
+	// Nothing is written before commit
+	ASSERT_FALSE(procReader->getBitValue(testShmTag));
+	ASSERT_FALSE(procReader->getBitValue(testModbusTag));
+
+	onh::writeBatchStats stats = procWriter->commitBatch();
+	ASSERT_FALSE(procWriter->isBatchActive());
+	ASSERT_EQ(6u, stats.operations);
+	ASSERT_EQ(2u, stats.connections);
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	ASSERT_TRUE(procReader->getBitValue(testShmTag));
+	ASSERT_TRUE(procReader->getBitValue(testModbusTag));
+	ASSERT_EQ(1200, procReader->getWord(wShm));
+	ASSERT_EQ(3.5, procReader->getReal(rShm));
+	ASSERT_EQ(3400, procReader->getWord(wModbus));
+	ASSERT_EQ(7, procReader->getByte(bModbus));
+}
+
+/**
+ * Check process writer write batch cancel
+ */
+TEST_F(driverTests, processWriterBatchCancel) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	procWriter->beginBatch();
+	procWriter->setBit(testShmTag);
+	procWriter->cancelBatch();
+	ASSERT_FALSE(procWriter->isBatchActive());
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	ASSERT_FALSE(procReader->getBitValue(testShmTag));
+
+	try {
+
+		procWriter->commitBatch();
+
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+
+		ASSERT_STREQ(e.what(), "ProcessWriter::commitBatch: Write batch is not active");
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+}
+
+/**
+ * Check process writer write batch wrong byte address
+ */
+TEST_F(driverTests, processWriterBatchException) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	procWriter->beginBatch();
+	procWriter->setBit(testShmTag);
+	procWriter->writeDWord(createDWordTag({onh::PDA_OUTPUT, maxModbusBytes-2, 0}, onh::DT_Modbus), 5);
+
+	try {
+
+		procWriter->commitBatch();
+
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+
+		std::stringstream s;
+		s << "ProcessWriter::commitBatch: ";
+		s << "ModbusUtils::checkProcessAddress: Byte address is out of range";
+
+		ASSERT_STREQ(e.what(), s.str().c_str());
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+
+	ASSERT_FALSE(procWriter->isBatchActive());
+}
+
+/**
+ * Execute all driver write queues
+ *
+ * @param drvM Driver manager
+ */
+static void executeWriteQueues(onh::DriverManager *drvM) {
+	for (onh::DriverWriteQueueData& wq : drvM->getDriverWriteQueues()) {
+		wq.writeQueue->execute(0);
+	}
+}
+
+/**
+ * Check process writer asynchronous writes
+ */
+TEST_F(driverTests, processWriterAsync) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	onh::Tag wShm = createWordTag({onh::PDA_MEMORY, 10, 0});
+	onh::Tag wModbus = createWordTag({onh::PDA_OUTPUT, 8, 0}, onh::DT_Modbus);
+
+	std::future<void> f1 = procWriter->writeWordAsync(wShm, 1200);
+	std::future<void> f2 = procWriter->writeWordAsync(wModbus, 3400, onh::PWP_HIGH);
+	std::future<void> f3 = procWriter->setBitAsync(testModbusTag);
+
+	// Writes are waiting in the queues
+	ASSERT_EQ(std::future_status::timeout, f1.wait_for(std::chrono::seconds(0)));
+	ASSERT_EQ(std::future_status::timeout, f2.wait_for(std::chrono::seconds(0)));
+	ASSERT_EQ(std::future_status::timeout, f3.wait_for(std::chrono::seconds(0)));
+
+	executeWriteQueues(drvM);
+
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_NO_THROW(f2.get());
+	ASSERT_NO_THROW(f3.get());
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	ASSERT_EQ(1200, procReader->getWord(wShm));
+	ASSERT_EQ(3400, procReader->getWord(wModbus));
+	ASSERT_TRUE(procReader->getBitValue(testModbusTag));
+}
+
+/**
+ * Check process writer asynchronous writes to the same address
+ */
+TEST_F(driverTests, processWriterAsyncCoalesce) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	onh::Tag wShm = createWordTag({onh::PDA_MEMORY, 10, 0});
+
+	std::future<void> f1 = procWriter->writeWordAsync(wShm, 1200);
+	std::future<void> f2 = procWriter->writeWordAsync(wShm, 1300);
+
+	unsigned int pending = 0;
+	for (onh::DriverWriteQueueData& wq : drvM->getDriverWriteQueues()) {
+		pending += wq.writeQueue->size();
+	}
+	ASSERT_EQ(1u, pending);
+
+	executeWriteQueues(drvM);
+
+	ASSERT_NO_THROW(f1.get());
+	ASSERT_NO_THROW(f2.get());
+
+	// Wait on synchronization
+	waitOnSyncBit();
+
+	ASSERT_EQ(1300, procReader->getWord(wShm));
+}
+
+/**
+ * Check process writer asynchronous write wrong byte address
+ */
+TEST_F(driverTests, processWriterAsyncException) {
+
+	// Check all process data
+	checkAllDataCleared();
+
+	std::future<void> f1 = procWriter->setBitAsync(testShmTag);
+	std::future<void> f2 = procWriter->writeDWordAsync(createDWordTag({onh::PDA_OUTPUT, maxModbusBytes-2, 0}, onh::DT_Modbus), 5);
+
+	executeWriteQueues(drvM);
+
+	ASSERT_NO_THROW(f1.get());
+
+	try {
+
+		f2.get();
+
+		FAIL() << "Expected onh::DriverException";
+	} catch (onh::DriverException &e) {
+
+		ASSERT_STREQ(e.what(), "ModbusUtils::checkProcessAddress: Byte address is out of range");
+
+	} catch(...) {
+		FAIL() << "Expected onh::DriverException";
+	}
+}
+
 #endif /* TESTS_DRIVER_PROCESSWRITERTESTS_H_ */
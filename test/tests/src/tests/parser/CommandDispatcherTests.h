@@ -0,0 +1,110 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_PARSER_COMMANDDISPATCHERTESTS_H_
+#define TEST_SRC_TESTS_PARSER_COMMANDDISPATCHERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <parser/CommandDispatcher.h>
+#include <parser/CommandList.h>
+#include <utils/SharedDataContainer.h>
+
+/**
+ * Command dispatcher test fixture (commands rejected before execution - no DB and drivers)
+ */
+class CommandDispatcherTests: public ::testing::Test {
+	protected:
+		void SetUp() override {
+			dispatcher = std::make_unique<onh::CommandDispatcher>(nullptr,
+																	nullptr,
+																	nullptr,
+																	nullptr,
+																	exitData.getController(),
+																	nullptr,
+																	nullptr);
+		}
+
+		/**
+		 * Check command is rejected as unknown
+		 *
+		 * @param query Query string
+		 * @param insideMulti Command is a part of the multi command
+		 */
+		void checkRejected(const std::string& query, bool insideMulti) {
+			try {
+				dispatcher->execute(query, insideMulti ? CMD_MULTI_VALUE_SEPARATOR : CMD_SEPARATOR, insideMulti);
+				FAIL() << "Command should be rejected: " << query;
+			} catch (onh::CommandParserException &e) {
+				ASSERT_EQ(onh::CommandParserException::UNKNOWN_COMMAND, e.getType()) << query;
+			}
+		}
+
+		/// Thread exit data
+		onh::SharedDataContainer<onh::ThreadExitData> exitData;
+
+		/// Tested dispatcher
+		std::unique_ptr<onh::CommandDispatcher> dispatcher;
+};
+
+/**
+ * Check unknown command number
+ */
+TEST_F(CommandDispatcherTests, UnknownCommand) {
+
+	checkRejected("999|TAG1", false);
+	checkRejected("999?TAG1", true);
+}
+
+/**
+ * Check commands not allowed inside multi command
+ */
+TEST_F(CommandDispatcherTests, NotAllowedInsideMulti) {
+
+	checkRejected("50?10", true);
+	checkRejected("60?TAG1", true);
+	checkRejected("500?1", true);
+}
+
+/**
+ * Check read only commands
+ */
+TEST_F(CommandDispatcherTests, ReadOnly) {
+
+	ASSERT_TRUE(dispatcher->isReadOnly("10|TAG1", CMD_SEPARATOR));
+	ASSERT_TRUE(dispatcher->isReadOnly("20|TAG1,TAG2", CMD_SEPARATOR));
+	ASSERT_FALSE(dispatcher->isReadOnly("11|TAG1", CMD_SEPARATOR));
+	ASSERT_FALSE(dispatcher->isReadOnly("999|TAG1", CMD_SEPARATOR));
+	ASSERT_FALSE(dispatcher->isReadOnly("60|TAG1", CMD_SEPARATOR));
+}
+
+/**
+ * Check read only multi command
+ */
+TEST_F(CommandDispatcherTests, ReadOnlyMulti) {
+
+	ASSERT_TRUE(dispatcher->isReadOnly("50|10?TAG1!30?TAG2!38?TAG3", CMD_SEPARATOR));
+
+	// Reads mixed with writes
+	ASSERT_FALSE(dispatcher->isReadOnly("50|10?TAG1!31?TAG2,5!38?TAG3", CMD_SEPARATOR));
+	ASSERT_FALSE(dispatcher->isReadOnly("50|13?TAG1!10?TAG1", CMD_SEPARATOR));
+
+	// Unknown command inside multi command
+	ASSERT_FALSE(dispatcher->isReadOnly("50|10?TAG1!999?TAG2", CMD_SEPARATOR));
+}
+
+#endif /* TEST_SRC_TESTS_PARSER_COMMANDDISPATCHERTESTS_H_ */
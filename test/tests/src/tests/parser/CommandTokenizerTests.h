@@ -0,0 +1,139 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_PARSER_COMMANDTOKENIZERTESTS_H_
+#define TEST_SRC_TESTS_PARSER_COMMANDTOKENIZERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <parser/CommandTokenizer.h>
+
+/**
+ * Check split of the valid query
+ */
+TEST(CommandTokenizerTests, Split) {
+
+	onh::commandTokens ct = onh::CommandTokenizer::split("10|TAG1", '|');
+
+	ASSERT_EQ(10, ct.command);
+	ASSERT_EQ("TAG1", ct.data);
+}
+
+/**
+ * Check split of the empty query
+ */
+TEST(CommandTokenizerTests, SplitEmpty) {
+
+	try {
+		onh::CommandTokenizer::split("", '|');
+		FAIL() << "Empty query should be rejected";
+	} catch (onh::CommandParserException &e) {
+		ASSERT_EQ(onh::CommandParserException::WRONG_DATA, e.getType());
+	}
+}
+
+/**
+ * Check split of the query with wrong separators count
+ */
+TEST(CommandTokenizerTests, SplitWrongSeparators) {
+
+	// Missing separator, trailing separator, two separators
+	const char *queries[] = {"10TAG1", "10|", "10|TAG1|"};
+
+	for (const char *q : queries) {
+		try {
+			onh::CommandTokenizer::split(q, '|');
+			FAIL() << "Query should be rejected: " << q;
+		} catch (onh::CommandParserException &e) {
+			ASSERT_EQ(onh::CommandParserException::WRONG_DATA_COUNT, e.getType()) << q;
+		}
+	}
+}
+
+/**
+ * Check split of the query with not numeric command
+ */
+TEST(CommandTokenizerTests, SplitUnknownCommand) {
+
+	try {
+		onh::CommandTokenizer::split("GET|TAG1", '|');
+		FAIL() << "Not numeric command should be rejected";
+	} catch (onh::CommandParserException &e) {
+		ASSERT_EQ(onh::CommandParserException::UNKNOWN_COMMAND, e.getType());
+	}
+}
+
+/**
+ * Check next token
+ */
+TEST(CommandTokenizerTests, NextToken) {
+
+	std::string_view data = "TAG1,TAG2";
+
+	ASSERT_EQ("TAG1", onh::CommandTokenizer::nextToken(data, ','));
+	ASSERT_EQ("TAG2", data);
+	ASSERT_EQ("TAG2", onh::CommandTokenizer::nextToken(data, ','));
+	ASSERT_TRUE(data.empty());
+}
+
+/**
+ * Check next token from empty data and data without separator
+ */
+TEST(CommandTokenizerTests, NextTokenNoSeparator) {
+
+	std::string_view data;
+
+	ASSERT_TRUE(onh::CommandTokenizer::nextToken(data, ',').empty());
+	ASSERT_TRUE(data.empty());
+
+	data = "TAG1";
+
+	ASSERT_EQ("TAG1", onh::CommandTokenizer::nextToken(data, ','));
+	ASSERT_TRUE(data.empty());
+}
+
+/**
+ * Check next token from data with trailing separator
+ */
+TEST(CommandTokenizerTests, NextTokenTrailingSeparator) {
+
+	std::string_view data = "TAG1,";
+
+	ASSERT_EQ("TAG1", onh::CommandTokenizer::nextToken(data, ','));
+	ASSERT_TRUE(data.empty());
+}
+
+/**
+ * Check command number conversion
+ */
+TEST(CommandTokenizerTests, ToNumber) {
+
+	int cmd = 0;
+
+	ASSERT_TRUE(onh::CommandTokenizer::toNumber("600", cmd));
+	ASSERT_EQ(600, cmd);
+
+	// Overflow
+	ASSERT_FALSE(onh::CommandTokenizer::toNumber("2147483648", cmd));
+	// Not numeric
+	ASSERT_FALSE(onh::CommandTokenizer::toNumber("", cmd));
+	ASSERT_FALSE(onh::CommandTokenizer::toNumber("abc", cmd));
+	ASSERT_FALSE(onh::CommandTokenizer::toNumber("10a", cmd));
+	ASSERT_FALSE(onh::CommandTokenizer::toNumber(" 10", cmd));
+}
+
+#endif /* TEST_SRC_TESTS_PARSER_COMMANDTOKENIZERTESTS_H_ */
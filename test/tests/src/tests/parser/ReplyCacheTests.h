@@ -0,0 +1,84 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_PARSER_REPLYCACHETESTS_H_
+#define TEST_SRC_TESTS_PARSER_REPLYCACHETESTS_H_
+
+#include <gtest/gtest.h>
+#include <parser/ReplyCache.h>
+
+/**
+ * Check reply cache within one generation
+ */
+TEST(ReplyCacheTests, SameGeneration) {
+
+	onh::ReplyCache cache;
+	std::string reply;
+
+	ASSERT_FALSE(cache.getReply("10|TAG1", 1, reply));
+
+	cache.putReply("10|TAG1", 1, "10|1");
+
+	ASSERT_TRUE(cache.getReply("10|TAG1", 1, reply));
+	ASSERT_STREQ("10|1", reply.c_str());
+
+	ASSERT_FALSE(cache.getReply("10|TAG2", 1, reply));
+
+	onh::replyCacheStats st = cache.getStats();
+	ASSERT_EQ(1u, st.hits);
+	ASSERT_EQ(2u, st.misses);
+	ASSERT_EQ(1u, st.entries);
+}
+
+/**
+ * Check reply cache after generation change
+ */
+TEST(ReplyCacheTests, GenerationChanged) {
+
+	onh::ReplyCache cache;
+	std::string reply;
+
+	cache.putReply("10|TAG1", 1, "10|1");
+
+	ASSERT_FALSE(cache.getReply("10|TAG1", 2, reply));
+
+	// Reply from older generation is not stored
+	cache.putReply("10|TAG1", 1, "10|1");
+	ASSERT_FALSE(cache.getReply("10|TAG1", 2, reply));
+
+	ASSERT_EQ(0u, cache.getStats().entries);
+}
+
+/**
+ * Check reply cache entries limit
+ */
+TEST(ReplyCacheTests, MaxEntries) {
+
+	onh::ReplyCache cache(2);
+	std::string reply;
+
+	cache.putReply("10|TAG1", 1, "10|1");
+	cache.putReply("10|TAG2", 1, "10|0");
+	cache.putReply("10|TAG3", 1, "10|0");
+
+	ASSERT_TRUE(cache.getReply("10|TAG2", 1, reply));
+	ASSERT_FALSE(cache.getReply("10|TAG3", 1, reply));
+	ASSERT_EQ(2u, cache.getStats().entries);
+}
+
+#endif  // TEST_SRC_TESTS_PARSER_REPLYCACHETESTS_H_
@@ -0,0 +1,152 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_PARSER_TAGSUBSCRIPTIONTESTS_H_
+#define TEST_SRC_TESTS_PARSER_TAGSUBSCRIPTIONTESTS_H_
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <parser/TagSubscription.h>
+#include <parser/CommandParserException.h>
+
+/**
+ * Create subscription test tags
+ *
+ * @return Bit, int and real tag
+ */
+static std::vector<onh::Tag> createSubscriptionTags() {
+	return {
+		onh::Tag(1, 1, "SubBit", onh::TT_BIT, {onh::PDA_MEMORY, 0, 0}),
+		onh::Tag(2, 1, "SubInt", onh::TT_INT, {onh::PDA_MEMORY, 4, 0}),
+		onh::Tag(3, 1, "SubReal", onh::TT_REAL, {onh::PDA_MEMORY, 8, 0})
+	};
+}
+
+/**
+ * Check subscription request parsing
+ */
+TEST(TagSubscriptionTests, ParseRequest) {
+
+	onh::subscriptionRequest req = onh::TagSubscription::parseRequest("100,0.5,TAG1,TAG2");
+
+	ASSERT_EQ(100u, req.interval);
+	ASSERT_DOUBLE_EQ(0.5, req.deadband);
+	ASSERT_EQ(2u, req.tagNames.size());
+	ASSERT_STREQ("TAG1", req.tagNames[0].c_str());
+	ASSERT_STREQ("TAG2", req.tagNames[1].c_str());
+
+	req = onh::TagSubscription::parseRequest("0,0,TAG1");
+
+	ASSERT_EQ(0u, req.interval);
+	ASSERT_DOUBLE_EQ(0, req.deadband);
+	ASSERT_EQ(1u, req.tagNames.size());
+}
+
+/**
+ * Check wrong subscription requests
+ */
+TEST(TagSubscriptionTests, ParseRequestWrongData) {
+
+	ASSERT_THROW(onh::TagSubscription::parseRequest(""), onh::CommandParserException);
+	ASSERT_THROW(onh::TagSubscription::parseRequest("100,0.5"), onh::CommandParserException);
+	ASSERT_THROW(onh::TagSubscription::parseRequest("abc,0.5,TAG1"), onh::CommandParserException);
+	ASSERT_THROW(onh::TagSubscription::parseRequest("100,abc,TAG1"), onh::CommandParserException);
+	ASSERT_THROW(onh::TagSubscription::parseRequest("100,-1,TAG1"), onh::CommandParserException);
+}
+
+/**
+ * Check first subscription update (all values sent)
+ */
+TEST(TagSubscriptionTests, FirstUpdate) {
+
+	onh::TagSubscription ts;
+
+	ASSERT_FALSE(ts.isActive());
+	ASSERT_FALSE(ts.isUpdateNeeded(1));
+	ASSERT_THROW(ts.subscribe({}, 0, 0), onh::Exception);
+	ASSERT_THROW(ts.subscribe(createSubscriptionTags(), 0, -1), onh::Exception);
+
+	ts.subscribe(createSubscriptionTags(), 0, 0);
+
+	ASSERT_TRUE(ts.isActive());
+	ASSERT_TRUE(ts.isUpdateNeeded(1));
+	ASSERT_THROW(ts.getUpdate(std::vector<double>{1, 2}, 1), onh::Exception);
+	ASSERT_STREQ("61|SubBit:1,SubInt:-5,SubReal:2.5", ts.getUpdate({1, -5, 2.5}, 1).c_str());
+
+	// Same process data generation
+	ASSERT_FALSE(ts.isUpdateNeeded(1));
+
+	// Nothing changed
+	ASSERT_TRUE(ts.isUpdateNeeded(2));
+	ASSERT_STREQ("", ts.getUpdate({1, -5, 2.5}, 2).c_str());
+
+	// Only changed values sent
+	ASSERT_STREQ("61|SubBit:0", ts.getUpdate({0, -5, 2.5}, 3).c_str());
+
+	ts.cancel();
+
+	ASSERT_FALSE(ts.isActive());
+	ASSERT_FALSE(ts.isUpdateNeeded(4));
+	ASSERT_THROW(ts.getUpdate({0, -5, 2.5}, 4), onh::Exception);
+}
+
+/**
+ * Check numeric values deadband
+ */
+TEST(TagSubscriptionTests, Deadband) {
+
+	onh::TagSubscription ts;
+
+	ts.subscribe(createSubscriptionTags(), 0, 1.5);
+
+	ts.getUpdate({0, 10, 1}, 1);
+
+	// Change below deadband
+	ASSERT_STREQ("", ts.getUpdate({0, 11, 2}, 2).c_str());
+
+	// Change from the last sent value reaches deadband
+	ASSERT_STREQ("61|SubInt:12", ts.getUpdate({0, 12, 2}, 3).c_str());
+	ASSERT_STREQ("61|SubReal:-0.5", ts.getUpdate({0, 12, -0.5}, 4).c_str());
+
+	// Bits are not filtered by deadband
+	ASSERT_STREQ("61|SubBit:1", ts.getUpdate({1, 12, -0.5}, 5).c_str());
+}
+
+/**
+ * Check minimum interval between updates
+ */
+TEST(TagSubscriptionTests, MinimumInterval) {
+
+	onh::TagSubscription ts;
+
+	ts.subscribe(createSubscriptionTags(), 50, 0);
+
+	// First update is not delayed
+	ASSERT_TRUE(ts.isUpdateNeeded(1));
+	ts.getUpdate({0, 0, 0}, 1);
+
+	// Process data changed - interval not passed
+	ASSERT_FALSE(ts.isUpdateNeeded(2));
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+	ASSERT_TRUE(ts.isUpdateNeeded(2));
+	ASSERT_FALSE(ts.isUpdateNeeded(1));
+}
+
+#endif  // TEST_SRC_TESTS_PARSER_TAGSUBSCRIPTIONTESTS_H_
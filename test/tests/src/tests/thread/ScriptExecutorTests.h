@@ -0,0 +1,189 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_THREAD_SCRIPTEXECUTORTESTS_H_
+#define TEST_SRC_TESTS_THREAD_SCRIPTEXECUTORTESTS_H_
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <thread/Script/ScriptExecutor.h>
+
+/**
+ * Create test script
+ *
+ * @param name Script file name
+ * @param body Script body
+ * @param shebang Add shebang line
+ *
+ * @return Script path
+ */
+inline std::string createTestScript(const std::string& name, const std::string& body, bool shebang = true) {
+	std::string path = "/tmp/" + name;
+
+	std::ofstream f(path);
+	if (shebang)
+		f << "#!/bin/sh\n";
+	f << body << "\n";
+	f.close();
+
+	chmod(path.c_str(), S_IRWXU);
+
+	return path;
+}
+
+/**
+ * Wait for script results
+ *
+ * @param ex Script executor
+ * @param count Expected results count
+ *
+ * @return Script results
+ */
+inline std::vector<onh::scriptResult> waitScriptResults(onh::ScriptExecutor& ex, unsigned int count) {
+	std::vector<onh::scriptResult> ret;
+
+	for (int i = 0; i < 500 && ret.size() < count; ++i) {
+		std::vector<onh::scriptResult> r = ex.getFinished();
+		ret.insert(ret.end(), r.begin(), r.end());
+
+		if (ret.size() < count)
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	return ret;
+}
+
+/**
+ * Read whole file
+ *
+ * @param path File path
+ *
+ * @return File content
+ */
+inline std::string readScriptLog(const std::string& path) {
+	std::ifstream f(path);
+	std::stringstream s;
+	s << f.rdbuf();
+
+	return s.str();
+}
+
+/**
+ * Check script output and exit code
+ */
+TEST(ScriptExecutorTests, Run) {
+
+	std::string sc = createTestScript("onh_test_script1.sh", "echo out1\necho err1 1>&2\nexit 3");
+
+	onh::ScriptExecutor ex(2, 0);
+	ex.run(7, sc, "/tmp/onh_test_script1.log");
+
+	std::vector<onh::scriptResult> res = waitScriptResults(ex, 1);
+
+	ASSERT_EQ(1u, res.size());
+	ASSERT_EQ(7u, res[0].id);
+	ASSERT_EQ(3, res[0].exitCode);
+	ASSERT_FALSE(res[0].timeout);
+
+	std::string log = readScriptLog("/tmp/onh_test_script1.log");
+	ASSERT_NE(std::string::npos, log.find("out1\nerr1\n"));
+	ASSERT_NE(std::string::npos, log.find("finished with exit code 3"));
+}
+
+/**
+ * Check script without shebang line (executed by the shell)
+ */
+TEST(ScriptExecutorTests, NoShebang) {
+
+	std::string sc = createTestScript("onh_test_script5.sh", "echo noshebang\nexit 4", false);
+
+	onh::ScriptExecutor ex(1, 0);
+	ex.run(8, sc, "/tmp/onh_test_script5.log");
+
+	std::vector<onh::scriptResult> res = waitScriptResults(ex, 1);
+
+	ASSERT_EQ(1u, res.size());
+	ASSERT_EQ(4, res[0].exitCode);
+	ASSERT_NE(std::string::npos, readScriptLog("/tmp/onh_test_script5.log").find("noshebang\n"));
+}
+
+/**
+ * Check scripts queue (pool size 1)
+ */
+TEST(ScriptExecutorTests, Queue) {
+
+	std::string sc = createTestScript("onh_test_script2.sh", "sleep 0.1\necho done");
+
+	onh::ScriptExecutor ex(1, 0);
+	ex.run(1, sc, "/tmp/onh_test_script2_1.log");
+	ex.run(2, sc, "/tmp/onh_test_script2_2.log");
+	ex.run(3, sc, "/tmp/onh_test_script2_3.log");
+
+	std::vector<onh::scriptResult> res = waitScriptResults(ex, 3);
+
+	// Scripts executed one after another
+	ASSERT_EQ(3u, res.size());
+	for (unsigned int i = 0; i < res.size(); ++i) {
+		ASSERT_EQ(i+1, res[i].id);
+		ASSERT_EQ(0, res[i].exitCode);
+	}
+	ASSERT_EQ(0u, ex.getQueued());
+}
+
+/**
+ * Check script timeout
+ */
+TEST(ScriptExecutorTests, Timeout) {
+
+	std::string sc = createTestScript("onh_test_script3.sh", "echo start\nsleep 10");
+
+	onh::ScriptExecutor ex(1, 100);
+	ex.run(4, sc, "/tmp/onh_test_script3.log");
+
+	std::vector<onh::scriptResult> res = waitScriptResults(ex, 1);
+
+	ASSERT_EQ(1u, res.size());
+	ASSERT_TRUE(res[0].timeout);
+	ASSERT_EQ(SCRIPT_EXIT_CODE_ERROR, res[0].exitCode);
+	ASSERT_LT(res[0].duration, 2000u);
+
+	std::string log = readScriptLog("/tmp/onh_test_script3.log");
+	ASSERT_NE(std::string::npos, log.find("start\n"));
+	ASSERT_NE(std::string::npos, log.find("killed after timeout"));
+}
+
+/**
+ * Check not existing script
+ */
+TEST(ScriptExecutorTests, NoScript) {
+
+	onh::ScriptExecutor ex(1, 0);
+	ex.run(5, "/tmp/onh_test_script_not_exist.sh", "/tmp/onh_test_script4.log");
+
+	std::vector<onh::scriptResult> res = waitScriptResults(ex, 1);
+
+	ASSERT_EQ(1u, res.size());
+	ASSERT_EQ(SCRIPT_EXIT_CODE_ERROR, res[0].exitCode);
+	ASSERT_NE(std::string::npos, readScriptLog("/tmp/onh_test_script4.log").find("Can not start script"));
+}
+
+#endif /* TEST_SRC_TESTS_THREAD_SCRIPTEXECUTORTESTS_H_ */
@@ -0,0 +1,229 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_THREAD_SCRIPTTABLETESTS_H_
+#define TEST_SRC_TESTS_THREAD_SCRIPTTABLETESTS_H_
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <thread/Script/ScriptTable.h>
+
+/**
+ * Script table test fixture (trigger values replace process reader)
+ */
+class ScriptTableTests: public ::testing::Test {
+	protected:
+		void SetUp() override {
+			triggerTag = onh::Tag(5, 1, "TriggerTag1", onh::TT_BIT, {onh::PDA_INPUT, 4, 6});
+			triggerTag2 = onh::Tag(6, 1, "TriggerTag2", onh::TT_BIT, {onh::PDA_INPUT, 4, 7});
+			feedbackTag = onh::Tag(9, 1, "FeedbackTag1", onh::TT_BIT, {onh::PDA_MEMORY, 70, 0});
+
+			items.clear();
+			items.push_back(onh::ScriptItem(1, triggerTag, "script1.sh", false, false, true));
+			items.push_back(onh::ScriptItem(2, triggerTag2, "script2.sh", false, false, feedbackTag, true));
+
+			table.load(items);
+		}
+
+		/**
+		 * Evaluate trigger values
+		 *
+		 * @param t1 Trigger value of the first script
+		 * @param t2 Trigger value of the second script
+		 */
+		void check(BYTE t1, BYTE t2) {
+			table.checkTriggers({t1, t2}, started, unlocked);
+		}
+
+		/// Trigger tags
+		onh::Tag triggerTag, triggerTag2;
+
+		/// Feedback run tag
+		onh::Tag feedbackTag;
+
+		/// Script definitions
+		std::vector<onh::ScriptItem> items;
+
+		/// Tested table
+		onh::ScriptTable table;
+
+		/// Started scripts
+		std::vector<unsigned int> started;
+
+		/// Unlocked scripts
+		std::vector<unsigned int> unlocked;
+};
+
+TEST_F(ScriptTableTests, Tags) {
+	ASSERT_EQ(2u, table.size());
+
+	std::vector<onh::Tag> tags = table.getTriggerTags();
+	ASSERT_EQ(2u, tags.size());
+	ASSERT_EQ(5u, tags[0].getId());
+	ASSERT_EQ(6u, tags[1].getId());
+
+	tags = table.getFeedbackTags();
+	ASSERT_EQ(1u, tags.size());
+	ASSERT_EQ(9u, tags[0].getId());
+	ASSERT_EQ(std::vector<unsigned int>({1}), table.getFeedbackScripts());
+	ASSERT_FALSE(table.at(0).hasFeedback);
+	ASSERT_TRUE(table.at(1).hasFeedback);
+}
+
+TEST_F(ScriptTableTests, RisingEdge) {
+	check(0, 0);
+	ASSERT_TRUE(started.empty());
+
+	// Rising edge starts script
+	check(1, 0);
+	ASSERT_EQ(std::vector<unsigned int>({0}), started);
+	ASSERT_TRUE(table.at(0).item.isRunning());
+	ASSERT_TRUE(table.at(0).item.isLocked());
+	ASSERT_FALSE(table.at(1).item.isRunning());
+
+	// High level does not start script again
+	table.setFinished(1, 0);
+	check(1, 0);
+	ASSERT_TRUE(started.empty());
+	ASSERT_FALSE(table.at(0).item.isRunning());
+	ASSERT_TRUE(table.at(0).item.isLocked());
+}
+
+TEST_F(ScriptTableTests, TriggerHighOnLoad) {
+	// Trigger already set when script is loaded
+	check(1, 1);
+	ASSERT_EQ(std::vector<unsigned int>({0, 1}), started);
+
+	// Running script is not started on next rising edge
+	check(0, 0);
+	check(1, 1);
+	ASSERT_TRUE(started.empty());
+	ASSERT_TRUE(unlocked.empty());
+}
+
+TEST_F(ScriptTableTests, LockRelease) {
+	check(1, 0);
+	table.setFinished(1, 3);
+
+	// Script stays locked until trigger release
+	check(1, 0);
+	ASSERT_TRUE(unlocked.empty());
+	ASSERT_TRUE(table.at(0).item.isLocked());
+
+	check(0, 0);
+	ASSERT_EQ(std::vector<unsigned int>({0}), unlocked);
+	ASSERT_FALSE(table.at(0).item.isLocked());
+
+	// Next rising edge starts script again
+	check(1, 0);
+	ASSERT_EQ(std::vector<unsigned int>({0}), started);
+}
+
+TEST_F(ScriptTableTests, LockReleaseWhileRunning) {
+	check(1, 0);
+
+	// Running script is not unlocked
+	check(0, 0);
+	ASSERT_TRUE(unlocked.empty());
+	ASSERT_TRUE(table.at(0).item.isLocked());
+
+	// Unlocked after finish
+	table.setFinished(1, 0);
+	check(0, 0);
+	ASSERT_EQ(std::vector<unsigned int>({0}), unlocked);
+}
+
+TEST_F(ScriptTableTests, WrongTriggerCount) {
+	ASSERT_THROW(table.checkTriggers({1}, started, unlocked), onh::Exception);
+}
+
+TEST_F(ScriptTableTests, StateSaving) {
+	// Nothing to save
+	ASSERT_TRUE(table.takeStates().empty());
+
+	check(1, 0);
+
+	std::vector<onh::scriptState> states = table.takeStates();
+	ASSERT_EQ(1u, states.size());
+	ASSERT_EQ(1u, states[0].id);
+	ASSERT_TRUE(states[0].run);
+	ASSERT_TRUE(states[0].lock);
+	ASSERT_FALSE(states[0].exitCodeValid);
+
+	// States are saved only once
+	ASSERT_TRUE(table.takeStates().empty());
+
+	table.setFinished(1, 7);
+	check(0, 0);
+
+	// Finish and unlock merged into one state
+	states = table.takeStates();
+	ASSERT_EQ(1u, states.size());
+	ASSERT_FALSE(states[0].run);
+	ASSERT_FALSE(states[0].lock);
+	ASSERT_TRUE(states[0].exitCodeValid);
+	ASSERT_EQ(7, states[0].exitCode);
+}
+
+TEST_F(ScriptTableTests, ReloadKeepsState) {
+	check(1, 0);
+
+	// Definitions changed during execution
+	items[0].setName("script1b.sh");
+	table.load(items);
+
+	ASSERT_EQ("script1b.sh", table.at(0).item.getName());
+	ASSERT_TRUE(table.at(0).item.isRunning());
+	ASSERT_TRUE(table.at(0).item.isLocked());
+	ASSERT_TRUE(table.at(0).trigger);
+
+	// Not saved state is kept
+	std::vector<onh::scriptState> states = table.takeStates();
+	ASSERT_EQ(1u, states.size());
+	ASSERT_EQ(1u, states[0].id);
+	ASSERT_TRUE(states[0].run);
+}
+
+TEST_F(ScriptTableTests, ReloadRemovedScript) {
+	check(1, 1);
+
+	// Second script removed before its state was saved
+	items.pop_back();
+	table.load(items);
+	ASSERT_EQ(1u, table.size());
+	ASSERT_TRUE(table.getFeedbackTags().empty());
+
+	std::vector<onh::scriptState> states = table.takeStates();
+	ASSERT_EQ(2u, states.size());
+	ASSERT_EQ(2u, states[0].id);
+	ASSERT_EQ(1u, states[1].id);
+
+	// Removed script finished
+	ASSERT_FALSE(table.setFinished(2, 1));
+	ASSERT_TRUE(table.setFinished(1, 0));
+
+	states = table.takeStates();
+	ASSERT_EQ(2u, states.size());
+	ASSERT_EQ(2u, states[0].id);
+	ASSERT_FALSE(states[0].run);
+	ASSERT_TRUE(states[0].exitCodeValid);
+	ASSERT_EQ(1, states[0].exitCode);
+	ASSERT_EQ(1u, states[1].id);
+}
+
+#endif  // TEST_SRC_TESTS_THREAD_SCRIPTTABLETESTS_H_
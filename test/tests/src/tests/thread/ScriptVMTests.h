@@ -0,0 +1,160 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_THREAD_SCRIPTVMTESTS_H_
+#define TEST_SRC_TESTS_THREAD_SCRIPTVMTESTS_H_
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include <thread/Script/ScriptCompiler.h>
+#include <thread/Script/ScriptVM.h>
+#include <utils/Exception.h>
+
+/**
+ * Test script host (tags stored in memory)
+ */
+class TestScriptHost: public onh::ScriptHost {
+	public:
+		explicit TestScriptHost(unsigned int tagsCount):
+			tags(tagsCount, 0.0) {
+		}
+
+		double readTag(unsigned int idx) override {
+			return tags[idx];
+		}
+
+		void writeTag(unsigned int idx, double val) override {
+			tags[idx] = val;
+		}
+
+		void print(double val) override {
+			out << val << "\n";
+		}
+
+		/// Tag values
+		std::vector<double> tags;
+
+		/// Script output
+		std::stringstream out;
+};
+
+/**
+ * Check embedded script compilation and run
+ */
+TEST(ScriptVMTests, Run) {
+
+	onh::ScriptBytecodePtr bc = onh::ScriptCompiler::compile(
+			"# Interlock\n"
+			"sum = 0; i = 1\n"
+			"while i <= 10 do sum = sum + i; i = i + 1 end\n"
+			"if $Start and not $Stop then\n"
+			"  $Motor = 1\n"
+			"else\n"
+			"  $Motor = 0\n"
+			"end\n"
+			"$Speed = max(min($Speed * 2, 100), -5) % 7\n"
+			"print sum\n"
+			"exit abs(-3)\n");
+
+	ASSERT_EQ(4u, bc->tags.size());
+	ASSERT_EQ("Start", bc->tags[0]);
+	ASSERT_EQ("Stop", bc->tags[1]);
+	ASSERT_EQ("Motor", bc->tags[2]);
+	ASSERT_EQ("Speed", bc->tags[3]);
+
+	onh::ScriptVM vm;
+	TestScriptHost host(4);
+	host.tags[0] = 1;
+	host.tags[3] = 30;
+
+	onh::scriptRunResult res = vm.run(*bc, host, {0, 0});
+
+	ASSERT_EQ(onh::SRS_OK, res.status);
+	ASSERT_EQ(3, res.exitCode);
+	ASSERT_EQ(1.0, host.tags[2]);
+	ASSERT_EQ(4.0, host.tags[3]);
+	ASSERT_EQ("55\n", host.out.str());
+
+	// Stop active
+	host.tags[1] = 1;
+	res = vm.run(*bc, host, {0, 0});
+
+	ASSERT_EQ(onh::SRS_OK, res.status);
+	ASSERT_EQ(0.0, host.tags[2]);
+}
+
+/**
+ * Check embedded script budgets
+ */
+TEST(ScriptVMTests, Budget) {
+
+	onh::ScriptBytecodePtr bc = onh::ScriptCompiler::compile("while true do x = 1 end");
+
+	onh::ScriptVM vm;
+	TestScriptHost host(0);
+
+	onh::scriptRunResult res = vm.run(*bc, host, {1000, 0});
+	ASSERT_EQ(onh::SRS_INSTRUCTION_LIMIT, res.status);
+	ASSERT_EQ(1001u, res.instructions);
+
+	res = vm.run(*bc, host, {0, 2000});
+	ASSERT_EQ(onh::SRS_TIME_LIMIT, res.status);
+}
+
+/**
+ * Check embedded script runtime error
+ */
+TEST(ScriptVMTests, DivisionByZero) {
+
+	onh::ScriptBytecodePtr bc = onh::ScriptCompiler::compile("x = 0\ny = 5 / x");
+
+	onh::ScriptVM vm;
+	TestScriptHost host(0);
+
+	onh::scriptRunResult res = vm.run(*bc, host, {0, 0});
+	ASSERT_EQ(onh::SRS_ERROR, res.status);
+	ASSERT_EQ("Division by zero", res.error);
+}
+
+/**
+ * Check embedded script compilation errors
+ */
+TEST(ScriptVMTests, CompileErrors) {
+
+	try {
+		onh::ScriptCompiler::compile("x = 1\ny = z + 1");
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+		ASSERT_STREQ(e.what(), "ScriptCompiler::compile: Line 2: Unknown variable 'z'");
+	}
+
+	try {
+		onh::ScriptCompiler::compile("if $A then\n$B = 1\n");
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+		ASSERT_STREQ(e.what(), "ScriptCompiler::compile: Line 3: Missing 'end'");
+	}
+
+	ASSERT_THROW(onh::ScriptCompiler::compile("x = 1 @"), onh::Exception);
+	ASSERT_THROW(onh::ScriptCompiler::compile("x = (1 + 2"), onh::Exception);
+	ASSERT_THROW(onh::ScriptCompiler::compile("end"), onh::Exception);
+	ASSERT_THROW(onh::ScriptCompiler::compile("$ = 1"), onh::Exception);
+}
+
+#endif /* TEST_SRC_TESTS_THREAD_SCRIPTVMTESTS_H_ */
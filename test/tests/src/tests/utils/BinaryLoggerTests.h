@@ -0,0 +1,159 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_UTILS_BINARYLOGGERTESTS_H_
+#define TEST_SRC_TESTS_UTILS_BINARYLOGGERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <utils/logger/BinaryLogger.h>
+#include <utils/logger/BinaryLogDecoder.h>
+#include <utils/logger/LogWriter.h>
+#include <utils/StringUtils.h>
+
+/**
+ * Decode binary log file
+ *
+ * @param path Log file path
+ *
+ * @return Log lines
+ */
+inline std::vector<std::string> binaryLogDecode(const std::string& path) {
+	std::ifstream f(path, std::ios::in | std::ios::binary);
+	onh::BinaryLogDecoder decoder(f);
+	std::vector<std::string> lines;
+	std::string line;
+
+	while (decoder.next(line))
+		lines.push_back(line);
+
+	return lines;
+}
+
+/**
+ * Check binary log entries decoding
+ */
+TEST(BinaryLoggerTests, Decode) {
+
+	system("rm -r -f logs");
+
+	onh::BinaryLogger log("test1", "bin_");
+
+	for (int i = 0; i < 3; ++i) {
+		BLOG_INFO(log, "Cycle {} value {} flag {}", i, 2.5, true);
+	}
+	BLOG_ERROR(log, "{}: {}", std::string("ModbusDriver::connect"), "Connection refused");
+	BLOG_INFO(log, "No arguments");
+	BLOG_INFO(log, "Extra", 10u);
+
+	log.flush();
+
+	std::vector<std::string> lines = binaryLogDecode(log.getLoggerPath());
+	ASSERT_EQ(6u, lines.size());
+
+	std::vector<std::string> msg = onh::StringUtils::explode(lines[0], '|');
+	ASSERT_EQ(2u, msg.size());
+	ASSERT_EQ(" INFO [TestBody] Cycle 0 value 2.5 flag 1", msg[1]);
+
+	msg = onh::StringUtils::explode(lines[2], '|');
+	ASSERT_EQ(" INFO [TestBody] Cycle 2 value 2.5 flag 1", msg[1]);
+
+	msg = onh::StringUtils::explode(lines[3], '|');
+	ASSERT_EQ(" ERROR [TestBody] ModbusDriver::connect: Connection refused", msg[1]);
+
+	msg = onh::StringUtils::explode(lines[4], '|');
+	ASSERT_EQ(" INFO [TestBody] No arguments", msg[1]);
+
+	msg = onh::StringUtils::explode(lines[5], '|');
+	ASSERT_EQ(" INFO [TestBody] Extra 10", msg[1]);
+
+	system("rm -r logs");
+}
+
+/**
+ * Check binary log file rotation (extension is kept)
+ */
+TEST(BinaryLoggerTests, Rotate) {
+
+	system("rm -r -f logs");
+
+	onh::BinaryLogger log("test1", "bin_");
+
+	BLOG_INFO(log, "First");
+	log.flush();
+
+	std::string path = log.getLoggerPath();
+	std::string rotated = path.substr(0, path.rfind('.')) + "_1" + BINARY_LOG_EXTENSION;
+
+	// Full log file (size is read again after file reopen)
+	onh::LogWriter::getWriter().closeFiles("test1");
+	ASSERT_EQ(0, truncate(path.c_str(), LOG_FILE_MAX_SIZE));
+
+	BLOG_INFO(log, "Second");
+	log.flush();
+
+	ASSERT_NE(0, access(path.c_str(), F_OK));
+	ASSERT_EQ(0, access(rotated.c_str(), F_OK));
+
+	// New file after rotation
+	BLOG_INFO(log, "Third");
+	log.flush();
+
+	std::vector<std::string> lines = binaryLogDecode(path);
+	ASSERT_EQ(1u, lines.size());
+
+	std::vector<std::string> msg = onh::StringUtils::explode(lines[0], '|');
+	ASSERT_EQ(" INFO [TestBody] Third", msg[1]);
+
+	system("rm -r logs");
+}
+
+/**
+ * Check wrong binary log file
+ */
+TEST(BinaryLoggerTests, WrongFile) {
+
+	std::stringstream s1("Not a binary log");
+	ASSERT_THROW(onh::BinaryLogDecoder d1(s1), onh::Exception);
+
+	// Entry with unknown format
+	std::string rec(BINARY_LOG_MAGIC);
+	uint32_t len = 12;
+	uint64_t tm = 0;
+	uint32_t id = 7;
+	rec += static_cast<char>(onh::BLR_ENTRY);
+	rec.append(reinterpret_cast<const char*>(&len), sizeof(len));
+	rec.append(reinterpret_cast<const char*>(&tm), sizeof(tm));
+	rec.append(reinterpret_cast<const char*>(&id), sizeof(id));
+
+	std::stringstream s2(rec);
+	onh::BinaryLogDecoder d2(s2);
+	std::string line;
+	ASSERT_THROW(d2.next(line), onh::Exception);
+
+	// Truncated record
+	std::stringstream s3(rec.substr(0, rec.length()-2));
+	onh::BinaryLogDecoder d3(s3);
+	ASSERT_THROW(d3.next(line), onh::Exception);
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_BINARYLOGGERTESTS_H_ */
@@ -0,0 +1,72 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_UTILS_CLOCKTESTS_H_
+#define TEST_SRC_TESTS_UTILS_CLOCKTESTS_H_
+
+#include <gtest/gtest.h>
+#include <utils/Clock.h>
+#include <utils/DateUtils.h>
+
+/**
+ * Check timestamp formatting
+ */
+TEST(ClockTests, Format) {
+
+	long long int t = onh::Clock::parseTimestamp("2019-10-01 12:50:42.563");
+
+	ASSERT_EQ(563, t % 1000);
+	ASSERT_STREQ("2019-10-01 12:50:42.563", onh::Clock::getTimestampString(t).c_str());
+
+	// Same second (cached prefix)
+	ASSERT_STREQ("2019-10-01 12:50:42.007", onh::Clock::getTimestampString(t - 556).c_str());
+	ASSERT_STREQ("2019-10-01 12:50:42.999", onh::Clock::getTimestampString(t + 436).c_str());
+
+	// Next second
+	ASSERT_STREQ("2019-10-01 12:50:43.000", onh::Clock::getTimestampString(t + 437).c_str());
+	ASSERT_STREQ("2019-10-01 12:51:00.040", onh::Clock::getTimestampString(t + 17477).c_str());
+}
+
+/**
+ * Check current time
+ */
+TEST(ClockTests, Now) {
+
+	onh::ClockTime c1 = onh::Clock::now();
+	std::string ds = onh::DateUtils::getTimestampString();
+	onh::ClockTime c2 = onh::Clock::now();
+
+	ASSERT_GE(c2.monotonic, c1.monotonic);
+	ASSERT_GE(c2.realtime, c1.realtime);
+
+	// Same seconds as DateUtils
+	std::string s1 = onh::Clock::getTimestampString(c1.realtime).substr(0, 19);
+	std::string s2 = onh::Clock::getTimestampString(c2.realtime).substr(0, 19);
+	ASSERT_TRUE(ds == s1 || ds == s2);
+}
+
+/**
+ * Check timestamp parse exceptions
+ */
+TEST(ClockTests, ParseException) {
+
+	ASSERT_THROW(onh::Clock::parseTimestamp("2019-10-01 12:50:42"), onh::Exception);
+	ASSERT_THROW(onh::Clock::parseTimestamp("2019-10-01 12:5a:42.563"), onh::Exception);
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_CLOCKTESTS_H_ */
@@ -0,0 +1,126 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_UTILS_LATENCYHISTOGRAMTESTS_H_
+#define TEST_SRC_TESTS_UTILS_LATENCYHISTOGRAMTESTS_H_
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <utils/LatencyHistogram.h>
+#include <utils/ThreadCycleStats.h>
+
+/**
+ * Check histogram bucket layout
+ */
+TEST(LatencyHistogramTests, Buckets) {
+
+	// Linear range
+	for (unsigned long int i = 0; i < LATENCY_HISTOGRAM_SUB_BUCKETS; ++i) {
+		ASSERT_EQ(i, onh::LatencyHistogram::bucketIndex(i));
+		ASSERT_EQ(i, onh::LatencyHistogram::bucketValue(i));
+	}
+
+	// Every value is in the bucket which covers it
+	for (unsigned long int v = 0; v < 100000; ++v) {
+		unsigned int idx = onh::LatencyHistogram::bucketIndex(v);
+
+		ASSERT_GE(onh::LatencyHistogram::bucketValue(idx), v);
+		if (idx > 0) {
+			ASSERT_LT(onh::LatencyHistogram::bucketValue(idx-1), v);
+		}
+	}
+
+	// Too big values in the last bucket
+	ASSERT_EQ(LATENCY_HISTOGRAM_BUCKETS-1, onh::LatencyHistogram::bucketIndex(~0ul));
+}
+
+/**
+ * Check histogram percentiles
+ */
+TEST(LatencyHistogramTests, Percentiles) {
+
+	onh::LatencyHistogram h;
+
+	onh::LatencyPercentiles lp = h.getPercentiles();
+	ASSERT_EQ(0u, lp.count);
+	ASSERT_EQ(0u, lp.p50);
+
+	// Values 1..1000 us
+	for (unsigned long int v = 1; v <= 1000; ++v)
+		h.record(v);
+
+	lp = h.getPercentiles();
+
+	ASSERT_EQ(1000u, lp.count);
+	ASSERT_EQ(1000u, lp.max);
+	// Relative error below 12.5%
+	ASSERT_GE(lp.p50, 500u);
+	ASSERT_LE(lp.p50, 563u);
+	ASSERT_GE(lp.p90, 900u);
+	ASSERT_LE(lp.p90, 1000u);
+	ASSERT_GE(lp.p99, 990u);
+	ASSERT_LE(lp.p99, 1000u);
+	ASSERT_EQ(1000u, lp.p999);
+
+	h.reset();
+
+	lp = h.getPercentiles();
+	ASSERT_EQ(0u, lp.count);
+	ASSERT_EQ(0u, lp.max);
+}
+
+/**
+ * Check thread cycle statistics windows
+ */
+TEST(LatencyHistogramTests, CycleStatsWindow) {
+
+	onh::ThreadCycleStats st(20);
+
+	for (unsigned int i = 0; i < 10; ++i) {
+		st.record(onh::CP_CYCLE, 100);
+		st.record(onh::CP_WAIT, 80);
+	}
+
+	onh::ThreadCycleWindow w = st.getCurrentWindow();
+
+	ASSERT_EQ(10u, w.cycles);
+	ASSERT_EQ(100u, w.phase[onh::CP_CYCLE].max);
+	ASSERT_EQ(10u, w.phase[onh::CP_WAIT].count);
+	ASSERT_EQ(0u, w.phase[onh::CP_DB_IO].count);
+
+	// Window not finished
+	st.cycleFinished();
+	ASSERT_EQ(0u, st.getLastWindow().cycles);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(25));
+
+	// Close window
+	st.cycleFinished();
+
+	w = st.getLastWindow();
+	ASSERT_EQ(10u, w.cycles);
+	ASSERT_GE(w.duration, 20u);
+	ASSERT_GT(w.rate, 0);
+	ASSERT_EQ(80u, w.phase[onh::CP_WAIT].p99);
+
+	// New window is empty
+	ASSERT_EQ(0u, st.getCurrentWindow().cycles);
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_LATENCYHISTOGRAMTESTS_H_ */
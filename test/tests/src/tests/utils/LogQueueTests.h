@@ -0,0 +1,88 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_UTILS_LOGQUEUETESTS_H_
+#define TEST_SRC_TESTS_UTILS_LOGQUEUETESTS_H_
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <utils/logger/LogQueue.h>
+#include <utils/Exception.h>
+
+/**
+ * Check queue capacity and entry order
+ */
+TEST(LogQueueTests, Capacity) {
+
+	onh::LogQueue q(4);
+	onh::logEntry e;
+	struct timeval tv = {0, 0};
+
+	ASSERT_FALSE(q.pop(e));
+
+	for (unsigned int i = 0; i < 4; ++i) {
+		ASSERT_TRUE(q.push(tv, nullptr, std::to_string(i)));
+	}
+
+	// Queue full
+	ASSERT_FALSE(q.push(tv, nullptr, "4"));
+
+	for (unsigned int i = 0; i < 4; ++i) {
+		ASSERT_TRUE(q.pop(e));
+		ASSERT_EQ(std::to_string(i), e.message);
+	}
+
+	ASSERT_FALSE(q.pop(e));
+
+	// Wrong capacity
+	ASSERT_THROW(onh::LogQueue(6), onh::Exception);
+}
+
+/**
+ * Check many producers
+ */
+TEST(LogQueueTests, Producers) {
+
+	onh::LogQueue q(1024);
+	std::vector<std::thread> th;
+
+	for (unsigned int t = 0; t < 4; ++t) {
+		th.push_back(std::thread([&q, t] {
+			struct timeval tv = {0, 0};
+
+			for (unsigned int i = 0; i < 200; ++i) {
+				ASSERT_TRUE(q.push(tv, nullptr, std::to_string(t)));
+			}
+		}));
+	}
+
+	for (auto& t : th)
+		t.join();
+
+	unsigned int cnt[4] = {0};
+	onh::logEntry e;
+
+	while (q.pop(e))
+		cnt[std::stoi(e.message)]++;
+
+	for (unsigned int t = 0; t < 4; ++t)
+		ASSERT_EQ(200u, cnt[t]);
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_LOGQUEUETESTS_H_ */
@@ -21,6 +21,9 @@
 
 #include <gtest/gtest.h>
 #include <utils/StringUtils.h>
+#include <fstream>
+#include <thread>
+#include <vector>
 
 #include "LoggerTestsFixtures.h"
 
@@ -30,6 +33,7 @@
 TEST_F(logsTest, log1) {
 
 	log->write("Message from tests");
+	log->flush();
 
 	// Test line from file
 	std::string line;
@@ -54,6 +58,7 @@ TEST_F(logsTest, log1) {
 TEST_F(logsTest, log2) {
 
 	log->write("Message 1 from tests");
+	log->flush();
 
 	// Test line from file
 	std::string line;
@@ -84,4 +89,39 @@ TEST_F(logsTest, log2) {
 	}
 }
 
+/**
+ * Check many log entries from many threads
+ */
+TEST_F(logsTest, log3) {
+
+	std::vector<std::thread> th;
+
+	for (unsigned int t = 0; t < 4; ++t) {
+		th.push_back(std::thread([this, t] {
+			for (unsigned int i = 0; i < 500; ++i)
+				log->write("Thread "+std::to_string(t)+" message "+std::to_string(i));
+		}));
+	}
+
+	for (auto& t : th)
+		t.join();
+
+	log->flush();
+
+	onh::logWriterStats st = onh::LogWriter::getWriter().getStats();
+
+	// Count lines
+	std::ifstream lFile(log->getLoggerPath());
+	ASSERT_TRUE(lFile.is_open());
+
+	unsigned int lines = 0;
+	std::string line;
+	while (getline(lFile, line)) {
+		++lines;
+	}
+
+	ASSERT_EQ(2000u, lines + st.dropped);
+	ASSERT_EQ(0u, st.errors);
+}
+
 #endif /* LOGGERTESTS_H_ */
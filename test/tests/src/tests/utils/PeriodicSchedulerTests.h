@@ -0,0 +1,90 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_UTILS_PERIODICSCHEDULERTESTS_H_
+#define TEST_SRC_TESTS_UTILS_PERIODICSCHEDULERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <utils/PeriodicScheduler.h>
+
+/**
+ * Check scheduler period does not drift with cycle work time
+ */
+TEST(PeriodicSchedulerTests, NoDrift) {
+
+	onh::PeriodicScheduler sch(20);
+
+	// Start schedule
+	sch.wait();
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (unsigned int i = 0; i < 10; ++i) {
+		// Cycle work
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+		sch.wait();
+	}
+
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	ASSERT_GE(elapsed.count(), 195);
+	ASSERT_LT(elapsed.count(), 245);
+
+	const onh::SchedulerStats& st = sch.getStats();
+
+	ASSERT_EQ(11u, st.cycles);
+	ASSERT_EQ(0u, st.overruns);
+	ASSERT_EQ(0u, st.skipped);
+
+	unsigned long int hist = 0;
+	for (unsigned int i = 0; i < SCHEDULER_JITTER_BUCKETS; ++i)
+		hist += st.jitterHist[i];
+
+	ASSERT_EQ(11u, hist);
+}
+
+/**
+ * Check scheduler overrun statistics
+ */
+TEST(PeriodicSchedulerTests, Overrun) {
+
+	onh::PeriodicScheduler sch(10);
+
+	sch.wait();
+
+	// Cycle work longer than 3 periods
+	std::this_thread::sleep_for(std::chrono::milliseconds(35));
+
+	auto start = std::chrono::steady_clock::now();
+	sch.wait();
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	// No sleep after overrun
+	ASSERT_LT(elapsed.count(), 5);
+
+	const onh::SchedulerStats& st = sch.getStats();
+
+	ASSERT_EQ(2u, st.cycles);
+	ASSERT_EQ(1u, st.overruns);
+	ASSERT_GE(st.skipped, 2u);
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_PERIODICSCHEDULERTESTS_H_ */
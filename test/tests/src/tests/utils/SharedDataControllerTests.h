@@ -0,0 +1,179 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_SRC_TESTS_UTILS_SHAREDDATACONTROLLERTESTS_H_
+#define TEST_SRC_TESTS_UTILS_SHAREDDATACONTROLLERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utils/SharedDataContainer.h>
+#include <utils/CycleTime.h>
+#include <thread/ThreadExitData.h>
+
+/**
+ * Check shared data access policies
+ */
+TEST(SharedDataControllerTests, Policy) {
+
+	ASSERT_EQ(onh::SDP_ATOMIC, onh::getSharedDataPolicy<int>());
+	ASSERT_EQ(onh::SDP_SEQLOCK, onh::getSharedDataPolicy<onh::CycleTimeData>());
+	ASSERT_EQ(onh::SDP_SHARED_MUTEX, onh::getSharedDataPolicy<onh::ThreadExitData>());
+}
+
+/**
+ * Check shared data controller object (atomic)
+ */
+TEST(SharedDataControllerTests, Atomic) {
+
+	int d1, d2;
+	onh::SharedDataContainer<int> data(66);
+	onh::SharedDataController<int> c1(data.getController(false));
+	onh::SharedDataController<int> c2(data.getController());
+
+	c1.getData(d1);
+	c2.getData(d2);
+
+	ASSERT_EQ(d1, 66);
+	ASSERT_EQ(d2, 66);
+
+	c1.setData(65);
+	c1.getData(d1);
+	c2.getData(d2);
+
+	ASSERT_EQ(d1, 65);
+	ASSERT_EQ(d2, 65);
+}
+
+/**
+ * Check shared data controller object (seqlock)
+ */
+TEST(SharedDataControllerTests, Seqlock) {
+
+	onh::CycleTimeData ctd;
+	ctd.min = 1;
+	ctd.max = 3;
+	ctd.current = 2;
+
+	onh::SharedDataContainer<onh::CycleTimeData> data;
+	onh::SharedDataController<onh::CycleTimeData> c1(data.getController(false));
+	onh::SharedDataController<onh::CycleTimeData> c2(data.getController());
+
+	c1.setData(ctd);
+
+	onh::CycleTimeData ret;
+	c2.getData(ret);
+
+	ASSERT_EQ(1, ret.min);
+	ASSERT_EQ(3, ret.max);
+	ASSERT_EQ(2, ret.current);
+}
+
+/**
+ * Check seqlock readers never see partially written data
+ */
+TEST(SharedDataControllerTests, SeqlockConcurrent) {
+
+	onh::CycleTimeData ctd;
+	ctd.min = 0;
+	ctd.max = 0;
+	ctd.current = 0;
+
+	onh::SharedDataContainer<onh::CycleTimeData> data(ctd);
+	onh::SharedDataController<onh::CycleTimeData> wr(data.getController(false));
+
+	std::thread writer([&wr]() {
+		onh::CycleTimeData w;
+		for (unsigned int i = 1; i <= 100000; ++i) {
+			w.min = i;
+			w.max = i;
+			w.current = i;
+			wr.setData(w);
+		}
+	});
+
+	std::vector<std::thread> readers;
+	bool torn[4] = {false, false, false, false};
+	for (unsigned int r = 0; r < 4; ++r) {
+		readers.push_back(std::thread([&data, &torn, r]() {
+			onh::SharedDataController<onh::CycleTimeData> rd(data.getController());
+			onh::CycleTimeData v;
+			for (unsigned int i = 0; i < 100000; ++i) {
+				rd.getData(v);
+				if (v.min != v.max || v.min != v.current)
+					torn[r] = true;
+			}
+		}));
+	}
+
+	writer.join();
+	for (std::thread& t : readers)
+		t.join();
+
+	for (unsigned int r = 0; r < 4; ++r)
+		ASSERT_FALSE(torn[r]);
+}
+
+/**
+ * Check shared data controller object (readers-writer lock)
+ */
+TEST(SharedDataControllerTests, SharedMutex) {
+
+	onh::ThreadExitData ex;
+	ex.exit = true;
+	ex.additionalInfo = "Exit from test";
+
+	onh::SharedDataContainer<onh::ThreadExitData> data;
+	onh::SharedDataController<onh::ThreadExitData> c1(data.getController(false));
+	onh::SharedDataController<onh::ThreadExitData> c2(data.getController());
+
+	onh::ThreadExitData ret;
+	c2.getData(ret);
+	ASSERT_FALSE(ret.exit);
+
+	c1.setData(ex);
+	c2.getData(ret);
+
+	ASSERT_TRUE(ret.exit);
+	ASSERT_EQ("Exit from test", ret.additionalInfo);
+}
+
+/**
+ * Check shared data controller read only state
+ */
+TEST(SharedDataControllerTests, ReadOnly) {
+
+	onh::SharedDataContainer<int> data;
+	onh::SharedDataController<int> c1(data.getController());
+
+	try {
+
+		c1.setData(5);
+
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+
+		ASSERT_STREQ(e.what(), "SharedDataController::setData: Data controller is in read only state");
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_SHAREDDATACONTROLLERTESTS_H_ */
@@ -0,0 +1,85 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TEST_SRC_TESTS_UTILS_SNAPSHOTCONTAINERTESTS_H_
+#define TEST_SRC_TESTS_UTILS_SNAPSHOTCONTAINERTESTS_H_
+
+#include <gtest/gtest.h>
+#include <utils/SnapshotContainer.h>
+
+/**
+ * Check snapshot publishing
+ */
+TEST(SnapshotContainerTests, Publish) {
+
+	onh::SnapshotContainer<int> data(5);
+
+	ASSERT_EQ(0u, data.getGeneration());
+	ASSERT_EQ(5, *data.acquire());
+
+	data.publish(std::make_shared<const int>(7));
+
+	ASSERT_EQ(1u, data.getGeneration());
+	ASSERT_EQ(7, *data.acquire());
+}
+
+/**
+ * Check acquired snapshot is not modified by publishing
+ */
+TEST(SnapshotContainerTests, AcquiredSnapshot) {
+
+	onh::SnapshotContainer<int> data(1);
+
+	std::shared_ptr<const int> s1 = data.acquire();
+	std::shared_ptr<const int> s2 = data.acquire();
+
+	// Same snapshot shared by readers
+	ASSERT_EQ(s1.get(), s2.get());
+
+	data.publish(std::make_shared<const int>(2));
+
+	ASSERT_EQ(1, *s1);
+	ASSERT_EQ(2, *data.acquire());
+	ASSERT_NE(s1.get(), data.acquire().get());
+}
+
+/**
+ * Check publishing empty snapshot
+ */
+TEST(SnapshotContainerTests, PublishEmpty) {
+
+	onh::SnapshotContainer<int> data(1);
+
+	try {
+
+		data.publish(nullptr);
+
+		FAIL() << "Expected onh::Exception";
+	} catch (onh::Exception &e) {
+
+		ASSERT_STREQ(e.what(), "SnapshotContainer::publish: Snapshot is empty");
+
+	} catch(...) {
+		FAIL() << "Expected onh::Exception";
+	}
+
+	ASSERT_EQ(1, *data.acquire());
+}
+
+#endif /* TEST_SRC_TESTS_UTILS_SNAPSHOTCONTAINERTESTS_H_ */
@@ -0,0 +1,14 @@
+# Source files
+
+target_sources(${PROJECT_NAME} PRIVATE
+    "src/onh_log_decoder.cpp"
+)
+
+# Program files
+target_sources(${PROJECT_NAME} PRIVATE
+    "../../src/onh/utils/Exception.h"
+	"../../src/onh/utils/Exception.cpp"
+	"../../src/onh/utils/logger/BinaryLogFormat.h"
+	"../../src/onh/utils/logger/BinaryLogDecoder.h"
+	"../../src/onh/utils/logger/BinaryLogDecoder.cpp"
+)
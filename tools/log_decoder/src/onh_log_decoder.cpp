@@ -0,0 +1,67 @@
+/**
+ * This file is part of openNetworkHMI.
+ * Copyright (c) 2021 Mateusz Mirosławski.
+ *
+ * openNetworkHMI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openNetworkHMI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openNetworkHMI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <utils/logger/BinaryLogDecoder.h>
+#include <utils/Exception.h>
+
+/**
+ * Print program usage
+ */
+void usage() {
+	std::cout << "Usage: onh_log_decoder log_file.blog ..." << std::endl;
+	std::cout << "  Prints binary log entries as text log lines" << std::endl;
+}
+
+/**
+ * Decode binary log file
+ *
+ * @param fileName File name
+ */
+void decodeFile(const std::string& fileName) {
+	std::ifstream f(fileName, std::ios::in | std::ios::binary);
+	if (!f.is_open())
+		throw onh::Exception("Can not open log file "+fileName, "decodeFile");
+
+	onh::BinaryLogDecoder decoder(f);
+	std::string line;
+
+	while (decoder.next(line))
+		std::cout << line << '\n';
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		usage();
+		return 1;
+	}
+
+	try {
+		for (int i = 1; i < argc; ++i)
+			decodeFile(argv[i]);
+	} catch (std::exception &e) {
+		std::cout.flush();
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}